@@ -65,6 +65,7 @@ mlkbool mGetFileModifyTime(const char *path,int64_t *dst);
 mlkerr mCreateDir(const char *path,int perm);
 mlkerr mCreateDir_parents(const char *path,int perm);
 mlkbool mDeleteFile(const char *path);
+mlkbool mRenameFile(const char *oldpath,const char *newpath);
 mlkbool mDeleteDir(const char *path);
 int mCompareFileModify(const char *path1,const char *path2);
 
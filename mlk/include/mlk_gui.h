@@ -175,6 +175,15 @@ enum MLK_TRSYS
 	MLK_TRSYS_FONT_PREVIEW_TEXT
 };
 
+enum MGUI_PROBE_TYPE
+{
+	MGUI_PROBE_POINTER,
+	MGUI_PROBE_RENDER_BEGIN,
+	MGUI_PROBE_RENDER_END
+};
+
+typedef void (*mFuncGuiProbe)(int type);
+
 /* function */
 
 #ifdef __cplusplus
@@ -188,6 +197,7 @@ void mGuiEnd(void);
 void mGuiSetWMClass(const char *name,const char *classname);
 void mGuiSetEnablePenTablet(void);
 void mGuiSetBlockUserAction(mlkbool on);
+void mGuiSetProbeHandler(mFuncGuiProbe func);
 
 mFontSystem *mGuiGetFontSystem(void);
 mFont *mGuiGetDefaultFont(void);
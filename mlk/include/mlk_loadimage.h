@@ -140,6 +140,7 @@ struct _mLoadImage
 		*palette_buf;
 
 	mFuncLoadImageProgress progress;
+	mlkerr (*putrow)(mLoadImage *p,int y,uint8_t *buf);
 	void *param;
 };
 
@@ -162,6 +163,7 @@ mlkbool mLoadImage_allocImage(mLoadImage *p,int line_bytes);
 mlkbool mLoadImage_allocImageFromBuf(mLoadImage *p,void *buf,int line_bytes);
 void mLoadImage_freeImage(mLoadImage *p);
 int mLoadImage_getLineBytes(mLoadImage *p);
+uint8_t *mLoadImage_allocRowBuf(mLoadImage *p);
 mlkbool mLoadImage_getDPI(mLoadImage *p,int *horz,int *vert);
 int mLoadImage_getEXIF_resolution(mLoadImage *p,const uint8_t *buf,int size);
 
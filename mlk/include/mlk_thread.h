@@ -37,6 +37,7 @@ mThread *mThreadNew(int size,void (*run)(mThread *),void *param);
 void mThreadDestroy(mThread *p);
 mlkbool mThreadRun(mThread *p);
 mlkbool mThreadWait(mThread *p);
+void mThreadSetLowPriority(void);
 
 mThreadMutex mThreadMutexNew(void);
 void mThreadMutexDestroy(mThreadMutex p);
@@ -79,6 +79,7 @@ int mDecodeBase64(void *dst,int dstsize,const char *src,int len);
 char *mGetProcessName(void);
 mlkbool mExec(const char *cmd);
 char *mGetSelfExePath(void);
+int mGetCPUNum(void);
 
 #ifdef __cplusplus
 }
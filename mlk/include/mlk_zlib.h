@@ -32,6 +32,7 @@ extern "C" {
 
 void mZlibFree(mZlib *p);
 void mZlibSetIO_stdio(mZlib *p,void *fp);
+void mZlibSetIO_buf(mZlib *p,mBuf *buf);
 
 mZlib *mZlibEncNew(int bufsize,int level,int windowbits,int memlevel,int strategy);
 mZlib *mZlibEncNew_default(int bufsize,int level);
@@ -45,6 +46,7 @@ void mZlibDecSetSize(mZlib *p,uint32_t size);
 void mZlibDecReset(mZlib *p);
 mlkerr mZlibDecReadOnce(mZlib *p,void *buf,int bufsize,uint32_t insize);
 mlkerr mZlibDecRead(mZlib *p,void *buf,int size);
+mlkerr mZlibDecReadBuf(mZlib *p,void *buf,int bufsize,const void *src,uint32_t srcsize);
 mlkerr mZlibDecFinish(mZlib *p);
 
 #ifdef __cplusplus
@@ -438,6 +438,19 @@ void mGuiSetBlockUserAction(mlkbool on)
 		MLKAPP->flags &= ~MAPPBASE_FLAGS_BLOCK_USER_ACTION;
 }
 
+/**@ 計測用のハンドラをセット
+ *
+ * @d:ポインタイベントの受信時と、ウィンドウイメージの転送前後に呼ばれる。\
+ * 入力から画面表示までの時間計測などに使う。
+ *
+ * @p:func NULL で解除。\
+ * 引数には MGUI_PROBE_* の値が渡される。 */
+
+void mGuiSetProbeHandler(mFuncGuiProbe func)
+{
+	MLKAPP->probe = func;
+}
+
 /**@ GUI 用のデフォルトのフォントシステムを取得 */
 
 mFontSystem *mGuiGetFontSystem(void)
@@ -1051,10 +1064,16 @@ mlkbool mGuiRenderWindows(void)
 
 				if(mRectClipBox_d(&rc, 0, 0, p->win.win_width, p->win.win_height))
 				{
+					if(MLKAPP->probe)
+						(MLKAPP->probe)(MGUI_PROBE_RENDER_BEGIN);
+
 					(MLKAPP->bkend.pixbuf_render)(p,
 						rc.x1, rc.y1,
 						rc.x2 - rc.x1 + 1, rc.y2 - rc.y1 + 1);
 
+					if(MLKAPP->probe)
+						(MLKAPP->probe)(MGUI_PROBE_RENDER_END);
+
 					ret = TRUE;
 				}
 			}
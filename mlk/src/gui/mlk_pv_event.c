@@ -1106,6 +1106,9 @@ mWidget *__mEventProcButton(mWindow *win,
 	int type,press;
 	mlkbool modal_skip;
 
+	if(MLKAPP->probe)
+		(MLKAPP->probe)(MGUI_PROBE_POINTER);
+
 	press = (flags & MEVENTPROC_BUTTON_F_PRESS);
 	modal_skip = __mEventIsModalSkip(win);
 
@@ -1161,6 +1164,9 @@ mWidget *__mEventProcMotion(mWindow *win,int fx,int fy,uint32_t state,mlkbool ad
 	mEvent *ev;
 	int ret_outside = 0;
 
+	if(MLKAPP->probe)
+		(MLKAPP->probe)(MGUI_PROBE_POINTER);
+
 	//ポインタ位置記録
 
 	MLKAPP->pointer_last_win_fx = fx;
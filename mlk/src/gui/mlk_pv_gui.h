@@ -161,6 +161,8 @@ typedef struct _mAppBase
 	mFontSystem *fontsys;
 	mFont *font_default;	//デフォルトフォント
 
+	mFuncGuiProbe probe;	//計測用ハンドラ (NULL でなし)
+
 	char *path_config,		//設定ファイル用のパス
 		*path_data;			//データファイル用のパス
 
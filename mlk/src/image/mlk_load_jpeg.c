@@ -319,12 +319,20 @@ static mlkerr _jpeg_open(mLoadImage *pli)
 static mlkerr _jpeg_getimage(mLoadImage *pli)
 {
 	jpegdata *p = (jpegdata *)pli->handle;
-	uint8_t **ppbuf;
-	int i,cnt,to_rgba,height,prog,prog_cur;
+	uint8_t **ppbuf,*rowbuf = NULL;
+	int i,cnt,to_rgba,height,prog,prog_cur,ret = MLKERR_OK;
+
+	//Y1行単位で出力する場合、作業用バッファ
+
+	if(pli->putrow)
+	{
+		rowbuf = mLoadImage_allocRowBuf(pli);
+		if(!rowbuf) return MLKERR_ALLOC;
+	}
 
 	//読み込み
 
-	ppbuf = pli->imgbuf;
+	ppbuf = (rowbuf)? &rowbuf: pli->imgbuf;
 	to_rgba = (pli->coltype == MLOADIMAGE_COLTYPE_RGBA);
 	height = p->jpg.output_height;
 	prog_cur = 0;
@@ -338,7 +346,18 @@ static mlkerr _jpeg_getimage(mLoadImage *pli)
 		if(to_rgba)
 			mImageConv_rgb8_to_rgba8_extend(*ppbuf, pli->width);
 
-		ppbuf++;
+		//出力
+
+		if(rowbuf)
+		{
+			if(pli->coltype == MLOADIMAGE_COLTYPE_CMYK)
+				mReverseVal_8bit(rowbuf, pli->width << 2);
+
+			ret = (pli->putrow)(pli, i, rowbuf);
+			if(ret) break;
+		}
+		else
+			ppbuf++;
 
 		//進捗
 
@@ -356,7 +375,7 @@ static mlkerr _jpeg_getimage(mLoadImage *pli)
 	
 	//CMYK の場合、値を反転
 
-	if(pli->coltype == MLOADIMAGE_COLTYPE_CMYK)
+	if(!rowbuf && pli->coltype == MLOADIMAGE_COLTYPE_CMYK)
 	{
 		ppbuf = pli->imgbuf;
 		cnt = pli->width << 2;
@@ -369,6 +388,12 @@ static mlkerr _jpeg_getimage(mLoadImage *pli)
 		}
 	}
 
+	mFree(rowbuf);
+
+	//中断時
+
+	if(ret) return ret;
+
 	//終了
 
 	jpeg_finish_decompress(&p->jpg);
@@ -502,49 +502,113 @@ static int _read_info(pngdata *p,mLoadImage *pli)
 	return _proc_info(p, pli);
 }
 
-/* 透過付きパレット8bit -> RGBA 変換
+/* 透過付きパレット8bit -> RGBA 変換の準備
  *
  * - 透過色のアルファ値変換なし時。
  * - A=0 のパレットは、A=255 にする。それ以外のアルファ値はそのまま。 */
 
-static void _convert_pal_to_rgba(pngdata *p,mLoadImage *pli)
+static void _convert_pal_init(pngdata *p)
 {
-	uint8_t **ppbuf,*pd,*ps,*ppal,*palbuf;
-	int ix,iy,src_right,dst_right;
-
-	palbuf = p->palbuf;
+	uint8_t *pd;
+	int i;
 
-	//パレットの A=0 を 255 に
+	pd = p->palbuf + 3;
 
-	pd = palbuf + 3;
-
-	for(ix = p->palnum; ix; ix--, pd += 4)
+	for(i = p->palnum; i; i--, pd += 4)
 	{
 		if(*pd == 0)
 			*pd = 255;
 	}
+}
+
+/* パレット8bit -> RGBA 変換 (Y1行) */
+
+static void _convert_pal_to_rgba_row(pngdata *p,uint8_t *buf,int width)
+{
+	uint8_t *pd,*ps,*palbuf;
+	int i;
+
+	//右端から処理
+
+	palbuf = p->palbuf;
+	ps = buf + width - 1;
+	pd = buf + (width - 1) * 4;
+
+	for(i = width; i; i--, pd -= 4, ps--)
+		*((uint32_t *)pd) = *((uint32_t *)(palbuf + (*ps << 2)));
+}
+
+/* 透過付きパレット8bit -> RGBA 変換 */
+
+static void _convert_pal_to_rgba(pngdata *p,mLoadImage *pli)
+{
+	uint8_t **ppbuf;
+	int i;
 
-	//RGBA 変換
+	_convert_pal_init(p);
 
 	ppbuf = pli->imgbuf;
-	src_right = pli->width - 1;
-	dst_right = src_right * 4;
 
-	for(iy = pli->height; iy; iy--)
+	for(i = pli->height; i; i--)
+		_convert_pal_to_rgba_row(p, *(ppbuf++), pli->width);
+}
+
+/* Y1行ずつ読み込んで、putrow で出力
+ *
+ * インターレースの場合は、全体を読み込んでから出力する。 */
+
+static mlkerr _getimage_putrow(pngdata *p,mLoadImage *pli)
+{
+	uint8_t *buf;
+	int y,ret = MLKERR_OK;
+
+	//インターレース
+
+	if(png_get_interlace_type(p->png, p->pnginfo) == PNG_INTERLACE_ADAM7)
 	{
-		pd = ps = *(ppbuf++);
-		ps += src_right;
-		pd += dst_right;
-	
-		for(ix = pli->width; ix; ix--, pd -= 4, ps--)
-		{
-			ppal = palbuf + (*ps << 2);
+		if(!mLoadImage_allocImage(pli, 0))
+			return MLKERR_ALLOC;
+
+		png_read_image(p->png, pli->imgbuf);
+
+		if(p->fconvpal)
+			_convert_pal_to_rgba(p, pli);
 
-			*((uint32_t *)pd) = *((uint32_t *)ppal);
+		for(y = 0; y < pli->height; y++)
+		{
+			ret = (pli->putrow)(pli, y, pli->imgbuf[y]);
+			if(ret) break;
 		}
+
+		mLoadImage_freeImage(pli);
+		pli->imgbuf = NULL;
+
+		return ret;
 	}
-}
 
+	//Y1行ずつ
+
+	buf = mLoadImage_allocRowBuf(pli);
+	if(!buf) return MLKERR_ALLOC;
+
+	if(p->fconvpal)
+		_convert_pal_init(p);
+
+	for(y = 0; y < pli->height; y++)
+	{
+		png_read_row(p->png, buf, NULL);
+
+		if(p->fconvpal)
+			_convert_pal_to_rgba_row(p, buf, pli->width);
+
+		ret = (pli->putrow)(pli, y, buf);
+		if(ret) break;
+	}
+
+	mFree(buf);
+
+	return ret;
+}
 
 //=================================
 // main
@@ -605,6 +669,18 @@ static mlkerr _png_getimage(mLoadImage *pli)
 	ret = mLoadImage_setPalette(pli, p->palbuf, 256 * 4, p->palnum);
 	if(ret) return ret;
 
+	//Y1行単位で出力
+
+	if(pli->putrow)
+	{
+		ret = _getimage_putrow(p, pli);
+		if(ret) return ret;
+
+		png_read_end(p->png, NULL);
+
+		return MLKERR_OK;
+	}
+
 	//イメージ
 
 	png_read_image(p->png, pli->imgbuf);
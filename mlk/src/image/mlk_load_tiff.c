@@ -548,7 +548,7 @@ static mlkerr _tiff_open(mLoadImage *pli)
 static mlkerr _tiff_getimage(mLoadImage *pli)
 {
 	tiffdata *p = (tiffdata *)pli->handle;
-	uint8_t *rowbuf,**ppbuf;
+	uint8_t *rowbuf,**ppbuf,*dstbuf = NULL;
 	mFuncImageConv funcconv;
 	mImageConv conv;
 	int y,ret,pitch,height,prog,prog_cur;
@@ -572,17 +572,25 @@ static mlkerr _tiff_getimage(mLoadImage *pli)
 
 	pitch = mLoadImage_getLineBytes(pli);
 
+	//Y1行単位で出力する場合、作業用バッファ
+
+	if(pli->putrow)
+	{
+		dstbuf = mLoadImage_allocRowBuf(pli);
+		if(!dstbuf) return MLKERR_ALLOC;
+	}
+
 	//変換
 
 	rowbuf = p->rowbuf;
-	ppbuf = pli->imgbuf;
+	ppbuf = (dstbuf)? &dstbuf: pli->imgbuf;
 	height = pli->height;
 	prog_cur = 0;
 
-	for(y = 0; y < height; y++, ppbuf++)
+	for(y = 0; y < height; y++)
 	{
 		ret = _get_row_image(p, y);
-		if(ret) return ret;
+		if(ret) goto END;
 
 		if(!funcconv)
 			//CMYK 8,16bit raw
@@ -593,6 +601,16 @@ static mlkerr _tiff_getimage(mLoadImage *pli)
 			(funcconv)(&conv);
 		}
 
+		//出力
+
+		if(dstbuf)
+		{
+			ret = (pli->putrow)(pli, y, dstbuf);
+			if(ret) goto END;
+		}
+		else
+			ppbuf++;
+
 		//進捗
 
 		if(pli->progress)
@@ -607,6 +625,8 @@ static mlkerr _tiff_getimage(mLoadImage *pli)
 		}
 	}
 
+	ret = MLKERR_OK;
+
 	//解放
 
 	mFree(p->rowbuf);
@@ -615,7 +635,10 @@ static mlkerr _tiff_getimage(mLoadImage *pli)
 	p->rowbuf = NULL;
 	p->planebuf = NULL;
 
-	return MLKERR_OK;
+END:
+	mFree(dstbuf);
+
+	return ret;
 }
 
 /**@ TIFF 判定と関数セット */
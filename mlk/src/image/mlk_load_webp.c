@@ -242,7 +242,7 @@ static mlkerr _webp_open(mLoadImage *pli)
 static mlkerr _webp_getimage(mLoadImage *pli)
 {
 	webpdata *p = (webpdata *)pli->handle;
-	uint8_t **ppbuf,*ps;
+	uint8_t **ppbuf,*ps,*rowbuf = NULL;
 	mFuncImageConv funcconv;
 	mImageConv conv;
 	WebPDecBuffer decbuf;
@@ -253,6 +253,18 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 	ret = _decode(p, pli, &decbuf);
 	if(ret) return ret;
 
+	//Y1行単位で出力する場合、作業用バッファ
+
+	if(pli->putrow)
+	{
+		rowbuf = mLoadImage_allocRowBuf(pli);
+		if(!rowbuf)
+		{
+			WebPFreeDecBuffer(&decbuf);
+			return MLKERR_ALLOC;
+		}
+	}
+
 	//変換パラメータ
 
 	mLoadImage_setImageConv(pli, &conv);
@@ -261,7 +273,7 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 
 	//変換
 
-	ppbuf = pli->imgbuf;
+	ppbuf = (rowbuf)? &rowbuf: pli->imgbuf;
 	height = pli->height;
 	ps = decbuf.u.RGBA.rgba;
 	prog_cur = 0;
@@ -273,9 +285,16 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 
 		(funcconv)(&conv);
 
-		//
-	
-		ppbuf++;
+		//出力
+
+		if(rowbuf)
+		{
+			ret = (pli->putrow)(pli, i, rowbuf);
+			if(ret) break;
+		}
+		else
+			ppbuf++;
+
 		ps += decbuf.u.RGBA.stride;
 
 		//進捗
@@ -295,6 +314,7 @@ static mlkerr _webp_getimage(mLoadImage *pli)
 	//
 
 	WebPFreeDecBuffer(&decbuf);
+	mFree(rowbuf);
 
 	return ret;
 }
@@ -375,6 +375,21 @@ int mLoadImage_getLineBytes(mLoadImage *p)
 	return ret;
 }
 
+/**@ Y1行単位で出力する時の作業用バッファを確保
+ *
+ * @d:putrow が NULL 以外の場合、imgbuf は使われない。\
+ * 読み込み側は、このバッファに Y1行ずつイメージをセットして、putrow() を呼ぶ。\
+ * putrow() は y = 0 から順に呼ばれる。\
+ * putrow() の戻り値が MLKERR_OK 以外の場合は、読み込みを中断して、その値を返す。\
+ * ※ buf の内容は、putrow() から戻った後は保持されない。
+ * 
+ * @r:確保されたバッファ (4byte単位)。mFree() で解放する。 */
+
+uint8_t *mLoadImage_allocRowBuf(mLoadImage *p)
+{
+	return (uint8_t *)mMalloc((mLoadImage_getLineBytes(p) + 3) & (~3));
+}
+
 /**@ 解像度を DPI 単位で取得
  *
  * @r:DPI で取得できない場合 FALSE */
@@ -21,6 +21,7 @@ $*/
  * mFile : ファイル関連操作
  *****************************************/
 
+#include <stdio.h>
 #include <string.h>
 #include <string.h>
 #include <stdlib.h>
@@ -530,6 +531,29 @@ mlkbool mDeleteFile(const char *path)
 	return ret;
 }
 
+/**@ ファイル名を変更
+ *
+ * @d:newpath が存在する場合は、置き換えられる。\
+ * 同じファイルシステム上であること。
+ * @r:FALSE で失敗 */
+
+mlkbool mRenameFile(const char *oldpath,const char *newpath)
+{
+	char *str1,*str2;
+	mlkbool ret = FALSE;
+
+	str1 = mUTF8toLocale(oldpath, -1, NULL);
+	str2 = mUTF8toLocale(newpath, -1, NULL);
+
+	if(str1 && str2)
+		ret = (rename(str1, str2) == 0);
+
+	mFree(str1);
+	mFree(str2);
+
+	return ret;
+}
+
 /**@ ディレクトリを削除
  *
  * @d:{em:中身が空であること。:em} */
@@ -21,7 +21,10 @@ $*/
  * スレッド (UNIX)
  *****************************************/
 
+#define _GNU_SOURCE  //SCHED_IDLE
+
 #include <pthread.h>
+#include <sched.h>
 
 #include "mlk.h"
 #include "mlk_thread.h"
@@ -152,6 +155,22 @@ mlkbool mThreadWait(mThread *p)
 	}
 }
 
+/**@ 呼び出し元のスレッドの優先度を下げる
+ *
+ * @d:バックグラウンドで行う処理用。\
+ * 対応していない環境では何もしない。 */
+
+void mThreadSetLowPriority(void)
+{
+#if defined(SCHED_IDLE)
+	struct sched_param prm;
+
+	prm.sched_priority = 0;
+
+	pthread_setschedparam(pthread_self(), SCHED_IDLE, &prm);
+#endif
+}
+
 
 //*******************************
 // mThreadMutex
@@ -168,3 +168,20 @@ char *mGetSelfExePath(void)
 		return dst;
 	}
 }
+
+/**@ 使用可能な CPU (論理コア) の数を取得
+ *
+ * @r:取得できなかった場合は 1 */
+
+int mGetCPUNum(void)
+{
+	long n;
+
+#if defined(_SC_NPROCESSORS_ONLN)
+	n = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+	n = 1;
+#endif
+
+	return (n < 1)? 1: (int)n;
+}
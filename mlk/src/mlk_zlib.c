@@ -26,6 +26,7 @@ $*/
 #include <zlib.h>
 
 #include "mlk.h"
+#include "mlk_buf.h"
 #include "mlk_zlib.h"
 
 
@@ -35,6 +36,7 @@ struct _mZlib
 {
 	z_stream z;
 	FILE *fp;
+	mBuf *membuf;		//[enc] 出力先のバッファ
 	uint8_t *buf;		//作業用バッファ
 	int is_decode;		//デコードか
 	uint32_t bufsize,	//作業用バッファのサイズ
@@ -127,7 +129,14 @@ static mZlib *_init(int bufsize,
 
 static int _encode_write(mZlib *p,int size)
 {
-	if(p->fp)
+	if(p->membuf)
+	{
+		if(mBufAppend(p->membuf, p->buf, size))
+			return MLKERR_OK;
+		else
+			return MLKERR_ALLOC;
+	}
+	else if(p->fp)
 	{
 		if(fwrite(p->buf, 1, size, p->fp) == size)
 			return MLKERR_OK;
@@ -186,6 +195,18 @@ void mZlibFree(mZlib *p)
 void mZlibSetIO_stdio(mZlib *p,void *fp)
 {
 	p->fp = (FILE *)fp;
+	p->membuf = NULL;
+}
+
+/**@ [enc] 出力先としてバッファをセット
+ *
+ * @d:圧縮データは mBuf の現在位置に追加される。\
+ * buf は確保済みであること。 */
+
+void mZlibSetIO_buf(mZlib *p,mBuf *buf)
+{
+	p->fp = NULL;
+	p->membuf = buf;
 }
 
 
@@ -468,6 +489,50 @@ mlkerr mZlibDecRead(mZlib *p,void *buf,int size)
 	return MLKERR_OK;
 }
 
+/**@ メモリ上の圧縮データを展開
+ *
+ * @d:展開前に mZlibDecReset() を行うこと。\
+ * 出力バッファが一杯になった時点で終了する。\
+ * 出力バッファが一杯になる前にデータの終端が来た場合は、MLKERR_NEED_MORE となる。
+ *
+ * @p:buf 出力先
+ * @p:bufsize 出力バッファのサイズ
+ * @p:src 圧縮データ
+ * @p:srcsize 圧縮データのサイズ
+ * @r:エラーコード */
+
+mlkerr mZlibDecReadBuf(mZlib *p,void *buf,int bufsize,const void *src,uint32_t srcsize)
+{
+	z_stream *z = &p->z;
+	int ret;
+
+	z->next_in  = (unsigned char *)src;
+	z->avail_in = srcsize;
+	z->next_out  = (unsigned char *)buf;
+	z->avail_out = bufsize;
+
+	while(z->avail_out)
+	{
+		ret = inflate(z, Z_NO_FLUSH);
+
+		if(ret == Z_STREAM_END)
+			break;
+		else if(ret == Z_BUF_ERROR && z->avail_in == 0)
+			return MLKERR_NEED_MORE;
+		else if(ret != Z_OK)
+			return MLKERR_DECODE;
+	}
+
+	z->avail_in = 0;
+
+	//指定サイズ分が展開されていない
+
+	if(z->avail_out)
+		return MLKERR_NEED_MORE;
+
+	return MLKERR_OK;
+}
+
 /**@ 読み込みを完了する
  *
  * @d:mZlibDecRead() で複数回に分けて読み込んだ場合、最後に実行すること。\
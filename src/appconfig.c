@@ -23,16 +23,26 @@ $*/
 
 #include <string.h>
 
+#include "mlk_platform.h"
+
+#if defined(MLK_PLATFORM_LINUX)
+#include <sys/vfs.h>
+#include <linux/magic.h>
+#endif
+
 #include "mlk_gui.h"
 #include "mlk_str.h"
 #include "mlk_list.h"
 #include "mlk_file.h"
 #include "mlk_dir.h"
 #include "mlk_util.h"
+#include "mlk_charset.h"
 
 #include "def_macro.h"
 #include "def_config.h"
 
+#include "tileimage.h"
+
 #include "appconfig.h"
 
 
@@ -211,3 +221,45 @@ mlkbool AppConfig_getTempPath(mStr *str,const char *path)
 	}
 }
 
+/* ディレクトリがメモリ上のファイルシステム (tmpfs/ramfs) にあるか */
+
+static mlkbool _is_memory_fs(const char *path)
+{
+#if defined(MLK_PLATFORM_LINUX)
+	struct statfs st;
+	char *str;
+	mlkbool ret = FALSE;
+
+	str = mUTF8toLocale(path, -1, NULL);
+	if(!str) return FALSE;
+
+	if(statfs(str, &st) == 0)
+		ret = (st.f_type == TMPFS_MAGIC || st.f_type == RAMFS_MAGIC);
+
+	mFree(str);
+
+	return ret;
+#else
+	return FALSE;
+#endif
+}
+
+/** タイルのスワップファイルを設定
+ *
+ * 作業用ディレクトリがない場合は、スワップしない。
+ * 作業用ディレクトリが tmpfs 上にある場合も、スワップ先がメモリになるため、スワップしない。 */
+
+void AppConfig_setTileSwap(void)
+{
+	mStr str = MSTR_INIT;
+
+	if(AppConfig_getTempPath(&str, "tileswap"))
+	{
+		if(_is_memory_fs(APPCONF->strTempDirProc.buf))
+			TileImage_pool_setSwap(NULL, 0);
+		else
+			TileImage_pool_setSwap(str.buf, (uint64_t)APPCONF->tile_maxmem_mb << 20);
+	}
+
+	mStrFree(&str);
+}
@@ -0,0 +1,689 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/**********************************
+ * ストローク再生ベンチマーク
+ *
+ * 記録したストロークを、ブラシで TileImage に描画して、
+ * 描画速度を計測する。GUI は使わない。
+ **********************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "mlk.h"
+#include "mlk_argparse.h"
+#include "mlk_iniread.h"
+#include "mlk_nanotime.h"
+
+#include "def_draw_ptr.h"
+#include "def_brushdraw.h"
+
+#include "colorvalue.h"
+#include "tileimage.h"
+#include "tileimage_drawinfo.h"
+#include "table_data.h"
+#include "dotshape.h"
+
+
+/*
+ [ストロークファイル]
+   1行に1点: "x y pressure time"
+   (pressure = 0.0-1.0, time = 記録開始からのミリ秒。省略可)
+   空行でストロークの区切り。'#' で始まる行はコメント。
+   ファイル指定なしの場合は、内蔵のストロークを使う。
+
+ [ブラシファイル (--brush)]
+   [brush] グループに、BrushDrawParam の値をそのまま記述する。
+   radius, opacity, shape_hard, shape_sand, min_size, min_opacity,
+   interval, rand_size_min, rand_pos_len, angle, angle_rand,
+   antialias, curve, hard_max (0 or 1)
+*/
+
+//-----------------------
+/* グローバル変数定義 (main.c の代わり) */
+
+typedef struct _AppWidgets AppWidgets;
+typedef struct _AppConfig AppConfig;
+
+AppWidgets *g_app_widgets = NULL;
+AppConfig *g_app_config = NULL;
+AppDraw *g_app_draw = NULL;
+
+//-----------------------
+
+#define _HELP_TEXT "[usage] exe [option] [STROKE_FILE]\n\n" \
+"  --size=WxH    image size [2000x2000]\n" \
+"  --brush=FILE  brush parameter file\n" \
+"  --repeat=N    replay count per mode [3]\n" \
+"  --stroke      blend by stroke (brush_stroke setpixel)\n" \
+"  --help        show this help"
+
+typedef struct
+{
+	double x,y,pressure;
+	uint32_t time;
+	uint8_t ftop;	//ストロークの先頭
+}_point;
+
+typedef struct
+{
+	_point *pt;
+	int num,alloc;
+}_stroke;
+
+typedef struct
+{
+	uint64_t dabs,pixels;	//点の数、ピクセル数
+	int tiles;				//確保されたタイル数
+}_count;
+
+static int g_imgw = 2000,
+	g_imgh = 2000,
+	g_repeat = 3;
+static const char *g_brushfile = NULL;
+static mlkbool g_blend_stroke = FALSE;
+
+static BrushDrawParam *g_brushdp = NULL;
+
+static TileImageSetPixelFunc g_setpixel_real;
+static uint64_t g_setpixel_num;
+
+static const char *g_mode_name[] = {
+	"normal", "compare_a", "overwrite", "erase", "finger",
+	"dodge", "burn", "add", "inverse_alpha"
+};
+
+//-----------------------
+
+
+//=============================
+// ストローク
+//=============================
+
+
+/* 点を追加 */
+
+static mlkbool _stroke_add(_stroke *p,double x,double y,double pressure,uint32_t time,mlkbool ftop)
+{
+	_point *pt;
+	int n;
+
+	if(p->num == p->alloc)
+	{
+		n = (p->alloc)? p->alloc * 2: 1024;
+
+		pt = (_point *)mRealloc(p->pt, sizeof(_point) * n);
+		if(!pt) return FALSE;
+
+		p->pt = pt;
+		p->alloc = n;
+	}
+
+	pt = p->pt + p->num;
+
+	pt->x = x;
+	pt->y = y;
+	pt->pressure = (pressure < 0)? 0: (pressure > 1)? 1: pressure;
+	pt->time = time;
+	pt->ftop = ftop;
+
+	p->num++;
+
+	return TRUE;
+}
+
+/* ファイルから読み込み */
+
+static mlkbool _stroke_load(_stroke *p,const char *filename)
+{
+	FILE *fp;
+	char buf[256];
+	double x,y,press;
+	unsigned int time;
+	int n;
+	mlkbool ftop = TRUE;
+
+	fp = fopen(filename, "rt");
+	if(!fp) return FALSE;
+
+	while(fgets(buf, 256, fp))
+	{
+		if(buf[0] == '#') continue;
+
+		time = 0;
+
+		n = sscanf(buf, "%lf %lf %lf %u", &x, &y, &press, &time);
+
+		if(n < 2)
+		{
+			//空行などは、ストロークの区切り
+			ftop = TRUE;
+			continue;
+		}
+
+		if(n == 2) press = 1;
+
+		if(!_stroke_add(p, x, y, press, time, ftop)) break;
+
+		ftop = FALSE;
+	}
+
+	fclose(fp);
+
+	return (p->num != 0);
+}
+
+/* 内蔵のストロークを作成
+ *
+ * 筆圧が変化する波線を、画像全体に描く。 */
+
+static void _stroke_create_default(_stroke *p)
+{
+	double x,y,w,h,t;
+	int i,j;
+
+	w = g_imgw;
+	h = g_imgh;
+
+	for(i = 0; i < 8; i++)
+	{
+		y = h * (i + 1) / 9;
+
+		for(j = 0; j <= 400; j++)
+		{
+			t = j / 400.0;
+			x = w * 0.05 + w * 0.9 * t;
+
+			_stroke_add(p, x,
+				y + sin(t * MLK_MATH_PI * 6 + i) * h * 0.04,
+				0.2 + 0.8 * sin(t * MLK_MATH_PI),
+				j * 8, (j == 0));
+		}
+	}
+}
+
+
+//=============================
+// ブラシパラメータ
+//=============================
+
+
+/* double 値を取得 */
+
+static double _ini_get_double(mIniRead *ini,const char *key,double def)
+{
+	const char *pc;
+
+	pc = mIniRead_getText(ini, key, NULL);
+
+	return (pc)? strtod(pc, NULL): def;
+}
+
+/* ブラシパラメータのセット */
+
+static mlkbool _set_brushparam(BrushDrawParam *p)
+{
+	mIniRead *ini;
+	uint32_t flags = 0;
+
+	//デフォルト
+
+	p->radius = 20;
+	p->opacity = 1;
+	p->shape_hard = 0.4;
+	p->min_size = 0;
+	p->min_opacity = 1;
+	p->interval = 0.15;
+	p->pressure_min = 0;
+	p->pressure_range = 1;
+
+	//ファイル
+
+	if(!g_brushfile) return TRUE;
+
+	if(mIniRead_loadFile(&ini, g_brushfile) || mIniRead_isEmpty(ini))
+	{
+		mIniRead_end(ini);
+		return FALSE;
+	}
+
+	mIniRead_setGroup(ini, "brush");
+
+	p->radius = _ini_get_double(ini, "radius", p->radius);
+	p->opacity = _ini_get_double(ini, "opacity", p->opacity);
+	p->shape_hard = _ini_get_double(ini, "shape_hard", p->shape_hard);
+	p->min_size = _ini_get_double(ini, "min_size", p->min_size);
+	p->min_opacity = _ini_get_double(ini, "min_opacity", p->min_opacity);
+	p->interval = _ini_get_double(ini, "interval", p->interval);
+	p->rand_size_min = _ini_get_double(ini, "rand_size_min", 1);
+	p->rand_pos_len = _ini_get_double(ini, "rand_pos_len", 0);
+
+	p->shape_sand = mIniRead_getInt(ini, "shape_sand", 0);
+	p->angle = mIniRead_getInt(ini, "angle", 0) & 511;
+	p->angle_rand = mIniRead_getInt(ini, "angle_rand", 0);
+
+	if(!mIniRead_getInt(ini, "antialias", 1)) flags |= BRUSHDP_F_NO_ANTIALIAS;
+	if(mIniRead_getInt(ini, "curve", 0)) flags |= BRUSHDP_F_CURVE;
+	if(mIniRead_getInt(ini, "hard_max", 0)) flags |= BRUSHDP_F_SHAPE_HARD_MAX;
+	if(p->rand_size_min < 1) flags |= BRUSHDP_F_RANDOM_SIZE;
+	if(p->rand_pos_len > 0) flags |= BRUSHDP_F_RANDOM_POS;
+
+	p->flags = flags;
+
+	mIniRead_end(ini);
+
+	return TRUE;
+}
+
+
+//=============================
+// 描画
+//=============================
+
+
+/* ピクセル数を数える setpixel 関数 */
+
+static void _setpixel_count(TileImage *p,int x,int y,void *col)
+{
+	g_setpixel_num++;
+
+	(g_setpixel_real)(p, x, y, col);
+}
+
+/* 描画情報をセット */
+
+static void _set_drawinfo(int bits,int mode,mlkbool fcount)
+{
+	TileImageDrawInfo *info = &g_tileimage_dinfo;
+	RGBcombo col;
+	uint64_t drawcol = 0;
+
+	//描画色 (暗めの青)
+
+	RGB32bit_to_RGBcombo(&col, 0x203080);
+	RGBcombo_to_bitcol(&drawcol, &col, bits);
+	bitcol_set_alpha_density100(&drawcol, 100, bits);
+
+	info->drawcol = drawcol;
+	info->brushdp = g_brushdp;
+	info->texture = NULL;
+	info->img_sel = NULL;
+	info->img_mask = NULL;
+	info->maskcol_type = 0;
+	info->alphamask_type = 0;
+	info->err = 0;
+
+	//関数
+
+	info->func_pixelcol = TileImage_global_getPixelColorFunc(mode);
+
+	if(mode == TILEIMAGE_PIXELCOL_FINGER)
+		info->func_setpixel = TileImage_setPixel_draw_finger;
+	else if(g_blend_stroke)
+		info->func_setpixel = TileImage_setPixel_draw_brush_stroke;
+	else
+		info->func_setpixel = TileImage_setPixel_draw_direct;
+
+	//ピクセル数の計測時
+
+	if(fcount)
+	{
+		g_setpixel_real = info->func_setpixel;
+		g_setpixel_num = 0;
+
+		info->func_setpixel = _setpixel_count;
+	}
+}
+
+/* ストロークを再生 (ブラシ) */
+
+static void _replay_brush(TileImage *img,_stroke *stroke)
+{
+	_point *pt;
+	int i;
+
+	pt = stroke->pt;
+
+	for(i = stroke->num; i > 0; i--, pt++)
+	{
+		if(pt->ftop)
+		{
+			if(pt != stroke->pt)
+				TileImage_drawBrushFree_finish(img, 0);
+
+			TileImage_drawBrush_beginFree(img, 0, pt->x, pt->y, pt->pressure);
+		}
+		else
+			TileImage_drawBrushFree(img, 0, pt->x, pt->y, pt->pressure);
+	}
+
+	TileImage_drawBrushFree_finish(img, 0);
+}
+
+/* ストロークを再生 (指先)
+ *
+ * 指先はドット形状で描画する。 */
+
+static void _replay_finger(TileImage *img,_stroke *stroke)
+{
+	_point *pt;
+	mPoint ptlast;
+	int i,x,y;
+
+	pt = stroke->pt;
+	ptlast.x = ptlast.y = 0;
+
+	for(i = stroke->num; i > 0; i--, pt++)
+	{
+		x = floor(pt->x);
+		y = floor(pt->y);
+
+		if(pt->ftop)
+		{
+			TileImage_setFingerBuf(img, x, y);
+
+			(g_tileimage_dinfo.func_setpixel)(img, x, y, &g_tileimage_dinfo.drawcol);
+		}
+		else
+			TileImage_drawLineB(img, ptlast.x, ptlast.y, x, y, &g_tileimage_dinfo.drawcol, TRUE);
+
+		ptlast.x = x;
+		ptlast.y = y;
+	}
+}
+
+/* 1回分の再生
+ *
+ * dst: 計測時、点の数とピクセル数、タイル数をセット
+ * return: 描画時間 (ns) */
+
+static uint64_t _run_once(_stroke *stroke,int mode,_count *dst)
+{
+	TileImage *img,*imgsave,*imgstroke = NULL;
+	mNanoTime nt1,nt2;
+	uint32_t dabnum;
+
+	//イメージ
+
+	img = TileImage_new(TILEIMAGE_COLTYPE_RGBA, g_imgw, g_imgh);
+	imgsave = TileImage_createSame(NULL, img, -1);
+
+	if(g_blend_stroke)
+		imgstroke = TileImage_createSame(NULL, img, TILEIMAGE_COLTYPE_ALPHA);
+
+	g_tileimage_dinfo.img_save = imgsave;
+	g_tileimage_dinfo.img_brush_stroke = imgstroke;
+
+	TileImage_getInfo(img, &g_tileimage_dinfo.tileimginfo);
+	TileImageDrawInfo_clearDrawRect();
+
+	//描画
+
+	dabnum = TileImage_drawBrush_getDabNum();
+
+	mNanoTimeGet(&nt1);
+
+	if(mode == TILEIMAGE_PIXELCOL_FINGER)
+		_replay_finger(img, stroke);
+	else
+		_replay_brush(img, stroke);
+
+	mNanoTimeGet(&nt2);
+
+	mNanoTimeSub(&nt2, &nt2, &nt1);
+
+	//計測
+
+	if(dst)
+	{
+		dst->dabs = TileImage_drawBrush_getDabNum() - dabnum;
+		dst->pixels = g_setpixel_num;
+		dst->tiles = TileImage_getHaveTileNum(img);
+	}
+
+	//
+
+	TileImage_free(img);
+	TileImage_free(imgsave);
+	TileImage_free(imgstroke);
+
+	g_tileimage_dinfo.img_save = NULL;
+	g_tileimage_dinfo.img_brush_stroke = NULL;
+
+	return nt2.sec * 1000000000 + nt2.ns;
+}
+
+/* 指先のドット形状のピクセル数 */
+
+static int _get_dotshape_pixels(void)
+{
+	uint8_t *ps,f;
+	int size,i,num = 0;
+
+	size = DotShape_getData(&ps);
+
+	for(i = size * size; i > 0; ps++)
+	{
+		for(f = 0x80; f && i > 0; f >>= 1, i--)
+		{
+			if(*ps & f) num++;
+		}
+	}
+
+	return num;
+}
+
+/* 1つのモードを計測 */
+
+static void _run_mode(_stroke *stroke,int bits,int mode)
+{
+	_count cnt;
+	uint64_t ns,ns_min = 0;
+	double sec;
+	int i;
+
+	//点の数とピクセル数 (計測用の関数で、時間は計らない)
+
+	_set_drawinfo(bits, mode, TRUE);
+
+	_run_once(stroke, mode, &cnt);
+
+	if(mode == TILEIMAGE_PIXELCOL_FINGER)
+	{
+		cnt.dabs = g_setpixel_num;
+		cnt.pixels = g_setpixel_num * _get_dotshape_pixels();
+	}
+
+	//時間 (最小値)
+
+	_set_drawinfo(bits, mode, FALSE);
+
+	for(i = 0; i < g_repeat; i++)
+	{
+		ns = _run_once(stroke, mode, NULL);
+
+		if(i == 0 || ns < ns_min)
+			ns_min = ns;
+	}
+
+	//結果
+
+	sec = ns_min / 1e9;
+	if(sec <= 0) sec = 1e-9;
+
+	printf("%2d  %-13s %10.3f %12.0f %14.0f %8d\n",
+		bits, g_mode_name[mode], ns_min / 1e6,
+		cnt.dabs / sec, cnt.pixels / sec, cnt.tiles);
+}
+
+
+//=============================
+// main
+//=============================
+
+
+static void _opt_size(mArgParse *p,char *arg)
+{
+	sscanf(arg, "%dx%d", &g_imgw, &g_imgh);
+}
+
+static void _opt_brush(mArgParse *p,char *arg)
+{
+	g_brushfile = arg;
+}
+
+static void _opt_repeat(mArgParse *p,char *arg)
+{
+	g_repeat = atoi(arg);
+}
+
+static void _opt_stroke(mArgParse *p,char *arg)
+{
+	g_blend_stroke = TRUE;
+}
+
+/* コマンドラインオプション処理
+ *
+ * return: 通常引数の先頭位置。-1 で終了 */
+
+static int _cmdline_option(int argc,char **argv)
+{
+	mArgParse ap;
+	mArgParseOpt opts[] = {
+		{"help", 0, 0, NULL},
+		{"size", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_size},
+		{"brush", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_brush},
+		{"repeat", 0, MARGPARSEOPT_F_HAVE_ARG, _opt_repeat},
+		{"stroke", 0, 0, _opt_stroke},
+		{0,0,0,0}
+	};
+	int ret;
+
+	ap.argc = argc;
+	ap.argv = argv;
+	ap.opts = opts;
+	ap.flags = 0;
+
+	ret = mArgParseRun(&ap);
+
+	if(ret == -1 || (opts[0].flags & MARGPARSEOPT_F_PROCESSED))
+	{
+		puts(_HELP_TEXT);
+		return -1;
+	}
+
+	if(g_imgw < 1) g_imgw = 1;
+	if(g_imgh < 1) g_imgh = 1;
+	if(g_repeat < 1) g_repeat = 1;
+
+	return ret;
+}
+
+/** メイン */
+
+int main(int argc,char **argv)
+{
+	_stroke stroke;
+	TileImagePoolInfo pool;
+	int top,bits,mode,size,ret = 1;
+
+	top = _cmdline_option(argc, argv);
+	if(top == -1) return 1;
+
+	//初期化
+
+	TableData_init();
+
+	if(!TileImage_init() || DotShape_init())
+	{
+		fputs("failed initialize\n", stderr);
+		return 1;
+	}
+
+	TileImage_global_setImageSize(g_imgw, g_imgh);
+	TileImage_global_setDPI(96);
+
+	mMemset0(&stroke, sizeof(_stroke));
+
+	//ブラシ
+
+	g_brushdp = (BrushDrawParam *)mMalloc0(sizeof(BrushDrawParam));
+
+	if(!g_brushdp || !_set_brushparam(g_brushdp))
+	{
+		fprintf(stderr, "failed load brush: %s\n", g_brushfile);
+		goto END;
+	}
+
+	//指先のドット形状 (ブラシの直径)
+
+	size = (int)(g_brushdp->radius * 2 + 0.5);
+
+	DotShape_create(DOTSHAPE_TYPE_CIRCLE,
+		(size < 1)? 1: (size > DOTSHAPE_MAX_SIZE)? DOTSHAPE_MAX_SIZE: size);
+
+	//ストローク
+
+	if(top >= argc)
+		_stroke_create_default(&stroke);
+	else if(!_stroke_load(&stroke, argv[top]))
+	{
+		fprintf(stderr, "failed load stroke: %s\n", argv[top]);
+		goto END;
+	}
+
+	printf("image %dx%d, %d points, radius %.1f, repeat %d%s\n\n",
+		g_imgw, g_imgh, stroke.num, g_brushdp->radius, g_repeat,
+		(g_blend_stroke)? ", stroke blend": "");
+
+	puts("bit mode            time(ms)     dabs/sec     pixels/sec    tiles");
+
+	//計測
+
+	for(bits = 8; bits <= 16; bits += 8)
+	{
+		TileImage_global_setImageBits(bits);
+
+		for(mode = 0; mode < TILEIMAGE_PIXELCOL_NUM; mode++)
+			_run_mode(&stroke, bits, mode);
+	}
+
+	//タイルのメモリプール
+
+	TileImage_pool_getInfo(&pool);
+
+	printf("\ntile pool: peak %.1f MiB, live %u tiles, %u slabs (%.1f MiB)\n",
+		pool.maxsize / 1048576.0, pool.tilenum, pool.slabnum, pool.poolsize / 1048576.0);
+
+	ret = 0;
+
+	//終了
+END:
+	mFree(stroke.pt);
+	mFree(g_brushdp);
+
+	DotShape_free();
+	TileImage_finish();
+	TableData_free();
+
+	return ret;
+}
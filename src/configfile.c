@@ -287,10 +287,14 @@ static void _load_configdata(mIniRead *ini,AppConfig *cf)
 	cf->iconsize_panel_tool = mIniRead_getInt(ini, "iconsize_panel_tool", 16);
 	cf->iconsize_other = mIniRead_getInt(ini, "iconsize_other", 16);
 	cf->canvas_scale_method = mIniRead_getInt(ini, "canvas_scale_method", 0);
+	cf->canvas_scale_keep_layer = mIniRead_getInt(ini, "canvas_scale_keep_layer", 0);
 
 	cf->undo_maxbufsize = mIniRead_getInt(ini, "undo_maxbufsize", 10 * 1024 * 1024);
 	cf->undo_maxnum = mIniRead_getInt(ini, "undo_maxnum", 100);
 	cf->savedup_type = mIniRead_getInt(ini, "savedup_type", 0);
+	cf->thread_num = mIniRead_getInt(ini, "thread_num", 0);
+	cf->autosave_min = mIniRead_getInt(ini, "autosave_min", 5);
+	cf->tile_maxmem_mb = mIniRead_getInt(ini, "tile_maxmem_mb", 0);
 
 	mIniRead_getNumbers(ini, "cursor_hotspot", cf->cursor_hotspot, 2, 2, FALSE);
 
@@ -384,6 +388,7 @@ static void _load_configdata(mIniRead *ini,AppConfig *cf)
 	cf->save.tiff = mIniRead_getInt(ini, "tiff", SAVEOPT_TIFF_DEFAULT);
 	cf->save.webp = mIniRead_getInt(ini, "webp", SAVEOPT_WEBP_DEFAULT);
 	cf->save.psd = mIniRead_getInt(ini, "psd", SAVEOPT_PSD_DEFAULT);
+	cf->save.apd = mIniRead_getInt(ini, "apd", SAVEOPT_APD_DEFAULT);
 
 	//----- 操作設定
 
@@ -758,10 +763,14 @@ static void _save_configdata(FILE *fp,AppConfig *cf)
 	mIniWrite_putInt(fp, "iconsize_panel_tool", cf->iconsize_panel_tool);
 	mIniWrite_putInt(fp, "iconsize_other", cf->iconsize_other);
 	mIniWrite_putInt(fp, "canvas_scale_method", cf->canvas_scale_method);
+	mIniWrite_putInt(fp, "canvas_scale_keep_layer", cf->canvas_scale_keep_layer);
 
 	mIniWrite_putInt(fp, "undo_maxbufsize", cf->undo_maxbufsize);
 	mIniWrite_putInt(fp, "undo_maxnum", cf->undo_maxnum);
 	mIniWrite_putInt(fp, "savedup_type", cf->savedup_type);
+	mIniWrite_putInt(fp, "thread_num", cf->thread_num);
+	mIniWrite_putInt(fp, "autosave_min", cf->autosave_min);
+	mIniWrite_putInt(fp, "tile_maxmem_mb", cf->tile_maxmem_mb);
 
 	mIniWrite_putNumbers(fp, "cursor_hotspot", cf->cursor_hotspot, 2, 2, FALSE);
 
@@ -846,6 +855,7 @@ static void _save_configdata(FILE *fp,AppConfig *cf)
 	mIniWrite_putInt(fp, "tiff", cf->save.tiff);
 	mIniWrite_putInt(fp, "webp", cf->save.webp);
 	mIniWrite_putInt(fp, "psd", cf->save.psd);
+	mIniWrite_putInt(fp, "apd", cf->save.apd);
 
 	//----- ポインタデバイス
 
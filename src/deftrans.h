@@ -1,5 +1,5 @@
 static const unsigned char g_deftransdat[] = {
-0,0,0,55,0,0,3,193,0,0,77,164,0,0,0,21,
+0,0,0,55,0,0,3,200,0,0,78,201,0,0,0,21,
 0,0,0,0,0,1,0,10,0,0,0,126,0,2,0,15,
 0,0,0,186,0,3,0,18,0,0,1,20,0,10,0,12,
 0,0,1,128,0,11,0,9,0,0,1,200,0,12,0,19,
@@ -15,19 +15,19 @@ static const unsigned char g_deftransdat[] = {
 0,0,7,200,3,242,0,29,0,0,7,224,7,207,0,2,
 0,0,8,142,7,208,0,8,0,0,8,154,7,209,0,7,
 0,0,8,202,7,210,0,7,0,0,8,244,7,211,0,1,
-0,0,9,30,7,212,0,28,0,0,9,36,7,213,0,1,
-0,0,9,204,7,214,0,8,0,0,9,210,7,215,0,2,
-0,0,10,2,7,216,0,14,0,0,10,14,7,217,0,2,
-0,0,10,98,7,218,0,10,0,0,10,110,7,219,0,20,
-0,0,10,170,7,220,0,21,0,0,11,34,7,221,0,4,
-0,0,11,160,7,222,0,7,0,0,11,184,7,223,0,1,
-0,0,11,226,7,224,0,3,0,0,11,232,7,225,0,19,
-0,0,11,250,7,226,0,35,0,0,12,108,7,227,0,77,
-0,0,13,62,7,228,0,5,0,0,15,12,7,229,0,2,
-0,0,15,42,7,230,0,52,0,0,15,54,39,16,0,207,
-0,0,16,110,39,17,0,14,0,0,21,72,39,18,0,7,
-0,0,21,156,39,19,0,5,0,0,21,198,255,255,0,27,
-0,0,21,228,0,0,0,0,0,0,0,1,0,0,0,8,
+0,0,9,30,7,212,0,28,0,0,9,36,7,213,0,2,
+0,0,9,204,7,214,0,9,0,0,9,216,7,215,0,2,
+0,0,10,14,7,216,0,14,0,0,10,26,7,217,0,2,
+0,0,10,110,7,218,0,10,0,0,10,122,7,219,0,20,
+0,0,10,182,7,220,0,21,0,0,11,46,7,221,0,4,
+0,0,11,172,7,222,0,7,0,0,11,196,7,223,0,1,
+0,0,11,238,7,224,0,3,0,0,11,244,7,225,0,19,
+0,0,12,6,7,226,0,35,0,0,12,120,7,227,0,77,
+0,0,13,74,7,228,0,5,0,0,15,24,7,229,0,2,
+0,0,15,54,7,230,0,56,0,0,15,66,39,16,0,207,
+0,0,16,146,39,17,0,15,0,0,21,108,39,18,0,7,
+0,0,21,198,39,19,0,5,0,0,21,240,255,255,0,27,
+0,0,22,14,0,0,0,0,0,0,0,1,0,0,0,8,
 0,2,0,0,0,13,0,3,0,0,0,19,0,4,0,0,
 0,26,0,5,0,0,0,37,0,6,0,0,0,48,0,7,
 0,0,0,56,0,8,0,0,0,62,0,9,0,0,0,67,
@@ -184,1450 +184,1471 @@ static const unsigned char g_deftransdat[] = {
 0,113,0,0,31,43,0,114,0,0,31,76,0,115,0,0,
 31,97,0,116,0,0,31,131,0,117,0,0,31,150,0,118,
 0,0,32,81,3,232,0,0,32,135,3,233,0,0,32,155,
-0,0,0,0,32,172,0,0,0,0,32,187,0,1,0,0,
-32,201,0,100,0,0,32,227,0,101,0,0,32,239,0,102,
-0,0,33,0,0,103,0,0,33,6,0,104,0,0,33,31,
-0,105,0,0,33,42,0,0,0,0,33,63,0,1,0,0,
-33,87,0,0,0,0,33,132,0,1,0,0,33,149,0,2,
-0,0,33,158,0,3,0,0,33,172,0,4,0,0,33,189,
-0,5,0,0,33,205,0,6,0,0,33,211,0,7,0,0,
-33,227,0,8,0,0,33,241,0,100,0,0,34,150,0,101,
-0,0,34,175,0,102,0,0,34,211,0,103,0,0,35,9,
-0,104,0,0,35,31,0,0,0,0,35,43,0,1,0,0,
-35,74,0,0,0,0,35,96,0,1,0,0,35,111,0,2,
-0,0,35,118,0,3,0,0,35,130,0,4,0,0,35,136,
-0,5,0,0,35,152,0,6,0,0,35,168,0,7,0,0,
-35,183,0,8,0,0,35,208,0,9,0,0,35,220,0,0,
-0,0,36,155,0,1,0,0,36,160,0,2,0,0,36,165,
-0,3,0,0,36,170,0,4,0,0,36,186,0,5,0,0,
-36,205,0,6,0,0,36,223,0,7,0,0,36,236,0,8,
-0,0,36,245,0,9,0,0,36,253,0,10,0,0,37,18,
-0,11,0,0,37,23,0,12,0,0,37,37,0,100,0,0,
-37,60,0,101,0,0,37,78,0,102,0,0,37,95,0,103,
-0,0,37,119,0,104,0,0,37,132,0,105,0,0,37,151,
-0,200,0,0,37,174,0,0,0,0,37,196,0,1,0,0,
-37,217,0,2,0,0,37,230,0,3,0,0,38,5,0,4,
-0,0,38,21,0,5,0,0,38,31,0,6,0,0,38,50,
-0,7,0,0,38,69,0,8,0,0,38,87,0,9,0,0,
-38,102,0,10,0,0,38,121,0,100,0,0,38,153,0,101,
-0,0,38,165,0,102,0,0,38,174,0,103,0,0,38,183,
-0,104,0,0,38,189,0,105,0,0,38,206,3,232,0,0,
-38,245,3,233,0,0,39,7,3,234,0,0,39,33,3,235,
-0,0,39,81,0,0,0,0,39,102,0,1,0,0,39,120,
-0,2,0,0,39,125,0,3,0,0,39,130,0,0,0,0,
-39,135,0,1,0,0,39,145,0,2,0,0,39,160,0,3,
-0,0,39,179,0,100,0,0,39,193,0,101,0,0,39,224,
-0,102,0,0,39,232,0,0,0,0,39,240,0,0,0,0,
-39,255,0,1,0,0,40,17,0,2,0,0,40,23,0,0,
-0,0,40,28,0,1,0,0,40,42,0,2,0,0,40,66,
-0,3,0,0,40,80,0,4,0,0,40,96,0,5,0,0,
-40,111,0,6,0,0,40,143,0,7,0,0,40,155,0,8,
-0,0,40,167,0,9,0,0,40,180,0,10,0,0,40,197,
-0,11,0,0,40,215,0,12,0,0,40,230,0,13,0,0,
-40,251,0,50,0,0,41,13,0,100,0,0,41,131,0,101,
-0,0,41,147,0,102,0,0,41,165,0,103,0,0,41,189,
-0,0,0,0,41,224,0,1,0,0,41,242,0,100,0,0,
-42,6,0,101,0,0,42,16,0,102,0,0,42,26,3,232,
-0,0,42,61,3,233,0,0,42,73,3,234,0,0,42,93,
-3,235,0,0,42,108,3,236,0,0,42,140,3,237,0,0,
-42,180,3,238,0,0,42,222,3,239,0,0,43,11,3,240,
-0,0,43,45,4,76,0,0,43,58,4,77,0,0,43,63,
-4,78,0,0,43,68,4,79,0,0,43,95,4,80,0,0,
-43,122,4,81,0,0,43,144,4,82,0,0,43,181,4,83,
-0,0,43,204,4,84,0,0,43,227,4,85,0,0,44,3,
-4,86,0,0,44,41,4,87,0,0,44,83,4,176,0,0,
-44,123,4,177,0,0,44,141,4,178,0,0,44,157,4,179,
-0,0,44,174,4,180,0,0,44,185,4,181,0,0,44,196,
-5,20,0,0,44,220,5,21,0,0,44,252,5,22,0,0,
-45,32,0,1,0,0,45,53,0,2,0,0,45,59,0,10,
-0,0,45,90,0,11,0,0,45,101,0,12,0,0,45,110,
-0,13,0,0,45,122,0,14,0,0,45,126,0,15,0,0,
-45,137,0,16,0,0,45,147,0,17,0,0,45,152,0,18,
-0,0,45,157,0,19,0,0,45,164,0,20,0,0,45,170,
-0,21,0,0,45,179,0,22,0,0,45,245,0,23,0,0,
-45,254,0,24,0,0,46,15,0,25,0,0,46,23,0,26,
-0,0,46,29,0,27,0,0,46,34,0,28,0,0,46,42,
-0,29,0,0,46,56,0,30,0,0,46,63,0,31,0,0,
-46,80,0,32,0,0,46,98,0,33,0,0,46,109,0,34,
-0,0,46,119,0,35,0,0,46,137,0,36,0,0,46,155,
-0,37,0,0,46,172,0,38,0,0,46,189,0,39,0,0,
-46,205,0,40,0,0,46,219,0,41,0,0,46,225,0,42,
-0,0,46,232,0,43,0,0,47,14,0,44,0,0,47,32,
-0,45,0,0,47,40,0,46,0,0,47,48,0,47,0,0,
-47,56,0,48,0,0,47,86,0,49,0,0,47,96,0,50,
-0,0,47,114,0,51,0,0,47,123,0,52,0,0,47,131,
-0,53,0,0,47,138,0,54,0,0,47,144,0,55,0,0,
-47,158,0,56,0,0,47,169,0,57,0,0,47,175,0,58,
-0,0,47,191,0,59,0,0,47,215,0,60,0,0,47,237,
-0,61,0,0,47,244,0,62,0,0,48,4,0,63,0,0,
-48,18,0,64,0,0,48,44,0,65,0,0,48,57,0,66,
-0,0,48,65,0,67,0,0,48,81,0,68,0,0,48,98,
-0,69,0,0,48,112,0,70,0,0,48,124,0,71,0,0,
-48,143,0,72,0,0,48,158,3,232,0,0,48,173,3,233,
-0,0,48,210,3,234,0,0,48,254,3,235,0,0,49,42,
-3,236,0,0,49,87,3,237,0,0,49,216,3,238,0,0,
-50,15,3,239,0,0,50,42,3,240,0,0,50,66,3,241,
-0,0,50,102,3,242,0,0,50,193,3,243,0,0,50,226,
-0,0,0,0,51,28,0,1,0,0,51,49,0,2,0,0,
-51,55,0,3,0,0,51,60,0,4,0,0,51,67,0,0,
-0,0,51,74,0,1,0,0,51,96,0,0,0,0,51,115,
-0,1,0,0,51,137,0,2,0,0,51,147,0,3,0,0,
-51,153,0,4,0,0,51,170,0,5,0,0,51,180,0,100,
-0,0,51,187,0,101,0,0,51,211,0,102,0,0,51,234,
-0,103,0,0,51,252,0,104,0,0,52,41,0,105,0,0,
-52,73,0,106,0,0,52,98,0,107,0,0,52,157,0,150,
-0,0,52,185,0,151,0,0,52,210,0,152,0,0,53,4,
-0,153,0,0,53,56,0,200,0,0,53,117,0,201,0,0,
-53,131,0,202,0,0,53,153,0,203,0,0,53,171,0,204,
-0,0,53,182,0,205,0,0,53,189,0,206,0,0,53,197,
-0,207,0,0,54,57,0,208,0,0,54,91,0,209,0,0,
-54,106,0,210,0,0,54,134,0,211,0,0,54,150,0,250,
-0,0,54,165,0,251,0,0,54,180,0,252,0,0,54,194,
-0,253,0,0,54,202,0,254,0,0,54,207,0,255,0,0,
-54,213,1,44,0,0,54,235,1,45,0,0,55,1,1,46,
-0,0,55,30,1,47,0,0,55,61,1,48,0,0,55,76,
-1,49,0,0,55,119,3,232,0,0,55,174,3,233,0,0,
-55,202,4,76,0,0,55,243,4,77,0,0,56,7,4,78,
-0,0,56,21,4,79,0,0,56,36,4,80,0,0,56,52,
-4,81,0,0,56,64,4,82,0,0,56,78,4,83,0,0,
-56,92,0,1,0,0,56,107,0,2,0,0,56,116,0,3,
-0,0,56,125,0,4,0,0,56,135,0,5,0,0,56,149,
-0,6,0,0,56,160,0,7,0,0,56,169,3,232,0,0,
-56,181,3,233,0,0,56,192,3,234,0,0,56,204,3,235,
-0,0,56,213,3,236,0,0,56,228,3,237,0,0,56,250,
-3,238,0,0,57,18,3,239,0,0,57,27,4,76,0,0,
-57,45,4,77,0,0,57,54,4,78,0,0,57,63,4,79,
-0,0,57,72,4,80,0,0,57,82,4,81,0,0,57,108,
-4,82,0,0,57,141,4,83,0,0,57,163,4,176,0,0,
-57,207,4,177,0,0,57,220,4,178,0,0,57,235,4,179,
-0,0,57,247,4,180,0,0,58,18,4,181,0,0,58,27,
-4,182,0,0,58,35,4,183,0,0,58,58,4,184,0,0,
-58,98,4,185,0,0,58,145,5,20,0,0,58,192,5,21,
-0,0,58,221,5,22,0,0,58,242,5,23,0,0,59,11,
-5,24,0,0,59,38,5,25,0,0,59,66,7,208,0,0,
-59,79,7,209,0,0,59,96,7,210,0,0,59,111,7,211,
-0,0,59,138,7,212,0,0,59,184,7,213,0,0,59,198,
-7,214,0,0,59,209,7,215,0,0,59,219,7,216,0,0,
-59,254,7,217,0,0,60,25,7,218,0,0,60,53,7,219,
-0,0,60,67,7,220,0,0,60,103,7,221,0,0,60,125,
-7,222,0,0,60,138,7,223,0,0,60,159,7,224,0,0,
-60,168,7,225,0,0,60,177,7,226,0,0,60,188,8,52,
-0,0,60,198,8,53,0,0,60,220,8,54,0,0,60,245,
-8,102,0,0,61,14,8,152,0,0,61,42,8,153,0,0,
-61,62,8,154,0,0,61,83,8,155,0,0,61,117,8,252,
-0,0,61,152,8,253,0,0,61,165,8,254,0,0,61,178,
-8,255,0,0,61,206,9,0,0,0,61,231,9,96,0,0,
-62,12,9,97,0,0,62,53,9,98,0,0,62,93,9,196,
-0,0,62,106,9,197,0,0,62,138,9,198,0,0,62,153,
-11,184,0,0,62,169,11,185,0,0,62,182,11,186,0,0,
-62,197,11,187,0,0,62,207,11,188,0,0,62,225,11,189,
-0,0,63,6,11,190,0,0,63,20,11,191,0,0,63,43,
-11,192,0,0,63,64,11,193,0,0,63,76,11,194,0,0,
-63,91,11,195,0,0,63,111,11,196,0,0,63,156,11,197,
-0,0,63,177,11,198,0,0,63,195,12,28,0,0,63,241,
-12,29,0,0,64,12,12,30,0,0,64,36,12,31,0,0,
-64,45,12,32,0,0,64,59,12,33,0,0,64,77,12,34,
-0,0,64,88,12,35,0,0,64,98,12,36,0,0,64,108,
-12,37,0,0,64,124,12,38,0,0,64,142,12,39,0,0,
-64,163,12,40,0,0,64,179,12,41,0,0,64,196,12,128,
-0,0,64,212,12,129,0,0,64,224,12,130,0,0,64,237,
-12,131,0,0,64,246,12,228,0,0,65,5,12,229,0,0,
-65,30,12,230,0,0,65,56,12,231,0,0,65,65,12,232,
-0,0,65,75,12,233,0,0,65,86,19,136,0,0,65,97,
-19,137,0,0,65,103,19,138,0,0,65,121,19,139,0,0,
-65,142,19,140,0,0,65,163,19,141,0,0,65,168,19,142,
-0,0,65,174,19,143,0,0,65,184,19,144,0,0,65,197,
-19,145,0,0,65,205,19,146,0,0,65,212,19,147,0,0,
-65,227,19,236,0,0,65,234,19,237,0,0,66,1,19,238,
-0,0,66,10,19,239,0,0,66,19,19,240,0,0,66,37,
-19,241,0,0,66,55,19,242,0,0,66,73,19,243,0,0,
-66,100,19,244,0,0,66,110,19,245,0,0,66,122,19,246,
-0,0,66,152,19,247,0,0,66,168,19,248,0,0,66,193,
-19,249,0,0,66,210,19,250,0,0,66,234,19,251,0,0,
-67,14,19,252,0,0,67,60,19,253,0,0,67,95,19,254,
-0,0,67,131,19,255,0,0,67,180,20,0,0,0,67,230,
-20,1,0,0,68,7,20,2,0,0,68,33,20,3,0,0,
-68,64,20,4,0,0,68,95,20,5,0,0,68,144,20,6,
-0,0,68,185,20,7,0,0,68,209,20,8,0,0,68,229,
-20,9,0,0,68,254,20,10,0,0,69,18,20,11,0,0,
-69,52,20,12,0,0,69,60,20,13,0,0,69,74,20,14,
-0,0,69,89,20,15,0,0,69,104,20,16,0,0,69,117,
-20,17,0,0,69,127,20,18,0,0,69,142,20,19,0,0,
-69,163,20,20,0,0,69,192,20,21,0,0,69,202,20,22,
-0,0,69,235,20,23,0,0,69,244,20,24,0,0,70,14,
-20,25,0,0,70,32,20,26,0,0,70,48,20,27,0,0,
-70,70,20,28,0,0,70,94,20,29,0,0,70,115,20,30,
-0,0,70,128,20,31,0,0,70,148,20,32,0,0,70,158,
-20,33,0,0,70,169,20,34,0,0,70,182,20,35,0,0,
-70,191,20,36,0,0,70,207,20,37,0,0,70,234,20,38,
-0,0,71,9,20,39,0,0,71,22,20,40,0,0,71,30,
-20,41,0,0,71,44,20,42,0,0,71,60,20,43,0,0,
-71,70,20,44,0,0,71,79,20,45,0,0,71,91,20,46,
-0,0,71,102,20,47,0,0,71,112,20,48,0,0,71,120,
-20,49,0,0,71,128,20,50,0,0,71,138,20,51,0,0,
-71,159,20,52,0,0,71,176,20,53,0,0,71,186,20,54,
-0,0,71,213,20,55,0,0,71,237,20,56,0,0,71,254,
-20,57,0,0,72,8,20,58,0,0,72,35,0,0,0,0,
-72,44,0,1,0,0,72,52,0,2,0,0,72,100,0,3,
-0,0,72,115,0,4,0,0,72,130,0,5,0,0,72,176,
-0,6,0,0,72,245,0,7,0,0,73,18,0,8,0,0,
-73,124,0,9,0,0,73,171,0,100,0,0,74,54,0,200,
-0,0,74,105,0,201,0,0,74,187,0,202,0,0,74,227,
-0,0,0,0,75,8,0,1,0,0,75,14,0,2,0,0,
-75,40,0,3,0,0,75,65,0,4,0,0,75,84,0,5,
-0,0,75,106,0,6,0,0,75,156,0,1,0,0,75,201,
-0,2,0,0,75,231,0,3,0,0,76,9,0,4,0,0,
-76,33,0,5,0,0,76,61,0,1,0,0,76,98,0,2,
-0,0,76,101,0,3,0,0,76,108,0,4,0,0,76,112,
-0,5,0,0,76,115,0,6,0,0,76,120,0,7,0,0,
-76,131,0,8,0,0,76,137,0,9,0,0,76,161,0,10,
-0,0,76,174,0,11,0,0,76,184,0,12,0,0,76,194,
-0,13,0,0,76,211,0,14,0,0,76,216,0,15,0,0,
-76,225,0,16,0,0,76,234,0,17,0,0,76,243,0,18,
-0,0,77,2,0,19,0,0,77,20,0,20,0,0,77,70,
-0,21,0,0,77,95,0,22,0,0,77,107,0,23,0,0,
-77,113,0,24,0,0,77,120,0,25,0,0,77,125,0,26,
-0,0,77,135,0,27,0,0,77,142,80,114,101,118,105,101,
-119,0,78,97,109,101,0,87,105,100,116,104,0,72,101,105,
-103,104,116,0,82,101,115,111,108,117,116,105,111,110,0,73,
-109,97,103,101,32,98,105,116,115,0,68,101,110,115,105,116,
-121,0,67,111,108,111,114,0,84,121,112,101,0,66,108,101,
-110,100,32,109,111,100,101,0,79,112,97,99,105,116,121,0,
-84,101,120,116,117,114,101,0,65,110,103,108,101,0,66,97,
-99,107,103,114,111,117,110,100,32,99,111,108,111,114,0,83,
-105,122,101,0,85,110,105,116,0,84,101,109,112,108,97,116,
-101,0,65,110,116,105,45,97,108,105,97,115,105,110,103,0,
-80,105,120,101,108,32,109,111,100,101,0,99,105,114,99,108,
-101,0,99,105,114,99,108,101,32,102,114,97,109,101,0,114,
-101,99,116,97,110,103,108,101,0,114,101,99,116,97,110,103,
-108,101,32,102,114,97,109,101,0,100,105,97,109,111,110,100,
-0,100,105,97,109,111,110,100,32,102,114,97,109,101,0,88,
-32,109,97,114,107,0,99,114,111,115,115,0,103,108,105,116,
-116,101,114,0,0,82,101,115,101,116,0,65,100,100,0,68,
-101,108,101,116,101,0,85,112,0,68,111,119,110,0,82,101,
-110,97,109,101,0,68,117,112,108,105,99,97,116,101,0,69,
-100,105,116,0,79,112,101,110,0,83,97,118,101,0,77,111,
-118,101,0,91,83,104,105,102,116,58,32,66,114,117,115,104,
-32,115,105,122,101,32,99,104,97,110,103,101,93,32,91,67,
+0,0,0,0,32,172,0,1,0,0,32,187,0,0,0,0,
+32,199,0,1,0,0,32,213,0,100,0,0,32,239,0,101,
+0,0,32,251,0,102,0,0,33,12,0,103,0,0,33,18,
+0,104,0,0,33,43,0,105,0,0,33,54,0,106,0,0,
+33,75,0,0,0,0,33,87,0,1,0,0,33,111,0,0,
+0,0,33,156,0,1,0,0,33,173,0,2,0,0,33,182,
+0,3,0,0,33,196,0,4,0,0,33,213,0,5,0,0,
+33,229,0,6,0,0,33,235,0,7,0,0,33,251,0,8,
+0,0,34,9,0,100,0,0,34,174,0,101,0,0,34,199,
+0,102,0,0,34,235,0,103,0,0,35,33,0,104,0,0,
+35,55,0,0,0,0,35,67,0,1,0,0,35,98,0,0,
+0,0,35,120,0,1,0,0,35,135,0,2,0,0,35,142,
+0,3,0,0,35,154,0,4,0,0,35,160,0,5,0,0,
+35,176,0,6,0,0,35,192,0,7,0,0,35,207,0,8,
+0,0,35,232,0,9,0,0,35,244,0,0,0,0,36,179,
+0,1,0,0,36,184,0,2,0,0,36,189,0,3,0,0,
+36,194,0,4,0,0,36,210,0,5,0,0,36,229,0,6,
+0,0,36,247,0,7,0,0,37,4,0,8,0,0,37,13,
+0,9,0,0,37,21,0,10,0,0,37,42,0,11,0,0,
+37,47,0,12,0,0,37,61,0,100,0,0,37,84,0,101,
+0,0,37,102,0,102,0,0,37,119,0,103,0,0,37,143,
+0,104,0,0,37,156,0,105,0,0,37,175,0,200,0,0,
+37,198,0,0,0,0,37,220,0,1,0,0,37,241,0,2,
+0,0,37,254,0,3,0,0,38,29,0,4,0,0,38,45,
+0,5,0,0,38,55,0,6,0,0,38,74,0,7,0,0,
+38,93,0,8,0,0,38,111,0,9,0,0,38,126,0,10,
+0,0,38,145,0,100,0,0,38,177,0,101,0,0,38,189,
+0,102,0,0,38,198,0,103,0,0,38,207,0,104,0,0,
+38,213,0,105,0,0,38,230,3,232,0,0,39,13,3,233,
+0,0,39,31,3,234,0,0,39,57,3,235,0,0,39,105,
+0,0,0,0,39,126,0,1,0,0,39,144,0,2,0,0,
+39,149,0,3,0,0,39,154,0,0,0,0,39,159,0,1,
+0,0,39,169,0,2,0,0,39,184,0,3,0,0,39,203,
+0,100,0,0,39,217,0,101,0,0,39,248,0,102,0,0,
+40,0,0,0,0,0,40,8,0,0,0,0,40,23,0,1,
+0,0,40,41,0,2,0,0,40,47,0,0,0,0,40,52,
+0,1,0,0,40,66,0,2,0,0,40,90,0,3,0,0,
+40,104,0,4,0,0,40,120,0,5,0,0,40,135,0,6,
+0,0,40,167,0,7,0,0,40,179,0,8,0,0,40,191,
+0,9,0,0,40,204,0,10,0,0,40,221,0,11,0,0,
+40,239,0,12,0,0,40,254,0,13,0,0,41,19,0,50,
+0,0,41,37,0,100,0,0,41,155,0,101,0,0,41,171,
+0,102,0,0,41,189,0,103,0,0,41,213,0,0,0,0,
+41,248,0,1,0,0,42,10,0,100,0,0,42,30,0,101,
+0,0,42,40,0,102,0,0,42,50,3,232,0,0,42,85,
+3,233,0,0,42,97,3,234,0,0,42,117,3,235,0,0,
+42,132,3,236,0,0,42,164,3,237,0,0,42,204,3,238,
+0,0,42,246,3,239,0,0,43,35,3,240,0,0,43,69,
+4,76,0,0,43,82,4,77,0,0,43,87,4,78,0,0,
+43,92,4,79,0,0,43,119,4,80,0,0,43,146,4,81,
+0,0,43,168,4,82,0,0,43,205,4,83,0,0,43,228,
+4,84,0,0,43,251,4,85,0,0,44,27,4,86,0,0,
+44,65,4,87,0,0,44,107,4,176,0,0,44,147,4,177,
+0,0,44,165,4,178,0,0,44,181,4,179,0,0,44,198,
+4,180,0,0,44,209,4,181,0,0,44,220,5,20,0,0,
+44,244,5,21,0,0,45,20,5,22,0,0,45,56,0,1,
+0,0,45,77,0,2,0,0,45,83,0,10,0,0,45,114,
+0,11,0,0,45,125,0,12,0,0,45,134,0,13,0,0,
+45,146,0,14,0,0,45,150,0,15,0,0,45,161,0,16,
+0,0,45,171,0,17,0,0,45,176,0,18,0,0,45,181,
+0,19,0,0,45,188,0,20,0,0,45,194,0,21,0,0,
+45,203,0,22,0,0,46,13,0,23,0,0,46,22,0,24,
+0,0,46,39,0,25,0,0,46,47,0,26,0,0,46,53,
+0,27,0,0,46,58,0,28,0,0,46,66,0,29,0,0,
+46,80,0,30,0,0,46,87,0,31,0,0,46,104,0,32,
+0,0,46,122,0,33,0,0,46,133,0,34,0,0,46,143,
+0,35,0,0,46,161,0,36,0,0,46,179,0,37,0,0,
+46,196,0,38,0,0,46,213,0,39,0,0,46,229,0,40,
+0,0,46,243,0,41,0,0,46,249,0,42,0,0,47,0,
+0,43,0,0,47,38,0,44,0,0,47,56,0,45,0,0,
+47,64,0,46,0,0,47,72,0,47,0,0,47,80,0,48,
+0,0,47,110,0,49,0,0,47,120,0,50,0,0,47,138,
+0,51,0,0,47,147,0,52,0,0,47,155,0,53,0,0,
+47,162,0,54,0,0,47,168,0,55,0,0,47,182,0,56,
+0,0,47,193,0,57,0,0,47,199,0,58,0,0,47,215,
+0,59,0,0,47,239,0,60,0,0,48,5,0,61,0,0,
+48,12,0,62,0,0,48,28,0,63,0,0,48,42,0,64,
+0,0,48,68,0,65,0,0,48,81,0,66,0,0,48,89,
+0,67,0,0,48,105,0,68,0,0,48,122,0,69,0,0,
+48,136,0,70,0,0,48,148,0,71,0,0,48,167,0,72,
+0,0,48,182,3,232,0,0,48,197,3,233,0,0,48,234,
+3,234,0,0,49,22,3,235,0,0,49,66,3,236,0,0,
+49,111,3,237,0,0,49,240,3,238,0,0,50,39,3,239,
+0,0,50,66,3,240,0,0,50,90,3,241,0,0,50,126,
+3,242,0,0,50,217,3,243,0,0,50,250,0,0,0,0,
+51,52,0,1,0,0,51,73,0,2,0,0,51,79,0,3,
+0,0,51,84,0,4,0,0,51,91,0,0,0,0,51,98,
+0,1,0,0,51,120,0,0,0,0,51,139,0,1,0,0,
+51,161,0,2,0,0,51,171,0,3,0,0,51,177,0,4,
+0,0,51,194,0,5,0,0,51,204,0,100,0,0,51,211,
+0,101,0,0,51,235,0,102,0,0,52,2,0,103,0,0,
+52,20,0,104,0,0,52,65,0,105,0,0,52,97,0,106,
+0,0,52,122,0,107,0,0,52,181,0,108,0,0,52,209,
+0,109,0,0,52,251,0,110,0,0,53,30,0,111,0,0,
+53,97,0,150,0,0,53,130,0,151,0,0,53,155,0,152,
+0,0,53,205,0,153,0,0,54,1,0,200,0,0,54,62,
+0,201,0,0,54,76,0,202,0,0,54,98,0,203,0,0,
+54,116,0,204,0,0,54,127,0,205,0,0,54,134,0,206,
+0,0,54,142,0,207,0,0,55,2,0,208,0,0,55,36,
+0,209,0,0,55,51,0,210,0,0,55,79,0,211,0,0,
+55,95,0,250,0,0,55,110,0,251,0,0,55,125,0,252,
+0,0,55,139,0,253,0,0,55,147,0,254,0,0,55,152,
+0,255,0,0,55,158,1,44,0,0,55,180,1,45,0,0,
+55,202,1,46,0,0,55,231,1,47,0,0,56,6,1,48,
+0,0,56,21,1,49,0,0,56,64,3,232,0,0,56,119,
+3,233,0,0,56,147,4,76,0,0,56,188,4,77,0,0,
+56,208,4,78,0,0,56,222,4,79,0,0,56,237,4,80,
+0,0,56,253,4,81,0,0,57,9,4,82,0,0,57,23,
+4,83,0,0,57,37,0,1,0,0,57,52,0,2,0,0,
+57,61,0,3,0,0,57,70,0,4,0,0,57,80,0,5,
+0,0,57,94,0,6,0,0,57,105,0,7,0,0,57,114,
+3,232,0,0,57,126,3,233,0,0,57,137,3,234,0,0,
+57,149,3,235,0,0,57,158,3,236,0,0,57,173,3,237,
+0,0,57,195,3,238,0,0,57,219,3,239,0,0,57,228,
+4,76,0,0,57,246,4,77,0,0,57,255,4,78,0,0,
+58,8,4,79,0,0,58,17,4,80,0,0,58,27,4,81,
+0,0,58,53,4,82,0,0,58,86,4,83,0,0,58,108,
+4,176,0,0,58,152,4,177,0,0,58,165,4,178,0,0,
+58,180,4,179,0,0,58,192,4,180,0,0,58,219,4,181,
+0,0,58,228,4,182,0,0,58,236,4,183,0,0,59,3,
+4,184,0,0,59,43,4,185,0,0,59,90,5,20,0,0,
+59,137,5,21,0,0,59,166,5,22,0,0,59,187,5,23,
+0,0,59,212,5,24,0,0,59,239,5,25,0,0,60,11,
+7,208,0,0,60,24,7,209,0,0,60,41,7,210,0,0,
+60,56,7,211,0,0,60,83,7,212,0,0,60,129,7,213,
+0,0,60,143,7,214,0,0,60,154,7,215,0,0,60,164,
+7,216,0,0,60,199,7,217,0,0,60,226,7,218,0,0,
+60,254,7,219,0,0,61,12,7,220,0,0,61,48,7,221,
+0,0,61,70,7,222,0,0,61,83,7,223,0,0,61,104,
+7,224,0,0,61,113,7,225,0,0,61,122,7,226,0,0,
+61,133,8,52,0,0,61,143,8,53,0,0,61,165,8,54,
+0,0,61,190,8,102,0,0,61,215,8,152,0,0,61,243,
+8,153,0,0,62,7,8,154,0,0,62,28,8,155,0,0,
+62,62,8,252,0,0,62,97,8,253,0,0,62,110,8,254,
+0,0,62,123,8,255,0,0,62,151,9,0,0,0,62,176,
+9,96,0,0,62,213,9,97,0,0,62,254,9,98,0,0,
+63,38,9,196,0,0,63,51,9,197,0,0,63,83,9,198,
+0,0,63,98,11,184,0,0,63,114,11,185,0,0,63,127,
+11,186,0,0,63,142,11,187,0,0,63,152,11,188,0,0,
+63,170,11,189,0,0,63,207,11,190,0,0,63,221,11,191,
+0,0,63,244,11,192,0,0,64,9,11,193,0,0,64,21,
+11,194,0,0,64,36,11,195,0,0,64,56,11,196,0,0,
+64,101,11,197,0,0,64,122,11,198,0,0,64,140,12,28,
+0,0,64,186,12,29,0,0,64,213,12,30,0,0,64,237,
+12,31,0,0,64,246,12,32,0,0,65,4,12,33,0,0,
+65,22,12,34,0,0,65,33,12,35,0,0,65,43,12,36,
+0,0,65,53,12,37,0,0,65,69,12,38,0,0,65,87,
+12,39,0,0,65,108,12,40,0,0,65,124,12,41,0,0,
+65,141,12,128,0,0,65,157,12,129,0,0,65,169,12,130,
+0,0,65,182,12,131,0,0,65,191,12,228,0,0,65,206,
+12,229,0,0,65,231,12,230,0,0,66,1,12,231,0,0,
+66,10,12,232,0,0,66,20,12,233,0,0,66,31,19,136,
+0,0,66,42,19,137,0,0,66,48,19,138,0,0,66,66,
+19,139,0,0,66,87,19,140,0,0,66,108,19,141,0,0,
+66,113,19,142,0,0,66,119,19,143,0,0,66,129,19,144,
+0,0,66,142,19,145,0,0,66,150,19,146,0,0,66,157,
+19,147,0,0,66,172,19,236,0,0,66,179,19,237,0,0,
+66,202,19,238,0,0,66,211,19,239,0,0,66,220,19,240,
+0,0,66,238,19,241,0,0,67,0,19,242,0,0,67,18,
+19,243,0,0,67,45,19,244,0,0,67,55,19,245,0,0,
+67,67,19,246,0,0,67,97,19,247,0,0,67,113,19,248,
+0,0,67,138,19,249,0,0,67,155,19,250,0,0,67,179,
+19,251,0,0,67,215,19,252,0,0,68,5,19,253,0,0,
+68,40,19,254,0,0,68,76,19,255,0,0,68,125,20,0,
+0,0,68,175,20,1,0,0,68,208,20,2,0,0,68,234,
+20,3,0,0,69,9,20,4,0,0,69,40,20,5,0,0,
+69,89,20,6,0,0,69,130,20,7,0,0,69,154,20,8,
+0,0,69,174,20,9,0,0,69,199,20,10,0,0,69,219,
+20,11,0,0,69,253,20,12,0,0,70,5,20,13,0,0,
+70,19,20,14,0,0,70,34,20,15,0,0,70,49,20,16,
+0,0,70,62,20,17,0,0,70,72,20,18,0,0,70,87,
+20,19,0,0,70,108,20,20,0,0,70,137,20,21,0,0,
+70,147,20,22,0,0,70,180,20,23,0,0,70,189,20,24,
+0,0,70,215,20,25,0,0,70,233,20,26,0,0,70,249,
+20,27,0,0,71,15,20,28,0,0,71,39,20,29,0,0,
+71,60,20,30,0,0,71,73,20,31,0,0,71,93,20,32,
+0,0,71,103,20,33,0,0,71,114,20,34,0,0,71,127,
+20,35,0,0,71,136,20,36,0,0,71,152,20,37,0,0,
+71,179,20,38,0,0,71,210,20,39,0,0,71,223,20,40,
+0,0,71,231,20,41,0,0,71,245,20,42,0,0,72,5,
+20,43,0,0,72,15,20,44,0,0,72,24,20,45,0,0,
+72,36,20,46,0,0,72,47,20,47,0,0,72,57,20,48,
+0,0,72,65,20,49,0,0,72,73,20,50,0,0,72,83,
+20,51,0,0,72,104,20,52,0,0,72,121,20,53,0,0,
+72,131,20,54,0,0,72,158,20,55,0,0,72,182,20,56,
+0,0,72,199,20,57,0,0,72,209,20,58,0,0,72,236,
+0,0,0,0,72,245,0,1,0,0,72,253,0,2,0,0,
+73,45,0,3,0,0,73,60,0,4,0,0,73,75,0,5,
+0,0,73,121,0,6,0,0,73,190,0,7,0,0,73,219,
+0,8,0,0,74,69,0,9,0,0,74,116,0,10,0,0,
+74,255,0,100,0,0,75,91,0,200,0,0,75,142,0,201,
+0,0,75,224,0,202,0,0,76,8,0,0,0,0,76,45,
+0,1,0,0,76,51,0,2,0,0,76,77,0,3,0,0,
+76,102,0,4,0,0,76,121,0,5,0,0,76,143,0,6,
+0,0,76,193,0,1,0,0,76,238,0,2,0,0,77,12,
+0,3,0,0,77,46,0,4,0,0,77,70,0,5,0,0,
+77,98,0,1,0,0,77,135,0,2,0,0,77,138,0,3,
+0,0,77,145,0,4,0,0,77,149,0,5,0,0,77,152,
+0,6,0,0,77,157,0,7,0,0,77,168,0,8,0,0,
+77,174,0,9,0,0,77,198,0,10,0,0,77,211,0,11,
+0,0,77,221,0,12,0,0,77,231,0,13,0,0,77,248,
+0,14,0,0,77,253,0,15,0,0,78,6,0,16,0,0,
+78,15,0,17,0,0,78,24,0,18,0,0,78,39,0,19,
+0,0,78,57,0,20,0,0,78,107,0,21,0,0,78,132,
+0,22,0,0,78,144,0,23,0,0,78,150,0,24,0,0,
+78,157,0,25,0,0,78,162,0,26,0,0,78,172,0,27,
+0,0,78,179,80,114,101,118,105,101,119,0,78,97,109,101,
+0,87,105,100,116,104,0,72,101,105,103,104,116,0,82,101,
+115,111,108,117,116,105,111,110,0,73,109,97,103,101,32,98,
+105,116,115,0,68,101,110,115,105,116,121,0,67,111,108,111,
+114,0,84,121,112,101,0,66,108,101,110,100,32,109,111,100,
+101,0,79,112,97,99,105,116,121,0,84,101,120,116,117,114,
+101,0,65,110,103,108,101,0,66,97,99,107,103,114,111,117,
+110,100,32,99,111,108,111,114,0,83,105,122,101,0,85,110,
+105,116,0,84,101,109,112,108,97,116,101,0,65,110,116,105,
+45,97,108,105,97,115,105,110,103,0,80,105,120,101,108,32,
+109,111,100,101,0,99,105,114,99,108,101,0,99,105,114,99,
+108,101,32,102,114,97,109,101,0,114,101,99,116,97,110,103,
+108,101,0,114,101,99,116,97,110,103,108,101,32,102,114,97,
+109,101,0,100,105,97,109,111,110,100,0,100,105,97,109,111,
+110,100,32,102,114,97,109,101,0,88,32,109,97,114,107,0,
+99,114,111,115,115,0,103,108,105,116,116,101,114,0,0,82,
+101,115,101,116,0,65,100,100,0,68,101,108,101,116,101,0,
+85,112,0,68,111,119,110,0,82,101,110,97,109,101,0,68,
+117,112,108,105,99,97,116,101,0,69,100,105,116,0,79,112,
+101,110,0,83,97,118,101,0,77,111,118,101,0,91,83,104,
+105,102,116,58,32,66,114,117,115,104,32,115,105,122,101,32,
+99,104,97,110,103,101,93,32,91,67,116,114,108,58,32,82,
+117,108,101,114,32,115,101,116,116,105,110,103,93,32,91,65,
+108,116,58,32,67,111,108,111,114,32,80,105,99,107,101,114,
+40,99,97,110,118,97,115,41,93,0,91,83,104,105,102,116,
+58,32,49,112,120,32,101,114,97,115,101,114,93,32,91,67,
 116,114,108,58,32,82,117,108,101,114,32,115,101,116,116,105,
 110,103,93,32,91,65,108,116,58,32,67,111,108,111,114,32,
 80,105,99,107,101,114,40,99,97,110,118,97,115,41,93,0,
-91,83,104,105,102,116,58,32,49,112,120,32,101,114,97,115,
-101,114,93,32,91,67,116,114,108,58,32,82,117,108,101,114,
-32,115,101,116,116,105,110,103,93,32,91,65,108,116,58,32,
-67,111,108,111,114,32,80,105,99,107,101,114,40,99,97,110,
-118,97,115,41,93,0,91,67,116,114,108,58,32,82,117,108,
-101,114,32,115,101,116,116,105,110,103,93,32,91,65,108,116,
-58,32,67,111,108,111,114,32,80,105,99,107,101,114,40,99,
-97,110,118,97,115,41,93,0,91,83,104,105,102,116,58,32,
-72,111,114,105,122,111,110,116,97,108,93,32,91,67,116,114,
-108,58,32,86,101,114,116,105,99,97,108,93,0,91,43,67,
-116,114,108,32,119,104,101,110,32,112,114,101,115,115,101,100,
-58,32,82,97,110,103,101,32,100,101,108,101,116,105,111,110,
-93,0,91,67,116,114,108,58,32,72,105,100,101,32,115,101,
-108,101,99,116,105,111,110,32,119,104,105,108,101,32,100,114,
-97,103,103,105,110,103,93,0,91,73,102,32,116,104,101,114,
-101,32,105,115,32,97,110,32,105,109,97,103,101,44,32,99,
-108,105,99,107,32,116,111,32,112,97,115,116,101,93,32,91,
-67,116,114,108,58,32,67,108,101,97,114,32,116,104,101,32,
-105,109,97,103,101,32,97,110,100,32,115,116,97,114,116,32,
-115,101,108,101,99,116,105,110,103,93,0,91,67,116,114,108,
-58,32,71,101,116,32,116,104,101,32,99,111,108,111,114,32,
-111,110,32,116,104,101,32,108,97,121,101,114,93,32,91,83,
-104,105,102,116,58,32,70,105,114,115,116,32,115,101,116,32,
-111,102,32,99,111,108,111,114,32,109,97,115,107,115,93,0,
-91,83,104,105,102,116,58,32,52,53,32,100,101,103,114,101,
-101,32,117,110,105,116,93,0,91,83,104,105,102,116,58,32,
-115,113,117,97,114,101,93,0,91,83,104,105,102,116,58,32,
-99,105,114,99,108,101,93,32,91,67,116,114,108,58,32,114,
-101,99,116,97,110,103,108,101,93,0,91,83,104,105,102,116,
+91,67,116,114,108,58,32,82,117,108,101,114,32,115,101,116,
+116,105,110,103,93,32,91,65,108,116,58,32,67,111,108,111,
+114,32,80,105,99,107,101,114,40,99,97,110,118,97,115,41,
+93,0,91,83,104,105,102,116,58,32,72,111,114,105,122,111,
+110,116,97,108,93,32,91,67,116,114,108,58,32,86,101,114,
+116,105,99,97,108,93,0,91,43,67,116,114,108,32,119,104,
+101,110,32,112,114,101,115,115,101,100,58,32,82,97,110,103,
+101,32,100,101,108,101,116,105,111,110,93,0,91,67,116,114,
+108,58,32,72,105,100,101,32,115,101,108,101,99,116,105,111,
+110,32,119,104,105,108,101,32,100,114,97,103,103,105,110,103,
+93,0,91,73,102,32,116,104,101,114,101,32,105,115,32,97,
+110,32,105,109,97,103,101,44,32,99,108,105,99,107,32,116,
+111,32,112,97,115,116,101,93,32,91,67,116,114,108,58,32,
+67,108,101,97,114,32,116,104,101,32,105,109,97,103,101,32,
+97,110,100,32,115,116,97,114,116,32,115,101,108,101,99,116,
+105,110,103,93,0,91,67,116,114,108,58,32,71,101,116,32,
+116,104,101,32,99,111,108,111,114,32,111,110,32,116,104,101,
+32,108,97,121,101,114,93,32,91,83,104,105,102,116,58,32,
+70,105,114,115,116,32,115,101,116,32,111,102,32,99,111,108,
+111,114,32,109,97,115,107,115,93,0,91,83,104,105,102,116,
 58,32,52,53,32,100,101,103,114,101,101,32,117,110,105,116,
-93,32,91,82,105,103,104,116,47,76,101,102,116,32,68,66,
-76,67,76,75,47,69,110,116,101,114,47,69,83,67,58,32,
-102,105,110,105,115,104,93,32,91,66,97,99,107,83,112,97,
-99,101,58,32,67,111,110,110,101,99,116,32,119,105,116,104,
-32,116,104,101,32,115,116,97,114,116,32,112,111,105,110,116,
-32,97,110,100,32,101,110,100,93,0,91,83,104,105,102,116,
-58,32,52,53,32,100,101,103,114,101,101,32,117,110,105,116,
-93,32,91,82,105,103,104,116,47,76,101,102,116,32,68,66,
-76,67,76,75,47,69,110,116,101,114,58,32,102,105,110,105,
-115,104,93,32,91,69,83,67,58,32,99,97,110,99,101,108,
-93,0,91,83,104,105,102,116,58,32,52,53,32,100,101,103,
-114,101,101,32,117,110,105,116,93,32,91,82,105,103,104,116,
-47,69,83,67,58,32,99,97,110,99,101,108,93,32,91,66,
-97,99,107,83,112,97,99,101,58,32,82,101,116,117,114,110,
-32,116,111,32,99,111,110,116,114,111,108,32,112,111,105,110,
-116,32,49,93,0,91,83,104,105,102,116,58,32,52,53,32,
-100,101,103,114,101,101,32,117,110,105,116,93,32,91,82,105,
-103,104,116,47,76,101,102,116,32,68,66,76,67,76,75,47,
-69,110,116,101,114,58,32,100,114,97,119,93,32,91,69,83,
-67,58,32,99,97,110,99,101,108,93,0,78,101,119,0,79,
-112,101,110,0,79,112,101,110,32,114,101,99,101,110,116,108,
-121,32,117,115,101,100,32,102,105,108,101,115,0,79,118,101,
-114,119,114,105,116,101,0,83,97,118,101,32,97,115,0,83,
-97,118,101,32,100,117,112,108,105,99,97,116,101,0,85,110,
-100,111,0,82,101,100,111,0,67,108,101,97,114,32,108,97,
-121,101,114,0,82,101,108,101,97,115,101,32,115,101,108,101,
-99,116,105,111,110,0,83,104,111,119,32,112,97,110,101,108,
-115,0,70,108,105,112,32,99,97,110,118,97,115,32,104,111,
-114,105,122,111,110,116,97,108,108,121,0,83,104,111,119,32,
-98,97,99,107,103,114,111,117,110,100,32,97,115,32,112,108,
-97,105,100,32,112,97,116,116,101,114,110,0,83,104,111,119,
-32,103,114,105,100,0,83,104,111,119,32,100,105,118,105,100,
-105,110,103,32,108,105,110,101,0,71,114,105,100,32,115,101,
-116,116,105,110,103,115,0,70,105,108,116,101,114,32,108,105,
-115,116,32,112,97,110,101,108,0,90,111,111,109,0,84,111,
-111,108,0,84,111,111,108,32,108,105,115,116,0,66,114,117,
-115,104,32,115,101,116,116,105,110,103,115,0,79,112,116,105,
-111,110,0,76,97,121,101,114,0,67,111,108,111,114,0,67,
-111,108,111,114,32,119,104,101,101,108,0,67,111,108,111,114,
-32,112,97,108,101,116,116,101,0,67,97,110,118,97,115,32,
-99,111,110,116,114,111,108,0,67,97,110,118,97,115,32,118,
-105,101,119,0,73,109,97,103,101,32,118,105,101,119,101,114,
-0,70,105,108,116,101,114,32,108,105,115,116,0,67,111,108,
-111,114,0,71,114,97,121,115,99,97,108,101,0,65,108,112,
-104,97,32,118,97,108,117,101,0,65,108,112,104,97,32,118,
-97,108,117,101,40,49,98,105,116,41,0,70,111,108,100,101,
-114,0,84,111,110,101,32,108,97,121,101,114,58,71,114,97,
-121,115,99,97,108,101,0,84,111,110,101,32,108,97,121,101,
-114,58,65,108,112,104,97,32,118,97,108,117,101,40,49,98,
-105,116,41,0,84,101,120,116,32,108,97,121,101,114,58,65,
-108,112,104,97,32,118,97,108,117,101,0,84,101,120,116,32,
-108,97,121,101,114,58,65,108,112,104,97,32,118,97,108,117,
-101,40,49,98,105,116,41,0,110,111,114,109,97,108,0,109,
-117,108,116,105,112,108,105,99,97,116,105,111,110,0,97,100,
-100,105,116,105,111,110,0,115,117,98,116,114,97,99,116,105,
-111,110,0,115,99,114,101,101,110,0,111,118,101,114,108,97,
-121,0,104,97,114,100,32,108,105,103,104,116,0,115,111,102,
-116,32,108,105,103,104,116,0,100,111,100,103,101,0,98,117,
-114,110,0,108,105,110,101,97,114,32,98,117,114,110,0,118,
-105,118,105,100,32,108,105,103,104,116,0,108,105,110,101,97,
-114,32,108,105,103,104,116,0,112,105,110,32,108,105,103,104,
-116,0,100,105,109,0,98,114,105,103,104,116,101,110,0,100,
-105,102,102,101,114,101,110,99,101,0,108,117,109,105,110,111,
-117,115,40,97,100,100,41,0,108,117,109,105,110,111,117,115,
-40,100,111,100,103,101,41,0,84,111,111,108,32,108,105,115,
-116,0,68,111,116,32,108,105,110,101,0,68,111,116,32,101,
-114,97,115,101,114,0,70,105,110,103,101,114,0,83,104,97,
-112,101,100,32,102,105,108,108,0,83,104,97,112,101,100,32,
-101,114,97,115,101,114,0,70,105,108,108,0,79,112,97,113,
-117,101,32,97,114,101,97,32,99,108,101,97,114,0,71,114,
-97,100,105,101,110,116,0,84,101,120,116,0,77,111,118,101,
-0,77,97,103,105,99,32,119,97,110,100,0,83,101,108,101,
-99,116,105,111,110,0,67,117,116,32,97,110,100,32,112,97,
-115,116,101,0,82,101,99,116,97,110,103,108,101,32,101,100,
-105,116,105,110,103,0,83,116,97,109,112,0,77,111,118,101,
-32,99,97,110,118,97,115,0,82,111,116,97,116,101,32,99,
-97,110,118,97,115,0,67,111,108,111,114,32,112,105,99,107,
-101,114,0,70,114,101,101,32,104,97,110,100,0,76,105,110,
-101,0,82,101,99,116,97,110,103,108,101,0,67,105,114,99,
-108,101,0,67,111,110,116,105,110,117,111,117,115,32,115,116,
-114,97,105,103,104,116,32,108,105,110,101,0,67,111,110,99,
-101,110,116,114,97,116,101,100,32,108,105,110,101,0,66,101,
-122,105,101,114,32,99,117,114,118,101,0,108,105,110,101,97,
-114,0,82,111,117,110,100,0,82,101,99,116,97,110,103,108,
-101,0,82,97,100,105,97,108,0,67,117,114,114,101,110,116,
-32,108,97,121,101,114,0,71,114,97,98,98,101,100,32,108,
-97,121,101,114,0,67,104,101,99,107,101,100,32,108,97,121,
-101,114,115,0,65,108,108,32,108,97,121,101,114,115,0,67,
-111,108,111,114,32,111,110,32,99,97,110,118,97,115,0,67,
-111,108,111,114,32,111,110,32,116,104,101,32,99,117,114,114,
-101,110,116,32,108,97,121,101,114,0,67,114,101,97,116,101,
-32,110,101,117,116,114,97,108,32,99,111,108,111,114,32,40,
-99,108,105,99,107,32,50,32,112,111,105,110,116,115,41,0,
-82,101,112,108,97,99,101,32,116,104,101,32,99,111,108,111,
-114,32,97,99,113,117,105,114,101,100,32,111,110,32,116,104,
-101,32,108,97,121,101,114,32,119,105,116,104,32,116,104,101,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,0,82,
-101,112,108,97,99,101,32,116,104,101,32,99,111,108,111,114,
-32,97,99,113,117,105,114,101,100,32,111,110,32,116,104,101,
-32,108,97,121,101,114,32,119,105,116,104,32,116,114,97,110,
-115,112,97,114,101,110,116,0,80,111,108,121,103,111,110,0,
-77,111,118,101,32,105,109,97,103,101,0,67,111,112,121,32,
-105,109,97,103,101,0,77,111,118,101,32,115,101,108,101,99,
-116,105,111,110,0,67,111,112,121,0,67,117,116,0,80,97,
-115,116,101,0,80,97,115,116,101,32,102,114,111,109,32,105,
-109,97,103,101,0,70,108,105,112,32,104,111,114,105,122,111,
-110,116,97,108,0,102,108,105,112,32,117,112,115,105,100,101,
-32,100,111,119,110,0,82,111,116,97,116,101,32,57,48,32,
-100,101,103,114,101,101,115,32,116,111,32,116,104,101,32,108,
-101,102,116,0,82,111,116,97,116,101,32,57,48,32,100,101,
-103,114,101,101,115,32,116,111,32,116,104,101,32,114,105,103,
-104,116,0,84,114,97,110,115,102,111,114,109,97,116,105,111,
-110,0,84,114,105,109,109,105,110,103,0,80,105,120,101,108,
-32,111,118,101,114,108,97,112,0,83,116,114,111,107,101,32,
-111,118,101,114,108,97,112,0,65,108,112,104,97,32,99,111,
-109,112,97,114,105,115,111,110,32,111,118,101,114,119,114,105,
-116,101,0,83,104,97,112,101,32,111,118,101,114,119,114,105,
-116,101,0,82,101,99,116,97,110,103,108,101,32,111,118,101,
-114,119,114,105,116,101,0,68,111,100,103,101,0,66,117,114,
-110,0,65,100,100,105,116,105,111,110,0,69,114,97,115,101,
-114,0,80,105,120,101,108,32,111,118,101,114,108,97,112,0,
-65,108,112,104,97,32,99,111,109,112,97,114,105,115,111,110,
-32,111,118,101,114,119,114,105,116,101,0,79,118,101,114,119,
-114,105,116,101,0,69,114,97,115,101,114,0,100,111,32,110,
-111,116,32,117,115,101,0,80,97,114,97,108,108,101,108,32,
-108,105,110,101,0,80,97,114,97,108,108,101,108,32,108,105,
-110,101,32,40,71,114,105,100,41,0,67,111,110,99,101,110,
-116,114,97,116,101,100,32,108,105,110,101,0,67,111,110,99,
-101,110,116,114,105,99,32,99,105,114,99,108,101,115,32,40,
-67,105,114,99,108,101,41,0,67,111,110,99,101,110,116,114,
-105,99,32,99,105,114,99,108,101,115,32,40,69,108,108,105,
-112,115,101,41,0,76,105,110,101,32,115,121,109,109,101,116,
-114,121,0,83,101,116,116,105,110,103,32,109,111,100,101,32,
-40,111,112,101,114,97,116,101,100,32,111,110,32,99,97,110,
-118,97,115,41,0,78,111,110,101,0,78,111,110,101,40,70,
-111,114,99,101,100,41,0,85,115,101,32,111,112,116,105,111,
-110,97,108,32,116,101,120,116,117,114,101,115,0,85,115,117,
-97,108,108,121,32,99,105,114,99,117,108,97,114,0,73,109,
-97,103,101,32,115,101,108,101,99,116,105,111,110,0,84,101,
-120,116,117,114,101,32,105,109,97,103,101,32,115,101,108,101,
-99,116,105,111,110,0,78,101,119,32,116,101,120,116,40,38,
-78,41,0,69,100,105,116,40,38,84,41,0,68,101,108,101,
-116,101,40,38,76,41,0,67,111,112,121,40,38,67,41,0,
-80,97,115,116,101,40,38,80,41,0,82,101,100,114,97,119,
-32,101,118,101,114,121,116,104,105,110,103,40,38,82,41,0,
-69,100,105,116,32,116,104,105,115,32,116,101,120,116,40,38,
-69,41,0,68,101,108,101,116,101,32,116,104,105,115,32,116,
-101,120,116,40,38,68,41,0,83,97,118,101,32,102,111,114,
-109,97,116,0,83,97,109,101,32,102,111,114,109,97,116,32,
-97,115,32,116,104,101,32,99,117,114,114,101,110,116,32,102,
-105,108,101,0,79,112,101,110,40,38,79,41,46,46,46,0,
-80,114,101,118,105,111,117,115,32,102,105,108,101,40,38,80,
-41,0,78,101,120,116,32,102,105,108,101,40,38,78,41,0,
-67,108,101,97,114,40,38,67,41,0,70,117,108,108,32,118,
-105,101,119,40,38,70,41,0,77,105,114,114,111,114,40,38,
-72,41,0,83,101,116,116,105,110,103,40,38,83,41,46,46,
-46,0,77,101,110,117,0,79,112,101,110,0,80,114,101,118,
-105,111,117,115,32,102,105,108,101,0,78,101,120,116,32,102,
-105,108,101,0,90,111,111,109,0,70,117,108,108,32,118,105,
-101,119,0,77,105,114,114,111,114,0,83,101,116,32,116,111,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,0,83,
-101,116,32,116,111,32,98,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,78,117,109,101,114,105,99,97,108,
-32,105,110,112,117,116,0,82,71,66,32,115,112,101,99,105,
-102,105,99,97,116,105,111,110,58,32,50,53,53,44,48,44,
-49,50,56,32,40,83,101,112,97,114,97,116,101,32,119,105,
-116,104,32,110,111,110,45,110,117,109,101,114,105,99,32,99,
-104,97,114,97,99,116,101,114,115,41,10,72,84,77,76,32,
-99,111,108,111,114,32,115,112,101,99,105,102,105,99,97,116,
-105,111,110,58,32,35,102,102,48,48,56,48,32,40,54,32,
-100,105,103,105,116,32,111,110,108,121,41,0,83,101,116,32,
-100,114,97,119,105,110,103,32,99,111,108,111,114,40,38,83,
-41,32,91,76,66,84,84,93,0,79,78,47,79,70,70,32,
-115,119,105,116,99,104,105,110,103,40,38,84,41,32,91,67,
-116,114,108,43,76,66,84,84,93,0,71,101,116,32,99,111,
-108,111,114,40,38,80,41,32,91,83,104,105,102,116,43,76,
-66,84,84,93,0,72,83,86,40,84,114,105,97,110,103,108,
-101,41,0,72,83,86,40,82,101,99,116,97,110,103,108,101,
-41,0,80,97,108,101,116,116,101,32,108,105,115,116,40,38,
-76,41,46,46,46,0,83,101,116,116,105,110,103,40,38,79,
-41,46,46,46,0,69,100,105,116,40,38,69,41,0,70,105,
-108,101,40,38,70,41,0,72,101,108,112,40,38,72,41,0,
-80,97,108,101,116,116,101,32,101,100,105,116,105,110,103,40,
-38,69,41,46,46,46,0,77,97,107,101,32,97,108,108,32,
-100,114,97,119,105,110,103,32,99,111,108,111,114,115,40,38,
-87,41,0,82,101,97,100,32,102,114,111,109,32,102,105,108,
-101,40,38,76,41,46,46,46,0,65,100,100,105,116,105,111,
-110,97,108,32,114,101,97,100,105,110,103,32,102,114,111,109,
-32,102,105,108,101,40,38,65,41,46,46,46,0,71,101,116,
-32,112,97,108,101,116,116,101,32,102,114,111,109,32,105,109,
-97,103,101,32,99,111,108,111,114,40,38,73,41,46,46,46,
-0,83,97,118,101,32,116,111,32,102,105,108,101,40,38,83,
-41,46,46,46,0,71,114,97,100,97,116,105,111,110,32,115,
-101,116,116,105,110,103,115,40,38,79,41,0,67,111,108,111,
-114,32,80,97,108,101,116,116,101,0,67,111,109,112,97,99,
-116,32,109,111,100,101,40,38,67,41,0,80,97,108,101,116,
-116,101,40,38,80,41,0,72,83,76,40,38,83,41,0,71,
-114,97,100,97,116,105,111,110,40,38,77,41,0,77,97,107,
-101,32,97,108,108,32,100,114,97,119,105,110,103,32,99,111,
-108,111,114,115,46,10,65,114,101,32,121,111,117,32,115,117,
-114,101,63,0,83,101,116,116,105,110,103,115,32,102,111,114,
-32,101,97,99,104,32,98,97,114,0,78,117,109,98,101,114,
-32,111,102,32,115,116,97,103,101,115,0,51,126,54,52,46,
-32,78,111,32,115,116,101,112,115,32,97,116,32,48,46,0,
-80,97,108,101,116,116,101,32,108,105,115,116,0,83,101,116,
-32,100,114,97,119,105,110,103,32,99,111,108,111,114,40,38,
-83,41,0,71,101,116,32,116,104,105,115,32,99,111,108,111,
-114,40,38,71,41,0,80,97,108,101,116,116,101,32,115,101,
-116,116,105,110,103,115,0,78,117,109,98,101,114,32,111,102,
-32,99,111,108,111,114,115,0,84,104,101,32,119,105,100,116,
-104,32,111,102,32,111,110,101,32,99,111,108,111,114,0,84,
-104,101,32,104,101,105,103,104,116,32,111,102,32,111,110,101,
-32,99,111,108,111,114,0,77,97,120,105,109,117,109,32,110,
-117,109,98,101,114,32,111,102,32,104,111,114,105,122,111,110,
-116,97,108,32,100,105,115,112,108,97,121,115,10,40,48,32,
-116,111,32,109,97,116,99,104,32,116,104,101,32,119,105,100,
-116,104,41,0,80,97,108,101,116,116,101,32,101,100,105,116,
-105,110,103,0,82,71,66,32,105,110,112,117,116,0,34,82,
-44,71,44,66,34,32,111,114,32,34,35,82,82,71,71,66,
-66,34,46,10,83,101,116,32,119,105,116,104,32,69,110,116,
-101,114,46,0,83,104,105,102,116,43,76,32,111,114,32,82,
-105,103,104,116,32,99,108,105,99,107,58,32,83,101,108,101,
-99,116,32,102,114,111,109,32,116,104,101,32,99,117,114,114,
-101,110,116,32,112,111,115,105,116,105,111,110,32,116,111,32,
-116,104,101,32,112,114,101,115,115,101,100,32,112,111,115,105,
-116,105,111,110,10,68,38,68,58,32,77,111,118,101,32,116,
-104,101,32,99,111,108,111,114,32,111,102,32,116,104,101,32,
-115,101,108,101,99,116,105,111,110,32,116,111,32,116,104,101,
-32,115,112,101,99,105,102,105,101,100,32,112,111,115,105,116,
-105,111,110,0,78,117,109,98,101,114,32,111,102,32,97,100,
-100,105,116,105,111,110,115,32,47,32,105,110,115,101,114,116,
-105,111,110,115,0,82,101,109,111,118,101,32,114,97,110,103,
-101,32,99,111,108,111,114,0,71,114,97,100,97,116,105,111,
-110,32,98,101,116,119,101,101,110,32,114,97,110,103,101,115,
-0,65,100,100,32,116,104,101,32,115,112,101,99,105,102,105,
-101,100,32,110,117,109,98,101,114,32,116,111,32,116,104,101,
-32,101,110,100,0,73,110,115,101,114,116,32,116,104,101,32,
-115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,
-32,97,116,32,116,104,101,32,99,117,114,114,101,110,116,32,
-112,111,115,105,116,105,111,110,0,90,111,111,109,40,38,90,
-41,0,70,117,108,108,32,118,105,101,119,40,38,70,41,0,
-77,105,114,114,111,114,40,38,72,41,0,84,111,111,108,98,
-97,114,32,105,115,32,97,108,119,97,121,115,32,118,105,115,
-105,98,108,101,40,38,84,41,0,83,101,116,116,105,110,103,
-40,38,79,41,46,46,46,0,77,101,110,117,0,90,111,111,
-109,0,70,117,108,108,32,118,105,101,119,0,77,105,114,114,
-111,114,0,70,105,108,108,32,114,101,102,101,114,101,110,99,
-101,0,68,114,97,119,105,110,103,32,108,111,99,107,0,67,
-104,101,99,107,0,71,114,97,121,115,99,97,108,101,32,100,
-105,115,112,108,97,121,32,111,102,32,97,108,108,32,116,111,
-110,101,32,108,97,121,101,114,115,0,78,111,32,97,108,112,
-104,97,32,109,97,115,107,0,75,101,101,112,32,97,108,112,
-104,97,32,118,97,108,117,101,0,84,114,97,110,115,112,97,
-114,101,110,116,32,99,111,108,111,114,32,112,114,111,116,101,
-99,116,105,111,110,0,79,112,97,99,105,116,121,32,99,111,
-108,111,114,32,112,114,111,116,101,99,116,105,111,110,0,78,
-101,119,0,68,117,112,108,105,99,97,116,101,0,67,108,101,
-97,114,32,116,104,101,32,105,109,97,103,101,0,68,101,108,
-101,116,101,0,67,111,109,98,105,110,101,32,116,111,32,108,
-111,119,101,114,32,108,97,121,101,114,0,68,114,111,112,32,
-116,111,32,108,111,119,101,114,32,108,97,121,101,114,0,85,
-112,0,68,111,119,110,0,72,101,108,112,40,38,72,41,0,
-84,111,111,108,32,111,112,116,105,111,110,0,82,117,108,101,
-114,0,84,101,120,116,117,114,101,0,73,110,47,79,117,116,
-32,111,102,32,108,105,110,101,0,76,111,97,100,0,83,97,
-118,101,0,76,105,110,101,0,66,101,122,105,101,114,32,99,
-117,114,118,101,0,73,110,0,79,117,116,0,84,104,105,110,
-32,108,105,110,101,0,83,104,97,112,101,0,83,116,114,101,
-110,103,116,104,0,65,114,101,97,32,116,111,32,102,105,108,
-108,0,83,97,109,101,32,99,111,108,111,114,32,111,110,32,
-108,97,121,101,114,32,91,33,79,110,108,121,32,111,110,101,
-32,114,101,102,101,114,101,110,99,101,32,108,97,121,101,114,
-93,0,84,114,97,110,115,112,97,114,101,110,116,32,97,114,
-101,97,32,40,97,110,116,105,45,97,108,105,97,115,32,97,
-117,116,111,109,97,116,105,99,32,106,117,100,103,109,101,110,
-116,41,0,84,114,97,110,115,112,97,114,101,110,116,32,97,
-114,101,97,32,40,65,32,61,32,48,41,0,84,104,101,32,
-115,97,109,101,32,97,114,101,97,32,111,102,32,97,108,112,
-104,97,32,118,97,108,117,101,115,0,83,97,109,101,32,99,
-111,108,111,114,32,111,110,32,99,97,110,118,97,115,0,0,
-97,108,108,111,119,97,98,108,101,32,101,114,114,111,114,0,
-76,97,121,101,114,32,116,104,97,116,32,114,101,102,101,114,
-101,110,99,101,115,32,97,32,99,111,108,111,114,0,70,105,
-108,108,32,114,101,102,101,114,101,110,99,101,32,108,97,121,
-101,114,0,67,117,114,114,101,110,116,32,108,97,121,101,114,
-0,65,108,108,32,100,105,115,112,108,97,121,32,108,97,121,
-101,114,115,0,0,68,114,97,119,105,110,103,32,99,111,108,
-111,114,45,62,98,97,99,107,103,114,111,117,110,100,32,99,
-111,108,111,114,0,66,108,97,99,107,32,45,62,32,87,104,
-105,116,101,0,87,104,105,116,101,32,45,62,32,66,108,97,
-99,107,0,67,117,115,116,111,109,0,0,82,101,118,101,114,
-115,101,0,82,101,112,101,97,116,0,72,105,100,101,32,102,
-114,97,109,101,32,119,104,105,108,101,32,109,111,118,105,110,
-103,0,76,111,97,100,0,67,108,101,97,114,0,84,114,97,
-110,115,102,111,114,109,97,116,105,111,110,0,78,111,110,101,
-0,70,108,105,112,32,104,111,114,122,0,70,108,105,112,32,
-118,101,114,116,0,82,97,110,100,111,109,32,102,108,105,112,
-32,104,111,114,122,0,82,97,110,100,111,109,32,102,108,105,
-112,32,118,101,114,116,0,82,97,110,100,111,109,32,114,111,
-116,97,116,105,111,110,0,0,79,118,101,114,119,114,105,116,
-101,32,112,97,115,116,101,0,65,112,112,108,121,32,109,97,
-115,107,115,32,119,104,101,110,32,112,97,115,116,105,110,103,
-0,69,110,108,97,114,103,101,109,101,110,116,32,40,110,111,
-32,105,110,116,101,114,112,111,108,97,116,105,111,110,41,0,
-65,114,114,97,110,103,101,32,105,110,32,116,105,108,101,115,
-32,40,102,117,108,108,41,0,65,114,114,97,110,103,101,32,
-105,110,32,116,105,108,101,115,32,40,104,111,114,105,122,111,
-110,116,97,108,32,114,111,119,41,0,65,114,114,97,110,103,
-101,32,105,110,32,116,105,108,101,115,32,40,118,101,114,116,
-105,99,97,108,32,114,111,119,41,0,0,82,117,110,0,71,
-114,97,100,105,101,110,116,32,101,100,105,116,105,110,103,40,
-38,69,41,46,46,46,0,78,101,119,40,38,78,41,46,46,
-46,0,69,100,105,116,32,108,105,115,116,40,38,76,41,46,
-46,46,0,79,112,101,110,40,38,79,41,46,46,46,0,83,
-97,118,101,40,38,83,41,46,46,46,0,78,101,119,32,103,
-114,111,117,112,40,38,71,41,46,46,46,0,69,100,105,116,
-40,38,69,41,46,46,46,0,73,110,115,101,114,116,32,103,
-114,111,117,112,40,38,78,41,46,46,46,0,68,101,108,101,
-116,101,32,103,114,111,117,112,40,38,68,41,0,73,110,115,
-101,114,116,32,110,101,119,32,98,114,117,115,104,40,38,66,
-41,46,46,46,0,73,110,115,101,114,116,32,99,117,114,114,
-101,110,116,32,116,111,111,108,40,38,84,41,0,67,111,112,
-121,40,38,67,41,0,80,97,115,116,101,40,38,80,41,0,
-83,101,116,116,105,110,103,40,38,79,41,46,46,46,0,84,
-111,111,108,40,38,76,41,0,68,101,108,101,116,101,40,38,
-68,41,0,82,101,103,105,115,116,114,97,116,105,111,110,40,
-38,82,41,0,79,118,101,114,114,105,100,101,32,116,111,111,
-108,32,111,112,116,105,111,110,32,118,97,108,117,101,115,40,
-38,79,41,0,68,105,115,112,108,97,121,32,115,101,116,32,
-118,97,108,117,101,40,38,86,41,0,85,110,115,112,101,99,
-105,102,105,101,100,0,82,101,108,101,97,115,101,32,97,108,
-108,0,65,100,100,40,38,65,41,0,68,101,108,101,116,101,
-40,38,68,41,32,91,83,104,105,102,116,43,76,66,84,84,
-93,0,65,100,100,32,115,105,122,101,115,0,80,108,101,97,
-115,101,32,101,110,116,101,114,32,116,104,101,32,98,114,117,
-115,104,32,115,105,122,101,46,10,89,111,117,32,99,97,110,
-32,115,112,101,99,105,102,121,32,109,111,114,101,32,116,104,
-97,110,32,111,110,101,32,98,121,32,115,101,112,97,114,97,
-116,105,110,103,32,116,104,101,109,10,119,105,116,104,32,99,
-104,97,114,97,99,116,101,114,115,32,111,116,104,101,114,32,
-116,104,97,110,32,110,117,109,98,101,114,115,32,97,110,100,
-32,39,46,39,46,10,91,69,120,97,109,112,108,101,93,32,
-49,46,48,44,49,48,46,50,59,53,48,0,65,108,119,97,
-121,115,32,115,97,118,101,0,78,111,114,109,97,108,0,69,
-114,97,115,101,114,0,87,97,116,101,114,0,66,108,117,114,
-0,0,83,105,122,101,32,40,100,105,97,109,101,116,101,114,
-41,0,76,105,110,101,32,99,111,114,114,101,99,116,105,111,
-110,0,78,111,110,101,0,65,118,101,114,97,103,101,40,115,
-116,114,111,110,103,41,0,65,118,101,114,97,103,101,40,109,
-101,100,105,117,109,41,0,65,118,101,114,97,103,101,40,119,
-101,97,107,41,0,70,105,120,101,100,32,100,105,115,116,97,
-110,99,101,0,0,80,111,105,110,116,32,105,110,116,101,114,
-118,97,108,32,40,49,46,48,32,61,32,114,97,100,105,117,
-115,41,0,82,97,110,100,111,109,32,119,105,100,116,104,32,
-111,102,32,98,114,117,115,104,32,115,105,122,101,40,37,41,
-0,82,97,110,100,111,109,32,119,105,100,116,104,32,111,102,
-32,112,111,105,110,116,32,112,111,115,105,116,105,111,110,0,
-67,117,114,118,101,32,105,110,116,101,114,112,111,108,97,116,
-105,111,110,0,87,97,116,101,114,0,65,109,111,117,110,116,
-32,111,102,32,100,114,97,119,105,110,103,32,99,111,108,111,
-114,0,65,109,111,117,110,116,32,116,111,32,101,120,116,101,
-110,100,0,84,114,101,97,116,32,116,104,101,32,98,97,99,
-107,103,114,111,117,110,100,32,97,115,32,119,104,105,116,101,
-0,80,114,101,115,101,116,0,66,114,117,115,104,32,115,104,
-97,112,101,0,83,104,97,112,101,32,105,109,97,103,101,0,
-72,97,114,100,110,101,115,115,32,119,104,101,110,32,110,111,
-114,109,97,108,108,121,32,114,111,117,110,100,0,83,116,114,
-101,110,103,116,104,32,111,102,32,115,97,110,100,105,110,103,
-0,66,97,115,101,32,97,110,103,108,101,32,111,102,32,114,
-111,116,97,116,105,111,110,0,82,97,110,100,111,109,32,114,
-111,116,97,116,105,111,110,32,119,105,100,116,104,0,82,111,
-116,97,116,101,32,105,110,32,116,104,101,32,100,105,114,101,
-99,116,105,111,110,32,111,102,32,116,114,97,118,101,108,0,
-80,101,110,32,112,114,101,115,115,117,114,101,0,83,105,122,
-101,32,119,104,101,110,32,48,32,112,114,101,115,115,117,114,
-101,40,37,41,0,68,101,110,115,105,116,121,32,119,104,101,
-110,32,48,32,112,114,101,115,115,117,114,101,40,37,41,0,
-80,114,101,115,115,117,114,101,32,99,117,114,118,101,32,101,
-100,105,116,105,110,103,0,85,115,101,32,97,32,99,111,109,
-109,111,110,32,112,114,101,115,115,117,114,101,32,99,117,114,
-118,101,0,86,97,114,105,111,117,115,0,82,101,103,105,115,
-116,101,114,101,100,32,105,110,32,37,99,0,82,101,115,101,
-116,40,38,82,41,0,69,100,105,116,32,103,114,97,100,105,
-101,110,116,32,108,105,115,116,0,83,112,101,99,105,102,121,
-105,110,103,32,116,104,101,32,105,109,97,103,101,32,112,111,
-115,105,116,105,111,110,0,83,101,116,116,105,110,103,0,76,
-101,102,116,32,98,117,116,116,111,110,0,67,116,114,108,43,
-76,101,102,116,0,83,104,105,102,116,43,76,101,102,116,0,
-82,105,103,104,116,32,98,117,116,116,111,110,0,77,105,100,
-100,108,101,32,98,117,116,116,111,110,0,83,99,114,111,108,
-108,32,116,104,101,32,118,105,101,119,32,98,121,32,100,114,
-97,103,103,105,110,103,9,83,99,114,111,108,108,32,116,104,
-101,32,99,97,110,118,97,115,32,98,121,32,100,114,97,103,
-103,105,110,103,9,90,111,111,109,32,98,121,32,100,114,97,
-103,103,105,110,103,32,117,112,32,97,110,100,32,100,111,119,
-110,9,77,101,110,117,0,83,99,114,111,108,108,32,98,121,
-32,100,114,97,103,103,105,110,103,9,90,111,111,109,32,98,
-121,32,100,114,97,103,103,105,110,103,32,117,112,32,97,110,
-100,32,100,111,119,110,9,71,101,116,32,99,111,108,111,114,
-40,100,114,97,119,105,110,103,32,99,111,108,111,114,41,9,
-71,101,116,32,99,111,108,111,114,40,98,97,99,107,103,114,
-111,117,110,100,32,99,111,108,111,114,41,9,67,111,108,111,
-114,32,97,99,113,117,105,115,105,116,105,111,110,32,109,101,
-110,117,0,78,101,119,32,99,97,110,118,97,115,0,73,110,
-105,116,105,97,108,32,108,97,121,101,114,0,83,101,116,32,
-97,115,32,115,116,97,114,116,117,112,32,115,105,122,101,0,
-84,104,101,32,109,97,120,105,109,117,109,32,101,100,105,116,
-97,98,108,101,32,112,120,32,115,105,122,101,32,104,97,115,
-32,98,101,101,110,32,101,120,99,101,101,100,101,100,46,0,
-72,105,115,116,111,114,121,0,82,101,103,105,115,116,114,97,
-116,105,111,110,0,82,101,103,117,108,97,116,105,111,110,115,
-0,71,114,105,100,32,115,101,116,116,105,110,103,115,0,71,
-114,105,100,0,68,105,118,105,100,105,110,103,32,108,105,110,
-101,0,78,117,109,98,101,114,32,111,102,32,104,111,114,105,
-122,111,110,116,97,108,32,100,105,118,105,115,105,111,110,115,
-0,78,117,109,98,101,114,32,111,102,32,118,101,114,116,105,
-99,97,108,32,100,105,118,105,115,105,111,110,115,0,83,104,
-111,119,32,49,112,120,32,103,114,105,100,0,37,100,37,37,
-32,111,114,32,109,111,114,101,0,73,103,110,111,114,101,32,
-97,108,112,104,97,32,99,104,97,110,110,101,108,0,78,101,
-119,32,108,97,121,101,114,0,76,97,121,101,114,32,115,101,
-116,116,105,110,103,115,0,76,97,121,101,114,32,99,111,108,
-111,114,32,115,101,108,101,99,116,105,111,110,0,66,97,116,
-99,104,32,99,111,110,118,101,114,115,105,111,110,32,111,102,
-32,110,117,109,98,101,114,32,111,102,32,108,105,110,101,115,
-0,84,101,109,112,108,97,116,101,32,108,105,115,116,32,101,
-100,105,116,0,67,111,109,98,105,110,101,32,109,117,108,116,
-105,112,108,101,32,108,97,121,101,114,115,0,67,104,97,110,
-103,101,32,108,97,121,101,114,32,116,121,112,101,0,84,111,
-110,105,110,103,0,78,117,109,98,101,114,32,111,102,32,108,
-105,110,101,115,0,70,105,120,101,100,32,100,101,110,115,105,
-116,121,0,77,97,107,101,32,116,104,101,32,98,97,99,107,
-103,114,111,117,110,100,32,119,104,105,116,101,0,83,101,116,
-32,102,114,111,109,32,100,114,97,119,105,110,103,32,99,111,
-108,111,114,0,83,101,116,32,116,111,32,100,114,97,119,105,
+93,0,91,83,104,105,102,116,58,32,115,113,117,97,114,101,
+93,0,91,83,104,105,102,116,58,32,99,105,114,99,108,101,
+93,32,91,67,116,114,108,58,32,114,101,99,116,97,110,103,
+108,101,93,0,91,83,104,105,102,116,58,32,52,53,32,100,
+101,103,114,101,101,32,117,110,105,116,93,32,91,82,105,103,
+104,116,47,76,101,102,116,32,68,66,76,67,76,75,47,69,
+110,116,101,114,47,69,83,67,58,32,102,105,110,105,115,104,
+93,32,91,66,97,99,107,83,112,97,99,101,58,32,67,111,
+110,110,101,99,116,32,119,105,116,104,32,116,104,101,32,115,
+116,97,114,116,32,112,111,105,110,116,32,97,110,100,32,101,
+110,100,93,0,91,83,104,105,102,116,58,32,52,53,32,100,
+101,103,114,101,101,32,117,110,105,116,93,32,91,82,105,103,
+104,116,47,76,101,102,116,32,68,66,76,67,76,75,47,69,
+110,116,101,114,58,32,102,105,110,105,115,104,93,32,91,69,
+83,67,58,32,99,97,110,99,101,108,93,0,91,83,104,105,
+102,116,58,32,52,53,32,100,101,103,114,101,101,32,117,110,
+105,116,93,32,91,82,105,103,104,116,47,69,83,67,58,32,
+99,97,110,99,101,108,93,32,91,66,97,99,107,83,112,97,
+99,101,58,32,82,101,116,117,114,110,32,116,111,32,99,111,
+110,116,114,111,108,32,112,111,105,110,116,32,49,93,0,91,
+83,104,105,102,116,58,32,52,53,32,100,101,103,114,101,101,
+32,117,110,105,116,93,32,91,82,105,103,104,116,47,76,101,
+102,116,32,68,66,76,67,76,75,47,69,110,116,101,114,58,
+32,100,114,97,119,93,32,91,69,83,67,58,32,99,97,110,
+99,101,108,93,0,78,101,119,0,79,112,101,110,0,79,112,
+101,110,32,114,101,99,101,110,116,108,121,32,117,115,101,100,
+32,102,105,108,101,115,0,79,118,101,114,119,114,105,116,101,
+0,83,97,118,101,32,97,115,0,83,97,118,101,32,100,117,
+112,108,105,99,97,116,101,0,85,110,100,111,0,82,101,100,
+111,0,67,108,101,97,114,32,108,97,121,101,114,0,82,101,
+108,101,97,115,101,32,115,101,108,101,99,116,105,111,110,0,
+83,104,111,119,32,112,97,110,101,108,115,0,70,108,105,112,
+32,99,97,110,118,97,115,32,104,111,114,105,122,111,110,116,
+97,108,108,121,0,83,104,111,119,32,98,97,99,107,103,114,
+111,117,110,100,32,97,115,32,112,108,97,105,100,32,112,97,
+116,116,101,114,110,0,83,104,111,119,32,103,114,105,100,0,
+83,104,111,119,32,100,105,118,105,100,105,110,103,32,108,105,
+110,101,0,71,114,105,100,32,115,101,116,116,105,110,103,115,
+0,70,105,108,116,101,114,32,108,105,115,116,32,112,97,110,
+101,108,0,90,111,111,109,0,84,111,111,108,0,84,111,111,
+108,32,108,105,115,116,0,66,114,117,115,104,32,115,101,116,
+116,105,110,103,115,0,79,112,116,105,111,110,0,76,97,121,
+101,114,0,67,111,108,111,114,0,67,111,108,111,114,32,119,
+104,101,101,108,0,67,111,108,111,114,32,112,97,108,101,116,
+116,101,0,67,97,110,118,97,115,32,99,111,110,116,114,111,
+108,0,67,97,110,118,97,115,32,118,105,101,119,0,73,109,
+97,103,101,32,118,105,101,119,101,114,0,70,105,108,116,101,
+114,32,108,105,115,116,0,67,111,108,111,114,0,71,114,97,
+121,115,99,97,108,101,0,65,108,112,104,97,32,118,97,108,
+117,101,0,65,108,112,104,97,32,118,97,108,117,101,40,49,
+98,105,116,41,0,70,111,108,100,101,114,0,84,111,110,101,
+32,108,97,121,101,114,58,71,114,97,121,115,99,97,108,101,
+0,84,111,110,101,32,108,97,121,101,114,58,65,108,112,104,
+97,32,118,97,108,117,101,40,49,98,105,116,41,0,84,101,
+120,116,32,108,97,121,101,114,58,65,108,112,104,97,32,118,
+97,108,117,101,0,84,101,120,116,32,108,97,121,101,114,58,
+65,108,112,104,97,32,118,97,108,117,101,40,49,98,105,116,
+41,0,110,111,114,109,97,108,0,109,117,108,116,105,112,108,
+105,99,97,116,105,111,110,0,97,100,100,105,116,105,111,110,
+0,115,117,98,116,114,97,99,116,105,111,110,0,115,99,114,
+101,101,110,0,111,118,101,114,108,97,121,0,104,97,114,100,
+32,108,105,103,104,116,0,115,111,102,116,32,108,105,103,104,
+116,0,100,111,100,103,101,0,98,117,114,110,0,108,105,110,
+101,97,114,32,98,117,114,110,0,118,105,118,105,100,32,108,
+105,103,104,116,0,108,105,110,101,97,114,32,108,105,103,104,
+116,0,112,105,110,32,108,105,103,104,116,0,100,105,109,0,
+98,114,105,103,104,116,101,110,0,100,105,102,102,101,114,101,
+110,99,101,0,108,117,109,105,110,111,117,115,40,97,100,100,
+41,0,108,117,109,105,110,111,117,115,40,100,111,100,103,101,
+41,0,84,111,111,108,32,108,105,115,116,0,68,111,116,32,
+108,105,110,101,0,68,111,116,32,101,114,97,115,101,114,0,
+70,105,110,103,101,114,0,83,104,97,112,101,100,32,102,105,
+108,108,0,83,104,97,112,101,100,32,101,114,97,115,101,114,
+0,70,105,108,108,0,79,112,97,113,117,101,32,97,114,101,
+97,32,99,108,101,97,114,0,71,114,97,100,105,101,110,116,
+0,84,101,120,116,0,77,111,118,101,0,77,97,103,105,99,
+32,119,97,110,100,0,83,101,108,101,99,116,105,111,110,0,
+67,117,116,32,97,110,100,32,112,97,115,116,101,0,82,101,
+99,116,97,110,103,108,101,32,101,100,105,116,105,110,103,0,
+83,116,97,109,112,0,77,111,118,101,32,99,97,110,118,97,
+115,0,82,111,116,97,116,101,32,99,97,110,118,97,115,0,
+67,111,108,111,114,32,112,105,99,107,101,114,0,70,114,101,
+101,32,104,97,110,100,0,76,105,110,101,0,82,101,99,116,
+97,110,103,108,101,0,67,105,114,99,108,101,0,67,111,110,
+116,105,110,117,111,117,115,32,115,116,114,97,105,103,104,116,
+32,108,105,110,101,0,67,111,110,99,101,110,116,114,97,116,
+101,100,32,108,105,110,101,0,66,101,122,105,101,114,32,99,
+117,114,118,101,0,108,105,110,101,97,114,0,82,111,117,110,
+100,0,82,101,99,116,97,110,103,108,101,0,82,97,100,105,
+97,108,0,67,117,114,114,101,110,116,32,108,97,121,101,114,
+0,71,114,97,98,98,101,100,32,108,97,121,101,114,0,67,
+104,101,99,107,101,100,32,108,97,121,101,114,115,0,65,108,
+108,32,108,97,121,101,114,115,0,67,111,108,111,114,32,111,
+110,32,99,97,110,118,97,115,0,67,111,108,111,114,32,111,
+110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,97,
+121,101,114,0,67,114,101,97,116,101,32,110,101,117,116,114,
+97,108,32,99,111,108,111,114,32,40,99,108,105,99,107,32,
+50,32,112,111,105,110,116,115,41,0,82,101,112,108,97,99,
+101,32,116,104,101,32,99,111,108,111,114,32,97,99,113,117,
+105,114,101,100,32,111,110,32,116,104,101,32,108,97,121,101,
+114,32,119,105,116,104,32,116,104,101,32,100,114,97,119,105,
+110,103,32,99,111,108,111,114,0,82,101,112,108,97,99,101,
+32,116,104,101,32,99,111,108,111,114,32,97,99,113,117,105,
+114,101,100,32,111,110,32,116,104,101,32,108,97,121,101,114,
+32,119,105,116,104,32,116,114,97,110,115,112,97,114,101,110,
+116,0,80,111,108,121,103,111,110,0,77,111,118,101,32,105,
+109,97,103,101,0,67,111,112,121,32,105,109,97,103,101,0,
+77,111,118,101,32,115,101,108,101,99,116,105,111,110,0,67,
+111,112,121,0,67,117,116,0,80,97,115,116,101,0,80,97,
+115,116,101,32,102,114,111,109,32,105,109,97,103,101,0,70,
+108,105,112,32,104,111,114,105,122,111,110,116,97,108,0,102,
+108,105,112,32,117,112,115,105,100,101,32,100,111,119,110,0,
+82,111,116,97,116,101,32,57,48,32,100,101,103,114,101,101,
+115,32,116,111,32,116,104,101,32,108,101,102,116,0,82,111,
+116,97,116,101,32,57,48,32,100,101,103,114,101,101,115,32,
+116,111,32,116,104,101,32,114,105,103,104,116,0,84,114,97,
+110,115,102,111,114,109,97,116,105,111,110,0,84,114,105,109,
+109,105,110,103,0,80,105,120,101,108,32,111,118,101,114,108,
+97,112,0,83,116,114,111,107,101,32,111,118,101,114,108,97,
+112,0,65,108,112,104,97,32,99,111,109,112,97,114,105,115,
+111,110,32,111,118,101,114,119,114,105,116,101,0,83,104,97,
+112,101,32,111,118,101,114,119,114,105,116,101,0,82,101,99,
+116,97,110,103,108,101,32,111,118,101,114,119,114,105,116,101,
+0,68,111,100,103,101,0,66,117,114,110,0,65,100,100,105,
+116,105,111,110,0,69,114,97,115,101,114,0,80,105,120,101,
+108,32,111,118,101,114,108,97,112,0,65,108,112,104,97,32,
+99,111,109,112,97,114,105,115,111,110,32,111,118,101,114,119,
+114,105,116,101,0,79,118,101,114,119,114,105,116,101,0,69,
+114,97,115,101,114,0,100,111,32,110,111,116,32,117,115,101,
+0,80,97,114,97,108,108,101,108,32,108,105,110,101,0,80,
+97,114,97,108,108,101,108,32,108,105,110,101,32,40,71,114,
+105,100,41,0,67,111,110,99,101,110,116,114,97,116,101,100,
+32,108,105,110,101,0,67,111,110,99,101,110,116,114,105,99,
+32,99,105,114,99,108,101,115,32,40,67,105,114,99,108,101,
+41,0,67,111,110,99,101,110,116,114,105,99,32,99,105,114,
+99,108,101,115,32,40,69,108,108,105,112,115,101,41,0,76,
+105,110,101,32,115,121,109,109,101,116,114,121,0,83,101,116,
+116,105,110,103,32,109,111,100,101,32,40,111,112,101,114,97,
+116,101,100,32,111,110,32,99,97,110,118,97,115,41,0,78,
+111,110,101,0,78,111,110,101,40,70,111,114,99,101,100,41,
+0,85,115,101,32,111,112,116,105,111,110,97,108,32,116,101,
+120,116,117,114,101,115,0,85,115,117,97,108,108,121,32,99,
+105,114,99,117,108,97,114,0,73,109,97,103,101,32,115,101,
+108,101,99,116,105,111,110,0,84,101,120,116,117,114,101,32,
+105,109,97,103,101,32,115,101,108,101,99,116,105,111,110,0,
+78,101,119,32,116,101,120,116,40,38,78,41,0,69,100,105,
+116,40,38,84,41,0,68,101,108,101,116,101,40,38,76,41,
+0,67,111,112,121,40,38,67,41,0,80,97,115,116,101,40,
+38,80,41,0,82,101,100,114,97,119,32,101,118,101,114,121,
+116,104,105,110,103,40,38,82,41,0,69,100,105,116,32,116,
+104,105,115,32,116,101,120,116,40,38,69,41,0,68,101,108,
+101,116,101,32,116,104,105,115,32,116,101,120,116,40,38,68,
+41,0,83,97,118,101,32,102,111,114,109,97,116,0,83,97,
+109,101,32,102,111,114,109,97,116,32,97,115,32,116,104,101,
+32,99,117,114,114,101,110,116,32,102,105,108,101,0,79,112,
+101,110,40,38,79,41,46,46,46,0,80,114,101,118,105,111,
+117,115,32,102,105,108,101,40,38,80,41,0,78,101,120,116,
+32,102,105,108,101,40,38,78,41,0,67,108,101,97,114,40,
+38,67,41,0,70,117,108,108,32,118,105,101,119,40,38,70,
+41,0,77,105,114,114,111,114,40,38,72,41,0,83,101,116,
+116,105,110,103,40,38,83,41,46,46,46,0,77,101,110,117,
+0,79,112,101,110,0,80,114,101,118,105,111,117,115,32,102,
+105,108,101,0,78,101,120,116,32,102,105,108,101,0,90,111,
+111,109,0,70,117,108,108,32,118,105,101,119,0,77,105,114,
+114,111,114,0,83,101,116,32,116,111,32,100,114,97,119,105,
 110,103,32,99,111,108,111,114,0,83,101,116,32,116,111,32,
-100,101,102,97,117,108,116,32,110,117,109,98,101,114,32,111,
-102,32,108,105,110,101,115,0,84,97,114,103,101,116,0,65,
-108,108,32,108,97,121,101,114,115,0,76,97,121,101,114,32,
-119,105,116,104,32,115,112,101,99,105,102,105,101,100,32,110,
-117,109,98,101,114,32,111,102,32,108,105,110,101,115,0,86,
-97,108,117,101,32,116,111,32,114,101,112,108,97,99,101,0,
-80,114,111,99,101,115,115,105,110,103,0,68,101,108,101,116,
-101,32,97,110,100,32,99,111,109,98,105,110,101,32,108,97,
-121,101,114,115,0,74,111,105,110,32,116,111,32,110,101,119,
-32,108,97,121,101,114,44,32,108,101,97,118,105,110,103,32,
-108,97,121,101,114,0,76,97,121,101,114,115,32,105,110,32,
-116,104,101,32,102,111,108,100,101,114,0,67,104,101,99,107,
-101,100,32,108,97,121,101,114,32,40,119,104,101,110,32,110,
-101,119,108,121,32,106,111,105,110,101,100,41,0,84,121,112,
-101,32,97,102,116,101,114,32,98,105,110,100,105,110,103,0,
-42,32,73,102,32,116,104,101,32,97,108,112,104,97,32,118,
-97,108,117,101,32,111,102,32,116,104,101,32,108,111,119,101,
-114,32,108,97,121,101,114,32,105,115,32,110,111,116,32,116,
-104,101,32,109,97,120,105,109,117,109,44,10,116,104,101,32,
-99,111,114,114,101,99,116,32,99,111,108,111,114,32,119,105,
-108,108,32,110,111,116,32,98,101,32,111,98,116,97,105,110,
-101,100,32,105,102,32,116,104,101,32,99,111,109,98,105,110,
-97,116,105,111,110,32,105,115,32,112,101,114,102,111,114,109,
-101,100,10,105,110,32,97,32,115,116,97,116,101,32,111,116,
-104,101,114,32,116,104,97,110,32,34,110,111,114,109,97,108,
-34,32,105,110,32,116,104,101,32,99,111,109,112,111,115,105,
-116,105,111,110,32,109,111,100,101,46,0,73,110,118,101,114,
-116,32,116,104,101,32,98,114,105,103,104,116,110,101,115,115,
-32,111,102,32,116,104,101,32,99,111,108,111,114,32,116,111,
-32,116,104,101,32,97,108,112,104,97,32,118,97,108,117,101,
-0,65,100,100,32,116,111,32,116,101,109,112,108,97,116,101,
-40,38,65,41,0,69,100,105,116,32,108,105,115,116,40,38,
-69,41,46,46,46,0,73,109,97,103,101,32,115,101,116,116,
-105,110,103,115,0,82,101,115,105,122,101,32,99,97,110,118,
-97,115,0,73,110,116,101,103,114,97,116,101,32,105,109,97,
-103,101,115,32,116,111,32,115,99,97,108,101,0,65,114,114,
-97,110,103,101,109,101,110,116,0,67,117,116,32,111,117,116,
-32,111,102,32,114,97,110,103,101,0,82,97,116,105,111,0,
-65,115,112,101,99,116,32,114,97,116,105,111,32,109,97,105,
-110,116,101,110,97,110,99,101,0,68,80,73,32,99,104,97,
-110,103,101,0,73,110,116,101,114,112,111,108,97,116,105,111,
-110,32,109,101,116,104,111,100,0,69,120,112,97,110,100,47,
-114,101,100,117,99,101,32,115,101,108,101,99,116,105,111,110,
-0,78,117,109,98,101,114,32,111,102,32,112,105,120,101,108,
-115,32,40,114,101,100,117,99,101,100,32,98,121,32,110,101,
-103,97,116,105,118,101,32,118,97,108,117,101,41,0,71,114,
-97,100,105,101,110,116,32,101,100,105,116,105,110,103,0,80,
-111,115,105,116,105,111,110,0,68,114,97,119,105,110,103,32,
-99,111,108,111,114,0,66,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,83,112,101,99,105,102,105,101,100,
-32,99,111,108,111,114,0,86,97,108,117,101,0,82,101,112,
-101,97,116,32,40,97,108,119,97,121,115,41,0,77,111,110,
-111,99,104,114,111,109,97,116,105,99,0,43,67,116,114,108,
-32,58,32,69,113,117,97,108,108,121,32,115,112,97,99,101,
-100,32,112,111,105,110,116,115,32,102,114,111,109,32,116,104,
+98,97,99,107,103,114,111,117,110,100,32,99,111,108,111,114,
+0,78,117,109,101,114,105,99,97,108,32,105,110,112,117,116,
+0,82,71,66,32,115,112,101,99,105,102,105,99,97,116,105,
+111,110,58,32,50,53,53,44,48,44,49,50,56,32,40,83,
+101,112,97,114,97,116,101,32,119,105,116,104,32,110,111,110,
+45,110,117,109,101,114,105,99,32,99,104,97,114,97,99,116,
+101,114,115,41,10,72,84,77,76,32,99,111,108,111,114,32,
+115,112,101,99,105,102,105,99,97,116,105,111,110,58,32,35,
+102,102,48,48,56,48,32,40,54,32,100,105,103,105,116,32,
+111,110,108,121,41,0,83,101,116,32,100,114,97,119,105,110,
+103,32,99,111,108,111,114,40,38,83,41,32,91,76,66,84,
+84,93,0,79,78,47,79,70,70,32,115,119,105,116,99,104,
+105,110,103,40,38,84,41,32,91,67,116,114,108,43,76,66,
+84,84,93,0,71,101,116,32,99,111,108,111,114,40,38,80,
+41,32,91,83,104,105,102,116,43,76,66,84,84,93,0,72,
+83,86,40,84,114,105,97,110,103,108,101,41,0,72,83,86,
+40,82,101,99,116,97,110,103,108,101,41,0,80,97,108,101,
+116,116,101,32,108,105,115,116,40,38,76,41,46,46,46,0,
+83,101,116,116,105,110,103,40,38,79,41,46,46,46,0,69,
+100,105,116,40,38,69,41,0,70,105,108,101,40,38,70,41,
+0,72,101,108,112,40,38,72,41,0,80,97,108,101,116,116,
+101,32,101,100,105,116,105,110,103,40,38,69,41,46,46,46,
+0,77,97,107,101,32,97,108,108,32,100,114,97,119,105,110,
+103,32,99,111,108,111,114,115,40,38,87,41,0,82,101,97,
+100,32,102,114,111,109,32,102,105,108,101,40,38,76,41,46,
+46,46,0,65,100,100,105,116,105,111,110,97,108,32,114,101,
+97,100,105,110,103,32,102,114,111,109,32,102,105,108,101,40,
+38,65,41,46,46,46,0,71,101,116,32,112,97,108,101,116,
+116,101,32,102,114,111,109,32,105,109,97,103,101,32,99,111,
+108,111,114,40,38,73,41,46,46,46,0,83,97,118,101,32,
+116,111,32,102,105,108,101,40,38,83,41,46,46,46,0,71,
+114,97,100,97,116,105,111,110,32,115,101,116,116,105,110,103,
+115,40,38,79,41,0,67,111,108,111,114,32,80,97,108,101,
+116,116,101,0,67,111,109,112,97,99,116,32,109,111,100,101,
+40,38,67,41,0,80,97,108,101,116,116,101,40,38,80,41,
+0,72,83,76,40,38,83,41,0,71,114,97,100,97,116,105,
+111,110,40,38,77,41,0,77,97,107,101,32,97,108,108,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,115,46,10,
+65,114,101,32,121,111,117,32,115,117,114,101,63,0,83,101,
+116,116,105,110,103,115,32,102,111,114,32,101,97,99,104,32,
+98,97,114,0,78,117,109,98,101,114,32,111,102,32,115,116,
+97,103,101,115,0,51,126,54,52,46,32,78,111,32,115,116,
+101,112,115,32,97,116,32,48,46,0,80,97,108,101,116,116,
+101,32,108,105,115,116,0,83,101,116,32,100,114,97,119,105,
+110,103,32,99,111,108,111,114,40,38,83,41,0,71,101,116,
+32,116,104,105,115,32,99,111,108,111,114,40,38,71,41,0,
+80,97,108,101,116,116,101,32,115,101,116,116,105,110,103,115,
+0,78,117,109,98,101,114,32,111,102,32,99,111,108,111,114,
+115,0,84,104,101,32,119,105,100,116,104,32,111,102,32,111,
+110,101,32,99,111,108,111,114,0,84,104,101,32,104,101,105,
+103,104,116,32,111,102,32,111,110,101,32,99,111,108,111,114,
+0,77,97,120,105,109,117,109,32,110,117,109,98,101,114,32,
+111,102,32,104,111,114,105,122,111,110,116,97,108,32,100,105,
+115,112,108,97,121,115,10,40,48,32,116,111,32,109,97,116,
+99,104,32,116,104,101,32,119,105,100,116,104,41,0,80,97,
+108,101,116,116,101,32,101,100,105,116,105,110,103,0,82,71,
+66,32,105,110,112,117,116,0,34,82,44,71,44,66,34,32,
+111,114,32,34,35,82,82,71,71,66,66,34,46,10,83,101,
+116,32,119,105,116,104,32,69,110,116,101,114,46,0,83,104,
+105,102,116,43,76,32,111,114,32,82,105,103,104,116,32,99,
+108,105,99,107,58,32,83,101,108,101,99,116,32,102,114,111,
+109,32,116,104,101,32,99,117,114,114,101,110,116,32,112,111,
+115,105,116,105,111,110,32,116,111,32,116,104,101,32,112,114,
+101,115,115,101,100,32,112,111,115,105,116,105,111,110,10,68,
+38,68,58,32,77,111,118,101,32,116,104,101,32,99,111,108,
+111,114,32,111,102,32,116,104,101,32,115,101,108,101,99,116,
+105,111,110,32,116,111,32,116,104,101,32,115,112,101,99,105,
+102,105,101,100,32,112,111,115,105,116,105,111,110,0,78,117,
+109,98,101,114,32,111,102,32,97,100,100,105,116,105,111,110,
+115,32,47,32,105,110,115,101,114,116,105,111,110,115,0,82,
+101,109,111,118,101,32,114,97,110,103,101,32,99,111,108,111,
+114,0,71,114,97,100,97,116,105,111,110,32,98,101,116,119,
+101,101,110,32,114,97,110,103,101,115,0,65,100,100,32,116,
+104,101,32,115,112,101,99,105,102,105,101,100,32,110,117,109,
+98,101,114,32,116,111,32,116,104,101,32,101,110,100,0,73,
+110,115,101,114,116,32,116,104,101,32,115,112,101,99,105,102,
+105,101,100,32,110,117,109,98,101,114,32,97,116,32,116,104,
 101,32,99,117,114,114,101,110,116,32,112,111,115,105,116,105,
-111,110,32,116,111,32,116,104,101,32,112,114,101,115,115,101,
-100,32,112,111,115,105,116,105,111,110,10,43,83,104,105,102,
-116,32,58,32,83,101,116,32,116,104,101,32,99,117,114,114,
-101,110,116,32,99,111,108,111,114,32,97,110,100,32,118,97,
-108,117,101,32,97,116,32,116,104,101,32,112,114,101,115,115,
-101,100,32,112,111,115,105,116,105,111,110,10,43,65,108,116,
-32,58,32,68,101,108,101,116,101,32,112,111,105,110,116,0,
-68,101,108,101,116,101,32,99,117,114,114,101,110,116,32,112,
-111,105,110,116,40,38,68,41,0,83,112,108,105,116,32,98,
-101,116,119,101,101,110,32,116,104,101,32,110,101,120,116,32,
-112,111,115,105,116,105,111,110,40,38,83,41,0,77,111,118,
-101,32,116,111,32,116,104,101,32,109,105,100,100,108,101,32,
-112,111,115,105,116,105,111,110,32,111,110,32,116,104,101,32,
-108,101,102,116,32,97,110,100,32,114,105,103,104,116,40,38,
-77,41,0,65,108,108,32,101,118,101,110,108,121,32,115,112,
-97,99,101,100,40,38,69,41,0,82,101,118,101,114,115,101,
-40,38,82,41,0,69,110,108,97,114,103,101,109,101,110,116,
-32,40,110,111,32,105,110,116,101,114,112,111,108,97,116,105,
-111,110,41,0,69,120,112,97,110,115,105,111,110,32,114,97,
-116,101,32,40,50,126,50,48,41,0,84,114,97,110,115,102,
-111,114,109,97,116,105,111,110,0,78,111,114,109,97,108,0,
-80,101,114,115,112,101,99,116,105,118,101,0,82,101,115,101,
-116,0,88,32,109,97,103,110,105,102,105,99,97,116,105,111,
-110,0,89,32,109,97,103,110,105,102,105,99,97,116,105,111,
-110,0,82,111,116,97,116,105,111,110,32,97,110,103,108,101,
-0,65,115,112,101,99,116,32,114,97,116,105,111,32,109,97,
-105,110,116,101,110,97,110,99,101,0,65,112,112,108,121,32,
-118,97,108,117,101,0,91,82,105,103,104,116,32,98,117,116,
-116,111,110,32,111,114,32,109,105,100,100,108,101,32,98,117,
-116,116,111,110,93,10,83,99,114,101,101,110,32,115,99,114,
-111,108,108,105,110,103,10,91,67,116,114,108,43,114,105,103,
-104,116,32,98,117,116,116,111,110,32,117,112,47,100,111,119,
-110,32,100,114,97,103,93,10,67,104,97,110,103,101,32,100,
-105,115,112,108,97,121,32,109,97,103,110,105,102,105,99,97,
-116,105,111,110,10,91,84,114,97,110,115,108,97,116,105,111,
-110,32,47,32,80,111,105,110,116,32,109,111,118,101,109,101,
-110,116,93,10,43,83,104,105,102,116,58,32,72,111,114,105,
-122,111,110,116,97,108,32,109,111,118,101,109,101,110,116,10,
-43,67,116,114,108,58,32,86,101,114,116,105,99,97,108,32,
-109,111,118,101,0,84,101,120,116,0,70,111,110,116,0,76,
-105,115,116,0,82,101,103,105,115,116,101,114,101,100,32,102,
-111,110,116,0,70,105,108,101,32,115,112,101,99,105,102,105,
-99,97,116,105,111,110,0,67,104,97,114,97,99,116,101,114,
-32,115,112,97,99,105,110,103,0,76,105,110,101,32,115,112,
-97,99,105,110,103,0,82,111,116,97,116,105,111,110,0,72,
-105,110,116,105,110,103,0,68,105,115,97,98,108,101,32,97,
-117,116,111,32,104,105,110,116,105,110,103,0,82,117,98,121,
-0,82,117,98,121,32,112,111,115,105,116,105,111,110,0,68,
-111,32,110,111,116,32,117,115,101,32,114,117,98,121,32,103,
-108,121,112,104,115,0,77,111,110,111,99,104,114,111,109,101,
-32,98,105,110,97,114,121,0,86,101,114,116,105,99,97,108,
-32,119,114,105,116,105,110,103,0,69,110,97,98,108,101,32,
-115,112,101,99,105,97,108,32,110,111,116,97,116,105,111,110,
-0,66,111,108,100,32,111,117,116,108,105,110,101,0,73,116,
-97,108,105,99,105,122,101,100,32,111,117,116,108,105,110,101,
-0,69,110,97,98,108,101,32,101,109,98,101,100,100,101,100,
-32,98,105,116,109,97,112,0,87,111,114,100,32,108,105,115,
-116,32,101,100,105,116,105,110,103,40,38,69,41,0,69,100,
-105,116,32,114,101,103,105,115,116,101,114,101,100,32,102,111,
-110,116,0,70,111,110,116,32,101,100,105,116,105,110,103,0,
-69,100,105,116,105,110,103,32,114,101,112,108,97,99,101,109,
-101,110,116,32,99,104,97,114,97,99,116,101,114,115,0,82,
-101,103,105,115,116,101,114,101,100,32,110,97,109,101,0,66,
-97,115,101,32,102,111,110,116,0,82,101,112,108,97,99,101,
-109,101,110,116,32,102,111,110,116,32,49,0,82,101,112,108,
-97,99,101,109,101,110,116,32,102,111,110,116,32,50,0,67,
-104,97,114,97,99,116,101,114,32,101,100,105,116,105,110,103,
-0,67,104,97,114,97,99,116,101,114,32,116,121,112,101,0,
-67,111,100,101,32,115,112,101,99,105,102,105,99,97,116,105,
-111,110,0,68,105,115,112,108,97,121,32,85,110,105,99,111,
-100,101,32,102,114,111,109,32,99,104,97,114,97,99,116,101,
-114,115,0,66,97,115,105,99,32,76,97,116,105,110,0,72,
-105,114,97,103,97,110,97,0,75,97,116,97,107,97,110,97,
-0,75,97,110,106,105,0,80,117,110,99,116,117,97,116,105,
-111,110,32,101,116,99,46,0,69,120,116,101,114,110,97,108,
-32,99,104,97,114,97,99,116,101,114,115,32,40,112,114,105,
-118,97,116,101,32,117,115,101,32,97,114,101,97,41,0,80,
-108,101,97,115,101,32,101,110,116,101,114,32,110,97,109,101,
-0,80,108,101,97,115,101,32,115,101,108,101,99,116,32,97,
-32,98,97,115,101,32,102,111,110,116,0,84,104,101,114,101,
-32,105,115,32,97,110,32,101,114,114,111,114,32,105,110,32,
-116,104,101,32,99,111,100,101,32,118,97,108,117,101,32,100,
-101,115,99,114,105,112,116,105,111,110,0,68,117,112,108,105,
-99,97,116,101,32,99,111,100,101,32,118,97,108,117,101,0,
-87,111,114,100,32,108,105,115,116,32,101,100,105,116,105,110,
-103,0,87,111,114,100,0,78,97,109,101,0,84,101,120,116,
-0,78,101,119,32,103,114,111,117,112,0,71,114,111,117,112,
-32,115,101,116,116,105,110,103,115,0,66,114,117,115,104,32,
-115,105,122,101,32,115,101,116,116,105,110,103,0,84,111,111,
-108,32,115,101,116,116,105,110,103,115,0,78,117,109,98,101,
-114,32,116,111,32,108,105,110,101,32,117,112,32,115,105,100,
-101,32,98,121,32,115,105,100,101,0,109,105,110,105,109,117,
-109,0,109,97,120,105,109,117,109,0,80,114,101,115,115,117,
-114,101,32,99,117,114,118,101,0,84,111,111,108,32,108,105,
-115,116,32,101,100,105,116,105,110,103,0,71,114,111,117,112,
-0,73,116,101,109,0,83,97,118,101,32,115,101,116,116,105,
-110,103,115,0,67,111,109,112,114,101,115,115,105,111,110,32,
-108,101,118,101,108,32,91,48,45,57,93,0,65,108,112,104,
-97,32,99,104,97,110,110,101,108,0,81,117,97,108,105,116,
-121,32,91,48,45,49,48,48,93,0,83,97,109,112,108,105,
-110,103,32,114,97,116,105,111,0,52,58,52,58,52,32,40,
-72,105,103,104,41,0,52,58,50,58,50,0,52,58,50,58,
-48,32,40,76,111,119,41,0,0,49,54,98,105,116,32,99,
-111,108,111,114,0,80,114,111,103,114,101,115,115,105,118,101,
-0,85,110,99,111,109,112,114,101,115,115,101,100,0,67,111,
-109,112,114,101,115,115,105,111,110,32,116,121,112,101,0,84,
-114,97,110,115,112,97,114,101,110,116,32,99,111,108,111,114,
-0,67,111,108,111,114,32,112,111,115,105,116,105,111,110,0,
-76,111,115,115,108,101,115,115,32,99,111,109,112,114,101,115,
-115,105,111,110,0,76,111,115,115,121,32,99,111,109,112,114,
-101,115,115,105,111,110,0,42,32,73,102,32,116,104,101,32,
-108,97,121,101,114,32,104,97,115,32,97,110,32,97,108,112,
-104,97,32,99,104,97,110,110,101,108,44,10,97,108,108,32,
-108,97,121,101,114,115,32,119,105,108,108,32,98,101,32,99,
-111,109,98,105,110,101,100,32,105,110,32,34,110,111,114,109,
-97,108,34,32,109,111,100,101,46,10,65,108,115,111,44,32,
-116,104,101,32,116,111,110,101,32,108,97,121,101,114,32,105,
-115,32,110,111,116,32,116,111,110,101,100,46,0,76,97,121,
-101,114,32,115,116,114,117,99,116,117,114,101,0,79,110,101,
-32,112,105,99,116,117,114,101,32,40,82,71,66,41,0,79,
-110,101,32,112,105,99,116,117,114,101,32,40,71,114,97,121,
-115,99,97,108,101,41,0,79,110,101,32,112,105,99,116,117,
-114,101,32,40,49,98,105,116,32,66,108,97,99,107,32,97,
-110,100,32,119,104,105,116,101,41,0,77,101,110,117,32,107,
-101,121,32,115,101,116,116,105,110,103,115,0,67,97,110,118,
-97,115,32,107,101,121,32,115,101,116,116,105,110,103,115,0,
-67,108,101,97,114,32,97,108,108,0,67,108,101,97,114,32,
-107,101,121,0,84,104,101,32,115,97,109,101,32,107,101,121,
-32,104,97,115,32,97,108,114,101,97,100,121,32,98,101,101,
-110,32,115,101,116,46,0,67,104,97,110,103,101,32,116,111,
-111,108,0,67,104,97,110,103,101,32,100,114,97,119,105,110,
-103,32,116,121,112,101,0,79,116,104,101,114,32,99,111,109,
-109,97,110,100,115,0,84,111,111,108,32,111,112,101,114,97,
-116,105,111,110,32,98,121,32,107,101,121,43,111,112,101,114,
-97,116,105,111,110,0,68,114,97,119,105,110,103,32,116,121,
-112,101,32,111,112,101,114,97,116,105,111,110,32,98,121,32,
-107,101,121,43,111,112,101,114,97,116,105,111,110,0,83,101,
-108,101,99,116,105,111,110,32,116,111,111,108,32,111,112,101,
+111,110,0,90,111,111,109,40,38,90,41,0,70,117,108,108,
+32,118,105,101,119,40,38,70,41,0,77,105,114,114,111,114,
+40,38,72,41,0,84,111,111,108,98,97,114,32,105,115,32,
+97,108,119,97,121,115,32,118,105,115,105,98,108,101,40,38,
+84,41,0,83,101,116,116,105,110,103,40,38,79,41,46,46,
+46,0,77,101,110,117,0,90,111,111,109,0,70,117,108,108,
+32,118,105,101,119,0,77,105,114,114,111,114,0,70,105,108,
+108,32,114,101,102,101,114,101,110,99,101,0,68,114,97,119,
+105,110,103,32,108,111,99,107,0,67,104,101,99,107,0,71,
+114,97,121,115,99,97,108,101,32,100,105,115,112,108,97,121,
+32,111,102,32,97,108,108,32,116,111,110,101,32,108,97,121,
+101,114,115,0,78,111,32,97,108,112,104,97,32,109,97,115,
+107,0,75,101,101,112,32,97,108,112,104,97,32,118,97,108,
+117,101,0,84,114,97,110,115,112,97,114,101,110,116,32,99,
+111,108,111,114,32,112,114,111,116,101,99,116,105,111,110,0,
+79,112,97,99,105,116,121,32,99,111,108,111,114,32,112,114,
+111,116,101,99,116,105,111,110,0,78,101,119,0,68,117,112,
+108,105,99,97,116,101,0,67,108,101,97,114,32,116,104,101,
+32,105,109,97,103,101,0,68,101,108,101,116,101,0,67,111,
+109,98,105,110,101,32,116,111,32,108,111,119,101,114,32,108,
+97,121,101,114,0,68,114,111,112,32,116,111,32,108,111,119,
+101,114,32,108,97,121,101,114,0,85,112,0,68,111,119,110,
+0,72,101,108,112,40,38,72,41,0,84,111,111,108,32,111,
+112,116,105,111,110,0,82,117,108,101,114,0,84,101,120,116,
+117,114,101,0,73,110,47,79,117,116,32,111,102,32,108,105,
+110,101,0,76,111,97,100,0,83,97,118,101,0,76,105,110,
+101,0,66,101,122,105,101,114,32,99,117,114,118,101,0,73,
+110,0,79,117,116,0,84,104,105,110,32,108,105,110,101,0,
+83,104,97,112,101,0,83,116,114,101,110,103,116,104,0,65,
+114,101,97,32,116,111,32,102,105,108,108,0,83,97,109,101,
+32,99,111,108,111,114,32,111,110,32,108,97,121,101,114,32,
+91,33,79,110,108,121,32,111,110,101,32,114,101,102,101,114,
+101,110,99,101,32,108,97,121,101,114,93,0,84,114,97,110,
+115,112,97,114,101,110,116,32,97,114,101,97,32,40,97,110,
+116,105,45,97,108,105,97,115,32,97,117,116,111,109,97,116,
+105,99,32,106,117,100,103,109,101,110,116,41,0,84,114,97,
+110,115,112,97,114,101,110,116,32,97,114,101,97,32,40,65,
+32,61,32,48,41,0,84,104,101,32,115,97,109,101,32,97,
+114,101,97,32,111,102,32,97,108,112,104,97,32,118,97,108,
+117,101,115,0,83,97,109,101,32,99,111,108,111,114,32,111,
+110,32,99,97,110,118,97,115,0,0,97,108,108,111,119,97,
+98,108,101,32,101,114,114,111,114,0,76,97,121,101,114,32,
+116,104,97,116,32,114,101,102,101,114,101,110,99,101,115,32,
+97,32,99,111,108,111,114,0,70,105,108,108,32,114,101,102,
+101,114,101,110,99,101,32,108,97,121,101,114,0,67,117,114,
+114,101,110,116,32,108,97,121,101,114,0,65,108,108,32,100,
+105,115,112,108,97,121,32,108,97,121,101,114,115,0,0,68,
+114,97,119,105,110,103,32,99,111,108,111,114,45,62,98,97,
+99,107,103,114,111,117,110,100,32,99,111,108,111,114,0,66,
+108,97,99,107,32,45,62,32,87,104,105,116,101,0,87,104,
+105,116,101,32,45,62,32,66,108,97,99,107,0,67,117,115,
+116,111,109,0,0,82,101,118,101,114,115,101,0,82,101,112,
+101,97,116,0,72,105,100,101,32,102,114,97,109,101,32,119,
+104,105,108,101,32,109,111,118,105,110,103,0,76,111,97,100,
+0,67,108,101,97,114,0,84,114,97,110,115,102,111,114,109,
+97,116,105,111,110,0,78,111,110,101,0,70,108,105,112,32,
+104,111,114,122,0,70,108,105,112,32,118,101,114,116,0,82,
+97,110,100,111,109,32,102,108,105,112,32,104,111,114,122,0,
+82,97,110,100,111,109,32,102,108,105,112,32,118,101,114,116,
+0,82,97,110,100,111,109,32,114,111,116,97,116,105,111,110,
+0,0,79,118,101,114,119,114,105,116,101,32,112,97,115,116,
+101,0,65,112,112,108,121,32,109,97,115,107,115,32,119,104,
+101,110,32,112,97,115,116,105,110,103,0,69,110,108,97,114,
+103,101,109,101,110,116,32,40,110,111,32,105,110,116,101,114,
+112,111,108,97,116,105,111,110,41,0,65,114,114,97,110,103,
+101,32,105,110,32,116,105,108,101,115,32,40,102,117,108,108,
+41,0,65,114,114,97,110,103,101,32,105,110,32,116,105,108,
+101,115,32,40,104,111,114,105,122,111,110,116,97,108,32,114,
+111,119,41,0,65,114,114,97,110,103,101,32,105,110,32,116,
+105,108,101,115,32,40,118,101,114,116,105,99,97,108,32,114,
+111,119,41,0,0,82,117,110,0,71,114,97,100,105,101,110,
+116,32,101,100,105,116,105,110,103,40,38,69,41,46,46,46,
+0,78,101,119,40,38,78,41,46,46,46,0,69,100,105,116,
+32,108,105,115,116,40,38,76,41,46,46,46,0,79,112,101,
+110,40,38,79,41,46,46,46,0,83,97,118,101,40,38,83,
+41,46,46,46,0,78,101,119,32,103,114,111,117,112,40,38,
+71,41,46,46,46,0,69,100,105,116,40,38,69,41,46,46,
+46,0,73,110,115,101,114,116,32,103,114,111,117,112,40,38,
+78,41,46,46,46,0,68,101,108,101,116,101,32,103,114,111,
+117,112,40,38,68,41,0,73,110,115,101,114,116,32,110,101,
+119,32,98,114,117,115,104,40,38,66,41,46,46,46,0,73,
+110,115,101,114,116,32,99,117,114,114,101,110,116,32,116,111,
+111,108,40,38,84,41,0,67,111,112,121,40,38,67,41,0,
+80,97,115,116,101,40,38,80,41,0,83,101,116,116,105,110,
+103,40,38,79,41,46,46,46,0,84,111,111,108,40,38,76,
+41,0,68,101,108,101,116,101,40,38,68,41,0,82,101,103,
+105,115,116,114,97,116,105,111,110,40,38,82,41,0,79,118,
+101,114,114,105,100,101,32,116,111,111,108,32,111,112,116,105,
+111,110,32,118,97,108,117,101,115,40,38,79,41,0,68,105,
+115,112,108,97,121,32,115,101,116,32,118,97,108,117,101,40,
+38,86,41,0,85,110,115,112,101,99,105,102,105,101,100,0,
+82,101,108,101,97,115,101,32,97,108,108,0,65,100,100,40,
+38,65,41,0,68,101,108,101,116,101,40,38,68,41,32,91,
+83,104,105,102,116,43,76,66,84,84,93,0,65,100,100,32,
+115,105,122,101,115,0,80,108,101,97,115,101,32,101,110,116,
+101,114,32,116,104,101,32,98,114,117,115,104,32,115,105,122,
+101,46,10,89,111,117,32,99,97,110,32,115,112,101,99,105,
+102,121,32,109,111,114,101,32,116,104,97,110,32,111,110,101,
+32,98,121,32,115,101,112,97,114,97,116,105,110,103,32,116,
+104,101,109,10,119,105,116,104,32,99,104,97,114,97,99,116,
+101,114,115,32,111,116,104,101,114,32,116,104,97,110,32,110,
+117,109,98,101,114,115,32,97,110,100,32,39,46,39,46,10,
+91,69,120,97,109,112,108,101,93,32,49,46,48,44,49,48,
+46,50,59,53,48,0,65,108,119,97,121,115,32,115,97,118,
+101,0,78,111,114,109,97,108,0,69,114,97,115,101,114,0,
+87,97,116,101,114,0,66,108,117,114,0,0,83,105,122,101,
+32,40,100,105,97,109,101,116,101,114,41,0,76,105,110,101,
+32,99,111,114,114,101,99,116,105,111,110,0,78,111,110,101,
+0,65,118,101,114,97,103,101,40,115,116,114,111,110,103,41,
+0,65,118,101,114,97,103,101,40,109,101,100,105,117,109,41,
+0,65,118,101,114,97,103,101,40,119,101,97,107,41,0,70,
+105,120,101,100,32,100,105,115,116,97,110,99,101,0,0,80,
+111,105,110,116,32,105,110,116,101,114,118,97,108,32,40,49,
+46,48,32,61,32,114,97,100,105,117,115,41,0,82,97,110,
+100,111,109,32,119,105,100,116,104,32,111,102,32,98,114,117,
+115,104,32,115,105,122,101,40,37,41,0,82,97,110,100,111,
+109,32,119,105,100,116,104,32,111,102,32,112,111,105,110,116,
+32,112,111,115,105,116,105,111,110,0,67,117,114,118,101,32,
+105,110,116,101,114,112,111,108,97,116,105,111,110,0,87,97,
+116,101,114,0,65,109,111,117,110,116,32,111,102,32,100,114,
+97,119,105,110,103,32,99,111,108,111,114,0,65,109,111,117,
+110,116,32,116,111,32,101,120,116,101,110,100,0,84,114,101,
+97,116,32,116,104,101,32,98,97,99,107,103,114,111,117,110,
+100,32,97,115,32,119,104,105,116,101,0,80,114,101,115,101,
+116,0,66,114,117,115,104,32,115,104,97,112,101,0,83,104,
+97,112,101,32,105,109,97,103,101,0,72,97,114,100,110,101,
+115,115,32,119,104,101,110,32,110,111,114,109,97,108,108,121,
+32,114,111,117,110,100,0,83,116,114,101,110,103,116,104,32,
+111,102,32,115,97,110,100,105,110,103,0,66,97,115,101,32,
+97,110,103,108,101,32,111,102,32,114,111,116,97,116,105,111,
+110,0,82,97,110,100,111,109,32,114,111,116,97,116,105,111,
+110,32,119,105,100,116,104,0,82,111,116,97,116,101,32,105,
+110,32,116,104,101,32,100,105,114,101,99,116,105,111,110,32,
+111,102,32,116,114,97,118,101,108,0,80,101,110,32,112,114,
+101,115,115,117,114,101,0,83,105,122,101,32,119,104,101,110,
+32,48,32,112,114,101,115,115,117,114,101,40,37,41,0,68,
+101,110,115,105,116,121,32,119,104,101,110,32,48,32,112,114,
+101,115,115,117,114,101,40,37,41,0,80,114,101,115,115,117,
+114,101,32,99,117,114,118,101,32,101,100,105,116,105,110,103,
+0,85,115,101,32,97,32,99,111,109,109,111,110,32,112,114,
+101,115,115,117,114,101,32,99,117,114,118,101,0,86,97,114,
+105,111,117,115,0,82,101,103,105,115,116,101,114,101,100,32,
+105,110,32,37,99,0,82,101,115,101,116,40,38,82,41,0,
+69,100,105,116,32,103,114,97,100,105,101,110,116,32,108,105,
+115,116,0,83,112,101,99,105,102,121,105,110,103,32,116,104,
+101,32,105,109,97,103,101,32,112,111,115,105,116,105,111,110,
+0,83,101,116,116,105,110,103,0,76,101,102,116,32,98,117,
+116,116,111,110,0,67,116,114,108,43,76,101,102,116,0,83,
+104,105,102,116,43,76,101,102,116,0,82,105,103,104,116,32,
+98,117,116,116,111,110,0,77,105,100,100,108,101,32,98,117,
+116,116,111,110,0,83,99,114,111,108,108,32,116,104,101,32,
+118,105,101,119,32,98,121,32,100,114,97,103,103,105,110,103,
+9,83,99,114,111,108,108,32,116,104,101,32,99,97,110,118,
+97,115,32,98,121,32,100,114,97,103,103,105,110,103,9,90,
+111,111,109,32,98,121,32,100,114,97,103,103,105,110,103,32,
+117,112,32,97,110,100,32,100,111,119,110,9,77,101,110,117,
+0,83,99,114,111,108,108,32,98,121,32,100,114,97,103,103,
+105,110,103,9,90,111,111,109,32,98,121,32,100,114,97,103,
+103,105,110,103,32,117,112,32,97,110,100,32,100,111,119,110,
+9,71,101,116,32,99,111,108,111,114,40,100,114,97,119,105,
+110,103,32,99,111,108,111,114,41,9,71,101,116,32,99,111,
+108,111,114,40,98,97,99,107,103,114,111,117,110,100,32,99,
+111,108,111,114,41,9,67,111,108,111,114,32,97,99,113,117,
+105,115,105,116,105,111,110,32,109,101,110,117,0,78,101,119,
+32,99,97,110,118,97,115,0,73,110,105,116,105,97,108,32,
+108,97,121,101,114,0,83,101,116,32,97,115,32,115,116,97,
+114,116,117,112,32,115,105,122,101,0,84,104,101,32,109,97,
+120,105,109,117,109,32,101,100,105,116,97,98,108,101,32,112,
+120,32,115,105,122,101,32,104,97,115,32,98,101,101,110,32,
+101,120,99,101,101,100,101,100,46,0,72,105,115,116,111,114,
+121,0,82,101,103,105,115,116,114,97,116,105,111,110,0,82,
+101,103,117,108,97,116,105,111,110,115,0,71,114,105,100,32,
+115,101,116,116,105,110,103,115,0,71,114,105,100,0,68,105,
+118,105,100,105,110,103,32,108,105,110,101,0,78,117,109,98,
+101,114,32,111,102,32,104,111,114,105,122,111,110,116,97,108,
+32,100,105,118,105,115,105,111,110,115,0,78,117,109,98,101,
+114,32,111,102,32,118,101,114,116,105,99,97,108,32,100,105,
+118,105,115,105,111,110,115,0,83,104,111,119,32,49,112,120,
+32,103,114,105,100,0,37,100,37,37,32,111,114,32,109,111,
+114,101,0,73,103,110,111,114,101,32,97,108,112,104,97,32,
+99,104,97,110,110,101,108,0,78,101,119,32,108,97,121,101,
+114,0,76,97,121,101,114,32,115,101,116,116,105,110,103,115,
+0,76,97,121,101,114,32,99,111,108,111,114,32,115,101,108,
+101,99,116,105,111,110,0,66,97,116,99,104,32,99,111,110,
+118,101,114,115,105,111,110,32,111,102,32,110,117,109,98,101,
+114,32,111,102,32,108,105,110,101,115,0,84,101,109,112,108,
+97,116,101,32,108,105,115,116,32,101,100,105,116,0,67,111,
+109,98,105,110,101,32,109,117,108,116,105,112,108,101,32,108,
+97,121,101,114,115,0,67,104,97,110,103,101,32,108,97,121,
+101,114,32,116,121,112,101,0,84,111,110,105,110,103,0,78,
+117,109,98,101,114,32,111,102,32,108,105,110,101,115,0,70,
+105,120,101,100,32,100,101,110,115,105,116,121,0,77,97,107,
+101,32,116,104,101,32,98,97,99,107,103,114,111,117,110,100,
+32,119,104,105,116,101,0,83,101,116,32,102,114,111,109,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,0,83,101,
+116,32,116,111,32,100,114,97,119,105,110,103,32,99,111,108,
+111,114,0,83,101,116,32,116,111,32,100,101,102,97,117,108,
+116,32,110,117,109,98,101,114,32,111,102,32,108,105,110,101,
+115,0,84,97,114,103,101,116,0,65,108,108,32,108,97,121,
+101,114,115,0,76,97,121,101,114,32,119,105,116,104,32,115,
+112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,32,
+111,102,32,108,105,110,101,115,0,86,97,108,117,101,32,116,
+111,32,114,101,112,108,97,99,101,0,80,114,111,99,101,115,
+115,105,110,103,0,68,101,108,101,116,101,32,97,110,100,32,
+99,111,109,98,105,110,101,32,108,97,121,101,114,115,0,74,
+111,105,110,32,116,111,32,110,101,119,32,108,97,121,101,114,
+44,32,108,101,97,118,105,110,103,32,108,97,121,101,114,0,
+76,97,121,101,114,115,32,105,110,32,116,104,101,32,102,111,
+108,100,101,114,0,67,104,101,99,107,101,100,32,108,97,121,
+101,114,32,40,119,104,101,110,32,110,101,119,108,121,32,106,
+111,105,110,101,100,41,0,84,121,112,101,32,97,102,116,101,
+114,32,98,105,110,100,105,110,103,0,42,32,73,102,32,116,
+104,101,32,97,108,112,104,97,32,118,97,108,117,101,32,111,
+102,32,116,104,101,32,108,111,119,101,114,32,108,97,121,101,
+114,32,105,115,32,110,111,116,32,116,104,101,32,109,97,120,
+105,109,117,109,44,10,116,104,101,32,99,111,114,114,101,99,
+116,32,99,111,108,111,114,32,119,105,108,108,32,110,111,116,
+32,98,101,32,111,98,116,97,105,110,101,100,32,105,102,32,
+116,104,101,32,99,111,109,98,105,110,97,116,105,111,110,32,
+105,115,32,112,101,114,102,111,114,109,101,100,10,105,110,32,
+97,32,115,116,97,116,101,32,111,116,104,101,114,32,116,104,
+97,110,32,34,110,111,114,109,97,108,34,32,105,110,32,116,
+104,101,32,99,111,109,112,111,115,105,116,105,111,110,32,109,
+111,100,101,46,0,73,110,118,101,114,116,32,116,104,101,32,
+98,114,105,103,104,116,110,101,115,115,32,111,102,32,116,104,
+101,32,99,111,108,111,114,32,116,111,32,116,104,101,32,97,
+108,112,104,97,32,118,97,108,117,101,0,65,100,100,32,116,
+111,32,116,101,109,112,108,97,116,101,40,38,65,41,0,69,
+100,105,116,32,108,105,115,116,40,38,69,41,46,46,46,0,
+73,109,97,103,101,32,115,101,116,116,105,110,103,115,0,84,
+105,108,101,32,109,101,109,111,114,121,0,82,101,115,105,122,
+101,32,99,97,110,118,97,115,0,73,110,116,101,103,114,97,
+116,101,32,105,109,97,103,101,115,32,116,111,32,115,99,97,
+108,101,0,65,114,114,97,110,103,101,109,101,110,116,0,67,
+117,116,32,111,117,116,32,111,102,32,114,97,110,103,101,0,
+82,97,116,105,111,0,65,115,112,101,99,116,32,114,97,116,
+105,111,32,109,97,105,110,116,101,110,97,110,99,101,0,68,
+80,73,32,99,104,97,110,103,101,0,73,110,116,101,114,112,
+111,108,97,116,105,111,110,32,109,101,116,104,111,100,0,75,
+101,101,112,32,108,97,121,101,114,115,0,69,120,112,97,110,
+100,47,114,101,100,117,99,101,32,115,101,108,101,99,116,105,
+111,110,0,78,117,109,98,101,114,32,111,102,32,112,105,120,
+101,108,115,32,40,114,101,100,117,99,101,100,32,98,121,32,
+110,101,103,97,116,105,118,101,32,118,97,108,117,101,41,0,
+71,114,97,100,105,101,110,116,32,101,100,105,116,105,110,103,
+0,80,111,115,105,116,105,111,110,0,68,114,97,119,105,110,
+103,32,99,111,108,111,114,0,66,97,99,107,103,114,111,117,
+110,100,32,99,111,108,111,114,0,83,112,101,99,105,102,105,
+101,100,32,99,111,108,111,114,0,86,97,108,117,101,0,82,
+101,112,101,97,116,32,40,97,108,119,97,121,115,41,0,77,
+111,110,111,99,104,114,111,109,97,116,105,99,0,43,67,116,
+114,108,32,58,32,69,113,117,97,108,108,121,32,115,112,97,
+99,101,100,32,112,111,105,110,116,115,32,102,114,111,109,32,
+116,104,101,32,99,117,114,114,101,110,116,32,112,111,115,105,
+116,105,111,110,32,116,111,32,116,104,101,32,112,114,101,115,
+115,101,100,32,112,111,115,105,116,105,111,110,10,43,83,104,
+105,102,116,32,58,32,83,101,116,32,116,104,101,32,99,117,
+114,114,101,110,116,32,99,111,108,111,114,32,97,110,100,32,
+118,97,108,117,101,32,97,116,32,116,104,101,32,112,114,101,
+115,115,101,100,32,112,111,115,105,116,105,111,110,10,43,65,
+108,116,32,58,32,68,101,108,101,116,101,32,112,111,105,110,
+116,0,68,101,108,101,116,101,32,99,117,114,114,101,110,116,
+32,112,111,105,110,116,40,38,68,41,0,83,112,108,105,116,
+32,98,101,116,119,101,101,110,32,116,104,101,32,110,101,120,
+116,32,112,111,115,105,116,105,111,110,40,38,83,41,0,77,
+111,118,101,32,116,111,32,116,104,101,32,109,105,100,100,108,
+101,32,112,111,115,105,116,105,111,110,32,111,110,32,116,104,
+101,32,108,101,102,116,32,97,110,100,32,114,105,103,104,116,
+40,38,77,41,0,65,108,108,32,101,118,101,110,108,121,32,
+115,112,97,99,101,100,40,38,69,41,0,82,101,118,101,114,
+115,101,40,38,82,41,0,69,110,108,97,114,103,101,109,101,
+110,116,32,40,110,111,32,105,110,116,101,114,112,111,108,97,
+116,105,111,110,41,0,69,120,112,97,110,115,105,111,110,32,
+114,97,116,101,32,40,50,126,50,48,41,0,84,114,97,110,
+115,102,111,114,109,97,116,105,111,110,0,78,111,114,109,97,
+108,0,80,101,114,115,112,101,99,116,105,118,101,0,82,101,
+115,101,116,0,88,32,109,97,103,110,105,102,105,99,97,116,
+105,111,110,0,89,32,109,97,103,110,105,102,105,99,97,116,
+105,111,110,0,82,111,116,97,116,105,111,110,32,97,110,103,
+108,101,0,65,115,112,101,99,116,32,114,97,116,105,111,32,
+109,97,105,110,116,101,110,97,110,99,101,0,65,112,112,108,
+121,32,118,97,108,117,101,0,91,82,105,103,104,116,32,98,
+117,116,116,111,110,32,111,114,32,109,105,100,100,108,101,32,
+98,117,116,116,111,110,93,10,83,99,114,101,101,110,32,115,
+99,114,111,108,108,105,110,103,10,91,67,116,114,108,43,114,
+105,103,104,116,32,98,117,116,116,111,110,32,117,112,47,100,
+111,119,110,32,100,114,97,103,93,10,67,104,97,110,103,101,
+32,100,105,115,112,108,97,121,32,109,97,103,110,105,102,105,
+99,97,116,105,111,110,10,91,84,114,97,110,115,108,97,116,
+105,111,110,32,47,32,80,111,105,110,116,32,109,111,118,101,
+109,101,110,116,93,10,43,83,104,105,102,116,58,32,72,111,
+114,105,122,111,110,116,97,108,32,109,111,118,101,109,101,110,
+116,10,43,67,116,114,108,58,32,86,101,114,116,105,99,97,
+108,32,109,111,118,101,0,84,101,120,116,0,70,111,110,116,
+0,76,105,115,116,0,82,101,103,105,115,116,101,114,101,100,
+32,102,111,110,116,0,70,105,108,101,32,115,112,101,99,105,
+102,105,99,97,116,105,111,110,0,67,104,97,114,97,99,116,
+101,114,32,115,112,97,99,105,110,103,0,76,105,110,101,32,
+115,112,97,99,105,110,103,0,82,111,116,97,116,105,111,110,
+0,72,105,110,116,105,110,103,0,68,105,115,97,98,108,101,
+32,97,117,116,111,32,104,105,110,116,105,110,103,0,82,117,
+98,121,0,82,117,98,121,32,112,111,115,105,116,105,111,110,
+0,68,111,32,110,111,116,32,117,115,101,32,114,117,98,121,
+32,103,108,121,112,104,115,0,77,111,110,111,99,104,114,111,
+109,101,32,98,105,110,97,114,121,0,86,101,114,116,105,99,
+97,108,32,119,114,105,116,105,110,103,0,69,110,97,98,108,
+101,32,115,112,101,99,105,97,108,32,110,111,116,97,116,105,
+111,110,0,66,111,108,100,32,111,117,116,108,105,110,101,0,
+73,116,97,108,105,99,105,122,101,100,32,111,117,116,108,105,
+110,101,0,69,110,97,98,108,101,32,101,109,98,101,100,100,
+101,100,32,98,105,116,109,97,112,0,87,111,114,100,32,108,
+105,115,116,32,101,100,105,116,105,110,103,40,38,69,41,0,
+69,100,105,116,32,114,101,103,105,115,116,101,114,101,100,32,
+102,111,110,116,0,70,111,110,116,32,101,100,105,116,105,110,
+103,0,69,100,105,116,105,110,103,32,114,101,112,108,97,99,
+101,109,101,110,116,32,99,104,97,114,97,99,116,101,114,115,
+0,82,101,103,105,115,116,101,114,101,100,32,110,97,109,101,
+0,66,97,115,101,32,102,111,110,116,0,82,101,112,108,97,
+99,101,109,101,110,116,32,102,111,110,116,32,49,0,82,101,
+112,108,97,99,101,109,101,110,116,32,102,111,110,116,32,50,
+0,67,104,97,114,97,99,116,101,114,32,101,100,105,116,105,
+110,103,0,67,104,97,114,97,99,116,101,114,32,116,121,112,
+101,0,67,111,100,101,32,115,112,101,99,105,102,105,99,97,
+116,105,111,110,0,68,105,115,112,108,97,121,32,85,110,105,
+99,111,100,101,32,102,114,111,109,32,99,104,97,114,97,99,
+116,101,114,115,0,66,97,115,105,99,32,76,97,116,105,110,
+0,72,105,114,97,103,97,110,97,0,75,97,116,97,107,97,
+110,97,0,75,97,110,106,105,0,80,117,110,99,116,117,97,
+116,105,111,110,32,101,116,99,46,0,69,120,116,101,114,110,
+97,108,32,99,104,97,114,97,99,116,101,114,115,32,40,112,
+114,105,118,97,116,101,32,117,115,101,32,97,114,101,97,41,
+0,80,108,101,97,115,101,32,101,110,116,101,114,32,110,97,
+109,101,0,80,108,101,97,115,101,32,115,101,108,101,99,116,
+32,97,32,98,97,115,101,32,102,111,110,116,0,84,104,101,
+114,101,32,105,115,32,97,110,32,101,114,114,111,114,32,105,
+110,32,116,104,101,32,99,111,100,101,32,118,97,108,117,101,
+32,100,101,115,99,114,105,112,116,105,111,110,0,68,117,112,
+108,105,99,97,116,101,32,99,111,100,101,32,118,97,108,117,
+101,0,87,111,114,100,32,108,105,115,116,32,101,100,105,116,
+105,110,103,0,87,111,114,100,0,78,97,109,101,0,84,101,
+120,116,0,78,101,119,32,103,114,111,117,112,0,71,114,111,
+117,112,32,115,101,116,116,105,110,103,115,0,66,114,117,115,
+104,32,115,105,122,101,32,115,101,116,116,105,110,103,0,84,
+111,111,108,32,115,101,116,116,105,110,103,115,0,78,117,109,
+98,101,114,32,116,111,32,108,105,110,101,32,117,112,32,115,
+105,100,101,32,98,121,32,115,105,100,101,0,109,105,110,105,
+109,117,109,0,109,97,120,105,109,117,109,0,80,114,101,115,
+115,117,114,101,32,99,117,114,118,101,0,84,111,111,108,32,
+108,105,115,116,32,101,100,105,116,105,110,103,0,71,114,111,
+117,112,0,73,116,101,109,0,83,97,118,101,32,115,101,116,
+116,105,110,103,115,0,67,111,109,112,114,101,115,115,105,111,
+110,32,108,101,118,101,108,32,91,48,45,57,93,0,65,108,
+112,104,97,32,99,104,97,110,110,101,108,0,81,117,97,108,
+105,116,121,32,91,48,45,49,48,48,93,0,83,97,109,112,
+108,105,110,103,32,114,97,116,105,111,0,52,58,52,58,52,
+32,40,72,105,103,104,41,0,52,58,50,58,50,0,52,58,
+50,58,48,32,40,76,111,119,41,0,0,49,54,98,105,116,
+32,99,111,108,111,114,0,80,114,111,103,114,101,115,115,105,
+118,101,0,85,110,99,111,109,112,114,101,115,115,101,100,0,
+67,111,109,112,114,101,115,115,105,111,110,32,116,121,112,101,
+0,84,114,97,110,115,112,97,114,101,110,116,32,99,111,108,
+111,114,0,67,111,108,111,114,32,112,111,115,105,116,105,111,
+110,0,76,111,115,115,108,101,115,115,32,99,111,109,112,114,
+101,115,115,105,111,110,0,76,111,115,115,121,32,99,111,109,
+112,114,101,115,115,105,111,110,0,42,32,73,102,32,116,104,
+101,32,108,97,121,101,114,32,104,97,115,32,97,110,32,97,
+108,112,104,97,32,99,104,97,110,110,101,108,44,10,97,108,
+108,32,108,97,121,101,114,115,32,119,105,108,108,32,98,101,
+32,99,111,109,98,105,110,101,100,32,105,110,32,34,110,111,
+114,109,97,108,34,32,109,111,100,101,46,10,65,108,115,111,
+44,32,116,104,101,32,116,111,110,101,32,108,97,121,101,114,
+32,105,115,32,110,111,116,32,116,111,110,101,100,46,0,76,
+97,121,101,114,32,115,116,114,117,99,116,117,114,101,0,79,
+110,101,32,112,105,99,116,117,114,101,32,40,82,71,66,41,
+0,79,110,101,32,112,105,99,116,117,114,101,32,40,71,114,
+97,121,115,99,97,108,101,41,0,79,110,101,32,112,105,99,
+116,117,114,101,32,40,49,98,105,116,32,66,108,97,99,107,
+32,97,110,100,32,119,104,105,116,101,41,0,77,101,110,117,
+32,107,101,121,32,115,101,116,116,105,110,103,115,0,67,97,
+110,118,97,115,32,107,101,121,32,115,101,116,116,105,110,103,
+115,0,67,108,101,97,114,32,97,108,108,0,67,108,101,97,
+114,32,107,101,121,0,84,104,101,32,115,97,109,101,32,107,
+101,121,32,104,97,115,32,97,108,114,101,97,100,121,32,98,
+101,101,110,32,115,101,116,46,0,67,104,97,110,103,101,32,
+116,111,111,108,0,67,104,97,110,103,101,32,100,114,97,119,
+105,110,103,32,116,121,112,101,0,79,116,104,101,114,32,99,
+111,109,109,97,110,100,115,0,84,111,111,108,32,111,112,101,
 114,97,116,105,111,110,32,98,121,32,107,101,121,43,111,112,
-101,114,97,116,105,111,110,0,82,101,103,105,115,116,114,97,
-116,105,111,110,32,116,111,111,108,32,111,112,101,114,97,116,
-105,111,110,32,98,121,32,107,101,121,43,111,112,101,114,97,
-116,105,111,110,0,79,116,104,101,114,32,111,112,101,114,97,
-116,105,111,110,115,32,98,121,32,107,101,121,43,111,112,101,
-114,97,116,105,111,110,0,82,117,108,101,114,32,79,78,47,
-79,70,70,0,85,110,100,111,0,82,101,100,111,0,90,111,
-111,109,32,114,97,116,101,32,111,110,101,32,108,101,118,101,
-108,32,101,120,112,97,110,100,0,90,111,111,109,32,114,97,
-116,101,32,111,110,101,32,108,101,118,101,108,32,114,101,100,
-117,99,101,0,67,97,110,118,97,115,32,114,111,116,97,116,
-105,111,110,32,114,101,115,101,116,0,68,114,97,119,105,110,
-103,47,98,97,99,107,103,114,111,117,110,100,32,99,111,108,
-111,114,32,105,110,116,101,114,99,104,97,110,103,101,0,83,
-101,108,101,99,116,32,111,110,101,32,108,97,121,101,114,32,
-97,98,111,118,101,0,83,101,108,101,99,116,32,111,110,101,
-32,108,97,121,101,114,32,98,101,108,111,119,0,67,117,114,
-114,101,110,116,32,108,97,121,101,114,32,118,105,115,105,98,
-108,101,47,105,110,118,105,115,105,98,108,101,0,83,101,108,
-101,99,116,32,116,104,101,32,110,101,120,116,32,105,116,101,
-109,32,105,110,32,116,104,101,32,116,111,111,108,32,108,105,
-115,116,0,83,101,108,101,99,116,32,116,104,101,32,112,114,
-101,118,105,111,117,115,32,105,116,101,109,32,105,110,32,116,
-104,101,32,116,111,111,108,32,108,105,115,116,0,84,111,111,
-108,32,108,105,115,116,44,32,115,119,105,116,99,104,32,116,
-111,32,108,97,115,116,32,115,101,108,101,99,116,101,100,32,
-105,116,101,109,0,83,101,108,101,99,116,58,32,114,101,99,
-116,97,110,103,108,101,0,83,101,108,101,99,116,58,32,112,
-111,108,121,103,111,110,0,83,101,108,101,99,116,58,32,102,
-114,101,101,104,97,110,100,0,77,111,118,101,32,105,109,97,
-103,101,0,67,111,112,121,32,105,109,97,103,101,0,77,111,
-118,101,32,115,101,108,101,99,116,105,111,110,32,112,111,115,
-105,116,105,111,110,0,67,104,97,110,103,101,32,122,111,111,
-109,32,114,97,116,101,32,40,117,112,45,100,111,119,110,32,
-100,114,97,103,41,0,67,104,97,110,103,101,32,98,114,117,
-115,104,32,115,105,122,101,32,40,108,101,102,116,45,114,105,
-103,104,116,32,100,114,97,103,41,0,83,101,108,101,99,116,
-32,103,114,97,98,98,101,100,32,108,97,121,101,114,0,82,
-101,115,101,116,0,80,114,111,99,101,115,115,32,111,110,108,
-121,32,119,105,116,104,105,110,32,116,104,101,32,99,97,110,
-118,97,115,0,66,114,105,103,104,116,110,101,115,115,0,67,
-111,110,116,114,97,115,116,0,71,97,109,109,97,32,118,97,
-108,117,101,0,72,117,101,0,83,97,116,117,114,97,116,105,
-111,110,0,84,104,114,101,115,104,111,108,100,0,84,121,112,
-101,0,84,111,110,101,0,82,97,100,105,117,115,0,65,110,
-103,108,101,0,83,116,114,101,110,103,116,104,0,89,111,117,
-32,99,97,110,32,99,104,97,110,103,101,32,116,104,101,32,
-99,101,110,116,101,114,32,112,111,115,105,116,105,111,110,10,
-98,121,32,108,101,102,116,45,99,108,105,99,107,105,110,103,
-32,111,110,32,116,104,101,32,99,97,110,118,97,115,0,69,
-109,112,104,97,115,105,115,0,78,117,109,98,101,114,32,111,
-102,32,99,121,99,108,101,115,0,67,108,97,114,105,116,121,
-0,67,111,108,111,114,0,83,105,122,101,0,68,101,110,115,
-105,116,121,0,65,110,116,105,45,97,108,105,97,115,105,110,
-103,0,65,109,111,117,110,116,0,82,97,110,100,111,109,58,
-114,97,100,105,117,115,40,37,41,0,82,97,110,100,111,109,
-58,68,101,110,115,105,116,121,40,37,41,0,80,111,105,110,
-116,32,116,121,112,101,0,84,104,105,99,107,110,101,115,115,
-0,77,105,110,105,109,117,109,32,116,104,105,99,107,110,101,
-115,115,0,77,97,120,105,109,117,109,32,116,104,105,99,107,
-110,101,115,115,0,77,105,110,105,109,117,109,32,105,110,116,
-101,114,118,97,108,0,77,97,120,105,109,117,109,32,105,110,
-116,101,114,118,97,108,0,72,111,114,105,122,111,110,116,97,
-108,32,108,105,110,101,0,86,101,114,116,105,99,97,108,32,
-108,105,110,101,0,87,105,100,116,104,0,72,101,105,103,104,
-116,0,77,97,107,101,32,116,104,101,32,104,101,105,103,104,
-116,32,116,104,101,32,115,97,109,101,32,97,115,32,116,104,
-101,32,119,105,100,116,104,0,85,115,101,32,97,118,101,114,
-97,103,101,32,99,111,108,111,114,0,65,110,103,108,101,32,
-82,0,65,110,103,108,101,32,71,0,65,110,103,108,101,32,
-66,0,77,97,107,101,32,97,108,108,32,97,110,103,108,101,
-115,32,116,104,101,32,115,97,109,101,32,97,115,32,82,0,
-71,114,97,121,115,99,97,108,101,0,65,112,112,108,105,99,
-97,98,108,101,32,97,109,111,117,110,116,0,68,105,115,116,
-97,110,99,101,0,82,101,118,101,114,115,101,0,76,101,110,
-103,116,104,0,87,105,100,116,104,0,76,111,111,112,32,116,
-104,101,32,101,110,100,115,0,66,97,99,107,103,114,111,117,
-110,100,0,83,99,97,108,101,0,78,117,109,98,101,114,32,
-111,102,32,116,105,109,101,115,0,83,111,117,114,99,101,32,
-105,115,32,99,104,101,99,107,101,100,32,108,97,121,101,114,
-0,67,114,111,112,32,116,104,101,32,115,111,117,114,99,101,
-32,105,109,97,103,101,0,83,109,111,111,116,104,0,78,117,
-109,98,101,114,32,111,102,32,108,105,110,101,115,0,70,105,
-120,101,100,32,100,101,110,115,105,116,121,0,77,97,107,101,
-32,116,104,101,32,98,97,99,107,103,114,111,117,110,100,32,
-119,104,105,116,101,0,65,115,112,101,99,116,32,114,97,116,
-105,111,0,68,101,110,115,105,116,121,0,73,110,116,101,114,
-118,97,108,58,82,97,110,100,111,109,0,84,104,105,99,107,
-110,101,115,115,58,82,97,110,100,111,109,0,76,101,110,103,
-116,104,58,82,97,110,100,111,109,0,87,97,118,101,32,108,
-101,110,103,116,104,0,84,104,105,99,107,110,101,115,115,32,
-102,97,100,101,32,111,117,116,0,83,105,109,112,108,101,32,
-112,114,101,118,105,101,119,0,80,114,101,118,105,101,119,32,
-105,110,32,114,101,100,0,66,97,121,101,114,50,120,50,0,
-66,97,121,101,114,52,120,52,0,83,112,105,114,97,108,0,
-68,111,116,0,82,97,110,100,111,109,0,0,66,108,97,99,
-107,47,87,104,105,116,101,0,68,114,97,119,105,110,103,47,
-66,97,99,107,103,114,111,117,110,100,0,66,108,97,99,107,
-43,65,108,112,104,97,0,0,68,114,97,119,105,110,103,32,
-99,111,108,111,114,0,66,97,99,107,103,114,111,117,110,100,
-32,99,111,108,111,114,0,66,108,97,99,107,0,87,104,105,
-116,101,0,0,68,111,116,32,99,105,114,99,108,101,0,65,
-110,116,105,45,97,108,105,97,115,105,110,103,32,99,105,114,
-99,108,101,0,83,111,102,116,32,99,105,114,99,108,101,0,
-0,68,114,97,119,105,110,103,32,99,111,108,111,114,0,82,
-97,110,100,111,109,40,103,114,97,121,115,99,97,108,101,41,
-0,82,97,110,100,111,109,40,82,71,66,41,0,82,97,110,
-100,111,109,40,72,117,101,41,0,82,97,110,100,111,109,40,
-115,97,116,117,114,97,116,105,111,110,32,111,102,32,100,114,
-97,119,105,110,103,32,99,111,108,111,114,41,0,82,97,110,
-100,111,109,40,98,114,105,103,104,116,110,101,115,115,32,111,
-102,32,100,114,97,119,105,110,103,32,99,111,108,111,114,41,
-0,0,79,117,116,101,114,32,115,105,100,101,32,111,102,32,
-111,112,97,99,105,116,121,32,97,114,101,97,0,73,110,110,
-101,114,32,115,105,100,101,32,111,102,32,111,112,97,99,105,
-116,121,32,97,114,101,97,0,0,83,108,97,110,116,0,72,
-111,114,105,122,111,110,116,97,108,0,86,101,114,116,105,99,
-97,108,0,0,77,105,110,105,109,117,109,0,77,105,100,100,
-108,101,0,77,97,120,105,109,117,109,0,0,72,111,114,105,
-122,111,110,116,97,108,32,111,110,108,121,0,86,101,114,116,
-105,99,97,108,32,111,110,108,121,0,66,111,116,104,0,0,
-82,101,99,116,97,110,103,117,108,97,114,32,99,111,111,114,
-100,105,110,97,116,101,115,32,45,62,32,80,111,108,97,114,
-32,99,111,111,114,100,105,110,97,116,101,115,0,80,111,108,
-97,114,32,99,111,111,114,100,105,110,97,116,101,115,32,45,
-62,32,82,101,99,116,97,110,103,117,108,97,114,32,99,111,
-111,114,100,105,110,97,116,101,115,0,0,84,114,97,110,115,
-112,97,114,101,110,116,0,83,105,100,101,32,99,111,108,111,
-114,0,84,104,97,116,32,119,97,121,0,0,66,114,117,115,
-104,40,97,110,116,105,45,97,108,105,97,115,105,110,103,41,
-0,66,114,117,115,104,40,110,111,32,97,110,116,105,45,97,
-108,105,97,115,105,110,103,41,0,49,112,120,32,100,111,116,
-32,112,101,110,0,0,80,97,110,101,108,32,108,97,121,111,
-117,116,32,115,101,116,116,105,110,103,0,80,97,110,101,108,
-0,80,97,110,101,0,80,97,110,101,37,100,0,67,97,110,
-118,97,115,0,84,111,111,108,98,97,114,32,99,117,115,116,
-111,109,105,122,97,116,105,111,110,0,45,45,45,32,83,101,
-112,97,114,97,116,105,111,110,32,45,45,45,0,69,110,118,
-105,114,111,110,109,101,110,116,97,108,32,115,101,116,116,105,
-110,103,0,83,101,116,116,105,110,103,32,49,0,70,108,97,
-103,115,0,66,117,116,116,111,110,32,111,112,101,114,97,116,
-105,111,110,0,73,110,116,101,114,102,97,99,101,0,83,121,
-115,116,101,109,0,67,97,110,118,97,115,32,98,97,99,107,
-103,114,111,117,110,100,32,99,111,108,111,114,0,80,108,97,
-105,100,32,98,97,99,107,103,114,111,117,110,100,32,99,111,
-108,111,114,0,82,117,108,101,114,32,103,117,105,100,101,32,
-99,111,108,111,114,0,68,101,102,97,117,108,116,32,110,117,
-109,98,101,114,32,111,102,32,98,105,116,115,32,119,104,101,
-110,32,114,101,97,100,105,110,103,32,97,110,32,105,109,97,
-103,101,0,77,97,120,105,109,117,109,32,110,117,109,98,101,
-114,32,111,102,32,117,110,100,111,115,32,91,50,45,52,48,
-48,93,0,77,97,120,105,109,117,109,32,117,110,100,111,32,
-98,117,102,102,101,114,32,115,105,122,101,0,79,110,101,32,
-115,116,101,112,32,111,102,32,99,97,110,118,97,115,32,100,
-105,115,112,108,97,121,32,109,97,103,110,105,102,105,99,97,
-116,105,111,110,32,40,97,116,32,49,48,48,37,32,111,114,
-32,109,111,114,101,41,0,79,110,101,32,115,116,101,112,32,
-111,102,32,99,97,110,118,97,115,32,114,111,116,97,116,105,
-111,110,0,67,111,110,102,105,114,109,32,119,104,101,110,32,
-111,118,101,114,119,114,105,116,105,110,103,0,67,104,101,99,
-107,32,119,104,101,110,32,111,118,101,114,119,114,105,116,105,
-110,103,32,105,110,32,97,32,102,111,114,109,97,116,32,111,
-116,104,101,114,32,116,104,97,110,32,65,80,68,0,68,111,
-32,110,111,116,32,119,114,105,116,101,32,97,32,115,105,110,
-103,108,101,32,112,105,99,116,117,114,101,32,105,109,97,103,
-101,32,119,104,101,110,32,115,97,118,105,110,103,32,65,80,
-68,0,40,80,97,110,101,108,41,32,70,105,108,116,101,114,
-32,108,105,115,116,32,105,116,101,109,115,32,99,97,110,32,
-98,101,32,101,120,101,99,117,116,101,100,32,98,121,32,100,
-111,117,98,108,101,45,99,108,105,99,107,105,110,103,0,78,
-111,114,109,97,108,32,100,101,118,105,99,101,0,68,101,118,
-105,99,101,115,32,119,105,116,104,32,112,114,101,115,115,117,
-114,101,0,67,111,109,109,97,110,100,32,115,101,108,101,99,
-116,105,111,110,0,71,101,116,32,98,117,116,116,111,110,0,
-66,117,116,116,111,110,0,67,111,109,109,97,110,100,0,87,
-104,101,110,32,121,111,117,32,112,114,101,115,115,32,116,104,
-101,32,98,117,116,116,111,110,32,111,102,32,101,97,99,104,
-32,100,101,118,105,99,101,32,111,110,32,116,104,101,32,34,
-71,101,116,32,66,117,116,116,111,110,34,32,97,114,101,97,
-44,10,116,104,101,32,105,116,101,109,32,111,102,32,116,104,
-97,116,32,98,117,116,116,111,110,32,105,115,32,115,101,108,
-101,99,116,101,100,32,105,110,32,116,104,101,32,108,105,115,
-116,46,0,78,111,116,32,115,112,101,99,105,102,105,101,100,
-32,40,100,101,102,97,117,108,116,32,111,112,101,114,97,116,
-105,111,110,41,0,84,111,111,108,32,111,112,101,114,97,116,
-105,111,110,0,82,101,103,105,115,116,114,97,116,105,111,110,
-32,116,111,111,108,32,111,112,101,114,97,116,105,111,110,0,
-79,116,104,101,114,32,111,112,101,114,97,116,105,111,110,0,
-79,116,104,101,114,32,99,111,109,109,97,110,100,115,0,80,
-97,110,101,108,32,102,111,110,116,32,91,42,93,0,73,99,
-111,110,32,115,105,122,101,32,91,42,93,0,84,111,111,108,
-98,97,114,0,84,111,111,108,0,79,116,104,101,114,0,84,
-111,111,108,98,97,114,32,99,117,115,116,111,109,105,122,97,
-116,105,111,110,0,87,111,114,107,105,110,103,32,100,105,114,
-101,99,116,111,114,121,32,91,42,93,0,85,115,101,114,39,
-115,32,98,114,117,115,104,32,105,109,97,103,101,32,100,105,
-114,101,99,116,111,114,121,0,85,115,101,114,39,115,32,116,
-101,120,116,117,114,101,32,105,109,97,103,101,32,100,105,114,
-101,99,116,111,114,121,0,68,114,97,119,105,110,103,32,99,
-117,114,115,111,114,0,73,109,97,103,101,32,102,105,108,101,
-32,40,116,114,97,110,115,112,97,114,101,110,116,32,111,114,
-32,80,78,71,32,119,105,116,104,32,97,108,112,104,97,41,
-0,67,101,110,116,101,114,32,112,111,115,105,116,105,111,110,
-32,40,116,104,101,32,117,112,112,101,114,32,108,101,102,116,
-32,111,102,32,116,104,101,32,105,109,97,103,101,32,105,115,
-32,40,48,44,48,41,41,0,91,42,93,32,61,32,65,112,
-112,108,121,32,97,116,32,110,101,120,116,32,115,116,97,114,
-116,117,112,0,83,101,116,32,116,104,101,32,119,111,114,107,
-105,110,103,32,100,105,114,101,99,116,111,114,121,32,112,97,
-116,104,32,99,111,114,114,101,99,116,108,121,0,48,58,69,
-114,97,115,101,114,32,111,102,32,116,104,101,32,112,101,110,
-0,49,58,76,101,102,116,32,98,117,116,116,111,110,0,50,
-58,82,105,103,104,116,32,98,117,116,116,111,110,0,51,58,
-77,105,100,100,108,101,32,98,117,116,116,111,110,0,52,58,
-83,99,114,111,108,108,32,117,112,0,53,58,83,99,114,111,
-108,108,32,100,111,119,110,0,54,58,83,99,114,111,108,108,
-32,108,101,102,116,0,55,58,83,99,114,111,108,108,32,114,
-105,103,104,116,0,70,105,108,101,40,38,70,41,0,69,100,
-105,116,40,38,69,41,0,76,97,121,101,114,40,38,76,41,
-0,83,101,108,101,99,116,105,111,110,40,38,83,41,0,70,
-105,108,116,101,114,40,38,84,41,0,86,105,101,119,40,38,
-86,41,0,83,101,116,116,105,110,103,40,38,79,41,0,78,
-101,119,40,38,78,41,46,46,46,0,79,112,101,110,40,38,
-79,41,46,46,46,0,83,97,118,101,40,38,83,41,0,83,
-97,118,101,32,97,115,40,38,87,41,46,46,46,0,83,97,
-118,101,32,100,117,112,108,105,99,97,116,101,40,38,68,41,
-46,46,46,0,82,101,99,101,110,116,108,121,32,117,115,101,
-100,32,102,105,108,101,115,40,38,82,41,0,69,120,105,116,
-40,38,88,41,0,67,108,101,97,114,32,104,105,115,116,111,
-114,121,40,38,67,41,0,85,110,100,111,40,38,90,41,0,
-82,101,100,111,40,38,89,41,0,70,105,108,108,40,38,70,
-41,0,69,114,97,115,101,40,38,69,41,0,67,104,97,110,
-103,101,32,99,97,110,118,97,115,32,115,105,122,101,40,38,
-83,41,46,46,46,0,73,110,116,101,103,114,97,116,101,32,
-105,109,97,103,101,115,32,116,111,32,115,99,97,108,101,40,
-38,82,41,46,46,46,0,73,109,97,103,101,32,115,101,116,
-116,105,110,103,115,40,38,79,41,46,46,46,0,68,114,97,
-119,105,110,103,32,99,111,108,111,114,32,97,115,32,105,109,
-97,103,101,32,98,97,99,107,103,114,111,117,110,100,32,99,
-111,108,111,114,40,38,66,41,0,68,101,115,101,108,101,99,
-116,40,38,68,41,0,83,101,108,101,99,116,32,97,108,108,
-40,38,65,41,0,82,101,118,101,114,115,101,40,38,73,41,
-0,69,120,112,97,110,115,105,111,110,47,82,101,100,117,99,
-116,105,111,110,40,38,69,41,46,46,46,0,67,111,112,121,
-40,38,67,41,0,67,117,116,40,38,88,41,0,80,97,115,
-116,101,32,116,111,32,110,101,119,32,108,97,121,101,114,40,
-38,86,41,0,83,101,108,101,99,116,32,116,104,101,32,111,
-112,97,113,117,101,32,97,114,101,97,32,111,102,32,116,104,
-101,32,108,97,121,101,114,40,38,79,41,0,83,101,108,101,
-99,116,32,116,104,101,32,100,114,97,119,105,110,103,32,99,
-111,108,111,114,32,97,114,101,97,32,111,102,32,116,104,101,
-32,108,97,121,101,114,40,38,76,41,0,79,117,116,112,117,
-116,32,116,104,101,32,105,109,97,103,101,32,105,110,32,115,
-101,108,101,99,116,105,111,110,32,116,111,32,97,32,102,105,
-108,101,40,38,80,41,46,46,46,0,69,110,118,105,114,111,
-110,109,101,110,116,97,108,32,115,101,116,116,105,110,103,40,
-38,69,41,46,46,46,0,71,114,105,100,32,115,101,116,116,
-105,110,103,115,40,38,71,41,46,46,46,0,77,101,110,117,
-32,107,101,121,32,115,101,116,116,105,110,103,115,40,38,75,
-41,46,46,46,0,67,97,110,118,97,115,32,107,101,121,32,
-115,101,116,116,105,110,103,115,40,38,67,41,46,46,46,0,
-80,97,110,101,108,32,108,97,121,111,117,116,32,115,101,116,
-116,105,110,103,40,38,80,41,46,46,46,0,65,98,111,117,
-116,40,38,65,41,46,46,46,0,78,101,119,32,108,97,121,
-101,114,40,38,78,41,46,46,46,0,78,101,119,32,102,111,
-108,100,101,114,40,38,70,41,0,78,101,119,32,108,97,121,
-101,114,32,102,114,111,109,32,102,105,108,101,40,38,73,41,
-46,46,46,0,67,114,101,97,116,101,32,110,101,119,32,111,
-110,32,116,111,112,32,111,102,32,116,104,101,32,99,117,114,
-114,101,110,116,32,108,97,121,101,114,40,38,81,41,46,46,
-46,0,68,117,112,108,105,99,97,116,101,40,38,67,41,0,
-68,101,108,101,116,101,40,38,68,41,0,69,114,97,115,101,
-40,38,88,41,0,77,111,118,101,32,105,109,97,103,101,32,
-100,111,119,110,32,116,111,32,108,97,121,101,114,32,98,101,
-108,111,119,40,38,90,41,0,77,101,114,103,101,32,119,105,
-116,104,32,108,97,121,101,114,32,98,101,108,111,119,40,38,
-66,41,0,77,101,114,103,101,32,118,97,114,105,111,117,115,
-32,108,97,121,101,114,115,40,38,87,41,46,46,46,0,77,
-101,114,103,101,32,97,108,108,40,38,77,41,0,68,105,115,
-112,108,97,121,32,116,111,110,101,32,108,97,121,101,114,32,
-105,110,32,103,114,97,121,115,99,97,108,101,40,38,84,41,
-0,79,117,116,112,117,116,32,116,111,32,102,105,108,101,40,
-38,83,41,46,46,46,0,83,101,116,116,105,110,103,115,40,
-38,79,41,0,66,97,116,99,104,32,99,111,110,118,101,114,
-115,105,111,110,40,38,65,41,0,69,100,105,116,40,38,69,
-41,0,86,105,101,119,40,38,86,41,0,70,111,108,100,101,
-114,40,38,74,41,0,70,108,97,103,115,40,38,71,41,0,
-76,97,121,101,114,32,115,101,116,116,105,110,103,115,40,38,
-79,41,46,46,46,0,67,104,97,110,103,101,32,108,97,121,
-101,114,32,116,121,112,101,40,38,84,41,46,46,46,0,67,
-104,97,110,103,101,32,108,105,110,101,32,99,111,108,111,114,
-40,38,67,41,46,46,46,0,78,117,109,98,101,114,32,111,
-102,32,116,111,110,101,32,108,105,110,101,115,40,38,76,41,
-46,46,46,0,70,108,105,112,32,104,111,114,105,122,111,110,
-116,97,108,40,38,72,41,0,70,108,105,112,32,117,112,115,
-105,100,101,32,100,111,119,110,40,38,86,41,0,82,111,116,
-97,116,101,32,57,48,32,100,101,103,114,101,101,115,32,116,
-111,32,116,104,101,32,108,101,102,116,40,38,76,41,0,82,
-111,116,97,116,101,32,57,48,32,100,101,103,114,101,101,115,
-32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,82,
-41,0,83,104,111,119,32,97,108,108,40,38,65,41,0,72,
-105,100,101,32,97,108,108,40,38,72,41,0,83,104,111,119,
-32,111,110,108,121,32,99,117,114,114,101,110,116,32,108,97,
-121,101,114,40,38,67,41,0,84,111,103,103,108,101,32,99,
-104,101,99,107,101,100,32,108,97,121,101,114,40,38,75,41,
-0,84,111,103,103,108,101,32,108,97,121,101,114,115,32,111,
-116,104,101,114,32,116,104,97,110,32,102,111,108,100,101,114,
-115,40,38,78,41,0,77,111,118,101,32,99,104,101,99,107,
-101,100,32,108,97,121,101,114,32,116,111,32,99,117,114,114,
-101,110,116,32,102,111,108,100,101,114,40,38,77,41,0,67,
-108,111,115,101,32,111,116,104,101,114,32,116,104,97,110,32,
-116,104,101,32,99,117,114,114,101,110,116,32,102,111,108,100,
-101,114,40,38,83,41,0,79,112,101,110,32,97,108,108,40,
-38,79,41,0,82,101,108,101,97,115,101,32,97,108,108,32,
-102,105,108,108,32,114,101,102,101,114,101,110,99,101,115,40,
-38,70,41,0,85,110,108,111,99,107,32,97,108,108,40,38,
-76,41,0,85,110,99,104,101,99,107,32,97,108,108,40,38,
-75,41,0,77,105,110,105,109,105,122,101,40,38,78,41,0,
-83,104,111,119,32,112,97,110,101,108,40,38,86,41,0,80,
-97,110,101,108,40,38,80,41,0,77,105,114,114,111,114,32,
-99,97,110,118,97,115,40,38,81,41,0,83,104,111,119,32,
-98,97,99,107,103,114,111,117,110,100,32,97,115,32,99,104,
-101,99,107,32,112,97,116,116,101,114,110,40,38,75,41,0,
-83,104,111,119,32,103,114,105,100,40,38,71,41,0,83,104,
-111,119,32,100,105,118,105,100,105,110,103,32,108,105,110,101,
-40,38,77,41,0,83,104,111,119,32,82,117,108,101,114,32,
-103,117,105,100,101,40,38,76,41,0,84,111,111,108,98,97,
-114,40,38,84,41,0,83,116,97,116,117,115,32,98,97,114,
-40,38,83,41,0,67,117,114,115,111,114,32,112,111,115,105,
-116,105,111,110,40,38,85,41,0,68,105,115,112,108,97,121,
-32,108,97,121,101,114,32,110,97,109,101,32,119,104,101,110,
-32,111,112,101,114,97,116,105,110,103,32,99,97,110,118,97,
-115,40,38,65,41,0,67,97,110,118,97,115,32,122,111,111,
-109,32,114,97,116,101,40,38,67,41,0,67,97,110,118,97,
-115,32,114,111,116,97,116,101,40,38,82,41,0,68,105,115,
-112,108,97,121,32,99,111,111,114,100,105,110,97,116,101,115,
-32,111,102,32,115,101,108,101,99,116,101,100,32,114,101,99,
-116,97,110,103,108,101,40,38,90,41,0,83,101,116,32,116,
-111,32,97,108,108,32,119,105,110,100,111,119,32,109,111,100,
-101,40,38,77,41,0,65,108,108,32,115,116,111,114,101,100,
-32,105,110,32,112,97,110,101,115,40,38,83,41,0,84,111,
-111,108,40,38,84,41,0,84,111,111,108,32,108,105,115,116,
-40,38,69,41,0,66,114,117,115,104,32,115,101,116,116,105,
-110,103,40,38,66,41,0,79,112,116,105,111,110,40,38,79,
-41,0,76,97,121,101,114,40,38,76,41,0,67,111,108,111,
-114,40,38,67,41,0,67,111,108,111,114,32,119,104,101,101,
-108,40,38,72,41,0,67,111,108,111,114,32,112,97,108,101,
-116,116,101,40,38,80,41,0,67,97,110,118,97,115,32,111,
-112,101,114,97,116,105,111,110,40,38,82,41,0,67,97,110,
-118,97,115,32,118,105,101,119,40,38,87,41,0,73,109,97,
-103,101,32,118,105,101,119,101,114,40,38,73,41,0,70,105,
-108,116,101,114,32,108,105,115,116,40,38,70,41,0,90,111,
-111,109,32,105,110,40,38,85,41,0,90,111,111,109,32,111,
-117,116,40,38,68,41,0,49,48,48,37,40,38,79,41,0,
-70,105,116,32,119,105,110,100,111,119,40,38,70,41,0,111,
-110,101,32,115,116,101,112,32,116,111,32,116,104,101,32,108,
-101,102,116,40,38,76,41,0,111,110,101,32,115,116,101,112,
-32,116,111,32,116,104,101,32,114,105,103,104,116,40,38,82,
-41,0,48,32,100,101,103,114,101,101,0,57,48,32,100,101,
-103,114,101,101,0,49,56,48,32,100,101,103,114,101,101,0,
-50,55,48,32,100,101,103,114,101,101,0,67,111,108,111,114,
-0,67,111,108,111,114,32,114,101,112,108,97,99,101,109,101,
-110,116,0,65,108,112,104,97,40,99,104,101,99,107,101,100,
-32,108,97,121,101,114,41,0,65,108,112,104,97,40,99,117,
-114,114,101,110,116,32,108,97,121,101,114,41,0,66,108,117,
-114,0,80,97,105,110,116,0,70,111,114,32,99,111,109,105,
-99,0,80,105,120,101,108,105,122,97,116,105,111,110,0,79,
-117,116,108,105,110,101,0,69,102,102,101,99,116,0,84,114,
-97,110,115,102,111,114,109,97,116,105,111,110,0,79,116,104,
-101,114,115,0,66,114,105,103,104,116,110,101,115,115,47,67,
-111,110,116,114,97,115,116,46,46,46,0,71,97,109,109,97,
-46,46,46,0,76,101,118,101,108,46,46,46,0,82,71,66,
-32,97,100,106,117,115,116,109,101,110,116,46,46,46,0,72,
-83,86,32,97,100,106,117,115,116,109,101,110,116,46,46,46,
-0,72,83,76,32,97,100,106,117,115,116,109,101,110,116,46,
-46,46,0,78,101,103,97,116,105,118,101,45,112,111,115,105,
-116,105,118,101,32,114,101,118,101,114,115,97,108,0,71,114,
-97,121,115,99,97,108,101,0,83,101,112,105,97,32,99,111,
-108,111,114,0,71,114,97,100,105,101,110,116,32,109,97,112,
-32,40,103,114,97,100,97,116,105,111,110,32,116,111,111,108,
-41,0,84,104,114,101,115,104,111,108,100,105,110,103,46,46,
-46,0,84,104,114,101,115,104,111,108,100,105,110,103,32,40,
-68,105,116,104,101,114,41,46,46,46,0,80,111,115,116,101,
-114,105,122,97,116,105,111,110,46,46,46,0,67,104,97,110,
-103,101,32,100,114,97,119,105,110,103,32,99,111,108,111,114,
-46,46,46,0,67,104,97,110,103,101,32,100,114,97,119,105,
-110,103,32,99,111,108,111,114,32,116,111,32,116,114,97,110,
-115,112,97,114,101,110,116,0,67,104,97,110,103,101,32,101,
-120,99,101,112,116,32,111,102,32,100,114,97,119,105,110,103,
-32,99,111,108,111,114,32,116,111,32,116,114,97,110,115,112,
-97,114,101,110,116,0,67,104,97,110,103,101,32,100,114,97,
-119,105,110,103,32,99,111,108,111,114,32,116,111,32,98,97,
-99,107,103,114,111,117,110,100,0,67,104,97,110,103,101,32,
-116,114,97,110,115,112,97,114,101,110,116,32,116,111,32,100,
-114,97,119,105,110,103,32,99,111,108,111,114,0,40,109,117,
-108,116,105,112,108,101,41,32,97,108,108,32,116,114,97,110,
-115,112,97,114,101,110,99,121,32,112,111,105,110,116,32,116,
-111,32,116,114,97,110,115,112,97,114,101,110,116,0,40,109,
-117,108,116,105,112,108,101,41,32,101,105,116,104,101,114,32,
-111,110,101,32,111,112,97,113,117,101,32,112,111,105,110,116,
-32,116,111,32,116,114,97,110,115,112,97,114,101,110,116,0,
-40,109,117,108,116,105,112,108,101,41,32,97,108,108,32,98,
-108,101,110,100,105,110,103,32,97,110,100,32,99,111,112,121,
-0,40,109,117,108,116,105,112,108,101,41,32,97,100,100,32,
-97,108,108,32,118,97,108,117,101,115,0,40,109,117,108,116,
-105,112,108,101,41,32,115,117,98,116,114,97,99,116,32,97,
-108,108,32,118,97,108,117,101,115,0,40,109,117,108,116,105,
-112,108,101,41,32,109,117,108,116,105,112,108,121,32,97,108,
-108,32,118,97,108,117,101,115,0,40,115,105,110,103,108,101,
-41,32,115,101,116,32,114,101,118,101,114,115,101,32,98,114,
-105,103,104,116,110,101,115,115,32,111,102,32,99,104,101,99,
-107,101,100,32,108,97,121,101,114,0,40,115,105,110,103,108,
-101,41,32,115,101,116,32,98,114,105,103,104,116,110,101,115,
-115,32,111,102,32,99,104,101,99,107,101,100,32,108,97,121,
-101,114,0,83,101,116,32,98,114,105,103,104,116,110,101,115,
-115,32,114,101,118,101,114,115,101,100,0,83,101,116,32,102,
-114,111,109,32,98,114,105,103,104,116,110,101,115,115,0,65,
-108,108,32,111,112,97,113,117,101,32,116,111,32,109,97,120,
-32,111,112,97,113,117,101,0,84,101,120,116,117,114,101,32,
-97,112,112,108,105,99,97,116,105,111,110,0,67,114,101,97,
-116,101,32,103,114,97,121,115,99,97,108,101,32,102,114,111,
-109,32,97,108,112,104,97,32,118,97,108,117,101,0,66,108,
-117,114,46,46,46,0,71,97,117,115,115,32,98,108,117,114,
-46,46,46,0,77,111,116,105,111,110,32,98,108,117,114,46,
-46,46,0,82,97,100,105,97,108,32,98,108,117,114,46,46,
-46,0,76,101,110,115,32,98,108,117,114,46,46,46,0,67,
-108,111,117,100,115,46,46,46,0,68,111,116,32,112,97,116,
-116,101,114,110,46,46,46,0,82,97,110,100,111,109,32,112,
-111,105,110,116,32,100,114,97,119,46,46,46,0,68,114,97,
-119,32,112,111,105,110,116,115,32,97,108,111,110,103,32,116,
-104,101,32,114,105,109,46,46,46,0,66,111,114,100,101,114,
-46,46,46,0,72,111,114,105,122,111,110,116,97,108,32,97,
-110,100,32,118,101,114,116,105,99,97,108,32,108,105,110,101,
-115,46,46,46,0,80,108,97,105,100,46,46,46,0,68,111,
-116,32,112,97,116,116,101,114,110,32,103,101,110,101,114,97,
-116,105,111,110,46,46,46,0,84,111,32,100,111,116,32,112,
-97,116,116,101,114,110,46,46,46,0,84,111,32,115,97,110,
-100,32,116,111,110,101,46,46,46,0,67,111,110,99,101,110,
-116,114,97,116,105,111,110,32,108,105,110,101,46,46,46,0,
-70,108,97,115,104,32,40,114,105,110,103,32,111,102,32,102,
-105,114,101,41,46,46,46,0,83,111,108,105,100,32,102,108,
-97,115,104,32,40,115,117,110,41,46,46,46,0,85,110,105,
-32,102,108,97,115,104,46,46,46,0,85,110,105,32,102,108,
-97,115,104,32,40,119,97,118,101,41,46,46,46,0,77,111,
-115,97,105,99,46,46,46,0,67,114,121,115,116,97,108,46,
-46,46,0,72,97,108,102,32,116,111,110,101,46,46,46,0,
-83,104,97,114,112,46,46,46,0,85,110,115,104,97,114,112,
-32,109,97,115,107,46,46,46,0,67,111,110,116,111,117,114,
-32,101,120,116,114,97,99,116,105,111,110,32,40,83,111,98,
-101,108,41,0,67,111,110,116,111,117,114,32,101,120,116,114,
-97,99,116,105,111,110,32,40,76,97,112,108,97,99,105,97,
-110,41,0,72,105,103,104,45,112,97,115,115,46,46,46,0,
-71,108,111,119,46,46,46,0,82,71,66,32,111,102,102,115,
-101,116,46,46,46,0,79,105,108,32,112,97,105,110,116,105,
-110,103,46,46,46,0,69,109,98,111,115,115,46,46,46,0,
-78,111,105,115,101,46,46,46,0,69,102,102,117,115,105,111,
-110,46,46,46,0,83,99,114,97,116,99,104,46,46,46,0,
-77,101,100,105,97,110,46,46,46,0,66,108,117,114,46,46,
-46,0,87,97,118,101,46,46,46,0,82,105,112,112,108,101,
-46,46,46,0,80,111,108,97,114,32,99,111,111,114,100,105,
-110,97,116,101,115,46,46,46,0,82,97,100,105,97,108,32,
-111,102,102,115,101,116,46,46,46,0,83,112,105,114,97,108,
-46,46,46,0,69,120,116,114,97,99,116,105,111,110,32,111,
-102,32,108,105,110,101,32,100,114,97,119,105,110,103,0,49,
-112,120,32,100,111,116,32,108,105,110,101,32,99,111,114,114,
-101,99,116,105,111,110,0,65,110,116,105,45,97,108,105,97,
-115,105,110,103,46,46,46,0,69,100,103,105,110,103,46,46,
-46,0,84,104,114,101,101,45,100,105,109,101,110,115,105,111,
-110,97,108,32,102,114,97,109,101,46,46,46,0,83,104,105,
-102,116,46,46,46,0,67,111,110,102,105,114,109,0,68,101,
-108,101,116,101,46,10,84,104,105,115,32,112,114,111,99,101,
-115,115,32,105,115,32,105,114,114,101,118,101,114,115,105,98,
-108,101,46,32,73,115,32,105,116,32,79,75,63,0,70,97,
-105,108,101,100,32,116,111,32,114,101,97,100,0,70,97,105,
-108,101,100,32,116,111,32,115,97,118,101,0,84,104,101,32,
-102,105,108,101,32,100,111,101,115,32,110,111,116,32,101,120,
-105,115,116,46,10,68,101,108,101,116,101,32,102,114,111,109,
-32,104,105,115,116,111,114,121,46,0,70,97,105,108,101,100,
-32,116,111,32,99,114,101,97,116,101,32,116,104,101,32,119,
+101,114,97,116,105,111,110,0,68,114,97,119,105,110,103,32,
+116,121,112,101,32,111,112,101,114,97,116,105,111,110,32,98,
+121,32,107,101,121,43,111,112,101,114,97,116,105,111,110,0,
+83,101,108,101,99,116,105,111,110,32,116,111,111,108,32,111,
+112,101,114,97,116,105,111,110,32,98,121,32,107,101,121,43,
+111,112,101,114,97,116,105,111,110,0,82,101,103,105,115,116,
+114,97,116,105,111,110,32,116,111,111,108,32,111,112,101,114,
+97,116,105,111,110,32,98,121,32,107,101,121,43,111,112,101,
+114,97,116,105,111,110,0,79,116,104,101,114,32,111,112,101,
+114,97,116,105,111,110,115,32,98,121,32,107,101,121,43,111,
+112,101,114,97,116,105,111,110,0,82,117,108,101,114,32,79,
+78,47,79,70,70,0,85,110,100,111,0,82,101,100,111,0,
+90,111,111,109,32,114,97,116,101,32,111,110,101,32,108,101,
+118,101,108,32,101,120,112,97,110,100,0,90,111,111,109,32,
+114,97,116,101,32,111,110,101,32,108,101,118,101,108,32,114,
+101,100,117,99,101,0,67,97,110,118,97,115,32,114,111,116,
+97,116,105,111,110,32,114,101,115,101,116,0,68,114,97,119,
+105,110,103,47,98,97,99,107,103,114,111,117,110,100,32,99,
+111,108,111,114,32,105,110,116,101,114,99,104,97,110,103,101,
+0,83,101,108,101,99,116,32,111,110,101,32,108,97,121,101,
+114,32,97,98,111,118,101,0,83,101,108,101,99,116,32,111,
+110,101,32,108,97,121,101,114,32,98,101,108,111,119,0,67,
+117,114,114,101,110,116,32,108,97,121,101,114,32,118,105,115,
+105,98,108,101,47,105,110,118,105,115,105,98,108,101,0,83,
+101,108,101,99,116,32,116,104,101,32,110,101,120,116,32,105,
+116,101,109,32,105,110,32,116,104,101,32,116,111,111,108,32,
+108,105,115,116,0,83,101,108,101,99,116,32,116,104,101,32,
+112,114,101,118,105,111,117,115,32,105,116,101,109,32,105,110,
+32,116,104,101,32,116,111,111,108,32,108,105,115,116,0,84,
+111,111,108,32,108,105,115,116,44,32,115,119,105,116,99,104,
+32,116,111,32,108,97,115,116,32,115,101,108,101,99,116,101,
+100,32,105,116,101,109,0,83,101,108,101,99,116,58,32,114,
+101,99,116,97,110,103,108,101,0,83,101,108,101,99,116,58,
+32,112,111,108,121,103,111,110,0,83,101,108,101,99,116,58,
+32,102,114,101,101,104,97,110,100,0,77,111,118,101,32,105,
+109,97,103,101,0,67,111,112,121,32,105,109,97,103,101,0,
+77,111,118,101,32,115,101,108,101,99,116,105,111,110,32,112,
+111,115,105,116,105,111,110,0,67,104,97,110,103,101,32,122,
+111,111,109,32,114,97,116,101,32,40,117,112,45,100,111,119,
+110,32,100,114,97,103,41,0,67,104,97,110,103,101,32,98,
+114,117,115,104,32,115,105,122,101,32,40,108,101,102,116,45,
+114,105,103,104,116,32,100,114,97,103,41,0,83,101,108,101,
+99,116,32,103,114,97,98,98,101,100,32,108,97,121,101,114,
+0,82,101,115,101,116,0,80,114,111,99,101,115,115,32,111,
+110,108,121,32,119,105,116,104,105,110,32,116,104,101,32,99,
+97,110,118,97,115,0,66,114,105,103,104,116,110,101,115,115,
+0,67,111,110,116,114,97,115,116,0,71,97,109,109,97,32,
+118,97,108,117,101,0,72,117,101,0,83,97,116,117,114,97,
+116,105,111,110,0,84,104,114,101,115,104,111,108,100,0,84,
+121,112,101,0,84,111,110,101,0,82,97,100,105,117,115,0,
+65,110,103,108,101,0,83,116,114,101,110,103,116,104,0,89,
+111,117,32,99,97,110,32,99,104,97,110,103,101,32,116,104,
+101,32,99,101,110,116,101,114,32,112,111,115,105,116,105,111,
+110,10,98,121,32,108,101,102,116,45,99,108,105,99,107,105,
+110,103,32,111,110,32,116,104,101,32,99,97,110,118,97,115,
+0,69,109,112,104,97,115,105,115,0,78,117,109,98,101,114,
+32,111,102,32,99,121,99,108,101,115,0,67,108,97,114,105,
+116,121,0,67,111,108,111,114,0,83,105,122,101,0,68,101,
+110,115,105,116,121,0,65,110,116,105,45,97,108,105,97,115,
+105,110,103,0,65,109,111,117,110,116,0,82,97,110,100,111,
+109,58,114,97,100,105,117,115,40,37,41,0,82,97,110,100,
+111,109,58,68,101,110,115,105,116,121,40,37,41,0,80,111,
+105,110,116,32,116,121,112,101,0,84,104,105,99,107,110,101,
+115,115,0,77,105,110,105,109,117,109,32,116,104,105,99,107,
+110,101,115,115,0,77,97,120,105,109,117,109,32,116,104,105,
+99,107,110,101,115,115,0,77,105,110,105,109,117,109,32,105,
+110,116,101,114,118,97,108,0,77,97,120,105,109,117,109,32,
+105,110,116,101,114,118,97,108,0,72,111,114,105,122,111,110,
+116,97,108,32,108,105,110,101,0,86,101,114,116,105,99,97,
+108,32,108,105,110,101,0,87,105,100,116,104,0,72,101,105,
+103,104,116,0,77,97,107,101,32,116,104,101,32,104,101,105,
+103,104,116,32,116,104,101,32,115,97,109,101,32,97,115,32,
+116,104,101,32,119,105,100,116,104,0,85,115,101,32,97,118,
+101,114,97,103,101,32,99,111,108,111,114,0,65,110,103,108,
+101,32,82,0,65,110,103,108,101,32,71,0,65,110,103,108,
+101,32,66,0,77,97,107,101,32,97,108,108,32,97,110,103,
+108,101,115,32,116,104,101,32,115,97,109,101,32,97,115,32,
+82,0,71,114,97,121,115,99,97,108,101,0,65,112,112,108,
+105,99,97,98,108,101,32,97,109,111,117,110,116,0,68,105,
+115,116,97,110,99,101,0,82,101,118,101,114,115,101,0,76,
+101,110,103,116,104,0,87,105,100,116,104,0,76,111,111,112,
+32,116,104,101,32,101,110,100,115,0,66,97,99,107,103,114,
+111,117,110,100,0,83,99,97,108,101,0,78,117,109,98,101,
+114,32,111,102,32,116,105,109,101,115,0,83,111,117,114,99,
+101,32,105,115,32,99,104,101,99,107,101,100,32,108,97,121,
+101,114,0,67,114,111,112,32,116,104,101,32,115,111,117,114,
+99,101,32,105,109,97,103,101,0,83,109,111,111,116,104,0,
+78,117,109,98,101,114,32,111,102,32,108,105,110,101,115,0,
+70,105,120,101,100,32,100,101,110,115,105,116,121,0,77,97,
+107,101,32,116,104,101,32,98,97,99,107,103,114,111,117,110,
+100,32,119,104,105,116,101,0,65,115,112,101,99,116,32,114,
+97,116,105,111,0,68,101,110,115,105,116,121,0,73,110,116,
+101,114,118,97,108,58,82,97,110,100,111,109,0,84,104,105,
+99,107,110,101,115,115,58,82,97,110,100,111,109,0,76,101,
+110,103,116,104,58,82,97,110,100,111,109,0,87,97,118,101,
+32,108,101,110,103,116,104,0,84,104,105,99,107,110,101,115,
+115,32,102,97,100,101,32,111,117,116,0,83,105,109,112,108,
+101,32,112,114,101,118,105,101,119,0,80,114,101,118,105,101,
+119,32,105,110,32,114,101,100,0,66,97,121,101,114,50,120,
+50,0,66,97,121,101,114,52,120,52,0,83,112,105,114,97,
+108,0,68,111,116,0,82,97,110,100,111,109,0,0,66,108,
+97,99,107,47,87,104,105,116,101,0,68,114,97,119,105,110,
+103,47,66,97,99,107,103,114,111,117,110,100,0,66,108,97,
+99,107,43,65,108,112,104,97,0,0,68,114,97,119,105,110,
+103,32,99,111,108,111,114,0,66,97,99,107,103,114,111,117,
+110,100,32,99,111,108,111,114,0,66,108,97,99,107,0,87,
+104,105,116,101,0,0,68,111,116,32,99,105,114,99,108,101,
+0,65,110,116,105,45,97,108,105,97,115,105,110,103,32,99,
+105,114,99,108,101,0,83,111,102,116,32,99,105,114,99,108,
+101,0,0,68,114,97,119,105,110,103,32,99,111,108,111,114,
+0,82,97,110,100,111,109,40,103,114,97,121,115,99,97,108,
+101,41,0,82,97,110,100,111,109,40,82,71,66,41,0,82,
+97,110,100,111,109,40,72,117,101,41,0,82,97,110,100,111,
+109,40,115,97,116,117,114,97,116,105,111,110,32,111,102,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,41,0,82,
+97,110,100,111,109,40,98,114,105,103,104,116,110,101,115,115,
+32,111,102,32,100,114,97,119,105,110,103,32,99,111,108,111,
+114,41,0,0,79,117,116,101,114,32,115,105,100,101,32,111,
+102,32,111,112,97,99,105,116,121,32,97,114,101,97,0,73,
+110,110,101,114,32,115,105,100,101,32,111,102,32,111,112,97,
+99,105,116,121,32,97,114,101,97,0,0,83,108,97,110,116,
+0,72,111,114,105,122,111,110,116,97,108,0,86,101,114,116,
+105,99,97,108,0,0,77,105,110,105,109,117,109,0,77,105,
+100,100,108,101,0,77,97,120,105,109,117,109,0,0,72,111,
+114,105,122,111,110,116,97,108,32,111,110,108,121,0,86,101,
+114,116,105,99,97,108,32,111,110,108,121,0,66,111,116,104,
+0,0,82,101,99,116,97,110,103,117,108,97,114,32,99,111,
+111,114,100,105,110,97,116,101,115,32,45,62,32,80,111,108,
+97,114,32,99,111,111,114,100,105,110,97,116,101,115,0,80,
+111,108,97,114,32,99,111,111,114,100,105,110,97,116,101,115,
+32,45,62,32,82,101,99,116,97,110,103,117,108,97,114,32,
+99,111,111,114,100,105,110,97,116,101,115,0,0,84,114,97,
+110,115,112,97,114,101,110,116,0,83,105,100,101,32,99,111,
+108,111,114,0,84,104,97,116,32,119,97,121,0,0,66,114,
+117,115,104,40,97,110,116,105,45,97,108,105,97,115,105,110,
+103,41,0,66,114,117,115,104,40,110,111,32,97,110,116,105,
+45,97,108,105,97,115,105,110,103,41,0,49,112,120,32,100,
+111,116,32,112,101,110,0,0,80,97,110,101,108,32,108,97,
+121,111,117,116,32,115,101,116,116,105,110,103,0,80,97,110,
+101,108,0,80,97,110,101,0,80,97,110,101,37,100,0,67,
+97,110,118,97,115,0,84,111,111,108,98,97,114,32,99,117,
+115,116,111,109,105,122,97,116,105,111,110,0,45,45,45,32,
+83,101,112,97,114,97,116,105,111,110,32,45,45,45,0,69,
+110,118,105,114,111,110,109,101,110,116,97,108,32,115,101,116,
+116,105,110,103,0,83,101,116,116,105,110,103,32,49,0,70,
+108,97,103,115,0,66,117,116,116,111,110,32,111,112,101,114,
+97,116,105,111,110,0,73,110,116,101,114,102,97,99,101,0,
+83,121,115,116,101,109,0,67,97,110,118,97,115,32,98,97,
+99,107,103,114,111,117,110,100,32,99,111,108,111,114,0,80,
+108,97,105,100,32,98,97,99,107,103,114,111,117,110,100,32,
+99,111,108,111,114,0,82,117,108,101,114,32,103,117,105,100,
+101,32,99,111,108,111,114,0,68,101,102,97,117,108,116,32,
+110,117,109,98,101,114,32,111,102,32,98,105,116,115,32,119,
+104,101,110,32,114,101,97,100,105,110,103,32,97,110,32,105,
+109,97,103,101,0,77,97,120,105,109,117,109,32,110,117,109,
+98,101,114,32,111,102,32,117,110,100,111,115,32,91,50,45,
+52,48,48,93,0,77,97,120,105,109,117,109,32,117,110,100,
+111,32,98,117,102,102,101,114,32,115,105,122,101,0,79,110,
+101,32,115,116,101,112,32,111,102,32,99,97,110,118,97,115,
+32,100,105,115,112,108,97,121,32,109,97,103,110,105,102,105,
+99,97,116,105,111,110,32,40,97,116,32,49,48,48,37,32,
+111,114,32,109,111,114,101,41,0,79,110,101,32,115,116,101,
+112,32,111,102,32,99,97,110,118,97,115,32,114,111,116,97,
+116,105,111,110,0,78,117,109,98,101,114,32,111,102,32,116,
+104,114,101,97,100,115,32,102,111,114,32,112,114,111,99,101,
+115,115,105,110,103,32,40,48,61,97,117,116,111,41,0,65,
+117,116,111,115,97,118,101,32,105,110,116,101,114,118,97,108,
+32,40,109,105,110,117,116,101,115,44,32,48,61,111,102,102,
+41,0,73,109,97,103,101,32,109,101,109,111,114,121,32,108,
+105,109,105,116,44,32,101,120,99,101,115,115,32,105,115,32,
+115,119,97,112,112,101,100,32,116,111,32,97,32,102,105,108,
+101,32,40,77,105,66,44,32,48,61,117,110,108,105,109,105,
+116,101,100,41,0,65,80,68,32,115,97,118,101,32,99,111,
+109,112,114,101,115,115,105,111,110,32,108,101,118,101,108,32,
+40,48,45,57,41,0,67,111,110,102,105,114,109,32,119,104,
+101,110,32,111,118,101,114,119,114,105,116,105,110,103,0,67,
+104,101,99,107,32,119,104,101,110,32,111,118,101,114,119,114,
+105,116,105,110,103,32,105,110,32,97,32,102,111,114,109,97,
+116,32,111,116,104,101,114,32,116,104,97,110,32,65,80,68,
+0,68,111,32,110,111,116,32,119,114,105,116,101,32,97,32,
+115,105,110,103,108,101,32,112,105,99,116,117,114,101,32,105,
+109,97,103,101,32,119,104,101,110,32,115,97,118,105,110,103,
+32,65,80,68,0,40,80,97,110,101,108,41,32,70,105,108,
+116,101,114,32,108,105,115,116,32,105,116,101,109,115,32,99,
+97,110,32,98,101,32,101,120,101,99,117,116,101,100,32,98,
+121,32,100,111,117,98,108,101,45,99,108,105,99,107,105,110,
+103,0,78,111,114,109,97,108,32,100,101,118,105,99,101,0,
+68,101,118,105,99,101,115,32,119,105,116,104,32,112,114,101,
+115,115,117,114,101,0,67,111,109,109,97,110,100,32,115,101,
+108,101,99,116,105,111,110,0,71,101,116,32,98,117,116,116,
+111,110,0,66,117,116,116,111,110,0,67,111,109,109,97,110,
+100,0,87,104,101,110,32,121,111,117,32,112,114,101,115,115,
+32,116,104,101,32,98,117,116,116,111,110,32,111,102,32,101,
+97,99,104,32,100,101,118,105,99,101,32,111,110,32,116,104,
+101,32,34,71,101,116,32,66,117,116,116,111,110,34,32,97,
+114,101,97,44,10,116,104,101,32,105,116,101,109,32,111,102,
+32,116,104,97,116,32,98,117,116,116,111,110,32,105,115,32,
+115,101,108,101,99,116,101,100,32,105,110,32,116,104,101,32,
+108,105,115,116,46,0,78,111,116,32,115,112,101,99,105,102,
+105,101,100,32,40,100,101,102,97,117,108,116,32,111,112,101,
+114,97,116,105,111,110,41,0,84,111,111,108,32,111,112,101,
+114,97,116,105,111,110,0,82,101,103,105,115,116,114,97,116,
+105,111,110,32,116,111,111,108,32,111,112,101,114,97,116,105,
+111,110,0,79,116,104,101,114,32,111,112,101,114,97,116,105,
+111,110,0,79,116,104,101,114,32,99,111,109,109,97,110,100,
+115,0,80,97,110,101,108,32,102,111,110,116,32,91,42,93,
+0,73,99,111,110,32,115,105,122,101,32,91,42,93,0,84,
+111,111,108,98,97,114,0,84,111,111,108,0,79,116,104,101,
+114,0,84,111,111,108,98,97,114,32,99,117,115,116,111,109,
+105,122,97,116,105,111,110,0,87,111,114,107,105,110,103,32,
+100,105,114,101,99,116,111,114,121,32,91,42,93,0,85,115,
+101,114,39,115,32,98,114,117,115,104,32,105,109,97,103,101,
+32,100,105,114,101,99,116,111,114,121,0,85,115,101,114,39,
+115,32,116,101,120,116,117,114,101,32,105,109,97,103,101,32,
+100,105,114,101,99,116,111,114,121,0,68,114,97,119,105,110,
+103,32,99,117,114,115,111,114,0,73,109,97,103,101,32,102,
+105,108,101,32,40,116,114,97,110,115,112,97,114,101,110,116,
+32,111,114,32,80,78,71,32,119,105,116,104,32,97,108,112,
+104,97,41,0,67,101,110,116,101,114,32,112,111,115,105,116,
+105,111,110,32,40,116,104,101,32,117,112,112,101,114,32,108,
+101,102,116,32,111,102,32,116,104,101,32,105,109,97,103,101,
+32,105,115,32,40,48,44,48,41,41,0,91,42,93,32,61,
+32,65,112,112,108,121,32,97,116,32,110,101,120,116,32,115,
+116,97,114,116,117,112,0,83,101,116,32,116,104,101,32,119,
 111,114,107,105,110,103,32,100,105,114,101,99,116,111,114,121,
-46,10,85,110,100,111,32,100,111,101,115,32,110,111,116,32,
-119,111,114,107,32,112,114,111,112,101,114,108,121,46,0,68,
-111,32,121,111,117,32,119,97,110,116,32,116,111,32,111,118,
-101,114,119,114,105,116,101,32,105,116,63,0,73,32,97,109,
-32,116,114,121,105,110,103,32,116,111,32,111,118,101,114,119,
-114,105,116,101,32,97,110,100,32,115,97,118,101,32,105,110,
-32,97,32,102,111,114,109,97,116,32,111,116,104,101,114,32,
-116,104,97,110,32,65,80,68,46,10,68,111,32,121,111,117,
-32,119,97,110,116,32,116,111,32,111,118,101,114,119,114,105,
-116,101,32,97,110,100,32,115,97,118,101,32,97,115,32,105,
-116,32,105,115,63,0,84,104,101,32,105,109,97,103,101,32,
-104,97,115,32,99,104,97,110,103,101,100,46,10,68,111,32,
-121,111,117,32,119,97,110,116,32,116,111,32,115,97,118,101,
-32,105,116,63,0,84,104,101,32,111,108,100,32,118,101,114,
-115,105,111,110,32,111,102,32,116,104,101,32,115,101,116,116,
-105,110,103,115,32,100,105,114,101,99,116,111,114,121,32,101,
-120,105,115,116,115,46,10,68,111,32,121,111,117,32,119,97,
-110,116,32,116,111,32,99,111,110,118,101,114,116,32,116,104,
-101,32,118,101,114,32,50,32,99,111,110,102,105,103,117,114,
-97,116,105,111,110,32,102,105,108,101,63,10,40,66,114,117,
-115,104,47,67,111,108,111,114,32,112,97,108,101,116,116,101,
-47,71,114,97,100,105,101,110,116,32,111,110,108,121,41,0,
-78,111,32,116,101,120,116,32,105,115,32,97,100,100,101,100,
-32,98,101,99,97,117,115,101,32,116,104,101,114,101,32,105,
-115,32,110,111,32,100,114,97,119,105,110,103,32,114,97,110,
-103,101,0,65,112,112,108,121,105,110,103,32,97,32,102,105,
-108,116,101,114,32,104,97,115,32,110,111,32,101,102,102,101,
-99,116,10,97,115,32,116,104,101,114,101,32,97,114,101,32,
-110,111,32,99,111,108,111,114,32,118,97,108,117,101,115,32,
-105,110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,
-97,121,101,114,0,80,108,101,97,115,101,32,115,101,116,32,
-97,32,99,104,101,99,107,32,102,111,114,32,116,104,101,32,
-116,97,114,103,101,116,32,108,97,121,101,114,0,83,101,116,
-32,116,104,101,32,116,101,120,116,117,114,101,32,105,110,32,
-116,104,101,32,111,112,116,105,111,110,115,32,112,97,110,101,
-108,0,69,114,114,111,114,0,70,97,105,108,101,100,32,116,
-111,32,97,108,108,111,99,97,116,101,32,109,101,109,111,114,
-121,0,73,109,97,103,101,32,115,105,122,101,32,101,120,99,
-101,101,100,115,32,108,105,109,105,116,0,85,110,115,117,112,
-112,111,114,116,101,100,32,102,111,114,109,97,116,0,84,104,
-101,32,102,105,108,101,32,105,115,32,99,111,114,114,117,112,
-116,101,100,0,73,102,32,116,104,101,32,71,73,70,32,101,
-120,99,101,101,100,115,32,50,53,54,32,99,111,108,111,114,
-115,44,32,105,116,32,99,97,110,110,111,116,32,98,101,32,
-115,97,118,101,100,0,87,69,66,80,32,99,97,110,110,111,
-116,32,115,116,111,114,101,32,115,105,122,101,115,32,108,97,
-114,103,101,114,32,116,104,97,110,32,49,54,51,56,51,32,
-112,120,0,84,104,101,32,99,117,114,114,101,110,116,32,108,
-97,121,101,114,32,105,115,32,97,32,102,111,108,100,101,114,
-0,84,104,101,32,99,117,114,114,101,110,116,32,108,97,121,
-101,114,32,105,115,32,97,32,116,101,120,116,32,108,97,121,
-101,114,0,76,97,121,101,114,32,105,115,32,100,114,97,119,
-105,110,103,32,108,111,99,107,101,100,0,84,104,101,32,99,
-117,114,114,101,110,116,32,108,97,121,101,114,32,105,115,32,
-104,105,100,100,101,110,0,67,97,110,110,111,116,32,100,114,
-97,119,32,119,104,105,108,101,32,112,97,115,116,105,110,103,
-32,97,110,100,32,109,111,118,105,110,103,0,79,75,0,67,
-97,110,99,101,108,0,89,101,115,0,78,111,0,83,97,118,
-101,0,68,111,110,39,116,32,83,97,118,101,0,65,98,111,
-114,116,0,68,111,110,39,116,32,115,104,111,119,32,116,104,
-105,115,32,109,101,115,115,97,103,101,0,83,101,108,101,99,
-116,32,67,111,108,111,114,0,79,112,101,110,32,70,105,108,
-101,0,83,97,118,101,32,70,105,108,101,0,83,101,108,101,
-99,116,32,68,105,114,101,99,116,111,114,121,0,79,112,101,
-110,0,70,105,108,101,110,97,109,101,0,70,105,108,101,115,
-105,122,101,0,77,111,100,105,102,105,101,100,0,72,111,109,
-101,32,100,105,114,101,99,116,111,114,121,0,83,104,111,119,
-32,104,105,100,100,101,110,32,102,105,108,101,115,0,70,105,
-108,101,32,97,108,114,101,97,100,121,32,101,120,105,115,116,
-115,46,10,68,111,32,121,111,117,32,119,97,110,116,32,116,
-111,32,111,118,101,114,119,114,105,116,101,32,105,116,63,0,
-70,105,108,101,110,97,109,101,32,105,115,32,110,111,116,32,
-99,111,114,114,101,99,116,46,0,83,101,108,101,99,116,32,
-70,111,110,116,0,83,116,121,108,101,0,73,116,97,108,105,
-99,0,83,105,122,101,0,70,111,110,116,32,102,105,108,101,
-0,68,101,116,97,105,108,0,97,98,99,100,101,102,103,32,
-65,66,67,68,69,70,71,32,48,49,50,51,52,0
+32,112,97,116,104,32,99,111,114,114,101,99,116,108,121,0,
+48,58,69,114,97,115,101,114,32,111,102,32,116,104,101,32,
+112,101,110,0,49,58,76,101,102,116,32,98,117,116,116,111,
+110,0,50,58,82,105,103,104,116,32,98,117,116,116,111,110,
+0,51,58,77,105,100,100,108,101,32,98,117,116,116,111,110,
+0,52,58,83,99,114,111,108,108,32,117,112,0,53,58,83,
+99,114,111,108,108,32,100,111,119,110,0,54,58,83,99,114,
+111,108,108,32,108,101,102,116,0,55,58,83,99,114,111,108,
+108,32,114,105,103,104,116,0,70,105,108,101,40,38,70,41,
+0,69,100,105,116,40,38,69,41,0,76,97,121,101,114,40,
+38,76,41,0,83,101,108,101,99,116,105,111,110,40,38,83,
+41,0,70,105,108,116,101,114,40,38,84,41,0,86,105,101,
+119,40,38,86,41,0,83,101,116,116,105,110,103,40,38,79,
+41,0,78,101,119,40,38,78,41,46,46,46,0,79,112,101,
+110,40,38,79,41,46,46,46,0,83,97,118,101,40,38,83,
+41,0,83,97,118,101,32,97,115,40,38,87,41,46,46,46,
+0,83,97,118,101,32,100,117,112,108,105,99,97,116,101,40,
+38,68,41,46,46,46,0,82,101,99,101,110,116,108,121,32,
+117,115,101,100,32,102,105,108,101,115,40,38,82,41,0,69,
+120,105,116,40,38,88,41,0,67,108,101,97,114,32,104,105,
+115,116,111,114,121,40,38,67,41,0,85,110,100,111,40,38,
+90,41,0,82,101,100,111,40,38,89,41,0,70,105,108,108,
+40,38,70,41,0,69,114,97,115,101,40,38,69,41,0,67,
+104,97,110,103,101,32,99,97,110,118,97,115,32,115,105,122,
+101,40,38,83,41,46,46,46,0,73,110,116,101,103,114,97,
+116,101,32,105,109,97,103,101,115,32,116,111,32,115,99,97,
+108,101,40,38,82,41,46,46,46,0,73,109,97,103,101,32,
+115,101,116,116,105,110,103,115,40,38,79,41,46,46,46,0,
+68,114,97,119,105,110,103,32,99,111,108,111,114,32,97,115,
+32,105,109,97,103,101,32,98,97,99,107,103,114,111,117,110,
+100,32,99,111,108,111,114,40,38,66,41,0,68,101,115,101,
+108,101,99,116,40,38,68,41,0,83,101,108,101,99,116,32,
+97,108,108,40,38,65,41,0,82,101,118,101,114,115,101,40,
+38,73,41,0,69,120,112,97,110,115,105,111,110,47,82,101,
+100,117,99,116,105,111,110,40,38,69,41,46,46,46,0,67,
+111,112,121,40,38,67,41,0,67,117,116,40,38,88,41,0,
+80,97,115,116,101,32,116,111,32,110,101,119,32,108,97,121,
+101,114,40,38,86,41,0,83,101,108,101,99,116,32,116,104,
+101,32,111,112,97,113,117,101,32,97,114,101,97,32,111,102,
+32,116,104,101,32,108,97,121,101,114,40,38,79,41,0,83,
+101,108,101,99,116,32,116,104,101,32,100,114,97,119,105,110,
+103,32,99,111,108,111,114,32,97,114,101,97,32,111,102,32,
+116,104,101,32,108,97,121,101,114,40,38,76,41,0,79,117,
+116,112,117,116,32,116,104,101,32,105,109,97,103,101,32,105,
+110,32,115,101,108,101,99,116,105,111,110,32,116,111,32,97,
+32,102,105,108,101,40,38,80,41,46,46,46,0,69,110,118,
+105,114,111,110,109,101,110,116,97,108,32,115,101,116,116,105,
+110,103,40,38,69,41,46,46,46,0,71,114,105,100,32,115,
+101,116,116,105,110,103,115,40,38,71,41,46,46,46,0,77,
+101,110,117,32,107,101,121,32,115,101,116,116,105,110,103,115,
+40,38,75,41,46,46,46,0,67,97,110,118,97,115,32,107,
+101,121,32,115,101,116,116,105,110,103,115,40,38,67,41,46,
+46,46,0,80,97,110,101,108,32,108,97,121,111,117,116,32,
+115,101,116,116,105,110,103,40,38,80,41,46,46,46,0,65,
+98,111,117,116,40,38,65,41,46,46,46,0,78,101,119,32,
+108,97,121,101,114,40,38,78,41,46,46,46,0,78,101,119,
+32,102,111,108,100,101,114,40,38,70,41,0,78,101,119,32,
+108,97,121,101,114,32,102,114,111,109,32,102,105,108,101,40,
+38,73,41,46,46,46,0,67,114,101,97,116,101,32,110,101,
+119,32,111,110,32,116,111,112,32,111,102,32,116,104,101,32,
+99,117,114,114,101,110,116,32,108,97,121,101,114,40,38,81,
+41,46,46,46,0,68,117,112,108,105,99,97,116,101,40,38,
+67,41,0,68,101,108,101,116,101,40,38,68,41,0,69,114,
+97,115,101,40,38,88,41,0,77,111,118,101,32,105,109,97,
+103,101,32,100,111,119,110,32,116,111,32,108,97,121,101,114,
+32,98,101,108,111,119,40,38,90,41,0,77,101,114,103,101,
+32,119,105,116,104,32,108,97,121,101,114,32,98,101,108,111,
+119,40,38,66,41,0,77,101,114,103,101,32,118,97,114,105,
+111,117,115,32,108,97,121,101,114,115,40,38,87,41,46,46,
+46,0,77,101,114,103,101,32,97,108,108,40,38,77,41,0,
+68,105,115,112,108,97,121,32,116,111,110,101,32,108,97,121,
+101,114,32,105,110,32,103,114,97,121,115,99,97,108,101,40,
+38,84,41,0,79,117,116,112,117,116,32,116,111,32,102,105,
+108,101,40,38,83,41,46,46,46,0,83,101,116,116,105,110,
+103,115,40,38,79,41,0,66,97,116,99,104,32,99,111,110,
+118,101,114,115,105,111,110,40,38,65,41,0,69,100,105,116,
+40,38,69,41,0,86,105,101,119,40,38,86,41,0,70,111,
+108,100,101,114,40,38,74,41,0,70,108,97,103,115,40,38,
+71,41,0,76,97,121,101,114,32,115,101,116,116,105,110,103,
+115,40,38,79,41,46,46,46,0,67,104,97,110,103,101,32,
+108,97,121,101,114,32,116,121,112,101,40,38,84,41,46,46,
+46,0,67,104,97,110,103,101,32,108,105,110,101,32,99,111,
+108,111,114,40,38,67,41,46,46,46,0,78,117,109,98,101,
+114,32,111,102,32,116,111,110,101,32,108,105,110,101,115,40,
+38,76,41,46,46,46,0,70,108,105,112,32,104,111,114,105,
+122,111,110,116,97,108,40,38,72,41,0,70,108,105,112,32,
+117,112,115,105,100,101,32,100,111,119,110,40,38,86,41,0,
+82,111,116,97,116,101,32,57,48,32,100,101,103,114,101,101,
+115,32,116,111,32,116,104,101,32,108,101,102,116,40,38,76,
+41,0,82,111,116,97,116,101,32,57,48,32,100,101,103,114,
+101,101,115,32,116,111,32,116,104,101,32,114,105,103,104,116,
+40,38,82,41,0,83,104,111,119,32,97,108,108,40,38,65,
+41,0,72,105,100,101,32,97,108,108,40,38,72,41,0,83,
+104,111,119,32,111,110,108,121,32,99,117,114,114,101,110,116,
+32,108,97,121,101,114,40,38,67,41,0,84,111,103,103,108,
+101,32,99,104,101,99,107,101,100,32,108,97,121,101,114,40,
+38,75,41,0,84,111,103,103,108,101,32,108,97,121,101,114,
+115,32,111,116,104,101,114,32,116,104,97,110,32,102,111,108,
+100,101,114,115,40,38,78,41,0,77,111,118,101,32,99,104,
+101,99,107,101,100,32,108,97,121,101,114,32,116,111,32,99,
+117,114,114,101,110,116,32,102,111,108,100,101,114,40,38,77,
+41,0,67,108,111,115,101,32,111,116,104,101,114,32,116,104,
+97,110,32,116,104,101,32,99,117,114,114,101,110,116,32,102,
+111,108,100,101,114,40,38,83,41,0,79,112,101,110,32,97,
+108,108,40,38,79,41,0,82,101,108,101,97,115,101,32,97,
+108,108,32,102,105,108,108,32,114,101,102,101,114,101,110,99,
+101,115,40,38,70,41,0,85,110,108,111,99,107,32,97,108,
+108,40,38,76,41,0,85,110,99,104,101,99,107,32,97,108,
+108,40,38,75,41,0,77,105,110,105,109,105,122,101,40,38,
+78,41,0,83,104,111,119,32,112,97,110,101,108,40,38,86,
+41,0,80,97,110,101,108,40,38,80,41,0,77,105,114,114,
+111,114,32,99,97,110,118,97,115,40,38,81,41,0,83,104,
+111,119,32,98,97,99,107,103,114,111,117,110,100,32,97,115,
+32,99,104,101,99,107,32,112,97,116,116,101,114,110,40,38,
+75,41,0,83,104,111,119,32,103,114,105,100,40,38,71,41,
+0,83,104,111,119,32,100,105,118,105,100,105,110,103,32,108,
+105,110,101,40,38,77,41,0,83,104,111,119,32,82,117,108,
+101,114,32,103,117,105,100,101,40,38,76,41,0,84,111,111,
+108,98,97,114,40,38,84,41,0,83,116,97,116,117,115,32,
+98,97,114,40,38,83,41,0,67,117,114,115,111,114,32,112,
+111,115,105,116,105,111,110,40,38,85,41,0,68,105,115,112,
+108,97,121,32,108,97,121,101,114,32,110,97,109,101,32,119,
+104,101,110,32,111,112,101,114,97,116,105,110,103,32,99,97,
+110,118,97,115,40,38,65,41,0,67,97,110,118,97,115,32,
+122,111,111,109,32,114,97,116,101,40,38,67,41,0,67,97,
+110,118,97,115,32,114,111,116,97,116,101,40,38,82,41,0,
+68,105,115,112,108,97,121,32,99,111,111,114,100,105,110,97,
+116,101,115,32,111,102,32,115,101,108,101,99,116,101,100,32,
+114,101,99,116,97,110,103,108,101,40,38,90,41,0,83,101,
+116,32,116,111,32,97,108,108,32,119,105,110,100,111,119,32,
+109,111,100,101,40,38,77,41,0,65,108,108,32,115,116,111,
+114,101,100,32,105,110,32,112,97,110,101,115,40,38,83,41,
+0,84,111,111,108,40,38,84,41,0,84,111,111,108,32,108,
+105,115,116,40,38,69,41,0,66,114,117,115,104,32,115,101,
+116,116,105,110,103,40,38,66,41,0,79,112,116,105,111,110,
+40,38,79,41,0,76,97,121,101,114,40,38,76,41,0,67,
+111,108,111,114,40,38,67,41,0,67,111,108,111,114,32,119,
+104,101,101,108,40,38,72,41,0,67,111,108,111,114,32,112,
+97,108,101,116,116,101,40,38,80,41,0,67,97,110,118,97,
+115,32,111,112,101,114,97,116,105,111,110,40,38,82,41,0,
+67,97,110,118,97,115,32,118,105,101,119,40,38,87,41,0,
+73,109,97,103,101,32,118,105,101,119,101,114,40,38,73,41,
+0,70,105,108,116,101,114,32,108,105,115,116,40,38,70,41,
+0,90,111,111,109,32,105,110,40,38,85,41,0,90,111,111,
+109,32,111,117,116,40,38,68,41,0,49,48,48,37,40,38,
+79,41,0,70,105,116,32,119,105,110,100,111,119,40,38,70,
+41,0,111,110,101,32,115,116,101,112,32,116,111,32,116,104,
+101,32,108,101,102,116,40,38,76,41,0,111,110,101,32,115,
+116,101,112,32,116,111,32,116,104,101,32,114,105,103,104,116,
+40,38,82,41,0,48,32,100,101,103,114,101,101,0,57,48,
+32,100,101,103,114,101,101,0,49,56,48,32,100,101,103,114,
+101,101,0,50,55,48,32,100,101,103,114,101,101,0,67,111,
+108,111,114,0,67,111,108,111,114,32,114,101,112,108,97,99,
+101,109,101,110,116,0,65,108,112,104,97,40,99,104,101,99,
+107,101,100,32,108,97,121,101,114,41,0,65,108,112,104,97,
+40,99,117,114,114,101,110,116,32,108,97,121,101,114,41,0,
+66,108,117,114,0,80,97,105,110,116,0,70,111,114,32,99,
+111,109,105,99,0,80,105,120,101,108,105,122,97,116,105,111,
+110,0,79,117,116,108,105,110,101,0,69,102,102,101,99,116,
+0,84,114,97,110,115,102,111,114,109,97,116,105,111,110,0,
+79,116,104,101,114,115,0,66,114,105,103,104,116,110,101,115,
+115,47,67,111,110,116,114,97,115,116,46,46,46,0,71,97,
+109,109,97,46,46,46,0,76,101,118,101,108,46,46,46,0,
+82,71,66,32,97,100,106,117,115,116,109,101,110,116,46,46,
+46,0,72,83,86,32,97,100,106,117,115,116,109,101,110,116,
+46,46,46,0,72,83,76,32,97,100,106,117,115,116,109,101,
+110,116,46,46,46,0,78,101,103,97,116,105,118,101,45,112,
+111,115,105,116,105,118,101,32,114,101,118,101,114,115,97,108,
+0,71,114,97,121,115,99,97,108,101,0,83,101,112,105,97,
+32,99,111,108,111,114,0,71,114,97,100,105,101,110,116,32,
+109,97,112,32,40,103,114,97,100,97,116,105,111,110,32,116,
+111,111,108,41,0,84,104,114,101,115,104,111,108,100,105,110,
+103,46,46,46,0,84,104,114,101,115,104,111,108,100,105,110,
+103,32,40,68,105,116,104,101,114,41,46,46,46,0,80,111,
+115,116,101,114,105,122,97,116,105,111,110,46,46,46,0,67,
+104,97,110,103,101,32,100,114,97,119,105,110,103,32,99,111,
+108,111,114,46,46,46,0,67,104,97,110,103,101,32,100,114,
+97,119,105,110,103,32,99,111,108,111,114,32,116,111,32,116,
+114,97,110,115,112,97,114,101,110,116,0,67,104,97,110,103,
+101,32,101,120,99,101,112,116,32,111,102,32,100,114,97,119,
+105,110,103,32,99,111,108,111,114,32,116,111,32,116,114,97,
+110,115,112,97,114,101,110,116,0,67,104,97,110,103,101,32,
+100,114,97,119,105,110,103,32,99,111,108,111,114,32,116,111,
+32,98,97,99,107,103,114,111,117,110,100,0,67,104,97,110,
+103,101,32,116,114,97,110,115,112,97,114,101,110,116,32,116,
+111,32,100,114,97,119,105,110,103,32,99,111,108,111,114,0,
+40,109,117,108,116,105,112,108,101,41,32,97,108,108,32,116,
+114,97,110,115,112,97,114,101,110,99,121,32,112,111,105,110,
+116,32,116,111,32,116,114,97,110,115,112,97,114,101,110,116,
+0,40,109,117,108,116,105,112,108,101,41,32,101,105,116,104,
+101,114,32,111,110,101,32,111,112,97,113,117,101,32,112,111,
+105,110,116,32,116,111,32,116,114,97,110,115,112,97,114,101,
+110,116,0,40,109,117,108,116,105,112,108,101,41,32,97,108,
+108,32,98,108,101,110,100,105,110,103,32,97,110,100,32,99,
+111,112,121,0,40,109,117,108,116,105,112,108,101,41,32,97,
+100,100,32,97,108,108,32,118,97,108,117,101,115,0,40,109,
+117,108,116,105,112,108,101,41,32,115,117,98,116,114,97,99,
+116,32,97,108,108,32,118,97,108,117,101,115,0,40,109,117,
+108,116,105,112,108,101,41,32,109,117,108,116,105,112,108,121,
+32,97,108,108,32,118,97,108,117,101,115,0,40,115,105,110,
+103,108,101,41,32,115,101,116,32,114,101,118,101,114,115,101,
+32,98,114,105,103,104,116,110,101,115,115,32,111,102,32,99,
+104,101,99,107,101,100,32,108,97,121,101,114,0,40,115,105,
+110,103,108,101,41,32,115,101,116,32,98,114,105,103,104,116,
+110,101,115,115,32,111,102,32,99,104,101,99,107,101,100,32,
+108,97,121,101,114,0,83,101,116,32,98,114,105,103,104,116,
+110,101,115,115,32,114,101,118,101,114,115,101,100,0,83,101,
+116,32,102,114,111,109,32,98,114,105,103,104,116,110,101,115,
+115,0,65,108,108,32,111,112,97,113,117,101,32,116,111,32,
+109,97,120,32,111,112,97,113,117,101,0,84,101,120,116,117,
+114,101,32,97,112,112,108,105,99,97,116,105,111,110,0,67,
+114,101,97,116,101,32,103,114,97,121,115,99,97,108,101,32,
+102,114,111,109,32,97,108,112,104,97,32,118,97,108,117,101,
+0,66,108,117,114,46,46,46,0,71,97,117,115,115,32,98,
+108,117,114,46,46,46,0,77,111,116,105,111,110,32,98,108,
+117,114,46,46,46,0,82,97,100,105,97,108,32,98,108,117,
+114,46,46,46,0,76,101,110,115,32,98,108,117,114,46,46,
+46,0,67,108,111,117,100,115,46,46,46,0,68,111,116,32,
+112,97,116,116,101,114,110,46,46,46,0,82,97,110,100,111,
+109,32,112,111,105,110,116,32,100,114,97,119,46,46,46,0,
+68,114,97,119,32,112,111,105,110,116,115,32,97,108,111,110,
+103,32,116,104,101,32,114,105,109,46,46,46,0,66,111,114,
+100,101,114,46,46,46,0,72,111,114,105,122,111,110,116,97,
+108,32,97,110,100,32,118,101,114,116,105,99,97,108,32,108,
+105,110,101,115,46,46,46,0,80,108,97,105,100,46,46,46,
+0,68,111,116,32,112,97,116,116,101,114,110,32,103,101,110,
+101,114,97,116,105,111,110,46,46,46,0,84,111,32,100,111,
+116,32,112,97,116,116,101,114,110,46,46,46,0,84,111,32,
+115,97,110,100,32,116,111,110,101,46,46,46,0,67,111,110,
+99,101,110,116,114,97,116,105,111,110,32,108,105,110,101,46,
+46,46,0,70,108,97,115,104,32,40,114,105,110,103,32,111,
+102,32,102,105,114,101,41,46,46,46,0,83,111,108,105,100,
+32,102,108,97,115,104,32,40,115,117,110,41,46,46,46,0,
+85,110,105,32,102,108,97,115,104,46,46,46,0,85,110,105,
+32,102,108,97,115,104,32,40,119,97,118,101,41,46,46,46,
+0,77,111,115,97,105,99,46,46,46,0,67,114,121,115,116,
+97,108,46,46,46,0,72,97,108,102,32,116,111,110,101,46,
+46,46,0,83,104,97,114,112,46,46,46,0,85,110,115,104,
+97,114,112,32,109,97,115,107,46,46,46,0,67,111,110,116,
+111,117,114,32,101,120,116,114,97,99,116,105,111,110,32,40,
+83,111,98,101,108,41,0,67,111,110,116,111,117,114,32,101,
+120,116,114,97,99,116,105,111,110,32,40,76,97,112,108,97,
+99,105,97,110,41,0,72,105,103,104,45,112,97,115,115,46,
+46,46,0,71,108,111,119,46,46,46,0,82,71,66,32,111,
+102,102,115,101,116,46,46,46,0,79,105,108,32,112,97,105,
+110,116,105,110,103,46,46,46,0,69,109,98,111,115,115,46,
+46,46,0,78,111,105,115,101,46,46,46,0,69,102,102,117,
+115,105,111,110,46,46,46,0,83,99,114,97,116,99,104,46,
+46,46,0,77,101,100,105,97,110,46,46,46,0,66,108,117,
+114,46,46,46,0,87,97,118,101,46,46,46,0,82,105,112,
+112,108,101,46,46,46,0,80,111,108,97,114,32,99,111,111,
+114,100,105,110,97,116,101,115,46,46,46,0,82,97,100,105,
+97,108,32,111,102,102,115,101,116,46,46,46,0,83,112,105,
+114,97,108,46,46,46,0,69,120,116,114,97,99,116,105,111,
+110,32,111,102,32,108,105,110,101,32,100,114,97,119,105,110,
+103,0,49,112,120,32,100,111,116,32,108,105,110,101,32,99,
+111,114,114,101,99,116,105,111,110,0,65,110,116,105,45,97,
+108,105,97,115,105,110,103,46,46,46,0,69,100,103,105,110,
+103,46,46,46,0,84,104,114,101,101,45,100,105,109,101,110,
+115,105,111,110,97,108,32,102,114,97,109,101,46,46,46,0,
+83,104,105,102,116,46,46,46,0,67,111,110,102,105,114,109,
+0,68,101,108,101,116,101,46,10,84,104,105,115,32,112,114,
+111,99,101,115,115,32,105,115,32,105,114,114,101,118,101,114,
+115,105,98,108,101,46,32,73,115,32,105,116,32,79,75,63,
+0,70,97,105,108,101,100,32,116,111,32,114,101,97,100,0,
+70,97,105,108,101,100,32,116,111,32,115,97,118,101,0,84,
+104,101,32,102,105,108,101,32,100,111,101,115,32,110,111,116,
+32,101,120,105,115,116,46,10,68,101,108,101,116,101,32,102,
+114,111,109,32,104,105,115,116,111,114,121,46,0,70,97,105,
+108,101,100,32,116,111,32,99,114,101,97,116,101,32,116,104,
+101,32,119,111,114,107,105,110,103,32,100,105,114,101,99,116,
+111,114,121,46,10,85,110,100,111,32,100,111,101,115,32,110,
+111,116,32,119,111,114,107,32,112,114,111,112,101,114,108,121,
+46,0,68,111,32,121,111,117,32,119,97,110,116,32,116,111,
+32,111,118,101,114,119,114,105,116,101,32,105,116,63,0,73,
+32,97,109,32,116,114,121,105,110,103,32,116,111,32,111,118,
+101,114,119,114,105,116,101,32,97,110,100,32,115,97,118,101,
+32,105,110,32,97,32,102,111,114,109,97,116,32,111,116,104,
+101,114,32,116,104,97,110,32,65,80,68,46,10,68,111,32,
+121,111,117,32,119,97,110,116,32,116,111,32,111,118,101,114,
+119,114,105,116,101,32,97,110,100,32,115,97,118,101,32,97,
+115,32,105,116,32,105,115,63,0,84,104,101,32,105,109,97,
+103,101,32,104,97,115,32,99,104,97,110,103,101,100,46,10,
+68,111,32,121,111,117,32,119,97,110,116,32,116,111,32,115,
+97,118,101,32,105,116,63,0,84,104,101,32,111,108,100,32,
+118,101,114,115,105,111,110,32,111,102,32,116,104,101,32,115,
+101,116,116,105,110,103,115,32,100,105,114,101,99,116,111,114,
+121,32,101,120,105,115,116,115,46,10,68,111,32,121,111,117,
+32,119,97,110,116,32,116,111,32,99,111,110,118,101,114,116,
+32,116,104,101,32,118,101,114,32,50,32,99,111,110,102,105,
+103,117,114,97,116,105,111,110,32,102,105,108,101,63,10,40,
+66,114,117,115,104,47,67,111,108,111,114,32,112,97,108,101,
+116,116,101,47,71,114,97,100,105,101,110,116,32,111,110,108,
+121,41,0,65,117,116,111,115,97,118,101,100,32,100,97,116,
+97,32,102,114,111,109,32,97,32,115,101,115,115,105,111,110,
+32,116,104,97,116,32,100,105,100,32,110,111,116,32,101,120,
+105,116,32,110,111,114,109,97,108,108,121,32,119,97,115,32,
+102,111,117,110,100,46,10,68,111,32,121,111,117,32,119,97,
+110,116,32,116,111,32,111,112,101,110,32,105,116,63,0,78,
+111,32,116,101,120,116,32,105,115,32,97,100,100,101,100,32,
+98,101,99,97,117,115,101,32,116,104,101,114,101,32,105,115,
+32,110,111,32,100,114,97,119,105,110,103,32,114,97,110,103,
+101,0,65,112,112,108,121,105,110,103,32,97,32,102,105,108,
+116,101,114,32,104,97,115,32,110,111,32,101,102,102,101,99,
+116,10,97,115,32,116,104,101,114,101,32,97,114,101,32,110,
+111,32,99,111,108,111,114,32,118,97,108,117,101,115,32,105,
+110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,97,
+121,101,114,0,80,108,101,97,115,101,32,115,101,116,32,97,
+32,99,104,101,99,107,32,102,111,114,32,116,104,101,32,116,
+97,114,103,101,116,32,108,97,121,101,114,0,83,101,116,32,
+116,104,101,32,116,101,120,116,117,114,101,32,105,110,32,116,
+104,101,32,111,112,116,105,111,110,115,32,112,97,110,101,108,
+0,69,114,114,111,114,0,70,97,105,108,101,100,32,116,111,
+32,97,108,108,111,99,97,116,101,32,109,101,109,111,114,121,
+0,73,109,97,103,101,32,115,105,122,101,32,101,120,99,101,
+101,100,115,32,108,105,109,105,116,0,85,110,115,117,112,112,
+111,114,116,101,100,32,102,111,114,109,97,116,0,84,104,101,
+32,102,105,108,101,32,105,115,32,99,111,114,114,117,112,116,
+101,100,0,73,102,32,116,104,101,32,71,73,70,32,101,120,
+99,101,101,100,115,32,50,53,54,32,99,111,108,111,114,115,
+44,32,105,116,32,99,97,110,110,111,116,32,98,101,32,115,
+97,118,101,100,0,87,69,66,80,32,99,97,110,110,111,116,
+32,115,116,111,114,101,32,115,105,122,101,115,32,108,97,114,
+103,101,114,32,116,104,97,110,32,49,54,51,56,51,32,112,
+120,0,84,104,101,32,99,117,114,114,101,110,116,32,108,97,
+121,101,114,32,105,115,32,97,32,102,111,108,100,101,114,0,
+84,104,101,32,99,117,114,114,101,110,116,32,108,97,121,101,
+114,32,105,115,32,97,32,116,101,120,116,32,108,97,121,101,
+114,0,76,97,121,101,114,32,105,115,32,100,114,97,119,105,
+110,103,32,108,111,99,107,101,100,0,84,104,101,32,99,117,
+114,114,101,110,116,32,108,97,121,101,114,32,105,115,32,104,
+105,100,100,101,110,0,67,97,110,110,111,116,32,100,114,97,
+119,32,119,104,105,108,101,32,112,97,115,116,105,110,103,32,
+97,110,100,32,109,111,118,105,110,103,0,79,75,0,67,97,
+110,99,101,108,0,89,101,115,0,78,111,0,83,97,118,101,
+0,68,111,110,39,116,32,83,97,118,101,0,65,98,111,114,
+116,0,68,111,110,39,116,32,115,104,111,119,32,116,104,105,
+115,32,109,101,115,115,97,103,101,0,83,101,108,101,99,116,
+32,67,111,108,111,114,0,79,112,101,110,32,70,105,108,101,
+0,83,97,118,101,32,70,105,108,101,0,83,101,108,101,99,
+116,32,68,105,114,101,99,116,111,114,121,0,79,112,101,110,
+0,70,105,108,101,110,97,109,101,0,70,105,108,101,115,105,
+122,101,0,77,111,100,105,102,105,101,100,0,72,111,109,101,
+32,100,105,114,101,99,116,111,114,121,0,83,104,111,119,32,
+104,105,100,100,101,110,32,102,105,108,101,115,0,70,105,108,
+101,32,97,108,114,101,97,100,121,32,101,120,105,115,116,115,
+46,10,68,111,32,121,111,117,32,119,97,110,116,32,116,111,
+32,111,118,101,114,119,114,105,116,101,32,105,116,63,0,70,
+105,108,101,110,97,109,101,32,105,115,32,110,111,116,32,99,
+111,114,114,101,99,116,46,0,83,101,108,101,99,116,32,70,
+111,110,116,0,83,116,121,108,101,0,73,116,97,108,105,99,
+0,83,105,122,101,0,70,111,110,116,32,102,105,108,101,0,
+68,101,116,97,105,108,0,97,98,99,100,101,102,103,32,65,
+66,67,68,69,70,71,32,48,49,50,51,52,0
 };
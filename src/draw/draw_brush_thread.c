@@ -0,0 +1,355 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * AppDraw
+ * ブラシ自由線の描画スレッド
+ *****************************************/
+
+#include "mlk_gui.h"
+#include "mlk_thread.h"
+#include "mlk_rectbox.h"
+
+#include "def_draw.h"
+
+#include "tileimage.h"
+#include "tileimage_drawinfo.h"
+#include "latency_probe.h"
+
+#include "draw_main.h"
+#include "draw_calc.h"
+#include "draw_brush_thread.h"
+
+
+/*
+  - ブラシの自由線描画時、GUI スレッドは点をリングバッファに追加するだけで、
+    実際の描画は専用のスレッドで行う。
+    (重いブラシでイベント処理が止まらないようにするため)
+  - リングバッファは、GUI スレッドのみが追加し、描画スレッドのみが取り出す。
+    通常時はロックなしで、空/満杯の時のみ待つ。
+  - 描画スレッドが点を描画している間と、GUI スレッドがレイヤイメージを
+    キャンバスに合成している間は、mutex_img で排他する。
+  - 描画された範囲は rcdraw に追加していき、GUI スレッドがタイマーで取得して更新する。
+*/
+
+//---------------------
+
+#define _RING_NUM   4096	//リングバッファの数 (2の累乗)
+#define _RING_MASK  (_RING_NUM - 1)
+
+enum
+{
+	_CMD_POINT,		//点を描画
+	_CMD_FINISH,	//最後の線を描画
+	_CMD_END		//スレッド終了
+};
+
+typedef struct
+{
+	double x,y,pressure;
+	int cmd,no;
+}_ringdat;
+
+typedef struct
+{
+	mThread th;
+
+	TileImage *img;
+	mThreadMutex mutex_img;	//イメージの排他
+
+	_ringdat ring[_RING_NUM];
+	uint32_t head,		//次に追加する位置 (GUI スレッドが書き込む)
+		tail;			//次に取り出す位置 (描画スレッドが書き込む)
+	int wait_empty,		//描画スレッドが、空で待機中
+		wait_full;		//GUI スレッドが、満杯で待機中
+
+	mRect rcdraw;		//描画された範囲 (mutex_img で保護)
+}_brushthread;
+
+static _brushthread *g_brushthread = NULL;
+
+#define _LOAD(v)     __atomic_load_n(&(v), __ATOMIC_SEQ_CST)
+#define _STORE(v,n)  __atomic_store_n(&(v), n, __ATOMIC_SEQ_CST)
+
+//---------------------
+
+
+/* 待機中の相手を起こす */
+
+static void _wakeup(_brushthread *p,int *pwait)
+{
+	if(_LOAD(*pwait))
+	{
+		mThreadMutexLock(p->th.mutex);
+		mThreadCondSignal(p->th.cond);
+		mThreadMutexUnlock(p->th.mutex);
+	}
+}
+
+/* 1つの点を描画 */
+
+static void _draw_point(_brushthread *p,_ringdat *dat)
+{
+	uint64_t t;
+
+	mThreadMutexLock(p->mutex_img);
+
+	TileImageDrawInfo_clearDrawRect();
+
+	t = LatencyProbe_begin();
+
+	TileImage_drawBrushFree(p->img, dat->no, dat->x, dat->y, dat->pressure);
+
+	if(dat->cmd == _CMD_FINISH)
+		TileImage_drawBrushFree_finish(p->img, dat->no);
+
+	LatencyProbe_end(LATENCY_STAGE_RASTER, t);
+
+	mRectUnion(&p->rcdraw, &g_tileimage_dinfo.rcdraw);
+
+	mThreadMutexUnlock(p->mutex_img);
+}
+
+/* スレッド関数 */
+
+static void _thread_func(mThread *th)
+{
+	_brushthread *p = (_brushthread *)th;
+	_ringdat *dat;
+	uint32_t tail;
+
+	tail = p->tail;
+
+	while(1)
+	{
+		//空の場合は待つ
+
+		if(tail == _LOAD(p->head))
+		{
+			mThreadMutexLock(th->mutex);
+
+			_STORE(p->wait_empty, TRUE);
+
+			while(tail == _LOAD(p->head))
+				mThreadCondWait(th->cond, th->mutex);
+
+			_STORE(p->wait_empty, FALSE);
+
+			mThreadMutexUnlock(th->mutex);
+		}
+
+		//取り出し
+
+		dat = p->ring + (tail & _RING_MASK);
+
+		if(dat->cmd == _CMD_END) break;
+
+		_draw_point(p, dat);
+
+		tail++;
+		_STORE(p->tail, tail);
+
+		_wakeup(p, &p->wait_full);
+	}
+}
+
+/* リングバッファに追加 */
+
+static void _add_ring(_brushthread *p,int cmd,int no,double x,double y,double pressure)
+{
+	_ringdat *dat;
+	uint32_t head;
+
+	head = p->head;
+
+	//満杯の場合は待つ (点は捨てない)
+
+	if(head - _LOAD(p->tail) == _RING_NUM)
+	{
+		mThreadMutexLock(p->th.mutex);
+
+		_STORE(p->wait_full, TRUE);
+
+		while(head - _LOAD(p->tail) == _RING_NUM)
+			mThreadCondWait(p->th.cond, p->th.mutex);
+
+		_STORE(p->wait_full, FALSE);
+
+		mThreadMutexUnlock(p->th.mutex);
+	}
+
+	//追加
+
+	dat = p->ring + (head & _RING_MASK);
+
+	dat->cmd = cmd;
+	dat->no = no;
+	dat->x = x;
+	dat->y = y;
+	dat->pressure = pressure;
+
+	_STORE(p->head, head + 1);
+
+	_wakeup(p, &p->wait_empty);
+}
+
+
+//=========================
+// main
+//=========================
+
+
+/** 描画スレッドを開始
+ *
+ * 自由線の開始処理 (TileImage_drawBrush_beginFree) と
+ * drawOpSub_beginDraw() の後に行う。
+ *
+ * return: FALSE で失敗 (GUI スレッドで描画する) */
+
+mlkbool drawBrushThread_begin(TileImage *img)
+{
+	_brushthread *p;
+
+	if(g_brushthread) return FALSE;
+
+	p = (_brushthread *)mThreadNew(sizeof(_brushthread), _thread_func, NULL);
+	if(!p) return FALSE;
+
+	p->img = img;
+	p->mutex_img = mThreadMutexNew();
+
+	mRectEmpty(&p->rcdraw);
+
+	if(!p->mutex_img || !mThreadRun((mThread *)p))
+	{
+		mThreadMutexDestroy(p->mutex_img);
+		mThreadDestroy((mThread *)p);
+		return FALSE;
+	}
+
+	g_brushthread = p;
+
+	return TRUE;
+}
+
+/** 描画スレッドを終了
+ *
+ * 残りの点をすべて描画してから戻る。
+ * 残りの描画範囲は AppDraw::w.rcdraw に追加され、キャンバスが更新される。 */
+
+void drawBrushThread_end(AppDraw *p)
+{
+	_brushthread *pt = g_brushthread;
+
+	if(!pt) return;
+
+	_add_ring(pt, _CMD_END, 0, 0, 0, 0);
+
+	mThreadWait((mThread *)pt);
+
+	//残りの範囲を更新
+
+	drawBrushThread_update(p);
+
+	//
+
+	g_brushthread = NULL;
+
+	mThreadMutexDestroy(pt->mutex_img);
+	mThreadDestroy((mThread *)pt);
+}
+
+/** 描画スレッドが実行中か */
+
+mlkbool drawBrushThread_isRunning(void)
+{
+	return (g_brushthread != NULL);
+}
+
+/** 自由線の点を追加
+ *
+ * no: 線の番号 (線対称時) */
+
+void drawBrushThread_addPoint(int no,double x,double y,double pressure)
+{
+	if(g_brushthread)
+		_add_ring(g_brushthread, _CMD_POINT, no, x, y, pressure);
+}
+
+/** 終端の点を追加
+ *
+ * 点を描画後、曲線の最後も描画する。 */
+
+void drawBrushThread_addFinish(int no,double x,double y,double pressure)
+{
+	if(g_brushthread)
+		_add_ring(g_brushthread, _CMD_FINISH, no, x, y, pressure);
+}
+
+/** 描画された範囲を取得して、キャンバスを更新
+ *
+ * [GUI スレッド] タイマーから呼ばれる。
+ *
+ * return: スレッドが実行中か */
+
+mlkbool drawBrushThread_update(AppDraw *p)
+{
+	_brushthread *pt = g_brushthread;
+	mRect rc;
+	mBox box;
+
+	if(!pt) return FALSE;
+
+	mThreadMutexLock(pt->mutex_img);
+
+	rc = pt->rcdraw;
+	mRectEmpty(&pt->rcdraw);
+
+	mThreadMutexUnlock(pt->mutex_img);
+
+	//更新
+
+	if(!mRectIsEmpty(&rc))
+	{
+		mRectUnion(&p->w.rcdraw, &rc);
+
+		if(drawCalc_image_rect_to_box(p, &box, &rc))
+			drawUpdateBox_canvas_curlayer(p, &box, FALSE);
+	}
+
+	return TRUE;
+}
+
+/** [GUI スレッド] レイヤイメージを参照する前にロック
+ *
+ * 描画スレッドがない場合は何もしない。 */
+
+void drawBrushThread_lockImage(void)
+{
+	if(g_brushthread)
+		mThreadMutexLock(g_brushthread->mutex_img);
+}
+
+/** イメージのロックを解除 */
+
+void drawBrushThread_unlockImage(void)
+{
+	if(g_brushthread)
+		mThreadMutexUnlock(g_brushthread->mutex_img);
+}
@@ -24,6 +24,7 @@ $*/
 #include "mlk_gui.h"
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
+#include "mlk_str.h"
 
 #include "def_macro.h"
 #include "def_config.h"
@@ -42,6 +43,7 @@ $*/
 #include "statusbar.h"
 #include "panel_func.h"
 #include "popup_thread.h"
+#include "autosave.h"
 
 #include "draw_main.h"
 
@@ -72,6 +74,11 @@ void drawImage_afterNewCanvas(AppDraw *p,mlkbool change_file)
 	if(p->imgbits != p->stamp.bits)
 		drawStamp_clearImage(p);
 
+	//ファイル読み込み時、単色のタイルを共有
+
+	if(change_file)
+		LayerList_shareSolidTiles(p->layerlist);
+
 	//
 
 	_change_imagesize(p);
@@ -194,6 +201,10 @@ mlkbool drawImage_newCanvas(AppDraw *p,NewCanvasValue *val)
 	if(h < 1) h = 1;
 	if(dpi <= 0) dpi = 96;
 
+	//自動保存の書き込み終了を待つ (ビット数が変わるため)
+
+	AutoSave_wait();
+
 	//UNDO クリア
 
 	Undo_deleteAll();
@@ -203,6 +214,10 @@ mlkbool drawImage_newCanvas(AppDraw *p,NewCanvasValue *val)
 
 	LayerList_clear(p->layerlist);
 
+	//APD 保存情報の対象ファイル
+
+	mStrEmpty(&p->strApdFile);
+
 	//イメージ情報
 
 	p->imgw = w;
@@ -267,6 +282,8 @@ mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog)
 
 	bits = (p->imgbits == 8)? 16: 8;
 
+	AutoSave_wait();
+
 	//キャンバスイメージ
 	// :失敗時は元に戻す
 
@@ -579,6 +596,120 @@ mlkbool drawImage_scaleCanvas(AppDraw *p,int w,int h,int dpi,int method)
 }
 
 
+//============================
+// レイヤを維持して拡大縮小
+//============================
+
+
+typedef struct
+{
+	TileImage **ppimg;	//各レイヤの拡大縮小後のイメージ
+	int w,h,method;
+}_thdata_scalelayer;
+
+
+static int _thread_scale_layer(mPopupProgress *prog,void *data)
+{
+	_thdata_scalelayer *p = (_thdata_scalelayer *)data;
+	LayerItem *pi;
+	TileImage **ppimg;
+
+	mPopupProgressThreadSetMax(prog, LayerList_getNormalLayerNum(APPDRAW->layerlist) * 10);
+
+	//各レイヤごとに、タイル行単位で並列処理
+
+	ppimg = p->ppimg;
+
+	for(pi = LayerList_getTopItem(APPDRAW->layerlist); pi; pi = LayerItem_getNext(pi))
+	{
+		if(pi->img)
+		{
+			*ppimg = TileImage_createScaleImage(pi->img, p->w, p->h, p->method, prog, 10);
+			if(!(*ppimg)) return 1;
+
+			ppimg++;
+		}
+	}
+
+	return 0;
+}
+
+/** レイヤを維持して拡大縮小
+ *
+ * 各レイヤのキャンバス範囲内のイメージを、それぞれ拡大縮小する。
+ * テキストレイヤは、通常レイヤになる。 */
+
+mlkbool drawImage_scaleCanvas_layer(AppDraw *p,int w,int h,int dpi,int method)
+{
+	_thdata_scalelayer dat;
+	LayerItem *pi;
+	TileImage **ppimg;
+	int i,num,sw,sh;
+
+	num = LayerList_getNormalLayerNum(p->layerlist);
+
+	dat.ppimg = (TileImage **)mMalloc0(sizeof(TileImage *) * (num + 1));
+	if(!dat.ppimg) return FALSE;
+
+	dat.w = w;
+	dat.h = h;
+	dat.method = method;
+
+	//スレッド
+
+	if(PopupThread_run(&dat, _thread_scale_layer))
+		goto ERR;
+
+	//キャンバスイメージのサイズ変更
+
+	sw = p->imgw;
+	sh = p->imgh;
+
+	if(!drawImage_changeImageSize(p, w, h))
+		goto ERR;
+
+	//undo
+
+	Undo_addScaleCanvas_layer(sw, sh);
+
+	//イメージを置き換え
+
+	ppimg = dat.ppimg;
+
+	for(pi = LayerList_getTopItem(p->layerlist); pi; pi = LayerItem_getNext(pi))
+	{
+		if(pi->img)
+		{
+			if(LAYERITEM_IS_TEXT(pi))
+			{
+				LayerItem_clearText(pi);
+
+				pi->flags &= ~LAYERITEM_F_TEXT;
+			}
+
+			LayerItem_replaceImage(pi, *(ppimg++), -1);
+		}
+	}
+
+	mFree(dat.ppimg);
+
+	//DPI 変更
+
+	if(dpi != -1)
+		drawImage_changeDPI(p, dpi);
+
+	return TRUE;
+
+ERR:
+	for(i = 0; i < num; i++)
+		TileImage_free(dat.ppimg[i]);
+
+	mFree(dat.ppimg);
+
+	return FALSE;
+}
+
+
 
 //=============================
 // レイヤ合成イメージ
@@ -640,205 +771,180 @@ void drawImage_blendImageReal_curbits(AppDraw *p,mPopupProgress *prog,int stepnu
 	}
 }
 
-/** アルファ無しで合成 (画像保存用)
+/* 1行を変換 (アルファなし)
  *
- * R,G,B 順で、アルファ値はない。 */
+ * 現在のビット値の RGBA を、dstbits の RGB に詰める。 */
 
-mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+static void _convert_row_normal(uint8_t *pd,int width,int srcbits,int dstbits,
+	uint8_t *table8,uint16_t *table16)
 {
-	uint8_t **ppbuf,*pd,*ps,*table8;
-	uint16_t *table16,*ps16,*pd16;
-	int ix,iy,i;
-
-	//現在のビット値で合成
-	
-	drawImage_blendImageReal_curbits(p, prog, stepnum);
+	uint8_t *ps;
+	uint16_t *ps16,*pd16;
+	int ix,i;
 
-	//変換
-
-	ppbuf = p->imgcanvas->ppbuf;
-
-	if(p->imgbits == 8)
+	if(srcbits == 8)
 	{
 		//----- 8bit: アルファ値を詰める
 
-		for(iy = p->imgh; iy; iy--)
-		{
-			pd = *(ppbuf++);
-			ps = pd;
+		ps = pd;
 
-			for(ix = p->imgw; ix; ix--, ps += 4, pd += 3)
-			{
-				pd[0] = ps[0];
-				pd[1] = ps[1];
-				pd[2] = ps[2];
-			}
+		for(ix = width; ix; ix--, ps += 4, pd += 3)
+		{
+			pd[0] = ps[0];
+			pd[1] = ps[1];
+			pd[2] = ps[2];
 		}
 	}
 	else
 	{
 		//---- 16bit: 値を変換 & アルファ値詰める
 
-		if(!_create_colconv_table(dstbits, &table8, &table16))
-			return MLKERR_ALLOC;
+		pd16 = (uint16_t *)pd;
+		ps16 = (uint16_t *)pd;
 
-		for(iy = p->imgh; iy; iy--)
+		for(ix = width; ix; ix--, ps16 += 4)
 		{
-			pd = *(ppbuf++);
-			pd16 = (uint16_t *)pd;
-			ps16 = (uint16_t *)pd;
-
-			for(ix = p->imgw; ix; ix--, ps16 += 4)
+			if(dstbits == 8)
 			{
-				if(dstbits == 8)
-				{
-					for(i = 0; i < 3; i++)
-						pd[i] = table8[ps16[i]];
+				for(i = 0; i < 3; i++)
+					pd[i] = table8[ps16[i]];
 
-					pd += 3;
-				}
-				else
-				{
-					for(i = 0; i < 3; i++)
-						pd16[i] = table16[ps16[i]];
+				pd += 3;
+			}
+			else
+			{
+				for(i = 0; i < 3; i++)
+					pd16[i] = table16[ps16[i]];
 
-					pd16 += 3;
-				}
+				pd16 += 3;
 			}
 		}
-
-		mFree(table8);
-		mFree(table16);
 	}
-
-	return MLKERR_OK;
 }
 
-/** アルファ付きで合成
- *
- * - 合成モードはすべて「通常」とする。
- * - トーンレイヤはトーン処理なし。
- *
- * dstbits: 出力ビット数 */
+/* 1行をアルファ付きで合成 */
 
-mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+static void _blend_alpha_row(AppDraw *p,int iy,uint8_t *pd,int dstbits,
+	uint8_t *table8,uint16_t *table16,TileImagePixelColorFunc func_blend)
 {
 	LayerItem *pi;
-	uint8_t **ppbuf,*pd,*table8;
-	uint16_t *pd16,*ps16,*table16;
-	int w,h,ix,iy,i,bits,a;
+	uint16_t *pd16,*ps16;
+	int ix,i,bits,a;
 	uint64_t colres,colsrc;
-	TileImagePixelColorFunc func_blend;
 
-	ppbuf = p->imgcanvas->ppbuf;
-	w = p->imgw;
-	h = p->imgh;
 	bits = p->imgbits;
 
-	func_blend = TileImage_global_getPixelColorFunc(TILEIMAGE_PIXELCOL_NORMAL);
-
-	//変換テーブル
-
-	if(!_create_colconv_table(dstbits, &table8, &table16))
-		return MLKERR_ALLOC;
+	for(ix = 0; ix < p->imgw; ix++)
+	{
+		colres = 0;
 
-	//
+		//各レイヤ合成
 
-	mPopupProgressThreadSubStep_begin(prog, stepnum, h);
+		pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
 
-	for(iy = 0; iy < h; iy++)
-	{
-		pd = *(ppbuf++);
-		
-		for(ix = 0; ix < w; ix++)
+		for( ; pi; pi = LayerItem_getPrevVisibleImage(pi))
 		{
-			colres = 0;
-
-			//各レイヤ合成
+			TileImage_getPixel(pi->img, ix, iy, &colsrc);
 
-			pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
+			if(bits == 8)
+				a = *((uint8_t *)&colsrc + 3);
+			else
+				a = *((uint16_t *)&colsrc + 3);
 
-			for( ; pi; pi = LayerItem_getPrevVisibleImage(pi))
+			if(a)
 			{
-				TileImage_getPixel(pi->img, ix, iy, &colsrc);
+				//テクスチャ
+				
+				if(pi->img_texture)
+					a = a * ImageMaterial_getPixel_forTexture(pi->img_texture, ix, iy) / 255;
+
+				//レイヤ不透明度
+
+				a = a * LayerItem_getOpacity_real(pi) >> 7;
 
-				if(bits == 8)
-					a = *((uint8_t *)&colsrc + 3);
-				else
-					a = *((uint16_t *)&colsrc + 3);
+				//アルファ合成 (res + src -> res)
 
 				if(a)
 				{
-					//テクスチャ
-					
-					if(pi->img_texture)
-						a = a * ImageMaterial_getPixel_forTexture(pi->img_texture, ix, iy) / 255;
-
-					//レイヤ不透明度
-
-					a = a * LayerItem_getOpacity_real(pi) >> 7;
-
-					//アルファ合成 (res + src -> res)
-
-					if(a)
-					{
-						if(bits == 8)
-							*((uint8_t *)&colsrc + 3) = a;
-						else
-							*((uint16_t *)&colsrc + 3) = a;
-					
-						(func_blend)(pi->img, &colres, &colsrc, NULL);
-					}
+					if(bits == 8)
+						*((uint8_t *)&colsrc + 3) = a;
+					else
+						*((uint16_t *)&colsrc + 3) = a;
+				
+					(func_blend)(pi->img, &colres, &colsrc, NULL);
 				}
 			}
+		}
 
-			//セット
-
-			if(bits == 8)
-			{
-				//8bit は常に 8bit
+		//セット
 
-				*((uint32_t *)pd) = *((uint32_t *)&colres);
+		if(bits == 8)
+		{
+			//8bit は常に 8bit
 
-				pd += 4;
-			}
-			else if(dstbits == 8)
-			{
-				//16bit -> 8bit
+			*((uint32_t *)pd) = *((uint32_t *)&colres);
 
-				if(colres == 0)
-					*((uint32_t *)pd) = 0;
-				else
-				{
-					ps16 = (uint16_t *)&colres;
-					
-					for(i = 0; i < 4; i++)
-						pd[i] = table8[ps16[i]];
-				}
+			pd += 4;
+		}
+		else if(dstbits == 8)
+		{
+			//16bit -> 8bit
 
-				pd += 4;
-			}
-			else if(dstbits == 16)
+			if(colres == 0)
+				*((uint32_t *)pd) = 0;
+			else
 			{
-				//16bit(fix15bit) -> 16bit
+				ps16 = (uint16_t *)&colres;
+				
+				for(i = 0; i < 4; i++)
+					pd[i] = table8[ps16[i]];
+			}
 
-				if(colres == 0)
-					*((uint64_t *)pd) = 0;
-				else
-				{
-					pd16 = (uint16_t *)pd;
-					ps16 = (uint16_t *)&colres;
+			pd += 4;
+		}
+		else if(dstbits == 16)
+		{
+			//16bit(fix15bit) -> 16bit
 
-					for(i = 0; i < 4; i++)
-						pd16[i] = table16[ps16[i]];
-				}
+			if(colres == 0)
+				*((uint64_t *)pd) = 0;
+			else
+			{
+				pd16 = (uint16_t *)pd;
+				ps16 = (uint16_t *)&colres;
 
-				pd += 8;
+				for(i = 0; i < 4; i++)
+					pd16[i] = table16[ps16[i]];
 			}
-		}
 
-		mPopupProgressThreadSubStep_inc(prog);
+			pd += 8;
+		}
 	}
+}
+
+/** アルファ無しで合成 (画像保存用)
+ *
+ * R,G,B 順で、アルファ値はない。 */
+
+mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum)
+{
+	uint8_t **ppbuf,*table8;
+	uint16_t *table16;
+	int iy;
+
+	//現在のビット値で合成
+	
+	drawImage_blendImageReal_curbits(p, prog, stepnum);
+
+	//変換
+
+	if(!_create_colconv_table(dstbits, &table8, &table16))
+		return MLKERR_ALLOC;
+
+	ppbuf = p->imgcanvas->ppbuf;
+
+	for(iy = p->imgh; iy; iy--)
+		_convert_row_normal(*(ppbuf++), p->imgw, p->imgbits, dstbits, table8, table16);
 
 	mFree(table8);
 	mFree(table16);
@@ -846,3 +952,159 @@ mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *pro
 	return MLKERR_OK;
 }
 
+
+//=============================
+// バンド単位の合成
+//=============================
+
+/*
+  - 画像保存時に、画像全体を合成せずに、_BAND_H 行ずつ必要な時に合成する。
+    作業用のイメージは、画像の幅 x _BAND_H 行分のみ。
+  - TileImage_blendToCanvas() は画像上の位置で ImageCanvas の行を参照するため、
+    画像の高さ分の行ポインタ (view) を用意して、現在のバンドの行だけ有効にする。
+  - 合成結果は、drawImage_blendImageReal_normal/alpha と同じ。
+*/
+
+#define _BAND_H  64
+
+struct _DrawBlendBand
+{
+	AppDraw *draw;
+	ImageCanvas *img,	//バンドのイメージ (imgw x _BAND_H)
+		view;			//合成時の参照用 (ppbuf は画像の高さ分)
+	uint8_t *table8;
+	uint16_t *table16;
+	TileImagePixelColorFunc func_blend;
+	int dstbits,
+		falpha,
+		y;			//現在のバンドの先頭位置 (-1 でなし)
+};
+
+
+/** バンド単位の合成データを作成
+ *
+ * dstbits: 出力ビット数
+ * falpha: アルファ付きで合成 (drawImage_blendImageReal_alpha と同じ)
+ * return: NULL でメモリが足りない */
+
+DrawBlendBand *drawImage_blendBand_new(AppDraw *p,int dstbits,mlkbool falpha)
+{
+	DrawBlendBand *band;
+
+	band = (DrawBlendBand *)mMalloc0(sizeof(DrawBlendBand));
+	if(!band) return NULL;
+
+	band->draw = p;
+	band->dstbits = dstbits;
+	band->falpha = falpha;
+	band->y = -1;
+	band->func_blend = TileImage_global_getPixelColorFunc(TILEIMAGE_PIXELCOL_NORMAL);
+
+	//イメージ
+
+	band->img = ImageCanvas_new(p->imgw, _BAND_H, p->imgbits);
+	if(!band->img) goto ERR;
+
+	band->view = *(band->img);
+	band->view.height = p->imgh;
+	band->view.ppbuf = (uint8_t **)mMalloc0(sizeof(void *) * p->imgh);
+	if(!band->view.ppbuf) goto ERR;
+
+	//変換テーブル
+
+	if(!_create_colconv_table(dstbits, &band->table8, &band->table16))
+		goto ERR;
+
+	return band;
+
+ERR:
+	drawImage_blendBand_free(band);
+	return NULL;
+}
+
+/** バンド単位の合成データを解放 */
+
+void drawImage_blendBand_free(DrawBlendBand *p)
+{
+	if(p)
+	{
+		ImageCanvas_free(p->img);
+		mFree(p->view.ppbuf);
+		mFree(p->table8);
+		mFree(p->table16);
+		mFree(p);
+	}
+}
+
+/* 指定位置から _BAND_H 行を合成 */
+
+static void _blendband_set(DrawBlendBand *p,int y)
+{
+	AppDraw *draw = p->draw;
+	LayerItem *pi;
+	TileImageBlendSrcInfo info;
+	uint8_t **ppbuf;
+	mBox box;
+	int i;
+
+	box.x = 0;
+	box.y = y;
+	box.w = draw->imgw;
+	box.h = draw->imgh - y;
+
+	if(box.h > _BAND_H) box.h = _BAND_H;
+
+	//参照用の行をセット
+
+	ppbuf = p->img->ppbuf;
+
+	for(i = 0; i < box.h; i++)
+		p->view.ppbuf[y + i] = ppbuf[i];
+
+	//合成
+
+	if(p->falpha)
+	{
+		for(i = 0; i < box.h; i++)
+		{
+			_blend_alpha_row(draw, y + i, ppbuf[i], p->dstbits,
+				p->table8, p->table16, p->func_blend);
+		}
+	}
+	else
+	{
+		ImageCanvas_fillBox(&p->view, &box, &draw->imgbkcol);
+
+		pi = LayerList_getItem_bottomVisibleImage(draw->layerlist);
+
+		for(; pi; pi = LayerItem_getPrevVisibleImage(pi))
+		{
+			drawUpdate_setCanvasBlendInfo(pi, &info);
+
+			TileImage_blendToCanvas(pi->img, &p->view, &box, &info);
+		}
+
+		for(i = 0; i < box.h; i++)
+		{
+			_convert_row_normal(ppbuf[i], draw->imgw, draw->imgbits, p->dstbits,
+				p->table8, p->table16);
+		}
+	}
+
+	p->y = y;
+}
+
+/** 指定行の合成結果を取得
+ *
+ * 行を含むバンドが合成されていない場合は、合成する。
+ * 上から順、または下から順に取得すると、各バンドは一度だけ合成される。
+ *
+ * return: 行のバッファ (アルファなしの場合 RGB、アルファ付きの場合 RGBA) */
+
+uint8_t *drawImage_blendBand_getRow(DrawBlendBand *p,int y)
+{
+	if(p->y == -1 || y < p->y || y >= p->y + _BAND_H)
+		_blendband_set(p, y - y % _BAND_H);
+
+	return p->img->ppbuf[y - p->y];
+}
@@ -127,24 +127,14 @@ mlkerr drawImage_loadFile(AppDraw *p,const char *filename,
 
 	LayerItem_setName_layerno(p->curlayer, 0);
 
-	//読み込み (ImageCanvas のバッファに)
+	//読み込み
+	// :PNG/JPEG/TIFF/WEBP は、直接タイルに変換。
+	// :それ以外は、ImageCanvas のバッファに読み込んでから変換。
 
-	mPopupProgressThreadSetMax(prog, 100 + 10);
-
-	li.imgbuf = p->imgcanvas->ppbuf;
-
-	ret = (tp.getimage)(&li);
+	ret = TileImage_loadFromLoadImage(p->curlayer->img, &li, &tp,
+		p->imgcanvas->ppbuf, opt->ignore_alpha, prog);
 	if(ret) goto ERR;
 
-	//イメージの処理
-
-	TileImage_loadimgbuf_convert(li.imgbuf, li.width, li.height,
-		li.bits_per_sample, opt->ignore_alpha);
-
-	//タイルイメージに変換
-
-	TileImage_convertFromCanvas(p->curlayer->img, p->imgcanvas, prog, 10);
-
 	//
 
 	(tp.close)(&li);
@@ -25,6 +25,9 @@ $*/
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
 #include "mlk_rectbox.h"
+#include "mlk_str.h"
+#include "mlk_file.h"
+#include "mlk_filestat.h"
 
 #include "def_draw.h"
 #include "def_config.h"
@@ -38,6 +41,55 @@ $*/
 #include "apd_v4_format.h"
 
 
+/*
+  [差分保存]
+  - 読み込み/保存時、各レイヤのイメージデータのファイル位置を LayerItem に記録し、
+    そのファイルを AppDraw::strApdFile とする。
+  - イメージが変更されたレイヤは、アンドゥ追加時などに記録がクリアされる。
+  - 上書き保存時、ファイルが外部で変更されていなければ、
+    記録のあるレイヤは、元ファイルからイメージデータをそのままコピーする。
+    (一時ファイルに書き込んだ後、元ファイルと置き換える)
+*/
+
+
+//=========================
+// sub
+//=========================
+
+
+/* APD 保存情報の対象ファイルをセット
+ *
+ * filename: NULL でクリア */
+
+static void _set_apdfile(AppDraw *p,const char *filename)
+{
+	mFileStat st;
+
+	if(filename && mGetFileStat(filename, &st))
+	{
+		mStrSetText(&p->strApdFile, filename);
+
+		p->apdfile_size = st.size;
+		p->apdfile_time = st.time_modify;
+	}
+	else
+		mStrEmpty(&p->strApdFile);
+}
+
+/* 保存先が APD 保存情報の対象ファイルで、変更されていないか */
+
+static mlkbool _is_apdfile(AppDraw *p,const char *filename)
+{
+	mFileStat st;
+
+	return (mStrIsnotEmpty(&p->strApdFile)
+		&& mStrCompareEq(&p->strApdFile, filename)
+		&& mGetFileStat(filename, &st)
+		&& st.size == p->apdfile_size
+		&& st.time_modify == p->apdfile_time);
+}
+
+
 //=========================
 // 保存
 //=========================
@@ -49,12 +101,47 @@ mlkerr drawFile_save_apd_v4(AppDraw *p,const char *filename,mPopupProgress *prog
 {
 	apd4save *save;
 	LayerItem *pi;
+	mStr strtmp = MSTR_INIT;
+	const char *savename;
 	mlkerr ret;
-	int layernum,fpict;
+	int layernum,fpict,fcopy;
 	mBox box;
 
-	ret = apd4save_open(&save, filename, prog);
-	if(ret) return ret;
+	//上書き保存で元ファイルが使える場合、一時ファイルに保存
+
+	fcopy = _is_apdfile(p, filename);
+
+	if(!fcopy)
+		savename = filename;
+	else
+	{
+		mStrSetText(&strtmp, filename);
+		mStrAppendText(&strtmp, ".tmp");
+
+		savename = strtmp.buf;
+	}
+
+	//保存中は情報が一致しなくなるため、クリア
+
+	_set_apdfile(p, NULL);
+
+	//開く
+
+	ret = apd4save_open(&save, savename, prog);
+
+	if(ret && fcopy)
+	{
+		//一時ファイルが作成できない場合、直接保存
+
+		fcopy = FALSE;
+		savename = filename;
+
+		ret = apd4save_open(&save, savename, prog);
+	}
+
+	if(ret) goto ERR_OPEN;
+
+	apd4save_setApdInfo(save, (fcopy)? filename: NULL);
 
 	fpict = !(APPCONF->foption & CONFIG_OPTF_SAVE_APD_NOPICT);
 
@@ -112,6 +199,24 @@ mlkerr drawFile_save_apd_v4(AppDraw *p,const char *filename,mPopupProgress *prog
 ERR:
 	apd4save_close(save);
 
+ERR_OPEN:
+	//一時ファイルを元ファイルと置き換え
+
+	if(fcopy)
+	{
+		if(ret == MLKERR_OK && !mRenameFile(savename, filename))
+			ret = MLKERR_IO;
+
+		if(ret) mDeleteFile(savename);
+	}
+
+	mStrFree(&strtmp);
+
+	//成功時、保存情報の対象ファイル
+
+	if(ret == MLKERR_OK)
+		_set_apdfile(p, filename);
+
 	return ret;
 }
 
@@ -154,6 +259,9 @@ mlkerr drawFile_load_apd_v4(AppDraw *p,const char *filename,mPopupProgress *prog
 
 	ret = apd4load_readLayers(load);
 
+	if(ret == MLKERR_OK)
+		_set_apdfile(p, filename);
+
 	//
 ERR:
 	apd4load_close(load);
@@ -151,8 +151,6 @@ void AppDraw_free(void)
 
 	if(!p) return;
 
-	TileImage_finish();
-
 	DotShape_free();
 
 	DrawFontFinish();
@@ -172,8 +170,10 @@ void AppDraw_free(void)
 	DrawTextData_free(&p->text.dt_copy);
 
 	mStrFree(&p->strOptTexturePath);
+	mStrFree(&p->strApdFile);
 
 	ImageCanvas_free(p->imgcanvas);
+	drawUpdate_freeBlendCache(p);
 
 	ImageMaterial_free(p->imgmat_opttex);
 
@@ -192,6 +192,10 @@ void AppDraw_free(void)
 	mFree(p->pointbuf);
 
 	mFree(p);
+
+	//[!] タイルのメモリプールを解放するため、TileImage の解放後に行う
+
+	TileImage_finish();
 }
 
 /** AppDraw 作成
@@ -36,6 +36,7 @@ $*/
 
 #include "pointbuf.h"
 #include "toollist.h"
+#include "latency_probe.h"
 
 #include "draw_main.h"
 #include "draw_calc.h"
@@ -43,7 +44,9 @@ $*/
 #include "draw_op_def.h"
 #include "draw_op_sub.h"
 #include "draw_op_func.h"
+#include "draw_brush_thread.h"
 
+#include "maincanvas.h"
 #include "panel_func.h"
 
 
@@ -53,6 +56,40 @@ $*/
 //===========================
 
 
+/* 自由線の点を描画
+ *
+ * 描画スレッドの実行中は、スレッドに点を送るだけ。
+ * no: 線の番号
+ * finish: 終端の点 (曲線の最後も描画) */
+
+static void _brush_free_drawpoint(AppDraw *p,int no,PointBufDat *pt,mlkbool finish,int update)
+{
+	uint64_t t;
+
+	if(drawBrushThread_isRunning())
+	{
+		if(finish)
+			drawBrushThread_addFinish(no, pt->x, pt->y, pt->pressure);
+		else
+			drawBrushThread_addPoint(no, pt->x, pt->y, pt->pressure);
+	}
+	else
+	{
+		TileImageDrawInfo_clearDrawRect();
+
+		t = LatencyProbe_begin();
+
+		TileImage_drawBrushFree(p->w.dstimg, no, pt->x, pt->y, pt->pressure);
+
+		if(finish)
+			TileImage_drawBrushFree_finish(p->w.dstimg, no);
+
+		LatencyProbe_end(LATENCY_STAGE_RASTER, t);
+
+		drawOpSub_addrect_and_update(p, update);
+	}
+}
+
 /* 離し */
 
 static mlkbool _brush_free_release(AppDraw *p)
@@ -75,15 +112,8 @@ static mlkbool _brush_free_release(AppDraw *p)
 	
 		//メイン線
 		// :pt が終端なら、曲線の最後も描画
-		
-		TileImageDrawInfo_clearDrawRect();
-
-		TileImage_drawBrushFree(p->w.dstimg, 0, pt.x, pt.y, pt.pressure);
 
-		if(!loop)
-			TileImage_drawBrushFree_finish(p->w.dstimg, 0);
-
-		drawOpSub_addrect_and_update(p, update);
+		_brush_free_drawpoint(p, 0, &pt, !loop, update);
 
 		//線対称
 
@@ -93,14 +123,7 @@ static mlkbool _brush_free_release(AppDraw *p)
 			
 			(p->rule.func_get_point)(p, &pt2.x, &pt2.y, i);
 
-			TileImageDrawInfo_clearDrawRect();
-
-			TileImage_drawBrushFree(p->w.dstimg, i, pt2.x, pt2.y, pt2.pressure);
-
-			if(!loop)
-				TileImage_drawBrushFree_finish(p->w.dstimg, i);
-
-			drawOpSub_addrect_and_update(p, update);
+			_brush_free_drawpoint(p, i, &pt2, !loop, update);
 		}
 
 		//
@@ -108,6 +131,15 @@ static mlkbool _brush_free_release(AppDraw *p)
 		pt = ptnext;
 	}
 
+	//描画スレッドの終了 (残りの点をすべて描画)
+
+	if(drawBrushThread_isRunning())
+	{
+		MainCanvasPage_clearTimer_brushThread();
+
+		drawBrushThread_end(p);
+	}
+
 	//終了
 
 	drawOpSub_finishDraw_workrect(p);
@@ -151,11 +183,7 @@ static void _brush_free_motion(AppDraw *p,uint32_t state)
 
 	if(PointBuf_getPoint(p->pointbuf, &pt))
 	{
-		TileImageDrawInfo_clearDrawRect();
-
-		TileImage_drawBrushFree(p->w.dstimg, 0, pt.x, pt.y, pt.pressure);
-
-		drawOpSub_addrect_and_update(p, update);
+		_brush_free_drawpoint(p, 0, &pt, FALSE, update);
 
 		//線対称
 
@@ -165,11 +193,7 @@ static void _brush_free_motion(AppDraw *p,uint32_t state)
 			
 			(p->rule.func_get_point)(p, &pt2.x, &pt2.y, i);
 
-			TileImageDrawInfo_clearDrawRect();
-
-			TileImage_drawBrushFree(p->w.dstimg, i, pt2.x, pt2.y, pt2.pressure);
-
-			drawOpSub_addrect_and_update(p, update);
+			_brush_free_drawpoint(p, i, &pt2, FALSE, update);
 		}
 	}
 }
@@ -220,6 +244,12 @@ mlkbool drawOp_brush_free_press(AppDraw *p)
 
 	drawOpSub_beginDraw(p);
 
+	//描画スレッド開始
+	// :失敗した場合は、GUI スレッドで描画する
+
+	if(drawBrushThread_begin(p->w.dstimg))
+		MainCanvasPage_setTimer_brushThread();
+
 	return TRUE;
 }
 
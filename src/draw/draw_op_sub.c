@@ -47,6 +47,7 @@ $*/
 #include "tileimage.h"
 #include "tileimage_drawinfo.h"
 #include "maincanvas.h"
+#include "panel_func.h"
 
 #include "dotshape.h"
 #include "fillpolygon.h"
@@ -450,13 +451,13 @@ void drawOpSub_addrect_and_update(AppDraw *p,int type)
 			{
 				//draw ハンドラで更新する範囲を追加
 				case DRAWOPSUB_UPDATE_ADD:
-					drawUpdateBox_canvas(p, &box);
+					drawUpdateBox_canvas_curlayer(p, &box, FALSE);
 					break;
 				//キャンバスに直接描画
 				// :連続直線/集中線の場合は、この後に XOR 描画をする必要があるため、
 				// :即時直接キャンバスを更新する。
 				case DRAWOPSUB_UPDATE_DIRECT:
-					drawUpdateBox_canvas_direct(p, &box);
+					drawUpdateBox_canvas_curlayer(p, &box, TRUE);
 					break;
 				//タイマー
 				case DRAWOPSUB_UPDATE_TIMER:
@@ -513,7 +514,7 @@ void drawOpSub_finishDraw_single(AppDraw *p)
 
 		if(drawCalc_image_rect_to_box(p, &box, &g_tileimage_dinfo.rcdraw))
 		{
-			drawUpdateBox_canvas(p, &box);
+			drawUpdateBox_canvas_curlayer(p, &box, FALSE);
 			drawUpdate_endDraw_box(p, &box);
 		}
 	}
@@ -523,7 +524,14 @@ void drawOpSub_finishDraw_single(AppDraw *p)
 
 void drawOpSub_update_rcdraw(AppDraw *p)
 {
-	drawUpdateRect_canvas_canvasview(p, &g_tileimage_dinfo.rcdraw);
+	mBox box;
+
+	if(drawCalc_image_rect_to_box(p, &box, &g_tileimage_dinfo.rcdraw))
+	{
+		drawUpdateBox_canvas_curlayer(p, &box, FALSE);
+
+		PanelCanvasView_updateBox(&box);
+	}
 }
 
 
@@ -35,6 +35,7 @@ $*/
 
 #include "imagecanvas.h"
 #include "fileformat.h"
+#include "draw_main.h"
 
 
 //---------------
@@ -49,7 +50,7 @@ static const uint16_t g_tiff_comptype[] = {
 //---------------
 
 
-/* Y1行を送る */
+/* Y1行を送る (合成済みのイメージから) */
 
 static mlkerr _save_setrow(mSaveImage *p,int y,uint8_t *buf,int line_bytes)
 {
@@ -62,6 +63,15 @@ static mlkerr _save_setrow(mSaveImage *p,int y,uint8_t *buf,int line_bytes)
 	return MLKERR_OK;
 }
 
+/* Y1行を送る (バンド単位で合成) */
+
+static mlkerr _save_setrow_band(mSaveImage *p,int y,uint8_t *buf,int line_bytes)
+{
+	memcpy(buf, drawImage_blendBand_getRow((DrawBlendBand *)p->param1, y), line_bytes);
+
+	return MLKERR_OK;
+}
+
 /* プログレス */
 
 static void _save_progress(mSaveImage *p,int percent)
@@ -71,7 +81,7 @@ static void _save_progress(mSaveImage *p,int percent)
 
 /* PNG 透過色をセット */
 
-static void _set_png_transparent(mSaveImageOpt *p,int dstbits,int samples)
+static void _set_png_transparent(mSaveImageOpt *p,DrawBlendBand *band,int dstbits,int samples)
 {
 	int x,y;
 	uint8_t *buf;
@@ -92,7 +102,7 @@ static void _set_png_transparent(mSaveImageOpt *p,int dstbits,int samples)
 
 		//
 
-		buf = APPDRAW->imgcanvas->ppbuf[y];
+		buf = drawImage_blendBand_getRow(band, y);
 
 		if(dstbits == 8)
 		{
@@ -164,6 +174,10 @@ static mlkerr _set_gif_info(AppDraw *p,mSaveImage *si,mSaveImageOpt *opt)
 }
 
 /** 画像ファイルに保存
+ *
+ * GIF の場合は、パレット作成のため、imgcanvas に合成済みであること
+ * (drawImage_blendImageReal_normal で 8bit)。
+ * それ以外は、保存時に 64 行単位で合成するため、imgcanvas は変更されない。
  *
  * return: [-100] GIF で 257 色以上 */
 
@@ -173,10 +187,19 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 	mSaveImage si;
 	mSaveImageOpt opt;
 	mFuncSaveImage func;
+	DrawBlendBand *band = NULL;
 	mlkerr ret;
 	uint32_t val;
 	uint16_t jpegsamp[] = {444,422,420};
 
+	//バンド単位の合成 (GIF 以外)
+
+	if(!(format & FILEFORMAT_GIF))
+	{
+		band = drawImage_blendBand_new(p, dstbits, falpha);
+		if(!band) return MLKERR_ALLOC;
+	}
+
 	//情報
 
 	mSaveImage_init(&si);
@@ -192,10 +215,19 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 	si.reso_horz = p->imgdpi;
 	si.reso_vert = p->imgdpi;
 	si.progress = _save_progress;
-	si.setrow = _save_setrow;
-	si.param1 = p->imgcanvas->ppbuf;
 	si.param2 = prog;
 
+	if(band)
+	{
+		si.setrow = _save_setrow_band;
+		si.param1 = band;
+	}
+	else
+	{
+		si.setrow = _save_setrow;
+		si.param1 = p->imgcanvas->ppbuf;
+	}
+
 	//保存関数,設定
 
 	opt.mask = 0;
@@ -209,7 +241,7 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 		opt.png.mask = MSAVEOPT_PNG_MASK_COMP_LEVEL;
 		opt.png.comp_level = SAVEOPT_PNG_GET_LEVEL(APPCONF->save.png);
 
-		_set_png_transparent(&opt, dstbits, si.samples_per_pixel);
+		_set_png_transparent(&opt, band, dstbits, si.samples_per_pixel);
 	}
 	else if(format & FILEFORMAT_JPEG)
 	{
@@ -228,7 +260,7 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 	}
 	else if(format & FILEFORMAT_BMP)
 	{
-		//BMP
+		//BMP (下から順に送られる)
 		
 		func = mSaveImageBMP;
 	}
@@ -266,7 +298,10 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 		opt.webp.quality = SAVEOPT_WEBP_GET_QUALITY(val);
 	}
 	else
-		return MLKERR_UNSUPPORTED;
+	{
+		ret = MLKERR_UNSUPPORTED;
+		goto END;
+	}
 	
 	//保存
 
@@ -277,6 +312,8 @@ mlkerr drawFile_save_imageFile(AppDraw *p,const char *filename,
 
 	mFree(si.palette_buf);
 
+END:
+	drawImage_blendBand_free(band);
+
 	return ret;
 }
-
@@ -21,6 +21,8 @@ $*/
  * AppDraw: 更新関連
  *****************************************/
 
+#include <string.h>
+
 #include "mlk_gui.h"
 #include "mlk_widget.h"
 #include "mlk_rectbox.h"
@@ -35,11 +37,14 @@ $*/
 #include "layeritem.h"
 #include "tileimage.h"
 #include "panel_func.h"
+#include "threadpool.h"
+#include "latency_probe.h"
 
 #include "draw_op_def.h"
 #include "draw_main.h"
 #include "draw_calc.h"
 #include "draw_rule.h"
+#include "draw_brush_thread.h"
 
 
 
@@ -111,55 +116,220 @@ void drawUpdate_all_layer(void)
 // キャンバスイメージ更新
 //===========================
 
+/*
+  - 合成範囲を、イメージ座標で 64px 単位の帯に分割し、
+    帯ごとにすべてのレイヤを合成する。
+  - 帯はスレッドプールで並列処理する。
+    各帯はキャンバスの異なる行に書き込むため、ロックは必要ない。
+
+  [合成キャッシュ]
+  - カレントレイヤへの描画中の更新時は、
+    背景 + カレントより下のレイヤの合成結果を、64x64 のタイル単位でキャッシュし、
+    カレント以上のレイヤのみを合成する。
+  - 合成モードによっては結合法則が成り立たない (整数の丸めも含む) ため、
+    カレントより上のレイヤの合成結果はキャッシュできない。
+  - 通常の更新 (drawUpdate_blendImage_full) 時は、範囲内のタイルのキャッシュを無効にする。
+  - 下層レイヤの構成・合成パラメータや背景が変わった場合は、すべて無効にする。
+  - キャッシュはキャンバスと同じサイズのイメージを確保するため、
+    サイズが _CACHE_MAXSIZE を超える場合は、キャッシュを使わずに通常の更新を行う。
+*/
+
+#define _BLEND_BAND_H   64	//帯の高さ
+#define _BLEND_ITEM_NUM 64	//一度に確保する合成アイテム数
+#define _CACHE_MAXSIZE  ((int64_t)256 << 20)	//合成キャッシュの最大バイト数
+
+/* 合成アイテム */
+
+typedef struct
+{
+	TileImage *img;
+	TileImageBlendSrcInfo info;
+}_blenditem;
 
-/** キャンバスイメージを更新
+/* 帯ごとの合成用データ */
+
+typedef struct
+{
+	AppDraw *draw;
+	mBox box;			//全体の範囲
+	_blenditem *item;	//合成順 (下層から)
+	int itemnum,
+		curno,			//カレントレイヤのアイテム位置 (-1 でなし)
+		bandtop,		//先頭の帯の Y 位置 (64 の倍数)
+		fbkgnd;			//背景を描画するか
+}_blendband;
+
+/* 合成キャッシュ */
+
+struct _DrawBlendCache
+{
+	ImageCanvas *img;	//背景 + カレントより下のレイヤの合成イメージ
+	uint8_t *tileflag;	//タイルごとに、キャッシュが有効か
+	_blenditem *item;	//キャッシュ作成時の下層の合成アイテム
+	int tilew,tileh,
+		itemnum,
+		dpi;
+	RGBcombo bkcol,
+		checkcol[2];
+	uint8_t fplaid,
+		ftonegray;
+};
+
+
+/* 帯の範囲を取得
  *
- * box: NULL で全体 */
+ * return: FALSE で範囲なし */
 
-void drawUpdate_blendImage_full(AppDraw *p,const mBox *box)
+static mlkbool _get_band_box(_blendband *p,int no,mBox *box)
 {
-	mBox box1;
+	int y1,y2;
 
-	if(!box)
-	{
-		box1.x = box1.y = 0;
-		box1.w = p->imgw, box1.h = p->imgh;
+	y1 = p->bandtop + no * _BLEND_BAND_H;
+	y2 = y1 + _BLEND_BAND_H;
 
-		box = &box1;
-	}
+	if(y1 < p->box.y) y1 = p->box.y;
+	if(y2 > p->box.y + p->box.h) y2 = p->box.y + p->box.h;
 
-	//背景
+	if(y1 >= y2) return FALSE;
+
+	box->x = p->box.x;
+	box->w = p->box.w;
+	box->y = y1;
+	box->h = y2 - y1;
+
+	return TRUE;
+}
+
+/* 背景を描画 */
 
+static void _draw_bkgnd(AppDraw *p,ImageCanvas *dst,const mBox *box)
+{
 	if(APPCONF->fview & CONFIG_VIEW_F_BKGND_PLAID)
+		ImageCanvas_fillPlaidBox(dst, box, p->col.checkbkcol, p->col.checkbkcol + 1);
+	else
+		ImageCanvas_fillBox(dst, box, &p->imgbkcol);
+}
+
+/* 指定数のアイテムを合成 */
+
+static void _blend_items(ImageCanvas *dst,const mBox *box,_blenditem *pi,int num)
+{
+	for(; num > 0; num--, pi++)
+		TileImage_blendToCanvas(pi->img, dst, box, &pi->info);
+}
+
+/* [スレッド] 一つの帯を合成 */
+
+static void _thread_blend_band(void *param,int jobno,int threadno)
+{
+	_blendband *p = (_blendband *)param;
+	mBox box;
+
+	if(!_get_band_box(p, jobno, &box)) return;
+
+	//背景
+
+	if(p->fbkgnd)
+		_draw_bkgnd(p->draw, p->draw->imgcanvas, &box);
+
+	//レイヤ
+
+	_blend_items(p->draw->imgcanvas, &box, p->item, p->itemnum);
+}
+
+/* [スレッド] 一つの帯を合成 (キャッシュ使用)
+ *
+ * 帯は 64px 単位のため、各帯が扱うタイルの行は重ならない。 */
+
+static void _thread_blend_band_cache(void *param,int jobno,int threadno)
+{
+	_blendband *p = (_blendband *)param;
+	AppDraw *draw = p->draw;
+	DrawBlendCache *cache = draw->blendcache;
+	uint8_t **ppsrc,**ppdst,*pflag;
+	mBox box,boxt;
+	int tx,tx2,ty,x,bpp,size;
+
+	if(!_get_band_box(p, jobno, &box)) return;
+
+	//キャッシュが無効なタイルを作成
+	// :タイル内のイメージ範囲すべてを合成する
+
+	ty = box.y >> 6;
+	tx = box.x >> 6;
+	tx2 = (box.x + box.w - 1) >> 6;
+
+	pflag = cache->tileflag + ty * cache->tilew + tx;
+
+	for(; tx <= tx2; tx++, pflag++)
 	{
-		//チェック柄
-		ImageCanvas_fillPlaidBox(p->imgcanvas, box,
-			p->col.checkbkcol, p->col.checkbkcol + 1);
+		if(*pflag) continue;
+
+		boxt.x = tx << 6;
+		boxt.y = ty << 6;
+		boxt.w = (boxt.x + 64 > draw->imgw)? draw->imgw - boxt.x: 64;
+		boxt.h = (boxt.y + 64 > draw->imgh)? draw->imgh - boxt.y: 64;
+
+		_draw_bkgnd(draw, cache->img, &boxt);
+		_blend_items(cache->img, &boxt, p->item, p->curno);
+
+		*pflag = 1;
 	}
-	else
+
+	//キャッシュからコピー
+
+	bpp = (draw->imgbits == 8)? 4: 8;
+	x = box.x * bpp;
+	size = box.w * bpp;
+
+	ppsrc = cache->img->ppbuf + box.y;
+	ppdst = draw->imgcanvas->ppbuf + box.y;
+
+	for(ty = box.h; ty > 0; ty--)
+		memcpy(*(ppdst++) + x, *(ppsrc++) + x, size);
+
+	//カレント以上のレイヤ
+
+	_blend_items(draw->imgcanvas, &box, p->item + p->curno, p->itemnum - p->curno);
+}
+
+/* 合成アイテムを追加
+ *
+ * return: FALSE で確保に失敗 */
+
+static mlkbool _add_blenditem(_blendband *p,int *alloc,TileImage *img,const TileImageBlendSrcInfo *info)
+{
+	_blenditem *buf;
+
+	if(p->itemnum >= *alloc)
 	{
-		//指定色
+		buf = (_blenditem *)mRealloc(p->item, sizeof(_blenditem) * (*alloc + _BLEND_ITEM_NUM));
+		if(!buf) return FALSE;
 
-		if(box == &box1)
-			ImageCanvas_fill(p->imgcanvas, &p->imgbkcol);
-		else
-			ImageCanvas_fillBox(p->imgcanvas, box, &p->imgbkcol);
+		p->item = buf;
+		*alloc += _BLEND_ITEM_NUM;
 	}
 
-	//レイヤ合成
+	buf = p->item + p->itemnum;
+
+	buf->img = img;
+	buf->info = *info;
+
+	p->itemnum++;
 
-	drawUpdate_blendImage_layer(p, box);
+	return TRUE;
 }
 
-/** レイヤイメージを ImageCanvas に合成
+/* 合成するイメージと情報を、下層から順にセット
  *
- * [!] 背景は描画しない */
+ * return: FALSE で確保に失敗 */
 
-void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
+static mlkbool _set_blenditems(AppDraw *p,_blendband *dst)
 {
 	TileImage *img_insert = NULL;
-	LayerItem *pi,*current;
+	LayerItem *pi;
 	TileImageBlendSrcInfo info;
+	int alloc = 0;
 
 	//挿入イメージ
 
@@ -180,37 +350,29 @@ void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
 		img_insert = p->tileimg_filterprev;
 	}
 
-	//合成
+	//レイヤ
+
+	mMemset0(&info, sizeof(TileImageBlendSrcInfo));
 
-	pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
+	dst->curno = -1;
 
-	if(img_insert)
+	for(pi = LayerList_getItem_bottomVisibleImage(p->layerlist);
+		pi; pi = LayerItem_getPrevVisibleImage(pi))
 	{
-		//---- img_insert をカレントの上に挿入
+		drawUpdate_setCanvasBlendInfo(pi, &info);
 
-		current = p->curlayer;
+		if(pi == p->curlayer)
+			dst->curno = dst->itemnum;
 
-		for(; pi; pi = LayerItem_getPrevVisibleImage(pi))
-		{
-			drawUpdate_setCanvasBlendInfo(pi, &info);
-		
-			TileImage_blendToCanvas(pi->img, p->imgcanvas, box, &info);
+		if(!_add_blenditem(dst, &alloc, pi->img, &info))
+			return FALSE;
 
-			//カレントの上に、同じレイヤパラメータで挿入
+		//カレントの上に、同じレイヤパラメータで挿入
 
-			if(pi == current)
-				TileImage_blendToCanvas(img_insert, p->imgcanvas, box, &info);
-		}
-	}
-	else
-	{
-		//----- 通常時
-		
-		for(; pi; pi = LayerItem_getPrevVisibleImage(pi))
+		if(img_insert && pi == p->curlayer)
 		{
-			drawUpdate_setCanvasBlendInfo(pi, &info);
-		
-			TileImage_blendToCanvas(pi->img, p->imgcanvas, box, &info);
+			if(!_add_blenditem(dst, &alloc, img_insert, &info))
+				return FALSE;
 		}
 	}
 
@@ -220,9 +382,313 @@ void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
 	if(p->boxsel.is_paste_mode)
 	{
 		_setcanvasblendinfo_normal(&info);
+
+		if(!_add_blenditem(dst, &alloc, p->boxsel.img, &info))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* 帯の情報をセット
+ *
+ * return: 帯の数 */
+
+static int _init_blendband(AppDraw *p,_blendband *dat,const mBox *box,mlkbool fbkgnd)
+{
+	mMemset0(dat, sizeof(_blendband));
+
+	dat->draw = p;
+	dat->box = *box;
+	dat->fbkgnd = fbkgnd;
+	dat->bandtop = box->y & ~(_BLEND_BAND_H - 1);
+
+	return (box->y + box->h - dat->bandtop + _BLEND_BAND_H - 1) / _BLEND_BAND_H;
+}
+
+/* キャッシュの範囲内のタイルを無効にする
+ *
+ * box: NULL で全体 */
+
+static void _cache_invalidate(DrawBlendCache *p,const mBox *box)
+{
+	uint8_t *pd;
+	int x1,y1,x2,y2,ix;
+
+	if(!p) return;
+
+	if(!box)
+		mMemset0(p->tileflag, p->tilew * p->tileh);
+	else
+	{
+		x1 = box->x >> 6;
+		y1 = box->y >> 6;
+		x2 = (box->x + box->w - 1) >> 6;
+		y2 = (box->y + box->h - 1) >> 6;
+
+		if(x1 < 0) x1 = 0;
+		if(y1 < 0) y1 = 0;
+		if(x2 >= p->tilew) x2 = p->tilew - 1;
+		if(y2 >= p->tileh) y2 = p->tileh - 1;
+
+		for(; y1 <= y2; y1++)
+		{
+			pd = p->tileflag + y1 * p->tilew + x1;
+
+			for(ix = x1; ix <= x2; ix++)
+				*(pd++) = 0;
+		}
+	}
+}
+
+/* キャッシュを解放 */
+
+static void _cache_free(DrawBlendCache *p)
+{
+	if(p)
+	{
+		ImageCanvas_free(p->img);
+		mFree(p->tileflag);
+		mFree(p->item);
+		mFree(p);
+	}
+}
+
+/* RGBcombo が同じか */
+
+static mlkbool _is_same_rgbcombo(const RGBcombo *c1,const RGBcombo *c2)
+{
+	return (c1->c8.r == c2->c8.r && c1->c8.g == c2->c8.g && c1->c8.b == c2->c8.b
+		&& c1->c16.r == c2->c16.r && c1->c16.g == c2->c16.g && c1->c16.b == c2->c16.b);
+}
+
+/* 下層アイテムが、キャッシュ作成時と同じか */
+
+static mlkbool _cache_is_same_items(DrawBlendCache *p,_blenditem *item,int num)
+{
+	_blenditem *ps;
+	TileImageBlendSrcInfo *s,*d;
+
+	if(num != p->itemnum) return FALSE;
+
+	for(ps = p->item; num > 0; num--, ps++, item++)
+	{
+		s = &ps->info;
+		d = &item->info;
 	
-		TileImage_blendToCanvas(p->boxsel.img, p->imgcanvas, box, &info);
+		if(ps->img != item->img
+			|| s->opacity != d->opacity
+			|| s->blendmode != d->blendmode
+			|| s->img_texture != d->img_texture
+			|| s->tone_lines != d->tone_lines
+			|| (s->tone_lines
+				&& (s->tone_angle != d->tone_angle
+					|| s->tone_density != d->tone_density
+					|| s->ftone_white != d->ftone_white)))
+			return FALSE;
 	}
+
+	return TRUE;
+}
+
+/* キャッシュを使える状態にする
+ *
+ * キャンバスの状態や下層の構成が変わった場合は、すべて無効にする。
+ *
+ * return: FALSE でキャッシュを使わない */
+
+static mlkbool _cache_prepare(AppDraw *p,_blendband *dat)
+{
+	DrawBlendCache *cache = p->blendcache;
+	_blenditem *item;
+	mlkbool fplaid;
+
+	//キャンバス状態が異なる場合は、再作成
+
+	if(cache
+		&& (cache->img->width != p->imgw || cache->img->height != p->imgh
+			|| cache->img->bits != p->imgbits))
+	{
+		_cache_free(cache);
+		p->blendcache = cache = NULL;
+	}
+
+	//作成
+	// :イメージが大きい場合は、キャッシュを使わない
+
+	if(!cache)
+	{
+		if((int64_t)p->imgw * p->imgh * ((p->imgbits == 8)? 4: 8) > _CACHE_MAXSIZE)
+			return FALSE;
+
+		cache = (DrawBlendCache *)mMalloc0(sizeof(DrawBlendCache));
+		if(!cache) return FALSE;
+
+		cache->tilew = (p->imgw + 63) >> 6;
+		cache->tileh = (p->imgh + 63) >> 6;
+
+		cache->img = ImageCanvas_new(p->imgw, p->imgh, p->imgbits);
+		cache->tileflag = (uint8_t *)mMalloc0(cache->tilew * cache->tileh);
+
+		if(!cache->img || !cache->tileflag)
+		{
+			_cache_free(cache);
+			return FALSE;
+		}
+
+		cache->itemnum = -1;
+
+		p->blendcache = cache;
+	}
+
+	//背景と下層アイテムが異なる場合は、すべて無効
+
+	fplaid = ((APPCONF->fview & CONFIG_VIEW_F_BKGND_PLAID) != 0);
+
+	if(cache->fplaid != fplaid
+		|| cache->ftonegray != p->ftonelayer_to_gray
+		|| cache->dpi != p->imgdpi
+		|| !_is_same_rgbcombo(&cache->bkcol, &p->imgbkcol)
+		|| !_is_same_rgbcombo(cache->checkcol, p->col.checkbkcol)
+		|| !_is_same_rgbcombo(cache->checkcol + 1, p->col.checkbkcol + 1)
+		|| !_cache_is_same_items(cache, dat->item, dat->curno))
+	{
+		if(cache->itemnum < dat->curno)
+		{
+			item = (_blenditem *)mRealloc(cache->item, sizeof(_blenditem) * (dat->curno + 1));
+			if(!item) return FALSE;
+
+			cache->item = item;
+		}
+
+		memcpy(cache->item, dat->item, sizeof(_blenditem) * dat->curno);
+
+		cache->itemnum = dat->curno;
+		cache->fplaid = fplaid;
+		cache->ftonegray = p->ftonelayer_to_gray;
+		cache->dpi = p->imgdpi;
+		cache->bkcol = p->imgbkcol;
+		cache->checkcol[0] = p->col.checkbkcol[0];
+		cache->checkcol[1] = p->col.checkbkcol[1];
+
+		_cache_invalidate(cache, NULL);
+	}
+
+	return TRUE;
+}
+
+/* キャンバスイメージに合成 */
+
+static void _blend_image(AppDraw *p,const mBox *box,mlkbool fbkgnd)
+{
+	_blendband dat;
+	uint64_t t;
+	int bandnum;
+
+	t = LatencyProbe_begin();
+
+	bandnum = _init_blendband(p, &dat, box, fbkgnd);
+
+	//レイヤが変更された可能性があるため、キャッシュを無効にする
+
+	_cache_invalidate(p->blendcache, box);
+
+	//[!] 確保に失敗した場合は、セットできた分のみ合成される
+
+	_set_blenditems(p, &dat);
+
+	//ブラシ描画スレッドの実行中は、描画と排他する
+
+	drawBrushThread_lockImage();
+
+	ThreadPool_run(_thread_blend_band, &dat, bandnum);
+
+	drawBrushThread_unlockImage();
+
+	LatencyProbe_end(LATENCY_STAGE_BLEND, t);
+
+	mFree(dat.item);
+
+	//縮小表示用イメージの更新範囲
+
+	ImageCanvas_setMipUpdate(p->imgcanvas, box);
+}
+
+/** 合成キャッシュを解放 */
+
+void drawUpdate_freeBlendCache(AppDraw *p)
+{
+	_cache_free(p->blendcache);
+
+	p->blendcache = NULL;
+}
+
+/** キャンバスイメージを更新
+ *
+ * box: NULL で全体 */
+
+void drawUpdate_blendImage_full(AppDraw *p,const mBox *box)
+{
+	mBox box1;
+
+	if(!box)
+	{
+		box1.x = box1.y = 0;
+		box1.w = p->imgw, box1.h = p->imgh;
+
+		box = &box1;
+	}
+
+	//背景 + レイヤ合成
+
+	_blend_image(p, box, TRUE);
+}
+
+/** レイヤイメージを ImageCanvas に合成
+ *
+ * [!] 背景は描画しない */
+
+void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box)
+{
+	_blend_image(p, box, FALSE);
+}
+
+/** キャンバスイメージを更新 (カレントレイヤのみ変更された時)
+ *
+ * カレントより下層の合成結果はキャッシュを使う。
+ * キャッシュが使えない場合は、通常の更新を行う。 */
+
+void drawUpdate_blendImage_curlayer(AppDraw *p,const mBox *box)
+{
+	_blendband dat;
+	uint64_t t;
+	int bandnum;
+
+	t = LatencyProbe_begin();
+
+	bandnum = _init_blendband(p, &dat, box, TRUE);
+
+	if(!_set_blenditems(p, &dat)
+		|| dat.curno < 0
+		|| !_cache_prepare(p, &dat))
+	{
+		mFree(dat.item);
+
+		drawUpdate_blendImage_full(p, box);
+		return;
+	}
+
+	drawBrushThread_lockImage();
+
+	ThreadPool_run(_thread_blend_band_cache, &dat, bandnum);
+
+	drawBrushThread_unlockImage();
+
+	LatencyProbe_end(LATENCY_STAGE_BLEND, t);
+
+	mFree(dat.item);
+
+	ImageCanvas_setMipUpdate(p->imgcanvas, box);
 }
 
 
@@ -241,8 +707,11 @@ void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box)
 {
 	CanvasDrawInfo di;
 	mBox boximg;
+	uint64_t t;
 	int n;
 
+	t = LatencyProbe_begin();
+
 	//描画情報
 
 	di.boxdst = *box;
@@ -335,6 +804,8 @@ void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box)
 		drawpixbuf_rectframe(pixbuf, &p->w.rctmp[0], &di,
 			(p->canvas_angle == 0), 0x80ffa200);
 	}
+
+	LatencyProbe_end(LATENCY_STAGE_CANVAS, t);
 }
 
 
@@ -406,6 +877,20 @@ void drawUpdateBox_canvas_direct(AppDraw *p,const mBox *boximg)
 	drawUpdateBox_canvaswg_direct(p, boximg);
 }
 
+/** キャンバスを範囲更新 (カレントレイヤへの描画時)
+ *
+ * direct: 即時更新するか */
+
+void drawUpdateBox_canvas_curlayer(AppDraw *p,const mBox *boximg,mlkbool direct)
+{
+	drawUpdate_blendImage_curlayer(p, boximg);
+
+	if(direct)
+		drawUpdateBox_canvaswg_direct(p, boximg);
+	else
+		drawUpdateBox_canvaswg(p, boximg);
+}
+
 
 //==============
 
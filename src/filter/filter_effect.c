@@ -30,6 +30,7 @@ $*/
 
 #include "tileimage.h"
 #include "tileimage_drawinfo.h"
+#include "threadpool.h"
 
 #include "pv_filter_sub.h"
 
@@ -260,153 +261,311 @@ mlkbool FilterDraw_effect_rgbshift(FilterDrawInfo *info)
 
 
 //=============================
-// 油絵風
+// タイル単位の作業用バッファ
 //=============================
 
 
-/* 8bit */
+typedef struct
+{
+	int radius,
+		pos;	//メディアン: 取得する値の位置
+	uint8_t *buf[THREADPOOL_MAXNUM];	//スレッドごとの作業用
+}_tilebuf;
+
 
-static void _proc_oilpaint_8bit(FilterDrawInfo *info)
+/* スレッドごとの作業用バッファを確保 */
+
+static mlkbool _tilebuf_alloc(_tilebuf *p,int size)
 {
-	int ix,iy,i,j,jx,jy,vmin,min[3],max[3];
-	mPoint ptst[4],pted[4];
-	double d[4],dweight;
-	uint8_t col[4],colmin[4];
-	TileImageSetPixelFunc setpix;
+	int i;
 
-	FilterSub_getPixelFunc(&setpix);
+	mMemset0(p->buf, sizeof(p->buf));
 
-	mMemset0(ptst, sizeof(mPoint) * 4);
-	mMemset0(pted, sizeof(mPoint) * 4);
+	for(i = ThreadPool_getNum() - 1; i >= 0; i--)
+	{
+		p->buf[i] = (uint8_t *)mMalloc(size);
+		if(!p->buf[i]) return FALSE;
+	}
 
-	i = info->val_bar[0];
+	return TRUE;
+}
 
-	ptst[0].x = ptst[0].y = ptst[1].y = ptst[3].x = -i;
-	pted[1].x = pted[2].x = pted[2].y = pted[3].y = i;
+/* 作業用バッファを解放 */
 
-	dweight = 1.0 / ((i + 1) * (i + 1));
+static void _tilebuf_free(_tilebuf *p)
+{
+	int i;
 
-	//
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		mFree(p->buf[i]);
+}
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
-	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
-		{
-			vmin = 0;
+/* タイルの周囲 radius px を含む範囲の色を取得
+ *
+ * return: TRUE ですべて透明 */
 
-			for(i = 0; i < 4; i++)
-			{
-				d[0] = d[1] = d[2] = d[3] = 0;
+static mlkbool _tilebuf_get_src(FilterDrawInfo *info,const mRect *rcdst,int radius,uint8_t *buf)
+{
+	mRect rc;
 
-				min[0] = min[1] = min[2] = 255;
-				max[0] = max[1] = max[2] = 0;
+	rc.x1 = rcdst->x1 - radius;
+	rc.y1 = rcdst->y1 - radius;
+	rc.x2 = rcdst->x2 + radius;
+	rc.y2 = rcdst->y2 + radius;
 
-				for(jy = ptst[i].y; jy <= pted[i].y; jy++)
-				{
-					for(jx = ptst[i].x; jx <= pted[i].x; jx++)
-					{
-						FilterSub_getPixelSrc_clip(info, ix + jx, iy + jy, col);
+	if(info->bits == 8)
+		return FilterSub_getPixelBuf8(info->imgsrc, &rc, buf, info->clipping);
+	else
+		return FilterSub_getPixelBuf16(info->imgsrc, &rc, (uint16_t *)buf, info->clipping);
+}
 
-						FilterSub_advcol_add8(d, col);
 
-						//RGB 最小、最大値
+//=============================
+// 油絵風
+//=============================
+/*
+  - 点の左上/右上/右下/左下の (radius + 1) x (radius + 1) の範囲のうち、
+    RGB の最大値と最小値の差が最も小さい範囲の平均色をセットする。
+  - 範囲の左上位置ごとに、合計値と RGB の最小/最大値を、縦→横の順に
+    範囲をスライドしながら求める。(半径に関係なく、1px あたり一定の計算量)
+*/
 
-						for(j = 0; j < 3; j++)
-						{
-							if(col[j] < min[j]) min[j] = col[j];
-							if(col[j] > max[j]) max[j] = col[j];
-						}
-					}
-				}
 
-				//最小
+/* 範囲をスライドしながら、最小値または最大値を取得
+ *
+ * num: src の数。dst には num - len + 1 個が出力される。
+ * deq: 作業用 (num 個) */
+
+static void _slide_minmax(uint16_t *dst,int dststep,const uint16_t *src,int srcstep,
+	int num,int len,mlkbool fmax,int *deq)
+{
+	int i,top,end,v;
 
-				j = (max[0] - min[0]) + (max[1] - min[1]) + (max[2] - min[2]);
+	top = end = 0;
 
-				if(i == 0 || j < vmin)
-				{
-					vmin = j;
-					FilterSub_advcol_getColor8(d, dweight, colmin);
-				}
-			}
+	for(i = 0; i < num; i++)
+	{
+		v = src[i * srcstep];
+
+		//新しい値で不要になった値を除く
 
-			(setpix)(info->imgdst, ix, iy, colmin);
+		if(fmax)
+		{
+			while(end > top && src[deq[end - 1] * srcstep] <= v)
+				end--;
+		}
+		else
+		{
+			while(end > top && src[deq[end - 1] * srcstep] >= v)
+				end--;
 		}
 
-		FilterSub_prog_substep_inc(info);
+		deq[end++] = i;
+
+		//範囲外になった先頭を除く
+
+		if(deq[top] <= i - len) top++;
+
+		if(i >= len - 1)
+			dst[(i - len + 1) * dststep] = src[deq[top] * srcstep];
 	}
 }
 
-/* 16bit */
+/* 範囲をスライドしながら、合計値を取得 */
+
+static void _slide_sum(uint32_t *dst,int dststep,const uint32_t *src,int srcstep,int num,int len)
+{
+	int i;
+	uint32_t sum = 0;
+
+	for(i = 0; i < num; i++)
+	{
+		sum += src[i * srcstep];
+
+		if(i >= len)
+			sum -= src[(i - len) * srcstep];
 
-static void _proc_oilpaint_16bit(FilterDrawInfo *info)
+		if(i >= len - 1)
+			dst[(i - len + 1) * dststep] = sum;
+	}
+}
+
+/* タイルごとの処理 */
+
+static void _tile_oilpaint(FilterDrawInfo *info,const mRect *rcdst,int threadno,void *param)
 {
-	int ix,iy,i,j,jx,jy,vmin,min[3],max[3];
-	mPoint ptst[4],pted[4];
-	double d[4],dweight;
-	uint16_t col[4],colmin[4];
+	_tilebuf *p = (_tilebuf *)param;
+	uint8_t *srcbuf,*ps8;
+	uint16_t *col[3],*vmin[3],*vmax[3],*hmin,*hmax,*ps16;
+	uint32_t *sum[4],*vsum[4],*hsum[4],*range;
+	int *deq;
+	int i,j,ix,iy,w,h,sw,sh,aw,ah,len,plane,pos[4],vmin_range,fmin;
+	double d[4],dweight,dscale;
+	uint64_t colmin;
 	TileImageSetPixelFunc setpix;
 
 	FilterSub_getPixelFunc(&setpix);
 
-	mMemset0(ptst, sizeof(mPoint) * 4);
-	mMemset0(pted, sizeof(mPoint) * 4);
+	len = p->radius + 1;
 
-	i = info->val_bar[0];
+	w = rcdst->x2 - rcdst->x1 + 1;
+	h = rcdst->y2 - rcdst->y1 + 1;
+	sw = w + p->radius * 2;
+	sh = h + p->radius * 2;
+	aw = w + p->radius;
+	ah = h + p->radius;
 
-	ptst[0].x = ptst[0].y = ptst[1].y = ptst[3].x = -i;
-	pted[1].x = pted[2].x = pted[2].y = pted[3].y = i;
+	//バッファ
 
-	dweight = 1.0 / ((i + 1) * (i + 1));
+	plane = (64 + p->radius * 2) * (64 + p->radius * 2);
 
-	//
+	srcbuf = p->buf[threadno];
+	sum[0] = (uint32_t *)(srcbuf + plane * 8);
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	for(i = 1; i < 4; i++) sum[i] = sum[i - 1] + plane;
+	for(i = 0; i < 4; i++) vsum[i] = sum[3] + plane * (i + 1);
+	for(i = 0; i < 4; i++) hsum[i] = vsum[3] + plane * (i + 1);
+
+	range = hsum[3] + plane;
+	deq = (int *)(range + plane);
+
+	col[0] = (uint16_t *)(deq + plane);
+
+	for(i = 1; i < 3; i++) col[i] = col[i - 1] + plane;
+	for(i = 0; i < 3; i++) vmin[i] = col[2] + plane * (i + 1);
+	for(i = 0; i < 3; i++) vmax[i] = vmin[2] + plane * (i + 1);
+
+	hmin = vmax[2] + plane;
+	hmax = hmin + sw;
+
+	//ソース取得 (すべて透明なら処理なし)
+
+	if(_tilebuf_get_src(info, rcdst, p->radius, srcbuf))
+		return;
+
+	//RGB と、アルファ値を掛けた値
+
+	j = sw * sh;
+
+	if(info->bits == 8)
 	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		ps8 = srcbuf;
+
+		for(i = 0; i < j; i++, ps8 += 4)
 		{
-			vmin = 0;
+			col[0][i] = ps8[0];
+			col[1][i] = ps8[1];
+			col[2][i] = ps8[2];
+
+			sum[0][i] = ps8[0] * ps8[3];
+			sum[1][i] = ps8[1] * ps8[3];
+			sum[2][i] = ps8[2] * ps8[3];
+			sum[3][i] = ps8[3];
+		}
+	}
+	else
+	{
+		ps16 = (uint16_t *)srcbuf;
 
-			for(i = 0; i < 4; i++)
-			{
-				d[0] = d[1] = d[2] = d[3] = 0;
+		for(i = 0; i < j; i++, ps16 += 4)
+		{
+			col[0][i] = ps16[0];
+			col[1][i] = ps16[1];
+			col[2][i] = ps16[2];
+
+			sum[0][i] = (ps16[0] * ps16[3] + 0x4000) >> 15;
+			sum[1][i] = (ps16[1] * ps16[3] + 0x4000) >> 15;
+			sum[2][i] = (ps16[2] * ps16[3] + 0x4000) >> 15;
+			sum[3][i] = ps16[3];
+		}
+	}
 
-				min[0] = min[1] = min[2] = COLVAL_16BIT;
-				max[0] = max[1] = max[2] = 0;
+	//縦方向 (sw x ah)
 
-				for(jy = ptst[i].y; jy <= pted[i].y; jy++)
-				{
-					for(jx = ptst[i].x; jx <= pted[i].x; jx++)
-					{
-						FilterSub_getPixelSrc_clip(info, ix + jx, iy + jy, col);
+	for(ix = 0; ix < sw; ix++)
+	{
+		for(i = 0; i < 3; i++)
+		{
+			_slide_minmax(vmin[i] + ix, sw, col[i] + ix, sw, sh, len, FALSE, deq);
+			_slide_minmax(vmax[i] + ix, sw, col[i] + ix, sw, sh, len, TRUE, deq);
+		}
+
+		for(i = 0; i < 4; i++)
+			_slide_sum(vsum[i] + ix, sw, sum[i] + ix, sw, sh, len);
+	}
 
-						FilterSub_advcol_add16(d, col);
+	//横方向 (aw x ah)
 
-						//RGB 最小、最大値
+	for(iy = 0; iy < ah; iy++)
+	{
+		j = iy * sw;
 
-						for(j = 0; j < 3; j++)
-						{
-							if(col[j] < min[j]) min[j] = col[j];
-							if(col[j] > max[j]) max[j] = col[j];
-						}
-					}
-				}
+		mMemset0(range + j, aw * 4);
 
-				//最小
+		for(i = 0; i < 3; i++)
+		{
+			_slide_minmax(hmin, 1, vmin[i] + j, 1, sw, len, FALSE, deq);
+			_slide_minmax(hmax, 1, vmax[i] + j, 1, sw, len, TRUE, deq);
 
-				j = (max[0] - min[0]) + (max[1] - min[1]) + (max[2] - min[2]);
+			for(ix = 0; ix < aw; ix++)
+				range[j + ix] += hmax[ix] - hmin[ix];
+		}
+
+		for(i = 0; i < 4; i++)
+			_slide_sum(hsum[i] + j, 1, vsum[i] + j, 1, sw, len);
+	}
 
-				if(i == 0 || j < vmin)
+	//セット
+
+	dweight = 1.0 / (len * len);
+	dscale = (info->bits == 8)? 1.0 / 255: 1.0;
+
+	for(iy = 0; iy < h; iy++)
+	{
+		for(ix = 0; ix < w; ix++)
+		{
+			//左上、右上、右下、左下の範囲の位置
+
+			pos[0] = iy * sw + ix;
+			pos[1] = pos[0] + p->radius;
+			pos[2] = pos[1] + p->radius * sw;
+			pos[3] = pos[0] + p->radius * sw;
+
+			//差が最小の範囲
+
+			fmin = 0;
+			vmin_range = range[pos[0]];
+
+			for(i = 1; i < 4; i++)
+			{
+				if(range[pos[i]] < vmin_range)
 				{
-					vmin = j;
-					FilterSub_advcol_getColor16(d, dweight, colmin);
+					fmin = i;
+					vmin_range = range[pos[i]];
 				}
 			}
 
-			(setpix)(info->imgdst, ix, iy, colmin);
-		}
+			//平均色
 
-		FilterSub_prog_substep_inc(info);
+			j = pos[fmin];
+
+			d[0] = hsum[0][j] * dscale;
+			d[1] = hsum[1][j] * dscale;
+			d[2] = hsum[2][j] * dscale;
+
+			if(info->bits == 8)
+			{
+				d[3] = hsum[3][j] / 255.0;
+				FilterSub_advcol_getColor8(d, dweight, (uint8_t *)&colmin);
+			}
+			else
+			{
+				d[3] = (double)hsum[3][j] / COLVAL_16BIT;
+				FilterSub_advcol_getColor16(d, dweight, (uint16_t *)&colmin);
+			}
+
+			(setpix)(info->imgdst, rcdst->x1 + ix, rcdst->y1 + iy, &colmin);
+		}
 	}
 }
 
@@ -414,12 +573,22 @@ static void _proc_oilpaint_16bit(FilterDrawInfo *info)
 
 mlkbool FilterDraw_effect_oilpaint(FilterDrawInfo *info)
 {
-	if(info->bits == 8)
-		_proc_oilpaint_8bit(info);
-	else
-		_proc_oilpaint_16bit(info);
+	_tilebuf dat;
+	int plane;
+	mlkbool ret = FALSE;
 
-	return TRUE;
+	dat.radius = info->val_bar[0];
+
+	plane = (64 + dat.radius * 2) * (64 + dat.radius * 2);
+
+	//[ソース] [合計 x 4 x 3] [差] [作業用] [RGB x 3 x 3] [作業用 x 2]
+
+	if(_tilebuf_alloc(&dat, plane * (8 + 4 * 4 * 3 + 4 + 4 + 2 * 3 * 3 + 2 * 2)))
+		ret = FilterSub_proc_tile(info, _tile_oilpaint, &dat);
+
+	_tilebuf_free(&dat);
+
+	return ret;
 }
 
 
@@ -626,182 +795,216 @@ mlkbool FilterDraw_effect_scratch(FilterDrawInfo *info)
 //=============================
 // メディアン
 //=============================
+/*
+  - 範囲内の点を輝度順に並べた時の、指定位置 (最小/中央/最大) の点の色をセットする。
+  - 輝度のヒストグラムを、範囲を横にスライドしながら更新する。
+    ヒストグラムは、上位ビットの粗いものと、すべての値のものの 2 段階。
+  - 点の色は、列ごとの粗いヒストグラムから、その輝度を含む列を探して取得する。
+*/
 
 
-/* 8bit */
+/* タイルごとの処理 */
 
-static mlkbool _proc_median8(FilterDrawInfo *info)
+static void _tile_median(FilterDrawInfo *info,const mRect *rcdst,int threadno,void *param)
 {
-	int ix,iy,jx,jy,no,radius,num,pos;
-	RGBA8 col;
-	uint32_t *buf;
-	uint8_t col_v[7*7];
+	_tilebuf *p = (_tilebuf *)param;
+	uint8_t *srcbuf,*ps8;
+	uint16_t *lum,*colhist,*hc,*hf,*pl,*pl2,*ps16;
+	int i,ix,iy,jx,jy,w,h,sw,sh,len,plane,bytes,shift,cnum,v,cnt;
 	TileImageSetPixelFunc setpix;
 
 	FilterSub_getPixelFunc(&setpix);
 
-	radius = info->val_bar[0];
-	num = radius * 2 + 1;
-	num *= num;
+	len = p->radius * 2 + 1;
 
-	//バッファ
-
-	buf = (uint32_t *)mMalloc(num * 4);
-	if(!buf) return FALSE;
-
-	//取得する値の位置
+	w = rcdst->x2 - rcdst->x1 + 1;
+	h = rcdst->y2 - rcdst->y1 + 1;
+	sw = w + p->radius * 2;
+	sh = h + p->radius * 2;
 
-	ix = info->val_combo[0];
-
-	if(ix == 0)
-		pos = 0;
-	else if(ix == 1)
-		pos = num >> 1;
+	if(info->bits == 8)
+		bytes = 4, shift = 4, cnum = 16;
 	else
-		pos = num - 1;
-
-	//
-
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
-	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
-		{
-			//周囲の色と輝度を取得
+		bytes = 8, shift = 7, cnum = 257;
 
-			for(jy = -radius, no = 0; jy <= radius; jy++)
-			{
-				for(jx = -radius; jx <= radius; jx++, no++)
-				{
-					FilterSub_getPixelSrc_clip(info, ix + jx, iy + jy, &col);
+	//バッファ
 
-					buf[no] = col.v32;
-					col_v[no] = RGB_TO_LUM(col.r, col.g, col.b);
-				}
-			}
+	plane = (64 + p->radius * 2) * (64 + p->radius * 2);
 
-			//輝度の小さい順に並び替え
+	srcbuf = p->buf[threadno];
+	lum = (uint16_t *)(srcbuf + plane * 8);
+	colhist = lum + plane;
+	hc = colhist + (64 + p->radius * 2) * cnum;
+	hf = hc + cnum;
 
-			for(jx = 0; jx < num - 1; jx++)
-			{
-				no = jx;
+	//ソース取得 (すべて透明なら処理なし)
 
-				for(jy = jx + 1; jy < num; jy++)
-				{
-					if(col_v[jy] < col_v[no]) no = jy;
-				}
+	if(_tilebuf_get_src(info, rcdst, p->radius, srcbuf))
+		return;
 
-				if(no != jx)
-				{
-					jy = col_v[jx], col_v[jx] = col_v[no], col_v[no] = jy;
+	//輝度
 
-					col.v32 = buf[jx], buf[jx] = buf[no], buf[no] = col.v32;
-				}
-			}
+	ps8 = srcbuf;
+	ps16 = (uint16_t *)srcbuf;
 
-			//セット
-
-			(setpix)(info->imgdst, ix, iy, buf + pos);
+	for(i = sw * sh - 1, pl = lum; i >= 0; i--, pl++)
+	{
+		if(bytes == 4)
+		{
+			*pl = RGB_TO_LUM(ps8[0], ps8[1], ps8[2]);
+			ps8 += 4;
+		}
+		else
+		{
+			*pl = RGB_TO_LUM(ps16[0], ps16[1], ps16[2]);
+			ps16 += 4;
 		}
-
-		FilterSub_prog_substep_inc(info);
 	}
 
-	mFree(buf);
+	//列ごとの粗いヒストグラム (先頭行の範囲)
 
-	return TRUE;
-}
-
-/* 16bit */
+	mMemset0(colhist, sw * cnum * 2);
 
-static mlkbool _proc_median16(FilterDrawInfo *info)
-{
-	int ix,iy,jx,jy,no,radius,num,pos;
-	RGBA16 col;
-	uint64_t *buf;
-	uint16_t col_v[7*7];
-	TileImageSetPixelFunc setpix;
+	for(iy = 0, pl = lum; iy < len; iy++)
+	{
+		for(ix = 0; ix < sw; ix++, pl++)
+			colhist[ix * cnum + (*pl >> shift)]++;
+	}
 
-	FilterSub_getPixelFunc(&setpix);
+	mMemset0(hc, cnum * 2);
+	mMemset0(hf, (cnum << shift) * 2);
 
-	radius = info->val_bar[0];
-	num = radius * 2 + 1;
-	num *= num;
+	//
 
-	//バッファ
+	for(iy = 0; iy < h; iy++)
+	{
+		//列のヒストグラムを 1 行下へ
 
-	buf = (uint64_t *)mMalloc(num * 8);
-	if(!buf) return FALSE;
+		if(iy)
+		{
+			pl = lum + (iy - 1) * sw;
+			pl2 = pl + len * sw;
 
-	//取得する値の位置
+			for(ix = 0; ix < sw; ix++)
+			{
+				colhist[ix * cnum + (pl[ix] >> shift)]--;
+				colhist[ix * cnum + (pl2[ix] >> shift)]++;
+			}
+		}
 
-	ix = info->val_combo[0];
+		//行の先頭の範囲
 
-	if(ix == 0)
-		pos = 0;
-	else if(ix == 1)
-		pos = num >> 1;
-	else
-		pos = num - 1;
-
-	//
+		for(jy = 0, pl = lum + iy * sw; jy < len; jy++, pl += sw)
+		{
+			for(jx = 0; jx < len; jx++)
+			{
+				v = pl[jx];
+				hf[v]++;
+				hc[v >> shift]++;
+			}
+		}
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
-	{
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix++)
+		for(ix = 0; ix < w; ix++)
 		{
-			//周囲の色と輝度を取得
+			//範囲を右へ
 
-			for(jy = -radius, no = 0; jy <= radius; jy++)
+			if(ix)
 			{
-				for(jx = -radius; jx <= radius; jx++, no++)
+				for(jy = 0, pl = lum + iy * sw + ix - 1; jy < len; jy++, pl += sw)
 				{
-					FilterSub_getPixelSrc_clip(info, ix + jx, iy + jy, &col);
+					v = pl[0];
+					hf[v]--;
+					hc[v >> shift]--;
 
-					buf[no] = col.v64;
-					col_v[no] = RGB_TO_LUM(col.r, col.g, col.b);
+					v = pl[len];
+					hf[v]++;
+					hc[v >> shift]++;
 				}
 			}
 
-			//輝度の小さい順に並び替え
+			//pos 番目の輝度
+
+			cnt = 0;
 
-			for(jx = 0; jx < num - 1; jx++)
+			for(i = 0; cnt + hc[i] <= p->pos; i++)
+				cnt += hc[i];
+
+			for(v = i << shift; ; v++)
 			{
-				no = jx;
+				cnt += hf[v];
+				if(cnt > p->pos) break;
+			}
 
-				for(jy = jx + 1; jy < num; jy++)
-				{
-					if(col_v[jy] < col_v[no]) no = jy;
-				}
+			//輝度が v の点を探す
 
-				if(no != jx)
-				{
-					jy = col_v[jx], col_v[jx] = col_v[no], col_v[no] = jy;
+			for(jx = ix; jx < ix + len; jx++)
+			{
+				if(!colhist[jx * cnum + i]) continue;
 
-					col.v64 = buf[jx], buf[jx] = buf[no], buf[no] = col.v64;
+				for(jy = iy, pl = lum + iy * sw + jx; jy < iy + len; jy++, pl += sw)
+				{
+					if(*pl == v) goto FOUND;
 				}
 			}
 
-			//セット
+			continue;
 
-			(setpix)(info->imgdst, ix, iy, buf + pos);
+		FOUND:
+			(setpix)(info->imgdst, rcdst->x1 + ix, rcdst->y1 + iy,
+				srcbuf + (jy * sw + jx) * bytes);
 		}
 
-		FilterSub_prog_substep_inc(info);
-	}
-
-	mFree(buf);
+		//範囲のヒストグラムをクリア
 
-	return TRUE;
+		for(i = 0; i < cnum; i++)
+		{
+			if(hc[i])
+			{
+				mMemset0(hf + (i << shift), 2 << shift);
+				hc[i] = 0;
+			}
+		}
+	}
 }
 
 /** メディアン */
 
 mlkbool FilterDraw_effect_median(FilterDrawInfo *info)
 {
-	if(info->bits == 8)
-		return _proc_median8(info);
+	_tilebuf dat;
+	int num,size,cnum;
+	mlkbool ret = FALSE;
+
+	dat.radius = info->val_bar[0];
+
+	num = dat.radius * 2 + 1;
+	num *= num;
+
+	//取得する値の位置
+
+	if(info->val_combo[0] == 0)
+		dat.pos = 0;
+	else if(info->val_combo[0] == 1)
+		dat.pos = num >> 1;
 	else
-		return _proc_median16(info);
+		dat.pos = num - 1;
+
+	//[ソース] [輝度] [列ごとのヒストグラム] [範囲のヒストグラム (粗い/すべて)]
+
+	size = 64 + dat.radius * 2;
+	cnum = (info->bits == 8)? 16: 257;
+
+	size = size * size * (8 + 2)
+		+ size * cnum * 2
+		+ cnum * 2
+		+ (cnum << ((info->bits == 8)? 4: 7)) * 2;
+
+	if(_tilebuf_alloc(&dat, size))
+		ret = FilterSub_proc_tile(info, _tile_median, &dat);
+
+	_tilebuf_free(&dat);
+
+	return ret;
 }
 
 
@@ -503,7 +503,9 @@ static void _proc_preview_rgba(FilterDrawInfo *info,
 
 		for(tx = tinfo.rctile.x1; tx <= tinfo.rctile.x2; tx++, px += 64, ppsrc++, ppdst++)
 		{
-			if(!(*ppsrc)) continue;
+			//描画先は src の複製のため、タイルが共有されている
+
+			if(!(*ppsrc) || !TileImage_unshareTile(info->imgdst, ppdst)) continue;
 
 			//タイル単位で処理
 
@@ -594,7 +596,9 @@ static void _proc_preview_gray(FilterDrawInfo *info,
 
 		for(tx = tinfo.rctile.x1; tx <= tinfo.rctile.x2; tx++, px += 64, ppsrc++, ppdst++)
 		{
-			if(!(*ppsrc)) continue;
+			//描画先は src の複製のため、タイルが共有されている
+
+			if(!(*ppsrc) || !TileImage_unshareTile(info->imgdst, ppdst)) continue;
 
 			//タイル単位で処理
 
@@ -21,61 +21,220 @@ $*/
  * フィルタ処理: 共通描画処理関数
  **************************************/
 
+#include <string.h>
 #include <math.h>
 
 #include "mlk.h"
+#include "mlk_rectbox.h"
+#include "mlk_rand.h"
 
+#include "def_tileimage.h"
 #include "tileimage.h"
+#include "threadpool.h"
 
 #include "def_filterdraw.h"
 #include "pv_filter_sub.h"
 
 
 
-/** 点処理関数を指定して、描画
+//============================
+// タイル単位の並列処理
+//============================
+/*
+  - 処理範囲を、描画先イメージのタイル位置に合わせて 64x64 単位に分割し、
+    スレッドプールで並列処理する。
+  - 各ジョブは、描画先の異なるタイルにのみ書き込む。
+    実際の描画時は、事前にタイル配列を確保しておくため、ロックは必要ない。
+  - FilterDrawInfo はジョブごとに複製して渡す。
+    乱数は、スレッドごとの mRandSFMT を、ジョブごとに決まった種で初期化する。
+    (スレッド数に関係なく、同じ結果になる)
+*/
+
+typedef struct
+{
+	FilterDrawInfo *info;
+	FilterSubFunc_tile func;
+	void *param;
+	mRandSFMT *rand[THREADPOOL_MAXNUM];	//スレッドごとの乱数
+	int x1,y1,		//先頭タイルの左上位置
+		xnum,		//横のタイル数
+		fline;		//タイルの行単位 (横は処理範囲全体)
+	uint32_t seed;	//乱数の種の基準値
+}_proctile;
+
+
+/* [スレッド] 一つのタイルを処理 */
+
+static void _thread_proc_tile(void *param,int jobno,int threadno)
+{
+	_proctile *p = (_proctile *)param;
+	FilterDrawInfo info;
+	mRect rc;
+
+	info = *(p->info);
+	info.rand = p->rand[threadno];
+
+	mRandSFMT_init(info.rand, p->seed + jobno);
+
+	//範囲
+
+	rc.x1 = p->x1 + (jobno % p->xnum) * 64;
+	rc.y1 = p->y1 + (jobno / p->xnum) * 64;
+	rc.x2 = rc.x1 + 63;
+	rc.y2 = rc.y1 + 63;
+
+	if(p->fline)
+		rc.x2 = info.rc.x2;
+
+	if(rc.x1 < info.rc.x1) rc.x1 = info.rc.x1;
+	if(rc.y1 < info.rc.y1) rc.y1 = info.rc.y1;
+	if(rc.x2 > info.rc.x2) rc.x2 = info.rc.x2;
+	if(rc.y2 > info.rc.y2) rc.y2 = info.rc.y2;
+
+	(p->func)(&info, &rc, threadno, p->param);
+
+	FilterSub_prog_substep_inc(p->info);
+}
+
+/* タイル単位で処理 */
+
+static mlkbool _proc_tile(FilterDrawInfo *info,FilterSubFunc_tile func,void *param,int fline)
+{
+	_proctile dat;
+	TileImage *imgdst = info->imgdst;
+	int i,num,ret = FALSE;
+
+	if(mRectIsEmpty(&info->rc)) return TRUE;
+
+	//実際の描画時は、描画先のタイル配列を確保しておく
+
+	if(!info->in_dialog
+		&& !TileImage_setPixel_beginThread(imgdst, &info->rc))
+		return FALSE;
+
+	//
+
+	mMemset0(&dat, sizeof(_proctile));
+
+	dat.info = info;
+	dat.func = func;
+	dat.param = param;
+	dat.seed = mRandSFMT_getUint32(info->rand);
+
+	dat.x1 = imgdst->offx + ((info->rc.x1 - imgdst->offx) & ~63);
+	dat.y1 = imgdst->offy + ((info->rc.y1 - imgdst->offy) & ~63);
+	dat.xnum = (fline)? 1: (info->rc.x2 - dat.x1) / 64 + 1;
+	dat.fline = fline;
+
+	num = dat.xnum * ((info->rc.y2 - dat.y1) / 64 + 1);
+
+	//スレッドごとの乱数
+
+	for(i = ThreadPool_getNum() - 1; i >= 0; i--)
+	{
+		dat.rand[i] = mRandSFMT_new();
+		if(!dat.rand[i]) goto END;
+	}
+
+	//処理
+
+	FilterSub_prog_substep_begin_onestep(info, 50, num);
+
+	ThreadPool_run(_thread_proc_tile, &dat, num);
+
+	ret = TRUE;
+
+END:
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		mRandSFMT_free(dat.rand[i]);
+
+	return ret;
+}
+
+/** タイル単位で処理
  *
- * 関数で FALSE が返った場合、点を描画しない。 */
+ * info->rc の範囲を、描画先のタイル単位で分割して、並列処理する。
+ * func 内では、rc の範囲内の点のみを描画すること。
+ * 進捗は、タイルごとに +1 される。 */
 
-mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,
-	FilterSubFunc_pixel8 func8,FilterSubFunc_pixel16 func16)
+mlkbool FilterSub_proc_tile(FilterDrawInfo *info,FilterSubFunc_tile func,void *param)
+{
+	return _proc_tile(info, func, param, FALSE);
+}
+
+/** タイルの行単位で処理
+ *
+ * 高さはタイル単位で分割し、横は処理範囲全体を一度に処理する。 */
+
+mlkbool FilterSub_proc_tile_line(FilterDrawInfo *info,FilterSubFunc_tile func,void *param)
 {
+	return _proc_tile(info, func, param, TRUE);
+}
+
+
+//============================
+// 点処理
+//============================
+
+
+typedef struct
+{
+	FilterSubFunc_pixel8 func8;
+	FilterSubFunc_pixel16 func16;
+}_procpixel;
+
+
+/* タイルごとの処理 */
+
+static void _tile_pixel(FilterDrawInfo *info,const mRect *rc,int threadno,void *param)
+{
+	_procpixel *dat = (_procpixel *)param;
 	TileImage *imgsrc,*imgdst;
 	TileImageSetPixelFunc setpix; 
-	int ix,iy,bits;
+	int ix,iy;
 	uint64_t col;
-	mRect rc;
 
 	imgsrc = info->imgsrc;
 	imgdst = info->imgdst;
-	rc = info->rc;
-	bits = info->bits;
 
 	FilterSub_getPixelFunc(&setpix);
 
 	//
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
+	for(iy = rc->y1; iy <= rc->y2; iy++)
 	{
-		for(ix = rc.x1; ix <= rc.x2; ix++)
+		for(ix = rc->x1; ix <= rc->x2; ix++)
 		{
 			TileImage_getPixel(imgsrc, ix, iy, &col);
 
-			if(bits == 8)
+			if(info->bits == 8)
 			{
-				if((func8)(info, ix, iy, (RGBA8 *)&col))
+				if((dat->func8)(info, ix, iy, (RGBA8 *)&col))
 					(setpix)(imgdst, ix, iy, &col);
 			}
 			else
 			{
-				if((func16)(info, ix, iy, (RGBA16 *)&col))
+				if((dat->func16)(info, ix, iy, (RGBA16 *)&col))
 					(setpix)(imgdst, ix, iy, &col);
 			}
 		}
-
-		FilterSub_prog_substep_inc(info);
 	}
+}
 
-	return TRUE;
+/** 点処理関数を指定して、描画
+ *
+ * 関数で FALSE が返った場合、点を描画しない。
+ * 関数は複数のスレッドから呼ばれる。 */
+
+mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,
+	FilterSubFunc_pixel8 func8,FilterSubFunc_pixel16 func16)
+{
+	_procpixel dat;
+
+	dat.func8 = func8;
+	dat.func16 = func16;
+
+	return FilterSub_proc_tile(info, _tile_pixel, &dat);
 }
 
 
@@ -90,29 +249,28 @@ mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,
 
 /* 8bit */
 
-static void _proc_3x3_8bit(FilterDrawInfo *info,Filter3x3Info *dat)
+static void _tile_3x3_8bit(FilterDrawInfo *info,const mRect *rc,int threadno,void *param)
 {
+	Filter3x3Info *dat = (Filter3x3Info *)param;
 	TileImage *imgsrc,*imgdst;
 	int ix,iy,ixx,iyy,n;
 	double d[3],divmul,add,dd;
 	RGBA8 col,col2;
-	mRect rc;
 	TileImageSetPixelFunc setpix;
 
 	FilterSub_getPixelFunc(&setpix); 
 
 	imgsrc = info->imgsrc;
 	imgdst = info->imgdst;
-	rc = info->rc;
 
 	divmul = dat->divmul;
 	add = dat->add;
 
 	//
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
+	for(iy = rc->y1; iy <= rc->y2; iy++)
 	{
-		for(ix = rc.x1; ix <= rc.x2; ix++)
+		for(ix = rc->x1; ix <= rc->x2; ix++)
 		{
 			TileImage_getPixel(imgsrc, ix, iy, &col);
 
@@ -160,36 +318,33 @@ static void _proc_3x3_8bit(FilterDrawInfo *info,Filter3x3Info *dat)
 
 			(setpix)(imgdst, ix, iy, &col);
 		}
-
-		FilterSub_prog_substep_inc(info);
 	}
 }
 
 /* 16bit */
 
-static void _proc_3x3_16bit(FilterDrawInfo *info,Filter3x3Info *dat)
+static void _tile_3x3_16bit(FilterDrawInfo *info,const mRect *rc,int threadno,void *param)
 {
+	Filter3x3Info *dat = (Filter3x3Info *)param;
 	TileImage *imgsrc,*imgdst;
 	int ix,iy,ixx,iyy,n;
 	double d[3],divmul,add,dd;
 	RGBA16 col,col2;
-	mRect rc;
 	TileImageSetPixelFunc setpix;
 
 	FilterSub_getPixelFunc(&setpix); 
 
 	imgsrc = info->imgsrc;
 	imgdst = info->imgdst;
-	rc = info->rc;
 
 	divmul = dat->divmul;
 	add = dat->add;
 
 	//
 
-	for(iy = rc.y1; iy <= rc.y2; iy++)
+	for(iy = rc->y1; iy <= rc->y2; iy++)
 	{
-		for(ix = rc.x1; ix <= rc.x2; ix++)
+		for(ix = rc->x1; ix <= rc->x2; ix++)
 		{
 			TileImage_getPixel(imgsrc, ix, iy, &col);
 
@@ -237,8 +392,6 @@ static void _proc_3x3_16bit(FilterDrawInfo *info,Filter3x3Info *dat)
 
 			(setpix)(imgdst, ix, iy, &col);
 		}
-
-		FilterSub_prog_substep_inc(info);
 	}
 }
 
@@ -246,18 +399,31 @@ static void _proc_3x3_16bit(FilterDrawInfo *info,Filter3x3Info *dat)
 
 mlkbool FilterSub_proc_3x3(FilterDrawInfo *info,Filter3x3Info *dat)
 {
-	if(info->bits == 8)
-		_proc_3x3_8bit(info, dat);
-	else
-		_proc_3x3_16bit(info, dat);
-
-	return TRUE;
+	return FilterSub_proc_tile(info,
+		(info->bits == 8)? _tile_3x3_8bit: _tile_3x3_16bit, dat);
 }
 
 
 //=========================
 // ガウスぼかし
 //=========================
+/*
+  - 出力 64x64 ごとに、周囲 range px を含むソースを取得し、水平 -> 垂直の順でぼかす。
+  - 作業用バッファはスレッドごとに確保する。
+*/
+
+
+typedef struct
+{
+	TileImage *imgsrc;
+	FilterSubFunc_gaussblur_setpix setpix;
+	FilterSubFunc_gaussblur_setsrc setsrc;
+	double *tblbuf,
+		dweight;
+	int range,
+		procw;	//ソースの幅と高さ
+	uint8_t *buf[THREADPOOL_MAXNUM];	//スレッドごとの作業用 (ソース + 水平方向の結果)
+}_gaussblur;
 
 
 /** ガウスぼかしの重みテーブル作成 */
@@ -286,276 +452,678 @@ double *FilterSub_createGaussTable(int radius,int range,double *dst_weight)
 	return buf;
 }
 
-/** ガウスぼかし処理 (8bit)
+/* 作業用データの初期化
  *
- * setpix: 結果の点を描画する関数。NULL で imgdst に通常描画。
- * setsrc: ぼかし処理の前にソースの色を処理する関数。NULL でなし。 */
+ * bytes: 1px のバイト数 */
 
-mlkbool FilterSub_proc_gaussblur8(FilterDrawInfo *info,
-	TileImage *imgsrc,int radius,
+static mlkbool _gaussblur_init(_gaussblur *p,TileImage *imgsrc,int radius,int bytes,
 	FilterSubFunc_gaussblur_setpix setpix,FilterSubFunc_gaussblur_setsrc setsrc)
 {
+	int i;
+
+	mMemset0(p, sizeof(_gaussblur));
+
+	p->imgsrc = imgsrc;
+	p->setpix = setpix;
+	p->setsrc = setsrc;
+	p->range = radius * 3;
+	p->procw = p->range * 2 + 64;
+
+	//ガウステーブル
+
+	p->tblbuf = FilterSub_createGaussTable(radius, p->range, &p->dweight);
+	if(!p->tblbuf) return FALSE;
+
+	//バッファ
+
+	for(i = ThreadPool_getNum() - 1; i >= 0; i--)
+	{
+		p->buf[i] = (uint8_t *)mMalloc((p->procw * p->procw + p->procw * 64) * bytes);
+		if(!p->buf[i]) return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* 作業用データの解放 */
+
+static void _gaussblur_free(_gaussblur *p)
+{
+	int i;
+
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		mFree(p->buf[i]);
+
+	mFree(p->tblbuf);
+}
+
+/* タイルごとの処理 (8bit) */
+
+static void _tile_gaussblur8(FilterDrawInfo *info,const mRect *rcdst,int threadno,void *param)
+{
+	_gaussblur *p = (_gaussblur *)param;
 	uint32_t *buf1,*buf2,*ps,*psY,*pd;
-	int ix,iy,jx,jy,i,range,procw,xnum,ynum,pos,blurlen,srcpixnum;
+	int jx,jy,i,range,procw,xnum,ynum,pos,blurlen;
 	uint8_t col[4];
 	double d[4],*tblbuf,dweight;
 	mRect rc;
 	TileImageSetPixelFunc setpix_def;
 
-	range = radius * 3;
-	procw = range * 2 + 64;
+	range = p->range;
+	procw = p->procw;
 	blurlen = range * 2 + 1;
-	srcpixnum = procw * procw;
+	tblbuf = p->tblbuf;
+	dweight = p->dweight;
+
+	buf1 = (uint32_t *)p->buf[threadno];
+	buf2 = buf1 + procw * procw;
 
 	FilterSub_getPixelFunc(&setpix_def);
 
-	//バッファ
+	//rc = ソースの取得範囲
+
+	rc.x1 = rcdst->x1 - range;
+	rc.y1 = rcdst->y1 - range;
+	rc.x2 = rc.x1 + procw - 1;
+	rc.y2 = rc.y1 + procw - 1;
+
+	//buf1 に 64x64 処理分のソースセット (すべて透明なら処理なし)
+
+	if(FilterSub_getPixelBuf8(p->imgsrc, &rc, (uint8_t *)buf1, info->clipping))
+		return;
 
-	buf1 = (uint32_t *)mMalloc(procw * procw * 4);
-	buf2 = (uint32_t *)mMalloc(procw * 64 * 4);
+	//ソースの色を処理
 
-	if(!buf1 || !buf2)
+	if(p->setsrc)
+		(p->setsrc)(buf1, procw * procw, info);
+
+	//水平方向
+	// buf2: Y[procw] x X[64]
+
+	ps = buf1 + range;
+	pd = buf2;
+
+	for(jy = 0; jy < procw; jy++, pd++)
 	{
-		mFree(buf1);
-		return FALSE;
+		for(jx = 0, pos = 0; jx < 64; jx++, ps++, pos += procw)
+		{
+			d[0] = d[1] = d[2] = d[3] = 0;
+
+			for(i = 0; i < blurlen; i++)
+				FilterSub_advcol_add_weight8(d, tblbuf[i], (uint8_t *)(ps + i - range));
+
+			FilterSub_advcol_getColor8(d, dweight, (uint8_t *)(pd + pos));
+		}
+
+		ps += procw - 64;
 	}
 
-	//ガウステーブル
+	//垂直方向
+
+	xnum = rcdst->x2 - rcdst->x1 + 1;
+	ynum = rcdst->y2 - rcdst->y1 + 1;
 
-	tblbuf = FilterSub_createGaussTable(radius, range, &dweight);
-	if(!tblbuf)
+	psY = buf2 + range;
+
+	for(jx = 0; jx < xnum; jx++)
 	{
-		mFree(buf1);
-		mFree(buf2);
-		return FALSE;
+		for(jy = 0, ps = psY; jy < ynum; jy++, ps++)
+		{
+			d[0] = d[1] = d[2] = d[3] = 0;
+
+			for(i = 0; i < blurlen; i++)
+				FilterSub_advcol_add_weight8(d, tblbuf[i], (uint8_t *)(ps + i - range));
+
+			FilterSub_advcol_getColor8(d, dweight, col);
+
+			if(p->setpix)
+				(p->setpix)(rcdst->x1 + jx, rcdst->y1 + jy, col, info);
+			else
+				(setpix_def)(info->imgdst, rcdst->x1 + jx, rcdst->y1 + jy, col);
+		}
+
+		psY += procw;
 	}
+}
 
-	//--------------
+/* タイルごとの処理 (16bit) */
 
-	FilterSub_prog_substep_begin_onestep(info, 50, ((info->box.w + 63) / 64) * ((info->box.h + 63) / 64));
+static void _tile_gaussblur16(FilterDrawInfo *info,const mRect *rcdst,int threadno,void *param)
+{
+	_gaussblur *p = (_gaussblur *)param;
+	uint64_t *buf1,*buf2,*ps,*psY,*pd;
+	int jx,jy,i,range,procw,xnum,ynum,pos,blurlen;
+	uint16_t col[4];
+	double d[4],*tblbuf,dweight;
+	mRect rc;
+	TileImageSetPixelFunc setpix_def;
+
+	range = p->range;
+	procw = p->procw;
+	blurlen = range * 2 + 1;
+	tblbuf = p->tblbuf;
+	dweight = p->dweight;
+
+	buf1 = (uint64_t *)p->buf[threadno];
+	buf2 = buf1 + procw * procw;
+
+	FilterSub_getPixelFunc(&setpix_def);
 
 	//rc = ソースの取得範囲
 
-	rc.y1 = info->rc.y1 - range;
+	rc.x1 = rcdst->x1 - range;
+	rc.y1 = rcdst->y1 - range;
+	rc.x2 = rc.x1 + procw - 1;
 	rc.y2 = rc.y1 + procw - 1;
 
-	//
+	//buf1 に 64x64 処理分のソースセット (すべて透明なら処理なし)
+
+	if(FilterSub_getPixelBuf16(p->imgsrc, &rc, (uint16_t *)buf1, info->clipping))
+		return;
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy += 64)
+	//ソースの色を処理
+
+	if(p->setsrc)
+		(p->setsrc)(buf1, procw * procw, info);
+
+	//水平方向
+	// buf2: Y[procw] x X[64]
+
+	ps = buf1 + range;
+	pd = buf2;
+
+	for(jy = 0; jy < procw; jy++, pd++)
 	{
-		rc.x1 = info->rc.x1 - range;
-		rc.x2 = rc.x1 + procw - 1;
-	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix += 64, rc.x1 += 64, rc.x2 += 64)
+		for(jx = 0, pos = 0; jx < 64; jx++, ps++, pos += procw)
 		{
-			//buf1 に 64x64 処理分のソースセット (すべて透明なら処理なし)
-		
-			if(FilterSub_getPixelBuf8(imgsrc, &rc, (uint8_t *)buf1, info->clipping))
-			{
-				FilterSub_prog_substep_inc(info);
-				continue;
-			}
+			d[0] = d[1] = d[2] = d[3] = 0;
 
-			//ソースの色を処理
+			for(i = 0; i < blurlen; i++)
+				FilterSub_advcol_add_weight16(d, tblbuf[i], (uint16_t *)(ps + i - range));
 
-			if(setsrc)
-				(setsrc)(buf1, srcpixnum, info);
+			FilterSub_advcol_getColor16(d, dweight, (uint16_t *)(pd + pos));
+		}
 
-			//水平方向
-			// buf2: Y[procw] x X[64]
+		ps += procw - 64;
+	}
 
-			ps = buf1 + range;
-			pd = buf2;
+	//垂直方向
 
-			for(jy = 0; jy < procw; jy++, pd++)
-			{
-				for(jx = 0, pos = 0; jx < 64; jx++, ps++, pos += procw)
-				{
-					d[0] = d[1] = d[2] = d[3] = 0;
+	xnum = rcdst->x2 - rcdst->x1 + 1;
+	ynum = rcdst->y2 - rcdst->y1 + 1;
 
-					for(i = 0; i < blurlen; i++)
-						FilterSub_advcol_add_weight8(d, tblbuf[i], (uint8_t *)(ps + i - range));
+	psY = buf2 + range;
 
-					FilterSub_advcol_getColor8(d, dweight, (uint8_t *)(pd + pos));
-				}
+	for(jx = 0; jx < xnum; jx++)
+	{
+		for(jy = 0, ps = psY; jy < ynum; jy++, ps++)
+		{
+			d[0] = d[1] = d[2] = d[3] = 0;
 
-				ps += procw - 64;
-			}
+			for(i = 0; i < blurlen; i++)
+				FilterSub_advcol_add_weight16(d, tblbuf[i], (uint16_t *)(ps + i - range));
 
-			//垂直方向
+			FilterSub_advcol_getColor16(d, dweight, col);
 
-			xnum = ynum = 64;
-			if(ix + 63 > info->rc.x2) xnum = info->rc.x2 + 1 - ix;
-			if(iy + 63 > info->rc.y2) ynum = info->rc.y2 + 1 - iy;
+			if(p->setpix)
+				(p->setpix)(rcdst->x1 + jx, rcdst->y1 + jy, col, info);
+			else
+				(setpix_def)(info->imgdst, rcdst->x1 + jx, rcdst->y1 + jy, col);
+		}
 
-			psY = buf2 + range;
+		psY += procw;
+	}
+}
 
-			for(jx = 0; jx < xnum; jx++)
-			{
-				for(jy = 0, ps = psY; jy < ynum; jy++, ps++)
-				{
-					d[0] = d[1] = d[2] = d[3] = 0;
 
-					for(i = 0; i < blurlen; i++)
-						FilterSub_advcol_add_weight8(d, tblbuf[i], (uint8_t *)(ps + i - range));
+//==================================
+// ガウスぼかし (ボックスぼかしで近似)
+//==================================
+/*
+  - 3回のボックスぼかしで、ガウスぼかし (σ = 半径) を近似する。
+    各ボックスは移動和で処理するため、1行・1列内の 1px あたりの処理量は半径に関係しない。
+  - タイルの行単位 (高さ 64px、幅は処理範囲全体) で、
+    周囲を含む各行を水平方向にぼかした後、各列を垂直方向にぼかす。
+  - 各タイル行は独立して (並列で) 処理するため、上下の ext 行 (ボックス半径の合計) は
+    タイル行ごとに重複して処理される。
+    そのため、全体の処理量は (64 + ext * 2) / 64 倍になり、半径が大きいほど増える。
+    (それでも、ガウスの重みを半径 * 3 の範囲で掛けるより少ない)
+  - 値は、アルファ値を乗算した整数で扱う。
+    8bit: RGB = c * a、A = a * 255
+    16bit: RGB = (c * a) >> 6、A = a << 9 (最大 2^24)
+*/
 
-					FilterSub_advcol_getColor8(d, dweight, col);
+#define _BOXBLUR_NUM  3		//ボックスぼかしの回数
+#define _BOXBLUR_MIN_RADIUS 3	//この半径以上の場合に使う
 
-					if(setpix)
-						(setpix)(ix + jx, iy + jy, col, info);
-					else
-						(setpix_def)(info->imgdst, ix + jx, iy + jy, col);
-				}
+typedef struct
+{
+	TileImage *imgsrc;
+	FilterSubFunc_gaussblur_setpix setpix;
+	FilterSubFunc_gaussblur_setsrc setsrc;
+	int boxr[_BOXBLUR_NUM],	//各ボックスの半径
+		ext,		//周囲に必要な幅 (ボックス半径の合計)
+		width,		//処理範囲の幅
+		srclen,		//周囲を含む1行の長さ
+		linelen,	//作業用1行の長さ
+		bits;
+	uint8_t *buf[THREADPOOL_MAXNUM];	//スレッドごとの作業用
+}_boxblur;
+
+
+/* 各ボックスの半径を取得 */
+
+static void _boxblur_get_radius(int *dst,int radius)
+{
+	double sigma2;
+	int i,wl,m;
 
-				psY += procw;
-			}
+	sigma2 = 12.0 * radius * radius;
 
-			FilterSub_prog_substep_inc(info);
-		}
+	//ボックス幅 (奇数)
 
-		rc.y1 += 64;
-		rc.y2 += 64;
-	}
+	wl = (int)sqrt(sigma2 / _BOXBLUR_NUM + 1);
+	if(!(wl & 1)) wl--;
 
-	mFree(buf1);
-	mFree(buf2);
-	mFree(tblbuf);
+	//幅 wl のボックス数 (残りは wl + 2)
 
-	return TRUE;
+	m = (int)floor((sigma2 - _BOXBLUR_NUM * wl * wl - 4 * _BOXBLUR_NUM * wl - 3 * _BOXBLUR_NUM)
+		/ (-4.0 * wl - 4) + 0.5);
+
+	if(m < 0) m = 0;
+	else if(m > _BOXBLUR_NUM) m = _BOXBLUR_NUM;
+
+	for(i = 0; i < _BOXBLUR_NUM; i++)
+		dst[i] = ((i < m)? wl: wl + 2) >> 1;
 }
 
-/** ガウスぼかし処理 (16bit) */
+/* 作業用データの初期化 */
 
-mlkbool FilterSub_proc_gaussblur16(FilterDrawInfo *info,
-	TileImage *imgsrc,int radius,
+static mlkbool _boxblur_init(_boxblur *p,FilterDrawInfo *info,TileImage *imgsrc,int radius,
 	FilterSubFunc_gaussblur_setpix setpix,FilterSubFunc_gaussblur_setsrc setsrc)
 {
-	uint64_t *buf1,*buf2,*ps,*psY,*pd;
-	int ix,iy,jx,jy,i,range,procw,xnum,ynum,pos,blurlen,srcpixnum;
-	uint16_t col[4];
-	double d[4],*tblbuf,dweight;
-	mRect rc;
-	TileImageSetPixelFunc setpix_def;
+	int i,size;
 
-	range = radius * 3;
-	procw = range * 2 + 64;
-	blurlen = range * 2 + 1;
-	srcpixnum = procw * procw;
+	mMemset0(p, sizeof(_boxblur));
 
-	FilterSub_getPixelFunc(&setpix_def);
+	p->imgsrc = imgsrc;
+	p->setpix = setpix;
+	p->setsrc = setsrc;
+	p->bits = info->bits;
+
+	_boxblur_get_radius(p->boxr, radius);
+
+	for(i = 0; i < _BOXBLUR_NUM; i++)
+		p->ext += p->boxr[i];
+
+	p->width = info->rc.x2 - info->rc.x1 + 1;
+	p->srclen = p->width + p->ext * 2;
+	p->linelen = (p->srclen > 64 + p->ext * 2)? p->srclen: 64 + p->ext * 2;
 
 	//バッファ
+	// [ソース1行 (RGBA)] [作業用1行 x 2] [水平方向の結果 (64 + ext * 2) 行]
 
-	buf1 = (uint64_t *)mMalloc(procw * procw * 8);
-	buf2 = (uint64_t *)mMalloc(procw * 64 * 8);
+	size = p->srclen * 8
+		+ p->linelen * 16 * 2
+		+ (64 + p->ext * 2) * p->width * 16;
 
-	if(!buf1 || !buf2)
+	for(i = ThreadPool_getNum() - 1; i >= 0; i--)
 	{
-		mFree(buf1);
-		return FALSE;
+		p->buf[i] = (uint8_t *)mMalloc(size);
+		if(!p->buf[i]) return FALSE;
 	}
 
-	//ガウステーブル
+	return TRUE;
+}
+
+/* 作業用データの解放 */
+
+static void _boxblur_free(_boxblur *p)
+{
+	int i;
+
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		mFree(p->buf[i]);
+}
+
+/* 1行をボックスぼかし
+ *
+ * num: src の数。dst には num - r * 2 個が出力される。 */
+
+static void _boxblur_line(uint32_t *dst,const uint32_t *src,int num,int r)
+{
+	const uint32_t *ps;
+	uint32_t s[4];
+	uint64_t mul;
+	int i,w;
+
+	w = r * 2 + 1;
+	mul = (((uint64_t)1 << 32) + (w >> 1)) / w;
 
-	tblbuf = FilterSub_createGaussTable(radius, range, &dweight);
-	if(!tblbuf)
+	s[0] = s[1] = s[2] = s[3] = 0;
+
+	for(i = 0, ps = src; i < w; i++, ps += 4)
 	{
-		mFree(buf1);
-		mFree(buf2);
-		return FALSE;
+		s[0] += ps[0];
+		s[1] += ps[1];
+		s[2] += ps[2];
+		s[3] += ps[3];
 	}
 
-	//--------------
+	//移動和
 
-	FilterSub_prog_substep_begin_onestep(info, 50, ((info->box.w + 63) / 64) * ((info->box.h + 63) / 64));
+	for(num -= w; 1; dst += 4, src += 4)
+	{
+		dst[0] = (s[0] * mul + ((uint64_t)1 << 31)) >> 32;
+		dst[1] = (s[1] * mul + ((uint64_t)1 << 31)) >> 32;
+		dst[2] = (s[2] * mul + ((uint64_t)1 << 31)) >> 32;
+		dst[3] = (s[3] * mul + ((uint64_t)1 << 31)) >> 32;
 
-	//rc = ソースの取得範囲
+		if(num-- <= 0) break;
 
-	rc.y1 = info->rc.y1 - range;
-	rc.y2 = rc.y1 + procw - 1;
+		s[0] += ps[0] - src[0];
+		s[1] += ps[1] - src[1];
+		s[2] += ps[2] - src[2];
+		s[3] += ps[3] - src[3];
 
-	//
+		ps += 4;
+	}
+}
+
+/* 1行を3回ボックスぼかし
+ *
+ * line[0] に入力。結果のバッファが返る。 */
+
+static uint32_t *_boxblur_line_all(_boxblur *p,uint32_t **line,int num)
+{
+	uint32_t *src,*dst,*tmp;
+	int i;
+
+	src = line[0];
+	dst = line[1];
 
-	for(iy = info->rc.y1; iy <= info->rc.y2; iy += 64)
+	for(i = 0; i < _BOXBLUR_NUM; i++)
 	{
-		rc.x1 = info->rc.x1 - range;
-		rc.x2 = rc.x1 + procw - 1;
+		_boxblur_line(dst, src, num, p->boxr[i]);
+
+		num -= p->boxr[i] * 2;
+
+		tmp = src, src = dst, dst = tmp;
+	}
+
+	return src;
+}
+
+/* ソースの1行を、アルファ値を乗算した値に変換 */
+
+static void _boxblur_convert_src(_boxblur *p,uint32_t *dst,void *src)
+{
+	uint8_t *ps8;
+	uint16_t *ps16;
+	uint32_t a;
+	int i;
+
+	if(p->bits == 8)
+	{
+		ps8 = (uint8_t *)src;
 	
-		for(ix = info->rc.x1; ix <= info->rc.x2; ix += 64, rc.x1 += 64, rc.x2 += 64)
+		for(i = p->srclen; i > 0; i--, ps8 += 4, dst += 4)
 		{
-			//buf1 に 64x64 処理分のソースセット (すべて透明なら処理なし)
-		
-			if(FilterSub_getPixelBuf16(imgsrc, &rc, (uint16_t *)buf1, info->clipping))
+			a = ps8[3];
+
+			dst[0] = ps8[0] * a;
+			dst[1] = ps8[1] * a;
+			dst[2] = ps8[2] * a;
+			dst[3] = a * 255;
+		}
+	}
+	else
+	{
+		ps16 = (uint16_t *)src;
+	
+		for(i = p->srclen; i > 0; i--, ps16 += 4, dst += 4)
+		{
+			a = ps16[3];
+
+			dst[0] = (ps16[0] * a) >> 6;
+			dst[1] = (ps16[1] * a) >> 6;
+			dst[2] = (ps16[2] * a) >> 6;
+			dst[3] = a << 9;
+		}
+	}
+}
+
+/* 結果の値から色を取得 */
+
+static void _boxblur_get_color(_boxblur *p,const uint32_t *ps,void *dst)
+{
+	uint8_t *pd8;
+	uint16_t *pd16;
+	uint32_t q;
+	int i,n;
+
+	q = ps[3];
+
+	if(p->bits == 8)
+	{
+		pd8 = (uint8_t *)dst;
+		n = (q + 127) / 255;
+
+		if(n == 0)
+			*((uint32_t *)dst) = 0;
+		else
+		{
+			for(i = 0; i < 3; i++)
+			{
+				n = (ps[i] * 255 + (q >> 1)) / q;
+				pd8[i] = (n > 255)? 255: n;
+			}
+
+			pd8[3] = (q + 127) / 255;
+		}
+	}
+	else
+	{
+		pd16 = (uint16_t *)dst;
+		n = (q + 256) >> 9;
+
+		if(n == 0)
+			*((uint64_t *)dst) = 0;
+		else
+		{
+			for(i = 0; i < 3; i++)
 			{
-				FilterSub_prog_substep_inc(info);
-				continue;
+				n = (((uint64_t)ps[i] << 15) + (q >> 1)) / q;
+				pd16[i] = (n > COLVAL_16BIT)? COLVAL_16BIT: n;
 			}
 
-			//ソースの色を処理
+			pd16[3] = (q + 256) >> 9;
+		}
+	}
+}
 
-			if(setsrc)
-				(setsrc)(buf1, srcpixnum, info);
+/* タイルの行ごとの処理 */
 
-			//水平方向
-			// buf2: Y[procw] x X[64]
+static void _tileline_boxblur(FilterDrawInfo *info,const mRect *rcdst,int threadno,void *param)
+{
+	_boxblur *p = (_boxblur *)param;
+	uint8_t *srcbuf;
+	uint32_t *line[2],*hbuf,*pd,*ps;
+	int ix,iy,width,rows,ext,fempty = TRUE;
+	uint64_t col;
+	mRect rc;
+	TileImageSetPixelFunc setpix_def;
 
-			ps = buf1 + range;
-			pd = buf2;
+	width = p->width;
+	ext = p->ext;
+	rows = rcdst->y2 - rcdst->y1 + 1 + ext * 2;
 
-			for(jy = 0; jy < procw; jy++, pd++)
-			{
-				for(jx = 0, pos = 0; jx < 64; jx++, ps++, pos += procw)
-				{
-					d[0] = d[1] = d[2] = d[3] = 0;
+	srcbuf = p->buf[threadno];
+	line[0] = (uint32_t *)(srcbuf + p->srclen * 8);
+	line[1] = line[0] + p->linelen * 4;
+	hbuf = line[1] + p->linelen * 4;
 
-					for(i = 0; i < blurlen; i++)
-						FilterSub_advcol_add_weight16(d, tblbuf[i], (uint16_t *)(ps + i - range));
+	FilterSub_getPixelFunc(&setpix_def);
 
-					FilterSub_advcol_getColor16(d, dweight, (uint16_t *)(pd + pos));
-				}
+	//---- 水平方向
 
-				ps += procw - 64;
-			}
+	rc.x1 = rcdst->x1 - ext;
+	rc.x2 = rcdst->x2 + ext;
+	rc.y1 = rcdst->y1 - ext;
 
-			//垂直方向
+	for(iy = 0, pd = hbuf; iy < rows; iy++, rc.y1++, pd += width * 4)
+	{
+		rc.y2 = rc.y1;
 
-			xnum = ynum = 64;
-			if(ix + 63 > info->rc.x2) xnum = info->rc.x2 + 1 - ix;
-			if(iy + 63 > info->rc.y2) ynum = info->rc.y2 + 1 - iy;
+		//ソース取得 (すべて透明ならゼロ)
 
-			psY = buf2 + range;
+		if(p->bits == 8)
+			ix = FilterSub_getPixelBuf8(p->imgsrc, &rc, srcbuf, info->clipping);
+		else
+			ix = FilterSub_getPixelBuf16(p->imgsrc, &rc, (uint16_t *)srcbuf, info->clipping);
 
-			for(jx = 0; jx < xnum; jx++)
-			{
-				for(jy = 0, ps = psY; jy < ynum; jy++, ps++)
-				{
-					d[0] = d[1] = d[2] = d[3] = 0;
+		if(ix)
+		{
+			mMemset0(pd, width * 16);
+			continue;
+		}
 
-					for(i = 0; i < blurlen; i++)
-						FilterSub_advcol_add_weight16(d, tblbuf[i], (uint16_t *)(ps + i - range));
+		fempty = FALSE;
 
-					FilterSub_advcol_getColor16(d, dweight, col);
+		//ソースの色を処理
 
-					if(setpix)
-						(setpix)(ix + jx, iy + jy, col, info);
-					else
-						(setpix_def)(info->imgdst, ix + jx, iy + jy, col);
-				}
+		if(p->setsrc)
+			(p->setsrc)(srcbuf, p->srclen, info);
 
-				psY += procw;
-			}
+		//ぼかし
+
+		_boxblur_convert_src(p, line[0], srcbuf);
+
+		ps = _boxblur_line_all(p, line, p->srclen);
+
+		memcpy(pd, ps, width * 16);
+	}
+
+	//すべて透明なら、処理なし
+
+	if(fempty) return;
+
+	//---- 垂直方向
+
+	for(ix = 0; ix < width; ix++)
+	{
+		//列を取得
+
+		ps = hbuf + ix * 4;
+		pd = line[0];
 
-			FilterSub_prog_substep_inc(info);
+		for(iy = rows; iy > 0; iy--, ps += width * 4, pd += 4)
+		{
+			pd[0] = ps[0];
+			pd[1] = ps[1];
+			pd[2] = ps[2];
+			pd[3] = ps[3];
 		}
 
-		rc.y1 += 64;
-		rc.y2 += 64;
+		//ぼかし
+
+		ps = _boxblur_line_all(p, line, rows);
+
+		//セット
+
+		for(iy = rcdst->y1; iy <= rcdst->y2; iy++, ps += 4)
+		{
+			_boxblur_get_color(p, ps, &col);
+
+			if(p->setpix)
+				(p->setpix)(rcdst->x1 + ix, iy, &col, info);
+			else
+				(setpix_def)(info->imgdst, rcdst->x1 + ix, iy, &col);
+		}
 	}
+}
 
-	mFree(buf1);
-	mFree(buf2);
-	mFree(tblbuf);
+/* ボックスぼかしで処理
+ *
+ * return: -1 で確保失敗 */
 
-	return TRUE;
+static int _proc_boxblur(FilterDrawInfo *info,TileImage *imgsrc,int radius,
+	FilterSubFunc_gaussblur_setpix setpix,FilterSubFunc_gaussblur_setsrc setsrc)
+{
+	_boxblur dat;
+	int ret;
+
+	if(!_boxblur_init(&dat, info, imgsrc, radius, setpix, setsrc))
+		ret = -1;
+	else
+		ret = FilterSub_proc_tile_line(info, _tileline_boxblur, &dat);
+
+	_boxblur_free(&dat);
+
+	return ret;
 }
 
+
+//=======================
+
+
+/** ガウスぼかし処理 (8bit)
+ *
+ * setpix: 結果の点を描画する関数。NULL で imgdst に通常描画。
+ * setsrc: ぼかし処理の前にソースの色を処理する関数。NULL でなし。
+ *
+ * 半径が _BOXBLUR_MIN_RADIUS 以上の場合は、ボックスぼかしによる近似で処理する。
+ *
+ * [!] setpix, setsrc は複数のスレッドから呼ばれる。 */
+
+mlkbool FilterSub_proc_gaussblur8(FilterDrawInfo *info,
+	TileImage *imgsrc,int radius,
+	FilterSubFunc_gaussblur_setpix setpix,FilterSubFunc_gaussblur_setsrc setsrc)
+{
+	_gaussblur dat;
+	mlkbool ret = FALSE;
+	int n;
+
+	//半径が大きい場合は近似で処理 (確保できなかった場合は通常処理)
+
+	if(radius >= _BOXBLUR_MIN_RADIUS)
+	{
+		n = _proc_boxblur(info, imgsrc, radius, setpix, setsrc);
+		if(n != -1) return (n != 0);
+	}
+
+	//
+
+	if(_gaussblur_init(&dat, imgsrc, radius, 4, setpix, setsrc))
+		ret = FilterSub_proc_tile(info, _tile_gaussblur8, &dat);
+
+	_gaussblur_free(&dat);
+
+	return ret;
+}
+
+/** ガウスぼかし処理 (16bit) */
+
+mlkbool FilterSub_proc_gaussblur16(FilterDrawInfo *info,
+	TileImage *imgsrc,int radius,
+	FilterSubFunc_gaussblur_setpix setpix,FilterSubFunc_gaussblur_setsrc setsrc)
+{
+	_gaussblur dat;
+	mlkbool ret = FALSE;
+	int n;
+
+	if(radius >= _BOXBLUR_MIN_RADIUS)
+	{
+		n = _proc_boxblur(info, imgsrc, radius, setpix, setsrc);
+		if(n != -1) return (n != 0);
+	}
+
+	//
+
+	if(_gaussblur_init(&dat, imgsrc, radius, 8, setpix, setsrc))
+		ret = FilterSub_proc_tile(info, _tile_gaussblur16, &dat);
+
+	_gaussblur_free(&dat);
+
+	return ret;
+}
@@ -73,6 +73,8 @@ typedef void (*FilterSubFunc_gaussblur_setsrc)(void *buf,int pixnum,FilterDrawIn
 
 typedef void (*FilterSubFunc_drawpoint_setpix)(int x,int y,FilterDrawPointInfo *dat);
 
+typedef void (*FilterSubFunc_tile)(FilterDrawInfo *info,const mRect *rc,int threadno,void *param);
+
 /* sub */
 
 void FilterSub_getPixelFunc(TileImageSetPixelFunc *func);
@@ -113,6 +115,8 @@ void FilterSub_getLinerColor_bkgnd(TileImage *img,double dx,double dy,int x,int
 
 /* 共通描画処理 */
 
+mlkbool FilterSub_proc_tile(FilterDrawInfo *info,FilterSubFunc_tile func,void *param);
+mlkbool FilterSub_proc_tile_line(FilterDrawInfo *info,FilterSubFunc_tile func,void *param);
 mlkbool FilterSub_proc_pixel(FilterDrawInfo *info,FilterSubFunc_pixel8 func8,FilterSubFunc_pixel16 func16);
 mlkbool FilterSub_proc_3x3(FilterDrawInfo *info,Filter3x3Info *dat);
 
@@ -413,3 +413,531 @@ void BlendColorFunc_setTable_16bit(BlendColorFunc *p)
 	p[18] = _luminous_dodge;
 }
 
+
+//==========================
+// 行単位
+//==========================
+/* 64px 分の色を R,G,B ごとに並べたデータで、まとめて処理する。
+ * 合成結果は dst にセットされる。src の値は変更される場合がある。
+ *
+ * - a = 0 の位置も計算されるが、結果は dst のままとなる。 */
+
+
+/** アルファ合成 (src -> dst) */
+
+static void _row_alpha(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+			pd[i] = ((ps[i] - pd[i]) * pa[i] >> 15) + pd[i];
+	}
+}
+
+/** 通常 */
+
+static void _row_normal(BlendColorRow *p,int num)
+{
+	_row_alpha(p, num);
+}
+
+/** 乗算 */
+
+static void _row_mul(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+			ps[i] = ps[i] * pd[i] >> 15;
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 加算 */
+
+static void _row_add(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = ps[i] + pd[i];
+			if(n > _MAXVAL) n = _MAXVAL;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 減算 */
+
+static void _row_sub(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = pd[i] - ps[i];
+			if(n < 0) n = 0;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** スクリーン */
+
+static void _row_screen(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+			ps[i] = ps[i] + pd[i] - (ps[i] * pd[i] >> 15);
+	}
+
+	_row_alpha(p, num);
+}
+
+/** オーバーレイ */
+
+static void _row_overlay(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(d < _HALFVAL)
+				ps[i] = s * d >> 14;
+			else
+				ps[i] = _MAXVAL - ((_MAXVAL - d) * (_MAXVAL - s) >> 14);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ハードライト */
+
+static void _row_hardlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s < _HALFVAL)
+				ps[i] = s * d >> 14;
+			else
+				ps[i] = _MAXVAL - ((_MAXVAL - d) * (_MAXVAL - s) >> 14);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ソフトライト */
+
+static void _row_softlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			n = s * d >> 15;
+
+			ps[i] = n + (d * (_MAXVAL - n - ((_MAXVAL - s) * (_MAXVAL - d) >> 15)) >> 15);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 覆い焼き */
+
+static void _row_dodge(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(ps[i] != _MAXVAL)
+			{
+				n = (pd[i] << 15) / (_MAXVAL - ps[i]);
+				if(n > _MAXVAL) n = _MAXVAL;
+
+				ps[i] = n;
+			}
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 焼き込み */
+
+static void _row_burn(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(ps[i])
+			{
+				n = _MAXVAL - ((_MAXVAL - pd[i]) << 15) / ps[i];
+				if(n < 0) n = 0;
+
+				ps[i] = n;
+			}
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 焼き込みリニア */
+
+static void _row_linearburn(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = pd[i] + ps[i] - _MAXVAL;
+			if(n < 0) n = 0;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ビビットライト */
+
+static void _row_vividlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s < _HALFVAL)
+			{
+				n = _MAXVAL - (s << 1);
+
+				if(d <= n || s == 0)
+					n = 0;
+				else
+					n = ((d - n) << 15) / (s << 1);
+			}
+			else
+			{
+				n = _MAXVAL * 2 - (s << 1);
+
+				if(d >= n || n == 0)
+					n = _MAXVAL;
+				else
+					n = (d << 15) / n;
+			}
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** リニアライト */
+
+static void _row_linearlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = (ps[i] << 1) + pd[i] - _MAXVAL;
+
+			if(n < 0) n = 0;
+			else if(n > _MAXVAL) n = _MAXVAL;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ピンライト */
+
+static void _row_pinlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s > _HALFVAL)
+			{
+				n = (s << 1) - _MAXVAL;
+				if(n < d) n = d;
+			}
+			else
+			{
+				n = s << 1;
+				if(n > d) n = d;
+			}
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 比較(暗) */
+
+static void _row_darken(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(pd[i] < ps[i])
+				ps[i] = pd[i];
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 比較(明) */
+
+static void _row_lighten(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(pd[i] > ps[i])
+				ps[i] = pd[i];
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 差の絶対値 */
+
+static void _row_difference(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = ps[i] - pd[i];
+			if(n < 0) n = -n;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 発光(加算) */
+
+static void _row_luminous_add(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+		{
+			n = (ps[i] * pa[i] >> 15) + pd[i];
+			if(n > _MAXVAL) n = _MAXVAL;
+
+			pd[i] = n;
+		}
+	}
+}
+
+/** 発光(覆い焼き) */
+
+static void _row_luminous_dodge(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i,s,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i] * pa[i] >> 15;
+
+			if(s == _MAXVAL)
+				n = _MAXVAL;
+			else
+			{
+				n = (pd[i] << 15) / (_MAXVAL - s);
+				if(n > _MAXVAL) n = _MAXVAL;
+			}
+
+			pd[i] = n;
+		}
+	}
+}
+
+/** 行単位の関数テーブルをセット */
+
+void BlendColorRowFunc_setTable_16bit(BlendColorRowFunc *p)
+{
+	p[0] = _row_normal;
+	p[1] = _row_mul;
+	p[2] = _row_add;
+	p[3] = _row_sub;
+	p[4] = _row_screen;
+	p[5] = _row_overlay;
+	p[6] = _row_hardlight;
+	p[7] = _row_softlight;
+	p[8] = _row_dodge;
+	p[9] = _row_burn;
+	p[10] = _row_linearburn;
+	p[11] = _row_vividlight;
+	p[12] = _row_linearlight;
+	p[13] = _row_pinlight;
+	p[14] = _row_darken;
+	p[15] = _row_lighten;
+	p[16] = _row_difference;
+	p[17] = _row_luminous_add;
+	p[18] = _row_luminous_dodge;
+}
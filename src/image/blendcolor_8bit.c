@@ -22,6 +22,7 @@ $*/
  *****************************************/
 
 #include "mlk.h"
+#include "mlk_simd.h"
 
 #include "blendcolor.h"
 
@@ -29,6 +30,8 @@ $*/
 #define _MAXVAL  255
 #define _HALFVAL 128
 
+#define _SIMD_ON 1
+
 /* dst の上に src を合成して、結果を src にセット。
  * 
  * 戻り値: TRUE でアルファ合成を行う */
@@ -415,3 +418,814 @@ void BlendColorFunc_setTable_8bit(BlendColorFunc *p)
 	p[18] = _luminous_dodge;
 }
 
+
+
+//==========================
+// 行単位
+//==========================
+/* 64px 分の色を R,G,B ごとに並べたデータで、まとめて処理する。
+ * 合成結果は dst にセットされる。src の値は変更される場合がある。
+ *
+ * - num 以降のデータも範囲内の値であること (SIMD では 4px 単位で処理する)。
+ * - a = 0 の位置も計算されるが、結果は dst のままとなる。 */
+
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+/* x / 255 (0 方向に切り捨て)
+ * |x| <= 255 * 255 */
+
+static __m128i _sse_div255(__m128i v)
+{
+	__m128i m;
+
+	m = _mm_srai_epi32(v, 31);
+	v = _mm_sub_epi32(_mm_xor_si128(v, m), m);
+
+	//(x + 1 + (x >> 8)) >> 8
+
+	v = _mm_add_epi32(_mm_add_epi32(v, _mm_set1_epi32(1)), _mm_srli_epi32(v, 8));
+	v = _mm_srli_epi32(v, 8);
+
+	return _mm_sub_epi32(_mm_xor_si128(v, m), m);
+}
+
+/* 最小値 */
+
+static __m128i _sse_min(__m128i a,__m128i b)
+{
+	__m128i m = _mm_cmpgt_epi32(a, b);
+
+	return _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a));
+}
+
+/* 最大値 */
+
+static __m128i _sse_max(__m128i a,__m128i b)
+{
+	__m128i m = _mm_cmpgt_epi32(a, b);
+
+	return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+}
+
+#endif
+
+/** アルファ合成 (src -> dst) */
+
+static void _row_alpha(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,d,a;
+
+	num = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i += 4)
+		{
+			s = _mm_loadu_si128((__m128i *)(ps + i));
+			d = _mm_loadu_si128((__m128i *)(pd + i));
+			a = _mm_loadu_si128((__m128i *)(pa + i));
+
+			//(s - d) * a / 255 + d
+			// :値は 16bit に収まるので、madd で 32bit の積を得る
+
+			s = _mm_madd_epi16(_mm_sub_epi32(s, d), a);
+			s = _mm_add_epi32(_sse_div255(s), d);
+
+			_mm_storeu_si128((__m128i *)(pd + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+			pd[i] = (ps[i] - pd[i]) * pa[i] / 255 + pd[i];
+	}
+
+#endif
+}
+
+/** 通常 */
+
+static void _row_normal(BlendColorRow *p,int num)
+{
+	_row_alpha(p, num);
+}
+
+/** 乗算 */
+
+static void _row_mul(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,d;
+	int n;
+
+	n = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_loadu_si128((__m128i *)(ps + i));
+			d = _mm_loadu_si128((__m128i *)(pd + i));
+
+			s = _sse_div255(_mm_madd_epi16(s, d));
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+			ps[i] = ps[i] * pd[i] / 255;
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** 加算 */
+
+static void _row_add(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,vmax;
+
+	n = (num + 3) & (~3);
+	vmax = _mm_set1_epi32(_MAXVAL);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_add_epi32(_mm_loadu_si128((__m128i *)(ps + i)),
+				_mm_loadu_si128((__m128i *)(pd + i)));
+
+			_mm_storeu_si128((__m128i *)(ps + i), _sse_min(s, vmax));
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = ps[i] + pd[i];
+			if(n > _MAXVAL) n = _MAXVAL;
+
+			ps[i] = n;
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** 減算 */
+
+static void _row_sub(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,vzero;
+
+	n = (num + 3) & (~3);
+	vzero = _mm_setzero_si128();
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_sub_epi32(_mm_loadu_si128((__m128i *)(pd + i)),
+				_mm_loadu_si128((__m128i *)(ps + i)));
+
+			_mm_storeu_si128((__m128i *)(ps + i), _sse_max(s, vzero));
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = pd[i] - ps[i];
+			if(n < 0) n = 0;
+
+			ps[i] = n;
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** スクリーン */
+
+static void _row_screen(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,d;
+	int n;
+
+	n = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_loadu_si128((__m128i *)(ps + i));
+			d = _mm_loadu_si128((__m128i *)(pd + i));
+
+			s = _mm_sub_epi32(_mm_add_epi32(s, d), _sse_div255(_mm_madd_epi16(s, d)));
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+			ps[i] = ps[i] + pd[i] - (ps[i] * pd[i] / 255);
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** オーバーレイ */
+
+static void _row_overlay(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(d < _HALFVAL)
+				ps[i] = s * d >> 7;
+			else
+				ps[i] = _MAXVAL - ((_MAXVAL - d) * (_MAXVAL - s) >> 7);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ハードライト */
+
+static void _row_hardlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s < _HALFVAL)
+				ps[i] = s * d >> 7;
+			else
+				ps[i] = _MAXVAL - ((_MAXVAL - d) * (_MAXVAL - s) >> 7);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ソフトライト */
+
+static void _row_softlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			n = s * d / 255;
+
+			ps[i] = n + (d * (_MAXVAL - n - (_MAXVAL - s) * (_MAXVAL - d) / 255) / 255);
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 覆い焼き */
+
+static void _row_dodge(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(ps[i] != _MAXVAL)
+			{
+				n = pd[i] * 255 / (_MAXVAL - ps[i]);
+				if(n > _MAXVAL) n = _MAXVAL;
+
+				ps[i] = n;
+			}
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 焼き込み */
+
+static void _row_burn(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(ps[i])
+			{
+				n = _MAXVAL - (_MAXVAL - pd[i]) * 255 / ps[i];
+				if(n < 0) n = 0;
+
+				ps[i] = n;
+			}
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 焼き込みリニア */
+
+static void _row_linearburn(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,vmax,vzero;
+
+	n = (num + 3) & (~3);
+	vmax = _mm_set1_epi32(_MAXVAL);
+	vzero = _mm_setzero_si128();
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_add_epi32(_mm_loadu_si128((__m128i *)(ps + i)),
+				_mm_loadu_si128((__m128i *)(pd + i)));
+
+			s = _sse_max(_mm_sub_epi32(s, vmax), vzero);
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = pd[i] + ps[i] - _MAXVAL;
+			if(n < 0) n = 0;
+
+			ps[i] = n;
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** ビビットライト */
+
+static void _row_vividlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s < _HALFVAL)
+			{
+				n = _MAXVAL - (s << 1);
+
+				if(d <= n || s == 0)
+					n = 0;
+				else
+					n = (d - n) * 255 / (s << 1);
+			}
+			else
+			{
+				n = _MAXVAL * 2 - (s << 1);
+
+				if(d >= n || n == 0)
+					n = _MAXVAL;
+				else
+					n = d * 255 / n;
+			}
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** リニアライト */
+
+static void _row_linearlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = (ps[i] << 1) + pd[i] - _MAXVAL;
+
+			if(n < 0) n = 0;
+			else if(n > _MAXVAL) n = _MAXVAL;
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** ピンライト */
+
+static void _row_pinlight(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,s,d,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i];
+			d = pd[i];
+
+			if(s > _HALFVAL)
+			{
+				n = (s << 1) - _MAXVAL;
+				if(n < d) n = d;
+			}
+			else
+			{
+				n = s << 1;
+				if(n > d) n = d;
+			}
+
+			ps[i] = n;
+		}
+	}
+
+	_row_alpha(p, num);
+}
+
+/** 比較(暗) */
+
+static void _row_darken(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s;
+	int n;
+
+	n = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _sse_min(_mm_loadu_si128((__m128i *)(ps + i)),
+				_mm_loadu_si128((__m128i *)(pd + i)));
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(pd[i] < ps[i])
+				ps[i] = pd[i];
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** 比較(明) */
+
+static void _row_lighten(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s;
+	int n;
+
+	n = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _sse_max(_mm_loadu_si128((__m128i *)(ps + i)),
+				_mm_loadu_si128((__m128i *)(pd + i)));
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			if(pd[i] > ps[i])
+				ps[i] = pd[i];
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** 差の絶対値 */
+
+static void _row_difference(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd;
+	int c,i,n;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+	__m128i s,m;
+
+	n = (num + 3) & (~3);
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < n; i += 4)
+		{
+			s = _mm_sub_epi32(_mm_loadu_si128((__m128i *)(ps + i)),
+				_mm_loadu_si128((__m128i *)(pd + i)));
+
+			m = _mm_srai_epi32(s, 31);
+			s = _mm_sub_epi32(_mm_xor_si128(s, m), m);
+
+			_mm_storeu_si128((__m128i *)(ps + i), s);
+		}
+	}
+
+#else
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+
+		for(i = 0; i < num; i++)
+		{
+			n = ps[i] - pd[i];
+			if(n < 0) n = -n;
+
+			ps[i] = n;
+		}
+	}
+
+#endif
+
+	_row_alpha(p, num);
+}
+
+/** 発光(加算) */
+
+static void _row_luminous_add(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+		{
+			n = ps[i] * pa[i] / 255 + pd[i];
+			if(n > _MAXVAL) n = _MAXVAL;
+
+			pd[i] = n;
+		}
+	}
+}
+
+/** 発光(覆い焼き) */
+
+static void _row_luminous_dodge(BlendColorRow *p,int num)
+{
+	int32_t *ps,*pd,*pa;
+	int c,i,s,n;
+
+	for(c = 0; c < 3; c++)
+	{
+		ps = p->src[c];
+		pd = p->dst[c];
+		pa = p->a;
+
+		for(i = 0; i < num; i++)
+		{
+			s = ps[i] * pa[i] / 255;
+
+			if(s == _MAXVAL)
+				n = _MAXVAL;
+			else
+			{
+				n = pd[i] * 255 / (_MAXVAL - s);
+				if(n > _MAXVAL) n = _MAXVAL;
+			}
+
+			pd[i] = n;
+		}
+	}
+}
+
+/** 行単位の関数テーブルをセット */
+
+void BlendColorRowFunc_setTable_8bit(BlendColorRowFunc *p)
+{
+	p[0] = _row_normal;
+	p[1] = _row_mul;
+	p[2] = _row_add;
+	p[3] = _row_sub;
+	p[4] = _row_screen;
+	p[5] = _row_overlay;
+	p[6] = _row_hardlight;
+	p[7] = _row_softlight;
+	p[8] = _row_dodge;
+	p[9] = _row_burn;
+	p[10] = _row_linearburn;
+	p[11] = _row_vividlight;
+	p[12] = _row_linearlight;
+	p[13] = _row_pinlight;
+	p[14] = _row_darken;
+	p[15] = _row_lighten;
+	p[16] = _row_difference;
+	p[17] = _row_luminous_add;
+	p[18] = _row_luminous_dodge;
+}
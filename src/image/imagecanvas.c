@@ -25,6 +25,7 @@ $*/
 
 #include "mlk.h"
 #include "mlk_pixbuf.h"
+#include "mlk_rectbox.h"
 
 #include "imagecanvas.h"
 #include "colorvalue.h"
@@ -59,6 +60,8 @@ void ImageCanvas_free(ImageCanvas *p)
 			mFree(p->ppbuf);
 		}
 
+		ImageCanvas_free(p->mip);
+
 		mFree(p);
 	}
 }
@@ -82,6 +85,8 @@ ImageCanvas *ImageCanvas_new(int width,int height,int bits)
 	p->bits = bits;
 	p->line_bytes = pitch;
 
+	mRectEmpty(&p->rcmip);
+
 	//バッファ
 
 	p->ppbuf = ppbuf = (uint8_t **)mMalloc0(sizeof(void*) * height);
@@ -393,6 +398,11 @@ void ImageCanvas_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo
 
 void ImageCanvas_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info)
 {
+	//1/2 以下の縮小時は、縮小イメージから
+
+	if(ImageCanvas_drawPixbuf_mip(src, dst, info))
+		return;
+
 	if(src->bits == 8)
 		ImageCanvas_8bit_drawPixbuf_oversamp(src, dst, info);
 	else
@@ -395,6 +395,119 @@ void ImageCanvas_8bit_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDr
 	}
 }
 
+/** キャンバス描画 (縮小イメージから)
+ *
+ * src: 縮小イメージ (1/2^level)
+ * cp: 元イメージでのパラメータ */
+
+void ImageCanvas_8bit_drawPixbuf_mip(ImageCanvas *src,mPixbuf *dst,_canvasparam *cp,uint8_t *pd,int level)
+{
+	int ix,iy,jx,jy,n,r,g,b,tapnum,tapshift,posshift,tbl_xpos[8];
+	uint8_t **ppbuf,*ps,*tbl_psY[8];
+	int64_t fx,fy,fincx,fincy,fincx2,fincy2,ftmp;
+
+	//縮小イメージ上での加算数
+
+	fincx = cp->finc_xx >> level;
+	fincy = cp->finc_yy >> level;
+
+	//サンプリング数 (縮小イメージでの 1px の範囲に合わせる)
+
+	if(fincy < FIXF_VAL * 2)
+		tapshift = 1;
+	else if(fincy < FIXF_VAL * 4)
+		tapshift = 2;
+	else
+		tapshift = 3;
+
+	tapnum = 1 << tapshift;
+	fincx2 = fincx >> tapshift;
+	fincy2 = fincy >> tapshift;
+
+	//範囲判定は元イメージの位置で行う
+
+	posshift = FIXF_BIT - level;
+
+	//
+
+	ppbuf = src->ppbuf;
+	fy = cp->fy >> level;
+
+	for(iy = cp->dsth; iy > 0; iy--, fy += fincy)
+	{
+		n = fy >> posshift;
+
+		//Yが範囲外
+
+		if(n < 0 || n >= cp->srch)
+		{
+			mPixbufBufLineH(dst, pd, cp->dstw, cp->pixbkgnd);
+			pd += dst->line_bytes;
+			continue;
+		}
+
+		//Y テーブル
+
+		for(jy = 0, ftmp = fy; jy < tapnum; jy++, ftmp += fincy2)
+		{
+			n = ftmp >> FIXF_BIT;
+			if(n >= src->height) n = src->height - 1;
+
+			tbl_psY[jy] = ppbuf[n];
+		}
+
+		//----- X
+
+		fx = cp->fx >> level;
+
+		for(ix = cp->dstw; ix > 0; ix--, fx += fincx, pd += cp->bpp)
+		{
+			n = fx >> posshift;
+
+			//範囲外
+
+			if(n < 0 || n >= cp->srcw)
+			{
+				(cp->setpix)(pd, cp->pixbkgnd);
+				continue;
+			}
+
+			//X テーブル
+
+			for(jx = 0, ftmp = fx; jx < tapnum; jx++, ftmp += fincx2)
+			{
+				n = ftmp >> FIXF_BIT;
+				if(n < 0) n = 0;
+				else if(n >= src->width) n = src->width - 1;
+
+				tbl_xpos[jx] = n << 2;
+			}
+
+			//平均
+
+			r = g = b = 0;
+
+			for(jy = 0; jy < tapnum; jy++)
+			{
+				for(jx = 0; jx < tapnum; jx++)
+				{
+					ps = tbl_psY[jy] + tbl_xpos[jx];
+
+					r += ps[0];
+					g += ps[1];
+					b += ps[2];
+				}
+			}
+
+			n = tapshift << 1;
+
+			(cp->setpix)(pd, mRGBtoPix_sep(r >> n, g >> n, b >> n));
+		}
+
+		pd += cp->pitchd;
+	}
+}
+
 /** キャンバス描画 (回転あり/補間なし) */
 
 void ImageCanvas_8bit_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info)
@@ -0,0 +1,210 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+
+/**************************************
+ * ImageCanvas: 縮小表示用イメージ
+ **************************************/
+
+#include "mlk.h"
+#include "mlk_pixbuf.h"
+#include "mlk_rectbox.h"
+
+#include "imagecanvas.h"
+#include "canvasinfo.h"
+
+#include "pv_imagecanvas.h"
+
+
+/*
+ * - 縮小表示時に、毎回多数の点をサンプリングしないように、
+ *   1/2 ずつ縮小したイメージ (ImageCanvas::mip で連結) を保持する。
+ * - 縮小イメージは、元のビット数に関係なく 8bit。
+ * - 合成イメージが更新された時は、範囲を記録しておき、
+ *   縮小イメージが必要になった時に、その範囲のみ更新する。
+ */
+
+#define _MIP_MAXLEVEL  6	//最大 1/64
+
+
+/* 1/2 縮小 (8bit -> 8bit) */
+
+static void _reduce_8bit(ImageCanvas *src,ImageCanvas *dst,const mRect *rc)
+{
+	uint8_t *ps1,*ps2,*pd;
+	int ix,iy,x1,x2,sw;
+
+	sw = src->width;
+
+	for(iy = rc->y1; iy <= rc->y2; iy++)
+	{
+		ps1 = src->ppbuf[iy << 1];
+		ps2 = src->ppbuf[((iy << 1) + 1 < src->height)? (iy << 1) + 1: iy << 1];
+		pd = dst->ppbuf[iy] + (rc->x1 << 2);
+
+		for(ix = rc->x1; ix <= rc->x2; ix++, pd += 4)
+		{
+			x1 = ix << 3;
+			x2 = ((ix << 1) + 1 < sw)? x1 + 4: x1;
+
+			pd[0] = (ps1[x1] + ps1[x2] + ps2[x1] + ps2[x2] + 2) >> 2;
+			pd[1] = (ps1[x1 + 1] + ps1[x2 + 1] + ps2[x1 + 1] + ps2[x2 + 1] + 2) >> 2;
+			pd[2] = (ps1[x1 + 2] + ps1[x2 + 2] + ps2[x1 + 2] + ps2[x2 + 2] + 2) >> 2;
+			pd[3] = 255;
+		}
+	}
+}
+
+/* 1/2 縮小 (16bit -> 8bit) */
+
+static void _reduce_16bit(ImageCanvas *src,ImageCanvas *dst,const mRect *rc)
+{
+	uint16_t *ps1,*ps2;
+	uint8_t *pd;
+	int ix,iy,i,x1,x2,sw;
+
+	sw = src->width;
+
+	for(iy = rc->y1; iy <= rc->y2; iy++)
+	{
+		ps1 = (uint16_t *)src->ppbuf[iy << 1];
+		ps2 = (uint16_t *)src->ppbuf[((iy << 1) + 1 < src->height)? (iy << 1) + 1: iy << 1];
+		pd = dst->ppbuf[iy] + (rc->x1 << 2);
+
+		for(ix = rc->x1; ix <= rc->x2; ix++, pd += 4)
+		{
+			x1 = ix << 3;
+			x2 = ((ix << 1) + 1 < sw)? x1 + 4: x1;
+
+			//4点の合計 (最大 0x20000) を 0-255 に
+
+			for(i = 0; i < 3; i++)
+				pd[i] = ((ps1[x1 + i] + ps1[x2 + i] + ps2[x1 + i] + ps2[x2 + i]) * 255 + 0x10000) >> 17;
+
+			pd[3] = 255;
+		}
+	}
+}
+
+/* 縮小イメージを更新
+ *
+ * p の更新範囲から、p->mip の範囲を更新する。 */
+
+static void _update_mip(ImageCanvas *p)
+{
+	ImageCanvas *mip = p->mip;
+	mRect rc;
+
+	if(mRectIsEmpty(&p->rcmip)) return;
+
+	//縮小イメージでの範囲
+
+	rc.x1 = p->rcmip.x1 >> 1;
+	rc.y1 = p->rcmip.y1 >> 1;
+	rc.x2 = p->rcmip.x2 >> 1;
+	rc.y2 = p->rcmip.y2 >> 1;
+
+	mRectEmpty(&p->rcmip);
+
+	if(!mRectClipBox_d(&rc, 0, 0, mip->width, mip->height))
+		return;
+
+	if(p->bits == 8)
+		_reduce_8bit(p, mip, &rc);
+	else
+		_reduce_16bit(p, mip, &rc);
+
+	//次の段階の更新範囲
+
+	mRectUnion(&mip->rcmip, &rc);
+}
+
+/* 指定段階の縮小イメージを取得
+ *
+ * 作成されていない段階は作成し、更新範囲があれば更新する。
+ *
+ * return: NULL で確保失敗 */
+
+static ImageCanvas *_get_mip(ImageCanvas *p,int level)
+{
+	for(; level > 0; level--)
+	{
+		if(!p->mip)
+		{
+			p->mip = ImageCanvas_new((p->width + 1) >> 1, (p->height + 1) >> 1, 8);
+			if(!p->mip) return NULL;
+
+			mRectSetBox_d(&p->rcmip, 0, 0, p->width, p->height);
+		}
+
+		_update_mip(p);
+
+		p = p->mip;
+	}
+
+	return p;
+}
+
+
+/** 合成イメージの更新範囲を追加
+ *
+ * 縮小イメージは、次の描画時に更新される。 */
+
+void ImageCanvas_setMipUpdate(ImageCanvas *p,const mBox *box)
+{
+	if(p->mip)
+		mRectUnion_box(&p->rcmip, box);
+}
+
+/** キャンバス描画 (回転なし/1/2 以下の縮小時)
+ *
+ * 倍率に合わせた縮小イメージから、少ない点数でサンプリングする。
+ *
+ * return: FALSE で縮小イメージを使わない (通常の処理で描画する) */
+
+mlkbool ImageCanvas_drawPixbuf_mip(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info)
+{
+	_canvasparam cp;
+	ImageCanvas *img;
+	uint8_t *pd;
+	int64_t finc;
+	int level;
+
+	//元イメージ 1px あたりの加算数
+
+	finc = (int64_t)(info->param->scalediv * FIXF_VAL + 0.5);
+
+	if(finc < FIXF_VAL * 2) return FALSE;
+
+	//縮小イメージ上で 1〜2px となる段階
+
+	for(level = 1; level < _MIP_MAXLEVEL && (finc >> (level + 1)) >= FIXF_VAL; level++);
+
+	img = _get_mip(src, level);
+	if(!img) return FALSE;
+
+	//描画
+
+	pd = __ImageCanvas_getCanvasParam(src, dst, info, &cp, FALSE);
+
+	if(pd)
+		ImageCanvas_8bit_drawPixbuf_mip(img, dst, &cp, pd, level);
+
+	return TRUE;
+}
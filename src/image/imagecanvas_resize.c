@@ -21,13 +21,20 @@ $*/
  * ImageCanvas: リサイズ処理
  *****************************************/
 
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "mlk_gui.h"
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
+#include "mlk_pixbuf.h"
+#include "mlk_simd.h"
 
 #include "imagecanvas.h"
+#include "threadpool.h"
+
+#include "pv_imagecanvas.h"
 
 
 //----------------
@@ -49,12 +56,7 @@ enum
 
 /* リサイズ用パラメータ */
 
-typedef struct
-{
-	double *pweight; //重み
-	uint16_t *pindex;
-	int tap;
-}_param;
+typedef ImageCanvasResizeParam _param;
 
 //----------------
 
@@ -347,6 +349,28 @@ static int _set_param_up(_param *p,int srcw,int dstw,int range,weightfunc wfunc)
 	return 0;
 }
 
+/* ニアレストネイバーのパラメータセット */
+
+static int _set_param_nearest(_param *p,int srcw,int dstw)
+{
+	int i;
+	double dscale;
+
+	p->tap = 1;
+
+	if(_param_alloc(p, dstw)) return 1;
+
+	dscale = (double)srcw / dstw;
+
+	for(i = 0; i < dstw; i++)
+	{
+		p->pweight[i] = 1;
+		p->pindex[i] = (int)(i * dscale);
+	}
+
+	return 0;
+}
+
 /* パラメータセット */
 
 static int _set_param(_param *p,int srcw,int dstw,int method)
@@ -374,225 +398,670 @@ static int _set_param(_param *p,int srcw,int dstw,int method)
 }
 
 
+/** リサイズ用のパラメータをセット
+ *
+ * 出力の各位置ごとに、tap 個の参照位置と重み (合計 1.0) をセットする。
+ * ニアレストネイバーの場合は、tap = 1。
+ *
+ * return: FALSE でメモリが足りない */
+
+mlkbool ImageCanvas_setResizeParam(ImageCanvasResizeParam *p,int srcw,int dstw,int method)
+{
+	mMemset0(p, sizeof(ImageCanvasResizeParam));
+
+	if(method == METHOD_NEAREST)
+		return (_set_param_nearest(p, srcw, dstw) == 0);
+	else
+		return (_set_param(p, srcw, dstw, method) == 0);
+}
+
+/** リサイズ用のパラメータを解放 */
+
+void ImageCanvas_freeResizeParam(ImageCanvasResizeParam *p)
+{
+	_param_free(p);
+}
+
+
 //===========================
-// リサイズ
+// 固定小数点の重み
 //===========================
 
+/*
+  - 8bit カラーの補間は、重みを固定小数点にした整数演算で行う。
+    重みは、上位 14bit (pweight) と、その下の lobits ビット (pweight_lo) に分けて、
+    それぞれ 16bit x 16bit で乗算・加算し、最後に合わせる。
+  - 各出力位置の重みの合計は常に 1.0 になるように補正するため、
+    単色の部分は、元と同じ色になる。
+  - SIMD 時は、2 つの参照位置の値を並べて _mm_madd_epi16() で計算するため、
+    tap 数は偶数にする (足りない分は重み 0)。
+  - 16bit カラーは、固定小数点では誤差が 1 を超える場合があるため、
+    double の重みのまま計算する (SIMD 時は 2 値ずつ)。
+    加算の順番は非 SIMD 時と同じなので、結果も同じになる。
+  - 水平/垂直の各処理は、_BAND_H 行単位でスレッドプールで並列処理する。
+*/
+
+#define _CHECK_RESIZE 0	//1 で、リサイズ結果を double での計算と比較して、最大の差を出力
 
-/* (8bit) 水平リサイズ */
+#define _FIX_BITS     14
+#define _FIXLO_MAXBIT 7
+#define _BAND_H       32	//1 ジョブで処理する行数
 
-static void _8bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+/* 固定小数点のパラメータ */
+
+typedef struct
 {
-	uint8_t **ppsrc,**ppdst,*pd,*ps,*psY;
-	int ix,iy,i,n,tap,dstw;
-	uint16_t *pi;
-	double *pw,c[3],dw;
+	int16_t *pweight,	//重みの上位 [dstw * tap]
+		*pweight_lo;	//重みの下位 [dstw * tap]
+	uint16_t *pindex;	//参照位置 [dstw * tap]
+	int tap,			//偶数
+		lobits;			//重みの下位のビット数
+}_fixparam;
 
-	ppsrc = imgsrc->ppbuf;
-	ppdst = imgdst->ppbuf;
-	dstw = imgdst->width;
-	tap = p->tap;
+/* リサイズ処理用データ */
 
-	for(iy = imgdst->height; iy; iy--)
+typedef struct
+{
+	_fixparam *param;	//8bit
+	_param *dparam;		//16bit
+	ImageCanvas *src,*dst;
+	mPopupProgress *prog;
+}_resizedat;
+
+
+/* 固定小数点パラメータを解放 */
+
+static void _fixparam_free(_fixparam *p)
+{
+	mFree(p->pweight);
+	mFree(p->pweight_lo);
+	mFree(p->pindex);
+
+	p->pweight = NULL;
+	p->pweight_lo = NULL;
+	p->pindex = NULL;
+}
+
+/* 固定小数点パラメータをセット
+ *
+ * return: 0 以外でエラー */
+
+static int _set_fixparam(_fixparam *p,int srcw,int dstw,int method)
+{
+	_param param;
+	double *psw;
+	uint16_t *psi,*pi;
+	int16_t *pw,*pwlo;
+	int i,j,n,sum,tap,maxno,lobits,bits;
+
+	mMemset0(&param, sizeof(_param));
+
+	if(_set_param(&param, srcw, dstw, method)) return 1;
+
+	tap = p->tap = (param.tap + 1) & ~1;
+
+	//下位のビット数 (下位の合計がオーバーフローしない範囲)
+
+	for(lobits = _FIXLO_MAXBIT; lobits > 0; lobits--)
 	{
-		pd = *(ppdst++);
-		psY = *(ppsrc++);
-		pw = p->pweight;
-		pi = p->pindex;
+		if((double)tap * ((1 << lobits) - 1) * 255 + (1 << (lobits + _FIX_BITS)) < 0x7fffffff)
+			break;
+	}
 
-		for(ix = dstw; ix; ix--, pd += 4)
-		{
-			c[0] = c[1] = c[2] = 0;
+	p->lobits = lobits;
+	bits = _FIX_BITS + lobits;
 
-			for(i = tap; i; i--, pw++, pi++)
-			{
-				ps = psY + (*pi << 2);
-				dw = *pw;
+	//確保
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+	p->pweight = (int16_t *)mMalloc(2 * dstw * tap);
+	p->pweight_lo = (int16_t *)mMalloc(2 * dstw * tap);
+	p->pindex = (uint16_t *)mMalloc(2 * dstw * tap);
 
-			//
+	if(!p->pweight || !p->pweight_lo || !p->pindex)
+	{
+		_fixparam_free(p);
+		_param_free(&param);
+		return 1;
+	}
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 255) n = 255;
+	//変換
 
-				pd[i] = n;
-			}
+	psw = param.pweight;
+	psi = param.pindex;
+	pw = p->pweight;
+	pwlo = p->pweight_lo;
+	pi = p->pindex;
+
+	for(i = 0; i < dstw; i++, pw += tap, pwlo += tap, pi += tap)
+	{
+		sum = 0;
+		maxno = 0;
+
+		for(j = 0; j < param.tap; j++)
+		{
+			n = lround(*(psw++) * (1 << bits));
+
+			pw[j] = n >> lobits;
+			pwlo[j] = n & ((1 << lobits) - 1);
+			pi[j] = *(psi++);
+
+			sum += n;
+
+			if(pw[j] > pw[maxno]) maxno = j;
 		}
 
-		mPopupProgressThreadSubStep_inc(prog);
+		//合計が 1.0 になるように、最大の重みで補正
+
+		n = (pw[maxno] << lobits) + pwlo[maxno] + (1 << bits) - sum;
+
+		pw[maxno] = n >> lobits;
+		pwlo[maxno] = n & ((1 << lobits) - 1);
+
+		//奇数の場合、重み 0 を追加
+
+		if(j < tap)
+		{
+			pw[j] = pwlo[j] = 0;
+			pi[j] = pi[j - 1];
+		}
 	}
+
+	_param_free(&param);
+
+	return 0;
 }
 
-/* (8bit) 垂直リサイズ */
+/* 上位と下位の合計から、結果の値を取得 */
 
-static void _8bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+static int _get_fixval(int hi,int lo,int lobits)
 {
-	uint8_t **ppdst,**ppsrc,*pd,*ps;
-	int ix,iy,i,n,tap,xpos,dstw;
-	uint16_t *pi;
-	double *pw,c[3],dw;
+	return (hi + ((lo + (1 << (lobits + _FIX_BITS - 1))) >> lobits)) >> _FIX_BITS;
+}
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+/* 2 つの重みをセットしたベクトル */
+
+static __m128i _simd_weight2(int16_t *pw)
+{
+	return _mm_set1_epi32((uint16_t)pw[0] | ((uint32_t)(uint16_t)pw[1] << 16));
+}
+
+/* [SIMD] 上位と下位の合計から、結果の値を取得 */
+
+static __m128i _simd_get_fixval(__m128i vhi,__m128i vlo,int lobits)
+{
+	vlo = _mm_add_epi32(vlo, _mm_set1_epi32(1 << (lobits + _FIX_BITS - 1)));
+	vlo = _mm_sra_epi32(vlo, _mm_cvtsi32_si128(lobits));
+
+	return _mm_srai_epi32(_mm_add_epi32(vhi, vlo), _FIX_BITS);
+}
+
+#endif
+
+
+//===========================
+// 8bit
+//===========================
+
 
-	ppsrc = imgsrc->ppbuf;
-	ppdst = imgdst->ppbuf;
-	dstw = imgdst->width;
+/* (8bit) 水平方向の 1 行 */
+
+static void _8bit_horz_line(_fixparam *p,uint8_t *ps,uint8_t *pd,int dstw)
+{
+	int16_t *pw,*pwlo;
+	uint16_t *pi;
+	int ix,i,tap,lobits;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+	__m128i v,v2,vhi,vlo,vzero;
 
 	pw = p->pweight;
+	pwlo = p->pweight_lo;
 	pi = p->pindex;
 	tap = p->tap;
+	lobits = p->lobits;
+	vzero = _mm_setzero_si128();
 
-	for(iy = imgdst->height; iy; iy--)
+	for(ix = dstw; ix; ix--, pd += 4)
 	{
-		pd = *(ppdst++);
-		xpos = 0;
-	
-		for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
+		vhi = vlo = vzero;
+
+		for(i = tap / 2; i; i--, pw += 2, pwlo += 2, pi += 2)
 		{
-			c[0] = c[1] = c[2] = 0;
+			//[R0,R1,G0,G1,B0,B1,A0,A1]
 
-			for(i = 0; i < tap; i++)
-			{
-				ps = ppsrc[pi[i]] + xpos;
-				dw = pw[i];
+			v = _mm_cvtsi32_si128(*((int32_t *)(ps + (pi[0] << 2))));
+			v2 = _mm_cvtsi32_si128(*((int32_t *)(ps + (pi[1] << 2))));
+			v = _mm_unpacklo_epi8(_mm_unpacklo_epi8(v, v2), vzero);
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+			vhi = _mm_add_epi32(vhi, _mm_madd_epi16(v, _simd_weight2(pw)));
+			vlo = _mm_add_epi32(vlo, _mm_madd_epi16(v, _simd_weight2(pwlo)));
+		}
 
-			//
+		v = _simd_get_fixval(vhi, vlo, lobits);
+		v = _mm_packs_epi32(v, v);
+		v = _mm_packus_epi16(v, v);
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 255) n = 255;
+		*((int32_t *)pd) = _mm_cvtsi128_si32(v);
+	}
+#else
+	uint8_t *ps2;
+	int c[4],clo[4],n,w,wlo;
 
-				pd[i] = n;
+	pw = p->pweight;
+	pwlo = p->pweight_lo;
+	pi = p->pindex;
+	tap = p->tap;
+	lobits = p->lobits;
+
+	for(ix = dstw; ix; ix--, pd += 4)
+	{
+		c[0] = c[1] = c[2] = c[3] = 0;
+		clo[0] = clo[1] = clo[2] = clo[3] = 0;
+
+		for(i = tap; i; i--, pw++, pwlo++, pi++)
+		{
+			ps2 = ps + (*pi << 2);
+			w = *pw;
+			wlo = *pwlo;
+
+			for(n = 0; n < 4; n++)
+			{
+				c[n] += ps2[n] * w;
+				clo[n] += ps2[n] * wlo;
 			}
 		}
 
-		pw += tap;
-		pi += tap;
+		for(i = 0; i < 4; i++)
+		{
+			n = _get_fixval(c[i], clo[i], lobits);
 
-		mPopupProgressThreadSubStep_inc(prog);
+			if(n < 0) n = 0;
+			else if(n > 255) n = 255;
+
+			pd[i] = n;
+		}
 	}
+#endif
 }
 
-/* (16bit) 水平リサイズ */
+/* (8bit) 垂直方向の 1 行
+ *
+ * pw,pwlo,pi: 出力位置の重みと参照位置 */
 
-static void _16bit_resize_horz(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+static void _8bit_vert_line(_fixparam *p,uint8_t **ppsrc,uint8_t *pd,
+	int16_t *pw,int16_t *pwlo,uint16_t *pi,int dstw)
 {
-	uint16_t **ppsrc,**ppdst,*pd,*ps,*psY;
-	int ix,iy,i,tap,dstw,n;
-	uint16_t *pi;
-	double *pw,c[3],dw;
+	uint8_t *ps;
+	int i,n,c[4],clo[4],tap,lobits,xpos = 0;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+	int ix;
+	__m128i v,v1,v2,vw,vwlo,vhi1,vhi2,vlo1,vlo2,vzero;
+#endif
 
-	ppsrc = (uint16_t **)imgsrc->ppbuf;
-	ppdst = (uint16_t **)imgdst->ppbuf;
-	dstw = imgdst->width;
 	tap = p->tap;
+	lobits = p->lobits;
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+	vzero = _mm_setzero_si128();
+
+	//2px 単位
 
-	for(iy = imgdst->height; iy; iy--)
+	for(ix = dstw / 2; ix; ix--, pd += 8, xpos += 8)
 	{
-		pd = *(ppdst++);
-		psY = *(ppsrc++);
-		pw = p->pweight;
-		pi = p->pindex;
+		vhi1 = vhi2 = vlo1 = vlo2 = vzero;
 
-		for(ix = dstw; ix; ix--, pd += 4)
+		for(i = 0; i < tap; i += 2)
 		{
-			c[0] = c[1] = c[2] = 0;
+			v = _mm_loadl_epi64((__m128i *)(ppsrc[pi[i]] + xpos));
+			v2 = _mm_loadl_epi64((__m128i *)(ppsrc[pi[i + 1]] + xpos));
+			v = _mm_unpacklo_epi8(v, v2);
+
+			v1 = _mm_unpacklo_epi8(v, vzero);
+			v2 = _mm_unpackhi_epi8(v, vzero);
+			vw = _simd_weight2(pw + i);
+			vwlo = _simd_weight2(pwlo + i);
+
+			vhi1 = _mm_add_epi32(vhi1, _mm_madd_epi16(v1, vw));
+			vhi2 = _mm_add_epi32(vhi2, _mm_madd_epi16(v2, vw));
+			vlo1 = _mm_add_epi32(vlo1, _mm_madd_epi16(v1, vwlo));
+			vlo2 = _mm_add_epi32(vlo2, _mm_madd_epi16(v2, vwlo));
+		}
 
-			for(i = tap; i; i--, pw++, pi++)
-			{
-				ps = psY + (*pi << 2);
-				dw = *pw;
+		v = _mm_packs_epi32(_simd_get_fixval(vhi1, vlo1, lobits),
+			_simd_get_fixval(vhi2, vlo2, lobits));
+		v = _mm_packus_epi16(v, v);
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+		_mm_storel_epi64((__m128i *)pd, v);
+	}
 
-			//
+	if(!(dstw & 1)) return;
+#endif
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 0x8000) n = 0x8000;
+	//残り (非 SIMD 時はすべて)
+
+	for(; xpos < dstw * 4; pd += 4, xpos += 4)
+	{
+		c[0] = c[1] = c[2] = c[3] = 0;
+		clo[0] = clo[1] = clo[2] = clo[3] = 0;
 
-				pd[i] = n;
+		for(i = 0; i < tap; i++)
+		{
+			ps = ppsrc[pi[i]] + xpos;
+
+			for(n = 0; n < 4; n++)
+			{
+				c[n] += ps[n] * pw[i];
+				clo[n] += ps[n] * pwlo[i];
 			}
 		}
 
-		mPopupProgressThreadSubStep_inc(prog);
+		for(i = 0; i < 4; i++)
+		{
+			n = _get_fixval(c[i], clo[i], lobits);
+
+			if(n < 0) n = 0;
+			else if(n > 255) n = 255;
+
+			pd[i] = n;
+		}
+	}
+}
+
+
+//===========================
+// 16bit
+//===========================
+
+
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+
+/* [SIMD] (16bit) 1px の RGBA 値を double x 2 で取得 */
+
+static void _simd_16bit_load(uint16_t *ps,__m128d *pv1,__m128d *pv2)
+{
+	__m128i v;
+
+	v = _mm_unpacklo_epi16(_mm_loadl_epi64((__m128i *)ps), _mm_setzero_si128());
+
+	*pv1 = _mm_cvtepi32_pd(v);
+	*pv2 = _mm_cvtepi32_pd(_mm_srli_si128(v, 8));
+}
+
+/* [SIMD] (16bit) 計算結果を 0〜0x8000 に制限して、四捨五入してセット */
+
+static void _simd_16bit_store(uint16_t *pd,__m128d v1,__m128d v2)
+{
+	__m128d vzero,vmax,vhalf;
+	__m128i v;
+
+	vzero = _mm_setzero_pd();
+	vmax = _mm_set1_pd(0x8000);
+	vhalf = _mm_set1_pd(0.5);
+
+	v1 = _mm_add_pd(_mm_min_pd(_mm_max_pd(v1, vzero), vmax), vhalf);
+	v2 = _mm_add_pd(_mm_min_pd(_mm_max_pd(v2, vzero), vmax), vhalf);
+
+	v = _mm_unpacklo_epi64(_mm_cvttpd_epi32(v1), _mm_cvttpd_epi32(v2));
+
+	//0x8000 は int16 の範囲外のため、-0x8000 した値で pack して戻す
+
+	v = _mm_packs_epi32(_mm_sub_epi32(v, _mm_set1_epi32(0x8000)), v);
+	v = _mm_add_epi16(v, _mm_set1_epi16(-0x8000));
+
+	_mm_storel_epi64((__m128i *)pd, v);
+}
+
+#else
+
+/* (16bit) 計算結果をセット */
+
+static void _16bit_store(uint16_t *pd,double *pc)
+{
+	int i,n;
+
+	for(i = 0; i < 4; i++)
+	{
+		n = lround(pc[i]);
+
+		if(n < 0) n = 0;
+		else if(n > 0x8000) n = 0x8000;
+
+		pd[i] = n;
 	}
 }
 
-/* (16bit) 垂直リサイズ */
+#endif
 
-static void _16bit_resize_vert(_param *p,ImageCanvas *imgsrc,ImageCanvas *imgdst,mPopupProgress *prog)
+/* (16bit) 水平方向の 1 行 */
+
+static void _16bit_horz_line(_param *p,uint16_t *ps,uint16_t *pd,int dstw)
 {
-	uint16_t **ppdst,**ppsrc,*pd,*ps;
-	int ix,iy,i,n,tap,xpos,dstw;
+	double *pw;
 	uint16_t *pi;
-	double *pw,c[3],dw;
+	int ix,i,tap;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+	__m128d v1,v2,vw,c1,c2;
+
+	pw = p->pweight;
+	pi = p->pindex;
+	tap = p->tap;
+
+	for(ix = dstw; ix; ix--, pd += 4)
+	{
+		c1 = c2 = _mm_setzero_pd();
+
+		for(i = tap; i; i--, pw++, pi++)
+		{
+			_simd_16bit_load(ps + (*pi << 2), &v1, &v2);
+
+			vw = _mm_set1_pd(*pw);
+
+			c1 = _mm_add_pd(c1, _mm_mul_pd(v1, vw));
+			c2 = _mm_add_pd(c2, _mm_mul_pd(v2, vw));
+		}
 
-	ppsrc = (uint16_t **)imgsrc->ppbuf;
-	ppdst = (uint16_t **)imgdst->ppbuf;
-	dstw = imgdst->width;
+		_simd_16bit_store(pd, c1, c2);
+	}
+#else
+	uint16_t *ps2;
+	double c[4],dw;
 
 	pw = p->pweight;
 	pi = p->pindex;
 	tap = p->tap;
 
-	for(iy = imgdst->height; iy; iy--)
+	for(ix = dstw; ix; ix--, pd += 4)
 	{
-		pd = *(ppdst++);
-		xpos = 0;
-	
-		for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
+		c[0] = c[1] = c[2] = c[3] = 0;
+
+		for(i = tap; i; i--, pw++, pi++)
 		{
-			c[0] = c[1] = c[2] = 0;
+			ps2 = ps + (*pi << 2);
+			dw = *pw;
 
-			for(i = 0; i < tap; i++)
-			{
-				ps = ppsrc[pi[i]] + xpos;
-				dw = pw[i];
+			c[0] += ps2[0] * dw;
+			c[1] += ps2[1] * dw;
+			c[2] += ps2[2] * dw;
+			c[3] += ps2[3] * dw;
+		}
 
-				c[0] += ps[0] * dw;
-				c[1] += ps[1] * dw;
-				c[2] += ps[2] * dw;
-			}
+		_16bit_store(pd, c);
+	}
+#endif
+}
 
-			//
+/* (16bit) 垂直方向の 1 行
+ *
+ * pw,pi: 出力位置の重みと参照位置 */
 
-			for(i = 0; i < 3; i++)
-			{
-				n = lround(c[i]);
-				
-				if(n < 0) n = 0;
-				else if(n > 0x8000) n = 0x8000;
+static void _16bit_vert_line(_param *p,uint16_t **ppsrc,uint16_t *pd,
+	double *pw,uint16_t *pi,int dstw)
+{
+	int ix,i,tap,xpos = 0;
+#if MLK_ENABLE_SSE2 && _SIMD_ON
+	__m128d v1,v2,vw,c1,c2;
 
-				pd[i] = n;
-			}
+	tap = p->tap;
+
+	for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
+	{
+		c1 = c2 = _mm_setzero_pd();
+
+		for(i = 0; i < tap; i++)
+		{
+			_simd_16bit_load(ppsrc[pi[i]] + xpos, &v1, &v2);
+
+			vw = _mm_set1_pd(pw[i]);
+
+			c1 = _mm_add_pd(c1, _mm_mul_pd(v1, vw));
+			c2 = _mm_add_pd(c2, _mm_mul_pd(v2, vw));
 		}
 
-		pw += tap;
-		pi += tap;
+		_simd_16bit_store(pd, c1, c2);
+	}
+#else
+	uint16_t *ps;
+	double c[4],dw;
 
-		mPopupProgressThreadSubStep_inc(prog);
+	tap = p->tap;
+
+	for(ix = dstw; ix; ix--, pd += 4, xpos += 4)
+	{
+		c[0] = c[1] = c[2] = c[3] = 0;
+
+		for(i = 0; i < tap; i++)
+		{
+			ps = ppsrc[pi[i]] + xpos;
+			dw = pw[i];
+
+			c[0] += ps[0] * dw;
+			c[1] += ps[1] * dw;
+			c[2] += ps[2] * dw;
+			c[3] += ps[3] * dw;
+		}
+
+		_16bit_store(pd, c);
 	}
+#endif
+}
+
+
+//===========================
+// スレッド
+//===========================
+
+
+/* [スレッド] 水平リサイズ (_BAND_H 行) */
+
+static void _thread_horz(void *param,int jobno,int threadno)
+{
+	_resizedat *p = (_resizedat *)param;
+	uint8_t **ppsrc,**ppdst;
+	int y,yend,dstw;
+
+	ppsrc = p->src->ppbuf;
+	ppdst = p->dst->ppbuf;
+	dstw = p->dst->width;
+
+	y = jobno * _BAND_H;
+	yend = y + _BAND_H;
+	if(yend > p->dst->height) yend = p->dst->height;
+
+	for(; y < yend; y++)
+	{
+		if(p->src->bits == 8)
+			_8bit_horz_line(p->param, ppsrc[y], ppdst[y], dstw);
+		else
+			_16bit_horz_line(p->dparam, (uint16_t *)ppsrc[y], (uint16_t *)ppdst[y], dstw);
+	}
+
+	mPopupProgressThreadSubStep_inc(p->prog);
+}
+
+/* [スレッド] 垂直リサイズ (_BAND_H 行) */
+
+static void _thread_vert(void *param,int jobno,int threadno)
+{
+	_resizedat *p = (_resizedat *)param;
+	uint8_t **ppdst;
+	int16_t *pw,*pwlo;
+	double *pdw;
+	uint16_t *pi;
+	int y,yend,dstw,tap;
+
+	ppdst = p->dst->ppbuf;
+	dstw = p->dst->width;
+
+	y = jobno * _BAND_H;
+	yend = y + _BAND_H;
+	if(yend > p->dst->height) yend = p->dst->height;
+
+	if(p->src->bits == 8)
+	{
+		tap = p->param->tap;
+		pw = p->param->pweight + y * tap;
+		pwlo = p->param->pweight_lo + y * tap;
+		pi = p->param->pindex + y * tap;
+
+		for(; y < yend; y++, pw += tap, pwlo += tap, pi += tap)
+			_8bit_vert_line(p->param, p->src->ppbuf, ppdst[y], pw, pwlo, pi, dstw);
+	}
+	else
+	{
+		tap = p->dparam->tap;
+		pdw = p->dparam->pweight + y * tap;
+		pi = p->dparam->pindex + y * tap;
+
+		for(; y < yend; y++, pdw += tap, pi += tap)
+		{
+			_16bit_vert_line(p->dparam, (uint16_t **)p->src->ppbuf, (uint16_t *)ppdst[y],
+				pdw, pi, dstw);
+		}
+	}
+
+	mPopupProgressThreadSubStep_inc(p->prog);
+}
+
+/* 水平 or 垂直リサイズのパラメータをセット
+ *
+ * 8bit は param に固定小数点、16bit は dparam に double の重みをセットする。
+ * return: 0 以外でエラー */
+
+static int _set_resize_param(_fixparam *param,_param *dparam,int srcw,int dstw,int method,int bits)
+{
+	if(bits == 8)
+		return _set_fixparam(param, srcw, dstw, method);
+	else
+		return _set_param(dparam, srcw, dstw, method);
+}
+
+/* 水平 or 垂直リサイズのパラメータを解放 */
+
+static void _free_resize_param(_fixparam *param,_param *dparam)
+{
+	_fixparam_free(param);
+	_param_free(dparam);
+}
+
+/* 水平 or 垂直リサイズを実行
+ *
+ * param: 8bit 時の重み
+ * dparam: 16bit 時の重み */
+
+static void _run_resize(_fixparam *param,_param *dparam,ImageCanvas *src,ImageCanvas *dst,
+	mPopupProgress *prog,mlkbool vert)
+{
+	_resizedat dat;
+
+	dat.param = param;
+	dat.dparam = dparam;
+	dat.src = src;
+	dat.dst = dst;
+	dat.prog = prog;
+
+	ThreadPool_run((vert)? _thread_vert: _thread_horz, &dat,
+		(dst->height + _BAND_H - 1) / _BAND_H);
 }
 
 
@@ -693,6 +1162,132 @@ ImageCanvas *_proc_nearest(ImageCanvas *src,int neww,int newh,mPopupProgress *pr
 }
 
 
+//===========================
+// 結果の確認 (デバッグ用)
+//===========================
+
+#if _CHECK_RESIZE
+
+/* イメージを複製 */
+
+static ImageCanvas *_check_clone(ImageCanvas *src)
+{
+	ImageCanvas *p;
+	int y;
+
+	p = ImageCanvas_new(src->width, src->height, src->bits);
+	if(!p) return NULL;
+
+	for(y = 0; y < src->height; y++)
+		memcpy(p->ppbuf[y], src->ppbuf[y], src->width * ((src->bits == 8)? 4: 8));
+
+	return p;
+}
+
+/* 色の値を取得 */
+
+static int _check_getval(ImageCanvas *p,int x,int y,int c)
+{
+	if(p->bits == 8)
+		return p->ppbuf[y][x * 4 + c];
+	else
+		return *((uint16_t *)p->ppbuf[y] + x * 4 + c);
+}
+
+/* double で水平 or 垂直リサイズ (以前の処理と同じ) */
+
+static void _check_resize_pass(ImageCanvas *src,ImageCanvas *dst,int method,mlkbool vert)
+{
+	ImageCanvasResizeParam param;
+	double d,*pw;
+	uint16_t *pi;
+	int x,y,c,i,n,max;
+
+	if(!ImageCanvas_setResizeParam(&param, (vert)? src->height: src->width,
+		(vert)? dst->height: dst->width, method))
+		return;
+
+	max = (src->bits == 8)? 255: 0x8000;
+
+	for(y = 0; y < dst->height; y++)
+	{
+		for(x = 0; x < dst->width; x++)
+		{
+			pw = param.pweight + ((vert)? y: x) * param.tap;
+			pi = param.pindex + ((vert)? y: x) * param.tap;
+
+			for(c = 0; c < 4; c++)
+			{
+				d = 0;
+
+				for(i = 0; i < param.tap; i++)
+				{
+					if(vert)
+						d += _check_getval(src, x, pi[i], c) * pw[i];
+					else
+						d += _check_getval(src, pi[i], y, c) * pw[i];
+				}
+
+				n = lround(d);
+
+				if(n < 0) n = 0;
+				else if(n > max) n = max;
+
+				if(dst->bits == 8)
+					dst->ppbuf[y][x * 4 + c] = n;
+				else
+					*((uint16_t *)dst->ppbuf[y] + x * 4 + c) = n;
+			}
+		}
+	}
+
+	ImageCanvas_freeResizeParam(&param);
+}
+
+/* double で計算した結果と比較して、最大の差を出力
+ *
+ * src は解放される */
+
+static void _check_resize(ImageCanvas *src,ImageCanvas *dst,int method)
+{
+	ImageCanvas *tmp,*ref;
+	int x,y,c,n,diff = 0;
+
+	if(!src || !dst) goto END;
+
+	tmp = ImageCanvas_new(dst->width, src->height, src->bits);
+	ref = ImageCanvas_new(dst->width, dst->height, src->bits);
+
+	if(tmp && ref)
+	{
+		_check_resize_pass(src, tmp, method, FALSE);
+		_check_resize_pass(tmp, ref, method, TRUE);
+
+		for(y = 0; y < dst->height; y++)
+		{
+			for(x = 0; x < dst->width; x++)
+			{
+				for(c = 0; c < 4; c++)
+				{
+					n = abs(_check_getval(dst, x, y, c) - _check_getval(ref, x, y, c));
+					if(n > diff) diff = n;
+				}
+			}
+		}
+
+		mDebug("resize: %dbit method:%d %dx%d -> %dx%d, max diff %d\n",
+			src->bits, method, src->width, src->height, dst->width, dst->height, diff);
+	}
+
+	ImageCanvas_free(tmp);
+	ImageCanvas_free(ref);
+END:
+	ImageCanvas_free(src);
+}
+
+#endif
+
+
 //===========================
 // main
 //===========================
@@ -708,8 +1303,12 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 	mPopupProgress *prog,int stepnum)
 {
 	ImageCanvas *dst,*tmp;
-	_param param;
+	_fixparam param;
+	_param dparam;
 	int bits,err = 1;
+#if _CHECK_RESIZE
+	ImageCanvas *chksrc;
+#endif
 
 	//ニアレストネイバー
 
@@ -721,9 +1320,15 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 	dst = NULL;
 	bits = src->bits;
 
-	mMemset0(&param, sizeof(_param));
+	mMemset0(&param, sizeof(_fixparam));
+	mMemset0(&dparam, sizeof(_param));
+
+#if _CHECK_RESIZE
+	chksrc = _check_clone(src);
+#endif
 
-	mPopupProgressThreadSubStep_begin(prog, stepnum, src->height + newh);
+	mPopupProgressThreadSubStep_begin(prog, stepnum,
+		(src->height + _BAND_H - 1) / _BAND_H + (newh + _BAND_H - 1) / _BAND_H);
 
 	//水平リサイズ結果用イメージ
 
@@ -732,14 +1337,11 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 
 	//水平リサイズ
 
-	if(_set_param(&param, src->width, neww, method)) goto ERR;
+	if(_set_resize_param(&param, &dparam, src->width, neww, method, bits)) goto ERR;
 
-	if(bits == 8)
-		_8bit_resize_horz(&param, src, tmp, prog);
-	else
-		_16bit_resize_horz(&param, src, tmp, prog);
+	_run_resize(&param, &dparam, src, tmp, prog, FALSE);
 
-	_param_free(&param);
+	_free_resize_param(&param, &dparam);
 
 	//src を解放
 
@@ -753,20 +1355,19 @@ ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,
 
 	//垂直リサイズ
 
-	if(_set_param(&param, tmp->height, newh, method)) goto ERR;
+	if(_set_resize_param(&param, &dparam, tmp->height, newh, method, bits)) goto ERR;
 
-	if(bits == 8)
-		_8bit_resize_vert(&param, tmp, dst, prog);
-	else
-		_16bit_resize_vert(&param, tmp, dst, prog);
+	_run_resize(&param, &dparam, tmp, dst, prog, TRUE);
 
-	_param_free(&param);
+	_free_resize_param(&param, &dparam);
 
 	//---------
 
 	err = 0;
 	
 ERR:
+	_free_resize_param(&param, &dparam);
+
 	ImageCanvas_free(src);
 	ImageCanvas_free(tmp);
 
@@ -776,6 +1377,10 @@ ERR:
 		dst = NULL;
 	}
 
+#if _CHECK_RESIZE
+	_check_resize(chksrc, dst, method);
+#endif
+
 	return dst;
 }
 
@@ -44,6 +44,7 @@ void ImageCanvas_8bit_fillPlaidBox(ImageCanvas *p,const mBox *box,RGBcombo *col1
 void ImageCanvas_8bit_setAlphaMax(ImageCanvas *p);
 void ImageCanvas_8bit_drawPixbuf_nearest(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_8bit_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
+void ImageCanvas_8bit_drawPixbuf_mip(ImageCanvas *src,mPixbuf *dst,_canvasparam *cp,uint8_t *pd,int level);
 void ImageCanvas_8bit_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_8bit_drawPixbuf_rotate_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 
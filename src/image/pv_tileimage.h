@@ -62,7 +62,7 @@ struct _TileImageBlendInfo
 		is_tone_bkgnd_tp;	//トーン:背景は透明
 	int64_t tone_fx,tone_fy,	//タイル開始位置でのセル位置
 		tone_fcos,tone_fsin;
-	BlendColorFunc func_blend;
+	BlendColorRowFunc func_blendrow;
 };
 
 #define TILEIMG_TONE_FIX_BITS  28
@@ -116,6 +116,8 @@ typedef struct
 	//r,g,b = 0.0-各ビット最大値, a = 0.0-1.0
 	RGBAdouble col_water,	//水彩色
 		col_water_draw;		//水彩、開始時の描画色
+
+	uint32_t dabnum;	//描画した点の累計数 (計測用)
 }TileImageBrushWorkData;
 
 /** 作業用データ */
@@ -134,6 +136,7 @@ typedef struct
 
 	TileImageColFuncData colfunc[4];	//各カラータイプの関数 (現在のビット用)
 	BlendColorFunc blendfunc[BLENDMODE_NUM];	//色合成関数 (現在のビット用)
+	BlendColorRowFunc blendrowfunc[BLENDMODE_NUM];	//行単位の色合成関数 (現在のビット用)
 	TileImagePixelColorFunc pixcolfunc[TILEIMAGE_PIXELCOL_NUM];	//ピクセルカラー関数 (現在のビット用)
 
 	TileImageBrushWorkData brush; //ブラシ描画用データ
@@ -171,6 +174,7 @@ mlkbool __TileImage_resizeTileBuf(TileImage *p,int movx,int movy,int neww,int ne
 mlkbool __TileImage_resizeTileBuf_clone(TileImage *p,TileImage *src);
 
 void __TileImage_setBlendInfo(TileImageBlendInfo *info,int px,int py,const mRect *rcclip);
+void __TileImage_blendRow(TileImageBlendInfo *info,BlendColorRow *row,uint8_t *dstbuf,int num);
 
 int __TileImage_density_to_colval(int v,mlkbool rev);
 void __TileImage_getRotateRect(mRect *rcdst,int width,int height,double dcos,double dsin);
@@ -180,3 +184,17 @@ void __TileImage_getRotateRect(mRect *rcdst,int width,int height,double dcos,dou
 uint8_t *__TileImage_getPixelBuf_new(TileImage *p,int x,int y);
 mlkbool __TileImage_getDrawSrcColor(TileImage *p,int x,int y,void *dstcol);
 
+/* tileimage_brush.c */
+
+void __TileImage_freeBrushStamp(void);
+
+/* tileimage_transform.c */
+
+void __TileImage_transform(TileImage *dst,TileImage *src,const mRect *rcdst,
+	const double *param,int sx,int sy,int sw,int sh,mPopupProgress *prog);
+
+/* tileimage_pool.c */
+
+mlkbool __TileImage_pool_init(void);
+void __TileImage_pool_finish(void);
+
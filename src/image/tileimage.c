@@ -61,6 +61,8 @@ void __TileImage_setPixelColorFunc(TileImagePixelColorFunc *p,int bits);
 
 void BlendColorFunc_setTable_8bit(BlendColorFunc *p);
 void BlendColorFunc_setTable_16bit(BlendColorFunc *p);
+void BlendColorRowFunc_setTable_8bit(BlendColorRowFunc *p);
+void BlendColorRowFunc_setTable_16bit(BlendColorRowFunc *p);
 
 //--------------------------
 
@@ -100,6 +102,10 @@ mlkbool TileImage_init(void)
 
 	g_tileimg_work = p;
 
+	//タイルのメモリプール
+
+	if(!__TileImage_pool_init()) return FALSE;
+
 	//指先用バッファ
 
 	p->finger_buf = (uint8_t *)mMalloc(101 * 101 * 8);
@@ -118,7 +124,9 @@ mlkbool TileImage_init(void)
 	return TRUE;
 }
 
-/** 終了時 */
+/** 終了時
+ *
+ * [!] すべての TileImage を解放した後に行う。 */
 
 void TileImage_finish(void)
 {
@@ -128,6 +136,10 @@ void TileImage_finish(void)
 	{
 		mRandSFMT_free(p->rand);
 
+		__TileImage_freeBrushStamp();
+
+		__TileImage_pool_finish();
+
 		mFree(p->finger_buf);
 		mFree(p);
 	}
@@ -163,9 +175,15 @@ void TileImage_global_setImageBits(int bits)
 		//合成関数
 
 		if(bits == 8)
+		{
 			BlendColorFunc_setTable_8bit(p->blendfunc);
+			BlendColorRowFunc_setTable_8bit(p->blendrowfunc);
+		}
 		else
+		{
 			BlendColorFunc_setTable_16bit(p->blendfunc);
+			BlendColorRowFunc_setTable_16bit(p->blendrowfunc);
+		}
 	}
 }
 
@@ -222,7 +240,9 @@ int TileImage_global_getTileSize(int type,int bits)
 	return size;
 }
 
-/** タイルバッファを、現在ビットの最大サイズで確保 */
+/** タイルバッファを、現在ビットの最大サイズで確保
+ *
+ * TileImage_freeTile_buf() で解放すること。 */
 
 uint8_t *TileImage_global_allocTileBitMax(void)
 {
@@ -233,7 +253,7 @@ uint8_t *TileImage_global_allocTileBitMax(void)
 	else
 		size = 64 * 64 * 8;
 
-	return (uint8_t *)mMallocAlign(size, 16);
+	return TileImage_pool_alloc(size);
 }
 
 /** 乱数用 mRandSFMT * を取得 */
@@ -319,7 +339,7 @@ void TileImage_free(TileImage *p)
 			for(i = p->tilew * p->tileh; i; i--, pp++)
 			{
 				if(*pp && *pp != TILEIMAGE_TILE_EMPTY)
-					mFree(*pp);
+					TileImage_pool_release(*pp);
 			}
 
 			mFree(p->ppbuf);
@@ -336,12 +356,21 @@ void TileImage_freeTile(uint8_t **pptile)
 	if(*pptile)
 	{
 		if(*pptile != TILEIMAGE_TILE_EMPTY)
-			mFree(*pptile);
+			TileImage_pool_release(*pptile);
 
 		*pptile = NULL;
 	}
 }
 
+/** タイルを解放 (ポインタ直接)
+ *
+ * TileImage_allocTile() で確保した作業用のタイルなど。 */
+
+void TileImage_freeTile_buf(uint8_t *buf)
+{
+	TileImage_pool_release(buf);
+}
+
 /** 指定タイル位置のタイルを解放 (アンドゥ用) */
 
 void TileImage_freeTile_atPos(TileImage *p,int tx,int ty)
@@ -381,6 +410,62 @@ void TileImage_freeAllTiles(TileImage *p)
 	}
 }
 
+/* タイルのすべてのピクセルが同じ値か
+ *
+ * A1 の場合は、8px 単位のバイトで比較するため、
+ * 0x00 か 0xff 以外のバイトが並んでいる場合 (縞模様など) は、単色ではない。
+ *
+ * return: 1px のバイト数 (0 で単色でない)。A1 の場合は 1 (8px 単位) */
+
+static int _get_solid_pixbytes(TileImage *p,uint8_t *tile)
+{
+	uint64_t *ps,v;
+	int i,pixbytes;
+
+	pixbytes = p->tilesize >> 12;
+
+	if(pixbytes == 0)
+	{
+		//A1
+
+		if(*tile != 0 && *tile != 0xff) return 0;
+
+		pixbytes = 1;
+	}
+
+	//先頭のピクセルを 8byte 分並べる
+
+	for(i = 0; i < 8; i += pixbytes)
+		memcpy((uint8_t *)&v + i, tile, pixbytes);
+
+	//比較
+
+	ps = (uint64_t *)tile;
+
+	for(i = p->tilesize >> 3; i; i--, ps++)
+	{
+		if(*ps != v) return 0;
+	}
+
+	return pixbytes;
+}
+
+/* 単色のタイルなら、共有の単色タイルに置き換える */
+
+static void _to_solid_tile(TileImage *p,uint8_t **pptile)
+{
+	int pixbytes;
+
+	if(*pptile == TILEIMAGE_TILE_EMPTY
+		|| TileImage_pool_isSolid(*pptile))
+		return;
+
+	pixbytes = _get_solid_pixbytes(p, *pptile);
+
+	if(pixbytes)
+		*pptile = TileImage_pool_toSolid(*pptile, pixbytes);
+}
+
 /** 空のタイルをすべて解放
  *
  * return: すべて空なら TRUE */
@@ -415,7 +500,8 @@ mlkbool TileImage_freeEmptyTiles(TileImage *p)
 /** 空のタイルをすべて解放 (アンドゥ用イメージでタイルが確保されている部分のみ)
  *
  * imgundo でタイルが確保されている部分は、イメージが変更された部分。
- * それらの中で、消しゴム等ですべて透明になったタイルは解放して、メモリ負担を軽減させる。 */
+ * それらの中で、消しゴム等ですべて透明になったタイルは解放して、メモリ負担を軽減させる。
+ * 塗りつぶし等で単色になったタイルは、共有の単色タイルにする。 */
 
 void TileImage_freeEmptyTiles_byUndo(TileImage *p,TileImage *imgundo)
 {
@@ -432,8 +518,33 @@ void TileImage_freeEmptyTiles_byUndo(TileImage *p,TileImage *imgundo)
 
 	for(i = p->tilew * p->tileh; i; i--, ppbuf++, ppundo++)
 	{
-		if(*ppundo && *ppbuf && (func)(*ppbuf))
-			TileImage_freeTile(ppbuf);
+		if(*ppundo && *ppbuf)
+		{
+			if((func)(*ppbuf))
+				TileImage_freeTile(ppbuf);
+			else
+				_to_solid_tile(p, ppbuf);
+		}
+	}
+}
+
+/** すべてのタイルで、単色のタイルを共有の単色タイルにする
+ *
+ * ファイル読み込み後など。 */
+
+void TileImage_shareSolidTiles(TileImage *p)
+{
+	uint8_t **ppbuf;
+	uint32_t i;
+
+	if(!p || !p->ppbuf) return;
+
+	ppbuf = p->ppbuf;
+
+	for(i = p->tilew * p->tileh; i; i--, ppbuf++)
+	{
+		if(*ppbuf)
+			_to_solid_tile(p, ppbuf);
 	}
 }
 
@@ -518,7 +629,9 @@ TileImage *TileImage_newFromRect_forFile(int type,const mRect *rc)
 
 /** 複製を新規作成 (タイルイメージも含む)
  *
- * return: すべてのタイルが確保できなかった場合、NULL */
+ * タイルは src と共有され、書き込み時に複製される。
+ *
+ * return: 確保できなかった場合、NULL */
 
 TileImage *TileImage_newClone(TileImage *src)
 {
@@ -535,7 +648,8 @@ TileImage *TileImage_newClone(TileImage *src)
 	p->offy = src->offy;
 	p->col  = src->col;
 
-	//タイルコピー
+	//タイルを共有
+	// :内容は、どちらかに書き込む時に複製される。
 
 	ppsrc = src->ppbuf;
 	ppdst = p->ppbuf;
@@ -544,14 +658,10 @@ TileImage *TileImage_newClone(TileImage *src)
 	{
 		if(*ppsrc)
 		{
-			*ppdst = TileImage_allocTile(p);
-			if(!(*ppdst))
-			{
-				TileImage_free(p);
-				return NULL;
-			}
+			if(*ppsrc != TILEIMAGE_TILE_EMPTY)
+				TileImage_pool_addRef(*ppsrc);
 
-			TileImage_copyTile(p, *ppdst, *ppsrc);
+			*ppdst = *ppsrc;
 		}
 	}
 
@@ -851,7 +961,7 @@ mlkbool TileImage_resizeTileBuf_forUndo(TileImage *p,TileImageInfo *info)
 
 uint8_t *TileImage_allocTile(TileImage *p)
 {
-	return (uint8_t *)mMallocAlign(p->tilesize, 16);
+	return TileImage_pool_alloc(p->tilesize);
 }
 
 /** タイルを確保してクリア */
@@ -860,7 +970,7 @@ uint8_t *TileImage_allocTile_clear(TileImage *p)
 {
 	uint8_t *buf;
 
-	buf = (uint8_t *)mMallocAlign(p->tilesize, 16);
+	buf = TileImage_pool_alloc(p->tilesize);
 	if(!buf) return NULL;
 
 	TileImage_clearTile(p, buf);
@@ -869,6 +979,8 @@ uint8_t *TileImage_allocTile_clear(TileImage *p)
 }
 
 /** ポインタの位置にタイルがなければ確保
+ *
+ * タイルに書き込む前に使う。共有されているタイルは複製される。
  *
  * return: FALSE で、タイルの新規確保に失敗 */
 
@@ -880,7 +992,7 @@ mlkbool TileImage_allocTile_atptr(TileImage *p,uint8_t **ppbuf)
 		if(!(*ppbuf)) return FALSE;
 	}
 
-	return TRUE;
+	return TileImage_unshareTile(p, ppbuf);
 }
 
 /** ポインタの位置にタイルがなければ確保して、クリア */
@@ -895,10 +1007,12 @@ mlkbool TileImage_allocTile_atptr_clear(TileImage *p,uint8_t **ppbuf)
 		TileImage_clearTile(p, *ppbuf);
 	}
 
-	return TRUE;
+	return TileImage_unshareTile(p, ppbuf);
 }
 
 /** 指定タイル位置のタイルを取得 (タイルが確保されていなければ確保)
+ *
+ * タイルに書き込む前に使う。共有されているタイルは複製される。
  *
  * return: タイルポインタ。位置が範囲外や、確保失敗の場合は NULL */
 
@@ -919,11 +1033,44 @@ uint8_t *TileImage_getTileAlloc_atpos(TileImage *p,int tx,int ty,mlkbool clear)
 			else
 				*pp = TileImage_allocTile(p);
 		}
+		else if(!TileImage_unshareTile(p, pp))
+			return NULL;
 
 		return *pp;
 	}
 }
 
+/** タイルが他のイメージと共有されている場合、複製して置き換える
+ *
+ * タイルの内容を直接書き換える前に行う。
+ * NULL や空タイルの場合は何もしない。
+ *
+ * return: FALSE で確保エラー (タイルはそのまま) */
+
+mlkbool TileImage_unshareTile(TileImage *p,uint8_t **pptile)
+{
+	uint8_t *buf;
+
+	if(!(*pptile) || *pptile == TILEIMAGE_TILE_EMPTY
+		|| !TileImage_pool_isShared(*pptile))
+		return TRUE;
+
+	//複製
+	// :コピーしてから参照を外すこと。
+	// :(他のスレッドで同時に複製される場合、先に解放されないように)
+
+	buf = TileImage_allocTile(p);
+	if(!buf) return FALSE;
+
+	TileImage_copyTile(p, buf, *pptile);
+
+	TileImage_pool_release(*pptile);
+
+	*pptile = buf;
+
+	return TRUE;
+}
+
 /** タイルを透明にクリア */
 
 void TileImage_clearTile(TileImage *p,uint8_t *tile)
@@ -1326,6 +1473,102 @@ static void _blendcanvas_set_tone_info(TileImageBlendInfo *dst,const TileImageBl
 	dst->tone_fsin = (int64_t)round(1.0 / round(dcell / dsin) * TILEIMG_TONE_FIX_VAL);
 }
 
+/* 単色タイルを ImageCanvas に合成
+ *
+ * テクスチャなし、トーン化なしの場合のみ。
+ * タイルの色は一つなので、ピクセルごとの読み込みを省略する。
+ * 通常合成で不透明の場合は、直接セットする。 */
+
+static void _blend_solid_tile(TileImage *p,TileImageBlendInfo *info)
+{
+	BlendColorRow row;
+	uint8_t **ppdst,*pd;
+	uint16_t col[4],*pd16;
+	int32_t c[3];
+	int ix,iy,i,a,amax,dstx;
+	mlkbool is8bit;
+
+	//タイルの色 (RGBA)
+
+	(TILEIMGWORK->colfunc[p->type].getpixel_at_tile)(p, info->tile, p->offx, p->offy, col);
+
+	is8bit = (TILEIMGWORK->bits == 8);
+
+	if(is8bit)
+	{
+		pd = (uint8_t *)col;
+		
+		c[0] = pd[0];
+		c[1] = pd[1];
+		c[2] = pd[2];
+		a = pd[3];
+		amax = 255;
+	}
+	else
+	{
+		c[0] = col[0];
+		c[1] = col[1];
+		c[2] = col[2];
+		a = col[3];
+		amax = 0x8000;
+	}
+
+	a = a * info->opacity >> 7;
+	if(!a) return;
+
+	ppdst = info->dstbuf;
+	dstx = (is8bit)? info->dx * 4: info->dx * 8;
+
+	//通常合成で不透明の場合、直接セット (X の値は維持)
+
+	if(a == amax && info->func_blendrow == TILEIMGWORK->blendrowfunc[0])
+	{
+		for(iy = info->h; iy; iy--, ppdst++)
+		{
+			pd = *ppdst + dstx;
+
+			if(is8bit)
+			{
+				for(ix = info->w; ix; ix--, pd += 4)
+				{
+					pd[0] = c[0];
+					pd[1] = c[1];
+					pd[2] = c[2];
+				}
+			}
+			else
+			{
+				pd16 = (uint16_t *)pd;
+
+				for(ix = info->w; ix; ix--, pd16 += 4)
+				{
+					pd16[0] = c[0];
+					pd16[1] = c[1];
+					pd16[2] = c[2];
+				}
+			}
+		}
+
+		return;
+	}
+
+	//行単位で合成
+	// :合成関数で src が変更されるため、毎行セットする
+
+	for(iy = info->h; iy; iy--, ppdst++)
+	{
+		for(i = 0; i < info->w; i++)
+		{
+			row.src[0][i] = c[0];
+			row.src[1][i] = c[1];
+			row.src[2][i] = c[2];
+			row.a[i] = a;
+		}
+
+		__TileImage_blendRow(info, &row, *ppdst + dstx, info->w);
+	}
+}
+
 /** ImageCanvas に合成
  *
  * - トーン化レイヤ対象外のカラータイプでは、トーン化は常に OFF に指定されていること。
@@ -1355,7 +1598,7 @@ void TileImage_blendToCanvas(TileImage *p,ImageCanvas *dst,
 
 	binfo.opacity = sinfo->opacity;
 	binfo.imgtex = sinfo->img_texture;
-	binfo.func_blend = TILEIMGWORK->blendfunc[sinfo->blendmode];
+	binfo.func_blendrow = TILEIMGWORK->blendrowfunc[sinfo->blendmode];
 	binfo.tone_repcol = -1;
 
 	//トーン化を行うか
@@ -1472,7 +1715,13 @@ void TileImage_blendToCanvas(TileImage *p,ImageCanvas *dst,
 				binfo.tile = *pptile;
 				binfo.dstbuf = dst->ppbuf + binfo.dy;
 
-				(func)(p, &binfo);
+				//単色タイル
+
+				if(!binfo.imgtex && binfo.tone_repcol == -1
+					&& TileImage_pool_isSolid(binfo.tile))
+					_blend_solid_tile(p, &binfo);
+				else
+					(func)(p, &binfo);
 			}
 
 			pptile += info.pitch_tile;
@@ -22,9 +22,11 @@ $*/
  *****************************************/
 
 #include <math.h>
+#include <string.h>
 
 #include "mlk.h"
 #include "mlk_rand.h"
+#include "mlk_list.h"
 
 #include "colorvalue.h"
 
@@ -355,6 +357,15 @@ void TileImage_drawBrush_beginOther(TileImage *p,double x,double y)
 	_begin_water(p, x, y);
 }
 
+/** 描画した点の累計数を取得 (計測用)
+ *
+ * TileImage_init() 時からの数。 */
+
+uint32_t TileImage_drawBrush_getDabNum(void)
+{
+	return TILEIMGWORK->brush.dabnum;
+}
+
 
 //================================
 // 線の描画
@@ -934,34 +945,104 @@ static int _drawpoint_get_image_color(uint8_t *buf,int r,int g,int b,int a,
 //--------------
 
 
-/* 通常円形 (硬さ最大時) */
+//---------- 通常円形の形状キャッシュ
 
-static void _drawbrush_point_circle_max(TileImage *p,
-	double x,double y,double radius,double opacity,void *drawcol)
+/*
+  - 通常円形の各 px の濃度 (0〜0x8000) を、
+    半径・硬さ・中心のサブピクセル位置ごとにキャッシュする。
+  - 半径は 1/16 px 単位、中心位置は半径に応じて 1/16〜1/4 px 単位に丸める。
+  - 使用したものをリストの先頭に移動し、合計サイズが上限を超えたら末尾から削除する。
+  - キャッシュを使うのは、同時に一つの描画スレッドのみ
+    (GUI スレッド、または自由線描画中のブラシ描画スレッド (draw_brush_thread.c))。
+    描画スレッドの実行中、イメージへのアクセスは mutex_img で排他されるため、
+    キャッシュ自体は排他処理をしない。
+    他のスレッドから同時にブラシ描画を行う場合は、排他が必要になる。
+*/
+
+#define _STAMP_HASH_NUM     256
+#define _STAMP_MAXSIZE_ALL  (32 * 1024 * 1024)	//全体の最大サイズ
+#define _STAMP_MAXSIZE_ONE  (4 * 1024 * 1024)	//キャッシュする一つの最大サイズ
+
+typedef struct _stampitem _stampitem;
+
+struct _stampitem
 {
-	_drawpointinfo info;
-	int ix,iy,px,py,n;
-	int xtbl[11],ytbl[11],subpos[11],fx,fy,fx_left,rr;
+	mListItem i;
+
+	_stampitem *hashnext;
+	double hard;		//硬さ (負の値で最大)
+	int rq,				//半径 (1/16 px 単位)
+		subx,suby,		//中心のサブピクセル位置
+		x1,y1,w,h;		//中心の整数位置からの描画範囲
+	uint32_t size;
+	uint16_t buf[1];	//濃度
+};
+
+static mList g_stamp_list = MLIST_INIT;
+static _stampitem *g_stamp_hash[_STAMP_HASH_NUM];
+static uint32_t g_stamp_size = 0;
+
+static int *g_span_buf = NULL;	//1行分のアルファ値
+static int g_span_bufnum = 0;
+
+
+/* 中心位置の分割数を取得 */
+
+static int _stamp_get_subdiv(int rq)
+{
+	if(rq < 8 * 16)
+		return 16;
+	else if(rq < 32 * 16)
+		return 8;
+	else
+		return 4;
+}
+
+/* ハッシュ値 */
+
+static int _stamp_get_hash(int rq,int subx,int suby,double hard)
+{
+	return (rq * 31 + subx * 7 + suby * 131 + (int)(hard * 1000)) & (_STAMP_HASH_NUM - 1);
+}
+
+/* 濃度をセット */
+
+static void _stamp_set_buf(_stampitem *p)
+{
+	uint16_t *pd;
+	int ix,iy,px,py,subnum,div,n;
+	int xtbl[SUBNUM_MAX],ytbl[SUBNUM_MAX],subpos[SUBNUM_MAX],fx,fy,fx_left,rr;
 	int64_t fpos;
-	double ddiv;
+	double x,y,radius,hard,dd,dsum,ddiv;
 
-	_drawpoint_set_info(&info, x, y, radius, opacity, FALSE);
+	radius = p->rq / 16.0;
+	hard = p->hard;
+
+	div = _stamp_get_subdiv(p->rq);
+	x = (double)p->subx / div;
+	y = (double)p->suby / div;
 
-	fx_left = floor((info.x1 - x) * FIXF_VAL);
-	fy = floor((info.y1 - y) * FIXF_VAL);
+	if(radius < 3) subnum = 11;
+	else if(radius < 15) subnum = 5;
+	else subnum = 3;
+
+	fx_left = floor((p->x1 - x) * FIXF_VAL);
+	fy = floor((p->y1 - y) * FIXF_VAL);
 	rr = floor(radius * radius * FIXF_VAL);
-	ddiv = 1.0 / (info.subnum * info.subnum);
+	ddiv = 0x8000 / (double)(subnum * subnum);
 
-	for(ix = 0; ix < info.subnum; ix++)
-		subpos[ix] = (ix << FIXF_BIT) / info.subnum;
+	for(ix = 0; ix < subnum; ix++)
+		subpos[ix] = (ix << FIXF_BIT) / subnum;
 
 	//各 px
 
-	for(py = info.y1; py <= info.y2; py++, fy += FIXF_VAL)
+	pd = p->buf;
+
+	for(py = 0; py < p->h; py++, fy += FIXF_VAL)
 	{
 		//Y テーブル
 
-		for(iy = 0; iy < info.subnum; iy++)
+		for(iy = 0; iy < subnum; iy++)
 		{
 			fpos = fy + subpos[iy];
 			ytbl[iy] = fpos * fpos >> FIXF_BIT;
@@ -969,111 +1050,290 @@ static void _drawbrush_point_circle_max(TileImage *p,
 
 		//
 
-		for(px = info.x1, fx = fx_left; px <= info.x2; px++, fx += FIXF_VAL)
+		for(px = 0, fx = fx_left; px < p->w; px++, fx += FIXF_VAL)
 		{
 			//X テーブル
 
-			for(ix = 0; ix < info.subnum; ix++)
+			for(ix = 0; ix < subnum; ix++)
 			{
 				fpos = fx + subpos[ix];
 				xtbl[ix] = fpos * fpos >> FIXF_BIT;
 			}
 
-			//円の内側ならカウント加算
+			//オーバーサンプリング
 
-			n = 0;
+			dsum = 0;
 
-			for(iy = 0; iy < info.subnum; iy++)
+			for(iy = 0; iy < subnum; iy++)
 			{
-				for(ix = 0; ix < info.subnum; ix++)
+				for(ix = 0; ix < subnum; ix++)
 				{
-					if(xtbl[ix] + ytbl[iy] < rr) n++;
+					n = xtbl[ix] + ytbl[iy];
+					if(n >= rr) continue;
+
+					if(hard < 0)
+						//硬さ最大時は、円の内側の数
+						dsum += 1;
+					else
+					{
+						dd = (double)n / rr;
+
+						dd = dd + hard - dd * hard;
+
+						if(dd < 0) dd = 0;
+						else if(dd > 1) dd = 1;
+
+						dsum += 1.0 - dd;
+					}
 				}
 			}
 
-			//点をセット
+			*(pd++) = (int)(dsum * ddiv + 0.5);
+		}
+	}
+}
+
+/* 古いものから削除して、サイズを空ける */
 
-			_drawpoint_setpixel(p, px, py, drawcol, (int)(info.opacity_bit * (n * ddiv) + 0.5), &info);
+static void _stamp_reduce(uint32_t addsize)
+{
+	_stampitem *pi,**pp;
+
+	while(g_stamp_list.bottom && g_stamp_size + addsize > _STAMP_MAXSIZE_ALL)
+	{
+		pi = (_stampitem *)g_stamp_list.bottom;
+
+		//ハッシュから外す
+
+		pp = g_stamp_hash + _stamp_get_hash(pi->rq, pi->subx, pi->suby, pi->hard);
+
+		for(; *pp; pp = &((*pp)->hashnext))
+		{
+			if(*pp == pi)
+			{
+				*pp = pi->hashnext;
+				break;
+			}
 		}
+
+		g_stamp_size -= pi->size;
+
+		mListDelete(&g_stamp_list, MLISTITEM(pi));
 	}
 }
 
-/* 通常円形 (硬さのパラメータ値から) */
+/* 形状を取得
+ *
+ * キャッシュにない場合は作成する。
+ *
+ * ptx,pty: 描画範囲の左上位置が入る
+ * pfcache: キャッシュされたデータか。FALSE の場合、使用後に解放すること。
+ * return: NULL で確保失敗 */
 
-static void _drawbrush_point_circle(TileImage *p,
-	double x,double y,double radius,double opacity,void *drawcol)
+static _stampitem *_stamp_get(double x,double y,double radius,double hard,
+	int *ptx,int *pty,mlkbool *pfcache)
 {
-	_drawpointinfo info;
-	int ix,iy,px,py;
-	int xtbl[11],ytbl[11],subpos[11],rr,fx,fy,fx_left;
-	int64_t fpos;
-	double hard_param,dd,dsum,ddiv;
+	_stampitem *pi;
+	int rq,div,subx,suby,cx,cy,x1,y1,w,h,hash;
+	uint32_t size;
+	double rad;
 
-	_drawpoint_set_info(&info, x, y, radius, opacity, FALSE);
+	//キー
 
-	hard_param = _BRUSHDP->shape_hard;
+	rq = (int)(radius * 16 + 0.5);
+	if(rq < 1) rq = 1;
 
-	//
+	div = _stamp_get_subdiv(rq);
 
-	fx_left = floor((info.x1 - x) * FIXF_VAL);
-	fy = floor((info.y1 - y) * FIXF_VAL);
-	rr = floor(radius * radius * FIXF_VAL);
-	ddiv = 1.0 / (info.subnum * info.subnum);
+	cx = (int)floor(x);
+	cy = (int)floor(y);
+	subx = (int)((x - cx) * div + 0.5);
+	suby = (int)((y - cy) * div + 0.5);
 
-	for(ix = 0; ix < info.subnum; ix++)
-		subpos[ix] = (ix << FIXF_BIT) / info.subnum;
+	if(subx == div) cx++, subx = 0;
+	if(suby == div) cy++, suby = 0;
 
-	//--------------
+	//検索
 
-	for(py = info.y1; py <= info.y2; py++, fy += FIXF_VAL)
-	{
-		//Y テーブル
+	hash = _stamp_get_hash(rq, subx, suby, hard);
 
-		for(iy = 0; iy < info.subnum; iy++)
+	for(pi = g_stamp_hash[hash]; pi; pi = pi->hashnext)
+	{
+		if(pi->rq == rq && pi->subx == subx && pi->suby == suby && pi->hard == hard)
 		{
-			fpos = fy + subpos[iy];
-			ytbl[iy] = fpos * fpos >> FIXF_BIT;
+			mListMoveToTop(&g_stamp_list, MLISTITEM(pi));
+
+			*ptx = cx + pi->x1;
+			*pty = cy + pi->y1;
+			*pfcache = TRUE;
+
+			return pi;
 		}
+	}
 
-		//
+	//範囲
+
+	rad = rq / 16.0;
 
-		for(px = info.x1, fx = fx_left; px <= info.x2; px++, fx += FIXF_VAL)
+	x1 = (int)floor((double)subx / div - rad);
+	y1 = (int)floor((double)suby / div - rad);
+	w = (int)floor((double)subx / div + rad) - x1 + 1;
+	h = (int)floor((double)suby / div + rad) - y1 + 1;
+
+	size = sizeof(_stampitem) + (w * h - 1) * 2;
+
+	//作成
+
+	if(size > _STAMP_MAXSIZE_ONE)
+	{
+		//大きすぎる場合はキャッシュしない
+
+		pi = (_stampitem *)mMalloc(size);
+		*pfcache = FALSE;
+	}
+	else
+	{
+		_stamp_reduce(size);
+
+		pi = (_stampitem *)mListInsertNew(&g_stamp_list, g_stamp_list.top, size);
+		*pfcache = TRUE;
+	}
+
+	if(!pi) return NULL;
+
+	pi->hard = hard;
+	pi->rq = rq;
+	pi->subx = subx;
+	pi->suby = suby;
+	pi->x1 = x1;
+	pi->y1 = y1;
+	pi->w = w;
+	pi->h = h;
+	pi->size = size;
+
+	_stamp_set_buf(pi);
+
+	//ハッシュに追加
+
+	if(*pfcache)
+	{
+		pi->hashnext = g_stamp_hash[hash];
+		g_stamp_hash[hash] = pi;
+
+		g_stamp_size += size;
+	}
+
+	*ptx = cx + x1;
+	*pty = cy + y1;
+
+	return pi;
+}
+
+/** 円形形状のキャッシュを解放 */
+
+void __TileImage_freeBrushStamp(void)
+{
+	mListDeleteAll(&g_stamp_list);
+
+	memset(g_stamp_hash, 0, sizeof(g_stamp_hash));
+
+	g_stamp_size = 0;
+
+	mFree(g_span_buf);
+	g_span_buf = NULL;
+	g_span_bufnum = 0;
+}
+
+/* 1行分のアルファ値バッファを取得 */
+
+static int *_get_span_buf(int num)
+{
+	int *buf;
+
+	if(num > g_span_bufnum)
+	{
+		buf = (int *)mRealloc(g_span_buf, num * sizeof(int));
+		if(!buf) return NULL;
+
+		g_span_buf = buf;
+		g_span_bufnum = num;
+	}
+
+	return g_span_buf;
+}
+
+//----------
+
+
+/* 通常円形 */
+
+static void _drawbrush_point_circle(TileImage *p,
+	double x,double y,double radius,double opacity,void *drawcol)
+{
+	_drawpointinfo info;
+	_stampitem *stamp;
+	uint16_t *ps;
+	int ix,iy,left,top,amax,a,*span;
+	mlkbool fcache;
+
+	_drawpoint_set_info(&info, x, y, radius, opacity, FALSE);
+
+	stamp = _stamp_get(x, y, radius,
+		(_BRUSHDP->flags & BRUSHDP_F_SHAPE_HARD_MAX)? -1: _BRUSHDP->shape_hard,
+		&left, &top, &fcache);
+
+	if(!stamp) return;
+
+	span = _get_span_buf(stamp->w);
+
+	//各 px
+
+	ps = stamp->buf;
+	amax = info.alpha_max;
+
+	for(iy = 0; iy < stamp->h; iy++)
+	{
+		if(!span)
 		{
-			//X テーブル
+			//確保失敗時は 1px ずつ
 
-			for(ix = 0; ix < info.subnum; ix++)
+			for(ix = 0; ix < stamp->w; ix++, ps++)
 			{
-				fpos = fx + subpos[ix];
-				xtbl[ix] = fpos * fpos >> FIXF_BIT;
+				_drawpoint_setpixel(p, left + ix, top + iy, drawcol,
+					(*ps * amax + 0x4000) >> 15, &info);
 			}
 
-			//オーバーサンプリング
+			continue;
+		}
 
-			dsum = 0;
+		//1行分のアルファ値 (_drawpoint_setpixel と同じ処理)
 
-			for(iy = 0; iy < info.subnum; iy++)
+		for(ix = 0; ix < stamp->w; ix++, ps++)
+		{
+			a = (*ps * amax + 0x4000) >> 15;
+
+			if(!a && !info.fdrawtp)
+				a = -1;
+			else if(a)
 			{
-				for(ix = 0; ix < info.subnum; ix++)
+				if(info.sand)
 				{
-					if(xtbl[ix] + ytbl[iy] < rr)
-					{
-						dd = (double)(xtbl[ix] + ytbl[iy]) / rr;
-
-						dd = dd + hard_param - dd * hard_param;
-
-						if(dd < 0) dd = 0;
-						else if(dd > 1) dd = 1;
-
-						dsum += 1.0 - dd;
-					}
+					a -= a * mRandSFMT_getIntRange(TILEIMGWORK->rand, 0, info.sand) >> 7;
+					if(a < 0) a = 0;
 				}
-			}
 
-			//点をセット
+				if(info.fnoaa && a)
+					a = info.alpha_max;
+			}
 
-			_drawpoint_setpixel(p, px, py, drawcol, (int)(info.opacity_bit * (dsum * ddiv) + 0.5), &info);
+			span[ix] = a;
 		}
+
+		TileImage_setPixel_span(p, left, top + iy, stamp->w, drawcol, span);
 	}
+
+	if(!fcache)
+		mFree(stamp);
 }
 
 /* 形状画像/回転なし (8bit:濃度のみ) */
@@ -1415,6 +1675,8 @@ void _drawbrush_point(TileImage *p,double x,double y,double radius,double opacit
 
 	if(opacity == 0 || radius < 0.05) return;
 
+	TILEIMGWORK->brush.dabnum++;
+
 	col = g_tileimage_dinfo.drawcol;
 
 	//水彩:描画色の計算
@@ -1430,10 +1692,7 @@ void _drawbrush_point(TileImage *p,double x,double y,double radius,double opacit
 	{
 		//通常円形
 
-		if(_BRUSHDP->flags & BRUSHDP_F_SHAPE_HARD_MAX)
-			_drawbrush_point_circle_max(p, x, y, radius, opacity, &col);
-		else
-			_drawbrush_point_circle(p, x, y, radius, opacity, &col);
+		_drawbrush_point_circle(p, x, y, radius, opacity, &col);
 	}
 	else
 	{
@@ -91,12 +91,16 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint8_t **ppdst,*ps,*pd;
-	int pitchs,ix,iy,dx,dy,a,dstx;
-	int32_t src[3],dst[3],r,g,b;
+	BlendColorRow row;
+	uint8_t **ppdst,*ps;
+	int pitchs,ix,iy,i,dx,dy,a,dstx;
+	int fdraw;
+	int32_t r,g,b;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = info.tile + info.sy * 64 + info.sx;
 	ppdst = info.dstbuf;
 	dstx = info.dx * 4;
@@ -110,43 +114,34 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		fdraw = 0;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps++, pd += 4)
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps++)
 		{
 			a = *ps;
-			if(!a) continue;
 
-			if(info.imgtex)
+			if(a && info.imgtex)
 				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
 
 			a = a * info.opacity >> 7;
-			if(!a) continue;
-
-			//色合成
 
-			src[0] = r;
-			src[1] = g;
-			src[2] = b;
+			row.a[i] = a;
+			fdraw |= a;
+		}
 
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+		//色合成
+		// :src は合成時に上書きされるので、毎回セット
 
-			if((info.func_blend)(src, dst, a) && a != 255)
+		if(fdraw)
+		{
+			for(i = 0; i < info.w; i++)
 			{
-				//アルファ合成
-
-				src[0] = (src[0] - dst[0]) * a / 255 + dst[0];
-				src[1] = (src[1] - dst[1]) * a / 255 + dst[1];
-				src[2] = (src[2] - dst[2]) * a / 255 + dst[2];
+				row.src[0][i] = r;
+				row.src[1][i] = g;
+				row.src[2][i] = b;
 			}
 
-			//セット
-
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
+			__TileImage_blendRow(&info, &row, *ppdst + dstx, info.w);
 		}
 
 		ps += pitchs;
@@ -343,12 +338,16 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint16_t **ppdst,*ps,*pd;
-	int pitchs,ix,iy,dx,dy,a,dstx;
-	int32_t src[3],dst[3],r,g,b;
+	BlendColorRow row;
+	uint16_t **ppdst,*ps;
+	int pitchs,ix,iy,i,dx,dy,a,dstx;
+	int fdraw;
+	int32_t r,g,b;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = (uint16_t *)info.tile + info.sy * 64 + info.sx;
 	ppdst = (uint16_t **)info.dstbuf;
 	dstx = info.dx * 4;
@@ -362,44 +361,34 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		fdraw = 0;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps++, pd += 4)
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps++)
 		{
 			a = *ps;
-			if(!a) continue;
 
-			if(info.imgtex)
+			if(a && info.imgtex)
 				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
 
 			a = a * info.opacity >> 7;
 
-			if(!a) continue;
-
-			//RGB 合成
-
-			src[0] = r;
-			src[1] = g;
-			src[2] = b;
+			row.a[i] = a;
+			fdraw |= a;
+		}
 
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+		//色合成
+		// :src は合成時に上書きされるので、毎回セット
 
-			if((info.func_blend)(src, dst, a) && a != 0x8000)
+		if(fdraw)
+		{
+			for(i = 0; i < info.w; i++)
 			{
-				//アルファ合成
-
-				src[0] = ((src[0] - dst[0]) * a >> 15) + dst[0];
-				src[1] = ((src[1] - dst[1]) * a >> 15) + dst[1];
-				src[2] = ((src[2] - dst[2]) * a >> 15) + dst[2];
+				row.src[0][i] = r;
+				row.src[1][i] = g;
+				row.src[2][i] = b;
 			}
 
-			//セット
-
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
+			__TileImage_blendRow(&info, &row, (uint8_t *)(*ppdst + dstx), info.w);
 		}
 
 		ps += pitchs;
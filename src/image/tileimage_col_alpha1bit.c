@@ -235,13 +235,17 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint8_t **ppdst,*ps,*psY,*pd,fleft,f,fval;
-	int ix,iy,dx,dy,a,dstx,c,cx,cy,thval;
-	int32_t src[3],dst[3],r,g,b;
+	BlendColorRow row;
+	uint8_t **ppdst,*ps,*psY,fleft,f,fval;
+	int ix,iy,i,dx,dy,a,dstx,c,cx,cy,thval;
+	mlkbool fdraw;
+	int32_t src[3],r,g,b;
 	int64_t fxx,fxy;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	psY = info.tile + ((info.sy << 3) + (info.sx >> 3));
 	ppdst = info.dstbuf;
 	dstx = info.dx * 4;
@@ -256,15 +260,16 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		memset(row.a, 0, sizeof(row.a));
+		fdraw = FALSE;
 		ps = psY;
 		f = fleft;
 		fval = *(ps++);
 		fxx = info.tone_fx;
 		fxy = info.tone_fy;
 	
-		for(ix = info.w, dx = info.dx; ix;
-			ix--, dx++, pd += 4, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, i = 0, dx = info.dx; ix;
+			ix--, i++, dx++, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
 		{
 			if(!f)
 				f = 0x80, fval = *(ps++);
@@ -334,27 +339,20 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 				}
 			}
 
-			//色合成
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
 
-			if((info.func_blend)(src, dst, a) && a != 255)
-			{
-				//アルファ合成
+			row.src[0][i] = src[0];
+			row.src[1][i] = src[1];
+			row.src[2][i] = src[2];
+			row.a[i] = a;
 
-				src[0] = (src[0] - dst[0]) * a / 255 + dst[0];
-				src[1] = (src[1] - dst[1]) * a / 255 + dst[1];
-				src[2] = (src[2] - dst[2]) * a / 255 + dst[2];
-			}
+			fdraw = TRUE;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, *ppdst + dstx, info.w);
 
 		psY += 8;
 		ppdst++;
@@ -463,14 +461,18 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
+	BlendColorRow row;
 	uint8_t *ps,*psY,fleft,f,fval;
-	uint16_t **ppdst,*pd;
-	int ix,iy,dx,dy,a,dstx,c,cx,cy,thval;
-	int32_t src[3],dst[3],r,g,b;
+	uint16_t **ppdst;
+	int ix,iy,i,dx,dy,a,dstx,c,cx,cy,thval;
+	mlkbool fdraw;
+	int32_t src[3],r,g,b;
 	int64_t fxx,fxy;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	psY = info.tile + ((info.sy << 3) + (info.sx >> 3));
 	ppdst = (uint16_t **)info.dstbuf;
 	dstx = info.dx * 4;
@@ -485,15 +487,16 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		memset(row.a, 0, sizeof(row.a));
+		fdraw = FALSE;
 		ps = psY;
 		f = fleft;
 		fval = *(ps++);
 		fxx = info.tone_fx;
 		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix;
-			ix--, dx++, pd += 4, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
+		for(ix = info.w, i = 0, dx = info.dx; ix;
+			ix--, i++, dx++, f >>= 1, fxx += info.tone_fcos, fxy += info.tone_fsin)
 		{
 			if(!f)
 				f = 0x80, fval = *(ps++);
@@ -563,27 +566,20 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 				}
 			}
 
-			//色合成
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
 
-			if((info.func_blend)(src, dst, a) && a != 0x8000)
-			{
-				//アルファ合成
+			row.src[0][i] = src[0];
+			row.src[1][i] = src[1];
+			row.src[2][i] = src[2];
+			row.a[i] = a;
 
-				src[0] = ((src[0] - dst[0]) * a >> 15) + dst[0];
-				src[1] = ((src[1] - dst[1]) * a >> 15) + dst[1];
-				src[2] = ((src[2] - dst[2]) * a >> 15) + dst[2];
-			}
+			fdraw = TRUE;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, (uint8_t *)(*ppdst + dstx), info.w);
 
 		psY += 8;
 		ppdst++;
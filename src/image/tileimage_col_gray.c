@@ -164,13 +164,17 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint8_t **ppdst,*ps,*pd,r,g,b;
-	int pitchs,ix,iy,dx,dy,a,c,dstx,cx,cy,thval;
-	int32_t src[3],dst[3];
+	BlendColorRow row;
+	uint8_t **ppdst,*ps,r,g,b;
+	int pitchs,ix,iy,i,dx,dy,a,c,dstx,cx,cy,thval;
+	mlkbool fdraw;
+	int32_t src[3];
 	int64_t fxx,fxy;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = info.tile + (info.sy * 64 + info.sx) * 2;
 	ppdst = info.dstbuf;
 	dstx = info.dx * 4;
@@ -184,11 +188,12 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		memset(row.a, 0, sizeof(row.a));
+		fdraw = FALSE;
 		fxx = info.tone_fx;
 		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 2, pd += 4,
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps += 2,
 				fxx += info.tone_fcos, fxy += info.tone_fsin)
 		{
 			a = ps[1];
@@ -252,27 +257,20 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 				}
 			}
 
-			//RGB 合成
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
 
-			if((info.func_blend)(src, dst, a) && a != 255)
-			{
-				//アルファ合成
+			row.src[0][i] = src[0];
+			row.src[1][i] = src[1];
+			row.src[2][i] = src[2];
+			row.a[i] = a;
 
-				src[0] = ((src[0] - dst[0]) * a / 255) + dst[0];
-				src[1] = ((src[1] - dst[1]) * a / 255) + dst[1];
-				src[2] = ((src[2] - dst[2]) * a / 255) + dst[2];
-			}
+			fdraw = TRUE;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, *ppdst + dstx, info.w);
 
 		ps += pitchs;
 		ppdst++;
@@ -552,13 +550,17 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint16_t **ppdst,*ps,*pd,r,g,b;
-	int pitchs,ix,iy,dx,dy,a,c,dstx,cx,cy,thval;
-	int32_t src[3],dst[3];
+	BlendColorRow row;
+	uint16_t **ppdst,*ps,r,g,b;
+	int pitchs,ix,iy,i,dx,dy,a,c,dstx,cx,cy,thval;
+	mlkbool fdraw;
+	int32_t src[3];
 	int64_t fxx,fxy;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = (uint16_t *)info.tile + (info.sy * 64 + info.sx) * 2;
 	ppdst = (uint16_t **)info.dstbuf;
 	dstx = info.dx * 4;
@@ -572,11 +574,12 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		memset(row.a, 0, sizeof(row.a));
+		fdraw = FALSE;
 		fxx = info.tone_fx;
 		fxy = info.tone_fy;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 2, pd += 4,
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps += 2,
 				fxx += info.tone_fcos, fxy += info.tone_fsin)
 		{
 			a = ps[1];
@@ -636,27 +639,20 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 				}
 			}
 
-			//RGB 合成
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
 
-			if((info.func_blend)(src, dst, a) && a != 0x8000)
-			{
-				//アルファ合成
+			row.src[0][i] = src[0];
+			row.src[1][i] = src[1];
+			row.src[2][i] = src[2];
+			row.a[i] = a;
 
-				src[0] = ((src[0] - dst[0]) * a >> 15) + dst[0];
-				src[1] = ((src[1] - dst[1]) * a >> 15) + dst[1];
-				src[2] = ((src[2] - dst[2]) * a >> 15) + dst[2];
-			}
+			fdraw = TRUE;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, (uint8_t *)(*ppdst + dstx), info.w);
 
 		ps += pitchs;
 		ppdst++;
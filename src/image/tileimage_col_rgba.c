@@ -146,12 +146,15 @@ static mlkbool _8bit_is_same_rgba(void *col1,void *col2)
 static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint8_t **ppdst,*ps,*pd;
-	int pitchs,ix,iy,dx,dy,a,dstx;
-	int32_t src[3],dst[3];
+	BlendColorRow row;
+	uint8_t **ppdst,*ps;
+	int pitchs,ix,iy,i,dx,dy,a,dstx;
+	int fdraw;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = info.tile + (info.sy * 64 + info.sx) * 4;
 	ppdst = info.dstbuf;
 	dstx = info.dx * 4;
@@ -161,44 +164,32 @@ static void _8bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		fdraw = 0;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 4, pd += 4)
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps += 4)
 		{
 			a = ps[3];
-			if(!a) continue;
 
-			if(info.imgtex)
+			if(a && info.imgtex)
 				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
 
 			a = a * info.opacity >> 7;
-			if(!a) continue;
-
-			//色合成
 
-			src[0] = ps[0];
-			src[1] = ps[1];
-			src[2] = ps[2];
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
+			// :a = 0 の場合も、色は範囲内の値なので、そのままセットする
 
-			if((info.func_blend)(src, dst, a) && a != 255)
-			{
-				//アルファ合成
+			row.src[0][i] = ps[0];
+			row.src[1][i] = ps[1];
+			row.src[2][i] = ps[2];
+			row.a[i] = a;
 
-				src[0] = (src[0] - dst[0]) * a / 255 + dst[0];
-				src[1] = (src[1] - dst[1]) * a / 255 + dst[1];
-				src[2] = (src[2] - dst[2]) * a / 255 + dst[2];
-			}
+			fdraw |= a;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, *ppdst + dstx, info.w);
 
 		ps += pitchs;
 		ppdst++;
@@ -437,12 +428,15 @@ static mlkbool _16bit_is_same_rgba(void *col1,void *col2)
 static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 {
 	TileImageBlendInfo info;
-	uint16_t **ppdst,*ps,*pd;
-	int pitchs,ix,iy,dx,dy,a,dstx;
-	int32_t src[3],dst[3];
+	BlendColorRow row;
+	uint16_t **ppdst,*ps;
+	int pitchs,ix,iy,i,dx,dy,a,dstx;
+	int fdraw;
 
 	info = *infosrc;
 
+	memset(&row, 0, sizeof(BlendColorRow));
+
 	ps = (uint16_t *)info.tile + (info.sy * 64 + info.sx) * 4;
 	ppdst = (uint16_t **)info.dstbuf;
 	dstx = info.dx * 4;
@@ -452,45 +446,32 @@ static void _16bit_blend_tile(TileImage *p,TileImageBlendInfo *infosrc)
 
 	for(iy = info.h, dy = info.dy; iy; iy--, dy++)
 	{
-		pd = *ppdst + dstx;
+		fdraw = 0;
 		
-		for(ix = info.w, dx = info.dx; ix; ix--, dx++, ps += 4, pd += 4)
+		for(ix = info.w, i = 0, dx = info.dx; ix; ix--, i++, dx++, ps += 4)
 		{
 			a = ps[3];
-			if(!a) continue;
 
-			if(info.imgtex)
+			if(a && info.imgtex)
 				a = a * ImageMaterial_getPixel_forTexture(info.imgtex, dx, dy) / 255;
 
 			a = a * info.opacity >> 7;
 
-			if(!a) continue;
-
-			//RGB合成
-
-			src[0] = ps[0];
-			src[1] = ps[1];
-			src[2] = ps[2];
-
-			dst[0] = pd[0];
-			dst[1] = pd[1];
-			dst[2] = pd[2];
+			//セット
+			// :a = 0 の場合も、色は範囲内の値なので、そのままセットする
 
-			if((info.func_blend)(src, dst, a) && a != 0x8000)
-			{
-				//アルファ合成
+			row.src[0][i] = ps[0];
+			row.src[1][i] = ps[1];
+			row.src[2][i] = ps[2];
+			row.a[i] = a;
 
-				src[0] = ((src[0] - dst[0]) * a >> 15) + dst[0];
-				src[1] = ((src[1] - dst[1]) * a >> 15) + dst[1];
-				src[2] = ((src[2] - dst[2]) * a >> 15) + dst[2];
-			}
+			fdraw |= a;
+		}
 
-			//セット
+		//色合成
 
-			pd[0] = src[0];
-			pd[1] = src[1];
-			pd[2] = src[2];
-		}
+		if(fdraw)
+			__TileImage_blendRow(&info, &row, (uint8_t *)(*ppdst + dstx), info.w);
 
 		ps += pitchs;
 		ppdst++;
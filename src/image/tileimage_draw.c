@@ -1401,6 +1401,8 @@ void TileImage_combine_forA1(TileImage *dst,TileImage *src)
 			{
 				//両方あり: 8byte 単位で OR 結合
 
+				if(!TileImage_unshareTile(dst, ppdst)) continue;
+
 				ps = (uint64_t *)*ppsrc;
 				pd = (uint64_t *)*ppdst;
 
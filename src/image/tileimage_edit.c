@@ -81,12 +81,12 @@ void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
 
 		//タイル再確保
 
-		mFree(*pp);
+		TileImage_freeTile_buf(*pp);
 
 		*pp = TileImage_allocTile(p);
 		if(!(*pp))
 		{
-			mFree(tilebuf);
+			TileImage_freeTile_buf(tilebuf);
 			return;
 		}
 
@@ -100,7 +100,7 @@ void TileImage_convertColorType(TileImage *p,int newtype,mlkbool lum_to_alpha)
 			TileImage_freeTile(pp);
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile_buf(tilebuf);
 }
 
 /** タイルを指定ビット数に変換してコピー
@@ -180,7 +180,7 @@ void TileImage_convertBits(TileImage *p,int bits,void *tblbuf,mPopupProgress *pr
 
 			//置き換え (NULL の場合も常に)
 
-			mFree(*pptile);
+			TileImage_freeTile_buf(*pptile);
 
 			*pptile = newbuf;
 		}
@@ -581,7 +581,7 @@ void TileImage_flipHorz_full(TileImage *p)
 
 	for(ix = p->tilew * p->tileh; ix; ix--, pptile++)
 	{
-		if(*pptile)
+		if(*pptile && TileImage_unshareTile(p, pptile))
 		{
 			TileImage_copyTile(p, ptmp, *pptile);
 		
@@ -589,7 +589,7 @@ void TileImage_flipHorz_full(TileImage *p)
 		}
 	}
 
-	mFree(ptmp);
+	TileImage_freeTile_buf(ptmp);
 
 	//タイル配列のポインタを左右反転
 
@@ -634,7 +634,7 @@ void TileImage_flipVert_full(TileImage *p)
 
 	for(ix = p->tilew * p->tileh; ix; ix--, pp++)
 	{
-		if(*pp)
+		if(*pp && TileImage_unshareTile(p, pp))
 		{
 			TileImage_copyTile(p, ptmp, *pp);
 		
@@ -642,7 +642,7 @@ void TileImage_flipVert_full(TileImage *p)
 		}
 	}
 
-	mFree(ptmp);
+	TileImage_freeTile_buf(ptmp);
 
 	//タイル配列を上下反転
 
@@ -681,7 +681,7 @@ void TileImage_rotateLeft_full(TileImage *p)
 	ppnew = __TileImage_allocTileBuf_new(p->tileh, p->tilew);
 	if(!ppnew)
 	{
-		mFree(tilebuf);
+		TileImage_freeTile_buf(tilebuf);
 		return;
 	}
 
@@ -701,7 +701,7 @@ void TileImage_rotateLeft_full(TileImage *p)
 
 	for(ix = p->tilew * p->tileh; ix; ix--, pp++)
 	{
-		if(*pp)
+		if(*pp && TileImage_unshareTile(p, pp))
 		{
 			TileImage_copyTile(p, tilebuf, *pp);
 		
@@ -709,7 +709,7 @@ void TileImage_rotateLeft_full(TileImage *p)
 		}
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile_buf(tilebuf);
 
 	//配列を回転して配置
 
@@ -752,7 +752,7 @@ void TileImage_rotateRight_full(TileImage *p)
 	ppnew = __TileImage_allocTileBuf_new(p->tileh, p->tilew);
 	if(!ppnew)
 	{
-		mFree(tilebuf);
+		TileImage_freeTile_buf(tilebuf);
 		return;
 	}
 
@@ -772,7 +772,7 @@ void TileImage_rotateRight_full(TileImage *p)
 
 	for(ix = p->tilew * p->tileh; ix; ix--, pp++)
 	{
-		if(*pp)
+		if(*pp && TileImage_unshareTile(p, pp))
 		{
 			TileImage_copyTile(p, tilebuf, *pp);
 		
@@ -780,7 +780,7 @@ void TileImage_rotateRight_full(TileImage *p)
 		}
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile_buf(tilebuf);
 
 	//配列を回転して配置
 
@@ -1267,10 +1267,7 @@ void TileImage_transformAffine(TileImage *dst,TileImage *src,const mBox *box,
 	mPopupProgress *prog)
 {
 	mRect rc;
-	int ix,iy,sw,sh;
-	double cx,cy,dx,dy,dxx,dyy,scalex_div,scaley_div,addxx,addxy,addyx,addyy;
-	uint64_t col;
-	TileImageSetPixelFunc setpix = g_tileimage_dinfo.func_setpixel;
+	double cx,cy,dx,dy,scalex_div,scaley_div,param[11];
 
 	//全体の描画先範囲
 
@@ -1280,51 +1277,29 @@ void TileImage_transformAffine(TileImage *dst,TileImage *src,const mBox *box,
 
 	if(!TileImage_clipCanDrawRect(dst, &rc)) return;
 
-	//
-
-	sw = box->w, sh = box->h;
+	//射影変換のパラメータとしてセット
+	// :描画先 (0,0) におけるソース座標と、x,y 各 +1 時の増加量
 
-	cx = sw * 0.5;
-	cy = sh * 0.5;
+	cx = box->w * 0.5;
+	cy = box->h * 0.5;
 
 	scalex_div = 1 / scalex;
 	scaley_div = 1 / scaley;
 
-	//描画先左上におけるソース座標
-
-	dx = rc.x1 - box->x - movx - cx;
-	dy = rc.y1 - box->y - movy - cy;
-
-	dxx = (dx *  dcos + dy * dsin) * scalex_div + cx;
-	dyy = (dx * -dsin + dy * dcos) * scaley_div + cy;
+	dx = -box->x - movx - cx;
+	dy = -box->y - movy - cy;
 
-	//
-
-	addxx = dcos * scalex_div;
-	addxy = -dsin * scaley_div;
-	addyx = dsin * scalex_div;
-	addyy = dcos * scaley_div;
+	param[0] = dcos * scalex_div;
+	param[1] = dsin * scalex_div;
+	param[2] = (dx *  dcos + dy * dsin) * scalex_div + cx;
+	param[3] = -dsin * scaley_div;
+	param[4] = dcos * scaley_div;
+	param[5] = (dx * -dsin + dy * dcos) * scaley_div + cy;
+	param[6] = param[7] = 0;
+	param[8] = 1;
+	param[9] = param[10] = 0;
 
-	//
-
-	mPopupProgressThreadSubStep_begin_onestep(prog, 50, rc.y2 - rc.y1 + 1);
-
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		dx = dxx;
-		dy = dyy;
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++, dx += addxx, dy += addxy)
-		{
-			if(TileImage_getColor_bicubic(src, dx, dy, sw, sh, &col))
-				(setpix)(dst, ix, iy, &col);
-		}
-
-		dxx += addyx;
-		dyy += addyy;
-
-		mPopupProgressThreadSubStep_inc(prog);
-	}
+	__TileImage_transform(dst, src, &rc, param, 0, 0, box->w, box->h, prog);
 }
 
 /** アフィン変換 + mPixbuf に合成 (プレビュー用)
@@ -1422,10 +1397,6 @@ void TileImage_transformHomography(TileImage *dst,TileImage *src,const mRect *rc
 	double *param,int sx,int sy,int sw,int sh,mPopupProgress *prog)
 {
 	mRect rc;
-	int ix,iy;
-	double dp_y,dx_y,dy_y,dx,dy,dp;
-	uint64_t col;
-	TileImageSetPixelFunc setpix = g_tileimage_dinfo.func_setpixel;
 
 	//描画可能範囲にクリッピング
 
@@ -1433,41 +1404,7 @@ void TileImage_transformHomography(TileImage *dst,TileImage *src,const mRect *rc
 
 	if(!TileImage_clipCanDrawRect(dst, &rc)) return;
 
-	//描画先左上のパラメータ
-
-	dx = rc.x1 - param[9];
-	dy = rc.y1 - param[10];
-
-	dp_y = dx * param[6] + dy * param[7] + param[8];
-	dx_y = dx * param[0] + dy * param[1] + param[2];
-	dy_y = dx * param[3] + dy * param[4] + param[5];
-
-	//
-
-	mPopupProgressThreadSubStep_begin_onestep(prog, 50, rc.y2 - rc.y1 + 1);
-
-	for(iy = rc.y1; iy <= rc.y2; iy++)
-	{
-		dp = dp_y;
-		dx = dx_y;
-		dy = dy_y;
-	
-		for(ix = rc.x1; ix <= rc.x2; ix++)
-		{
-			if(TileImage_getColor_bicubic(src, dx / dp - sx, dy / dp - sy, sw, sh, &col))
-				(setpix)(dst, ix, iy, &col);
-
-			dp += param[6];
-			dx += param[0];
-			dy += param[3];
-		}
-
-		dp_y += param[7];
-		dx_y += param[1];
-		dy_y += param[4];
-
-		mPopupProgressThreadSubStep_inc(prog);
-	}
+	__TileImage_transform(dst, src, &rc, param, sx, sy, sw, sh, prog);
 }
 
 /** 射影変換 + mPixbuf に合成 (プレビュー用)
@@ -28,6 +28,7 @@ $*/
 #include "mlk_widget_def.h"
 #include "mlk_popup_progress.h"
 #include "mlk_loadimage.h"
+#include "mlk_thread.h"
 #include "mlk_saveimage.h"
 #include "mlk_zlib.h"
 #include "mlk_stdio.h"
@@ -123,79 +124,103 @@ uint16_t *TileImage_create16fixto16_table(void)
 //===================================
 
 
-/* 8bit アルファ値無効処理 */
+/* 8bit アルファ値無効処理 (Y1行) */
 
-static void _loadimgbuf_convert_8bit(uint8_t **ppbuf,int width,int height)
+static void _loadimgbuf_convert_8bit(uint8_t *buf,int width)
 {
-	int ix,iy;
 	uint8_t *pd;
 
-	for(iy = height; iy; iy--, ppbuf++)
-	{
-		pd = *ppbuf + 3;
-
-		for(ix = width; ix; ix--, pd += 4)
-			*pd = 255;
-	}
+	for(pd = buf + 3; width; width--, pd += 4)
+		*pd = 255;
 }
 
-/* 8bit -> 16bit 処理 */
+/* 8bit -> 16bit 処理 (Y1行) */
 
-static void _loadimgbuf_convert_8to16(uint8_t **ppbuf,int width,int height,mlkbool ignore_alpha)
+static void _loadimgbuf_convert_8to16(uint8_t *buf,int width,uint16_t *tbl,mlkbool ignore_alpha)
 {
-	int ix,iy,right;
 	uint8_t *pd8;
-	uint16_t *pd16,*tbl,c[4];
+	uint16_t *pd16,c[4];
+	int right;
 
-	tbl = TileImage_create8to16fix_table();
-	if(!tbl) return;
+	//右端から処理
 
 	right = (width - 1) * 4;
 
-	for(iy = height; iy; iy--, ppbuf++)
+	pd8 = buf + right;
+	pd16 = (uint16_t *)buf + right;
+
+	for(; width; width--, pd8 -= 4, pd16 -= 4)
 	{
-		//右端から処理
-		pd8 = *ppbuf + right;
-		pd16 = (uint16_t *)*ppbuf + right;
+		c[0] = tbl[pd8[0]];
+		c[1] = tbl[pd8[1]];
+		c[2] = tbl[pd8[2]];
+		c[3] = tbl[(ignore_alpha)? 255: pd8[3]];
 
-		for(ix = width; ix; ix--, pd8 -= 4, pd16 -= 4)
-		{
-			c[0] = tbl[pd8[0]];
-			c[1] = tbl[pd8[1]];
-			c[2] = tbl[pd8[2]];
-			c[3] = tbl[(ignore_alpha)? 255: pd8[3]];
+		*((uint64_t *)pd16) = *((uint64_t *)c);
+	}
+}
 
-			*((uint64_t *)pd16) = *((uint64_t *)c);
-		}
+/* 16bit -> 16bit(固定小数15bit) 処理 (Y1行) */
+
+static void _loadimgbuf_convert_16to16(uint8_t *buf,int width,uint16_t *tbl,mlkbool ignore_alpha)
+{
+	uint16_t *pd;
+
+	for(pd = (uint16_t *)buf; width; width--, pd += 4)
+	{
+		pd[0] = tbl[pd[0]];
+		pd[1] = tbl[pd[1]];
+		pd[2] = tbl[pd[2]];
+		pd[3] = tbl[(ignore_alpha)? 0xffff: pd[3]];
 	}
+}
 
-	mFree(tbl);
+/* 読み込み時の変換用テーブルを作成
+ *
+ * return: NULL で、テーブルが必要ない (または確保失敗) */
+
+static uint16_t *_loadimgbuf_create_table(int srcbits)
+{
+	if(TILEIMGWORK->bits == 8)
+		return NULL;
+	else if(srcbits == 8)
+		return TileImage_create8to16fix_table();
+	else
+		return TileImage_create16to16fix_table();
 }
 
-/* 16bit -> 16bit(固定小数15bit) 処理 */
+/* 読み込まれたイメージの変換 (各行)
+ *
+ * tbl: _loadimgbuf_create_table() で作成したもの */
 
-static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,mlkbool ignore_alpha)
+static void _loadimgbuf_convert_rows(uint8_t **ppbuf,int width,int height,
+	int srcbits,mlkbool ignore_alpha,uint16_t *tbl)
 {
-	int ix,iy;
-	uint16_t *pd,*tbl;
+	if(TILEIMGWORK->bits == 8)
+	{
+		//8bit: "アルファ値無効"なしの場合は、何もしない
 
-	tbl = TileImage_create16to16fix_table();
-	if(!tbl) return;
+		if(!ignore_alpha) return;
 
-	for(iy = height; iy; iy--, ppbuf++)
+		for(; height; height--)
+			_loadimgbuf_convert_8bit(*(ppbuf++), width);
+	}
+	else if(!tbl)
+		return;
+	else if(srcbits == 8)
 	{
-		pd = (uint16_t *)*ppbuf;
+		//8bit -> 16bit(15fix)
 
-		for(ix = width; ix; ix--, pd += 4)
-		{
-			pd[0] = tbl[pd[0]];
-			pd[1] = tbl[pd[1]];
-			pd[2] = tbl[pd[2]];
-			pd[3] = tbl[(ignore_alpha)? 0xffff: pd[3]];
-		}
+		for(; height; height--)
+			_loadimgbuf_convert_8to16(*(ppbuf++), width, tbl, ignore_alpha);
 	}
+	else
+	{
+		//16bit -> 16bit(15fix)
 
-	mFree(tbl);
+		for(; height; height--)
+			_loadimgbuf_convert_16to16(*(ppbuf++), width, tbl, ignore_alpha);
+	}
 }
 
 /** 読み込まれた画像イメージの変換処理 (RGBA)
@@ -210,20 +235,13 @@ static void _loadimgbuf_convert_16to16(uint8_t **ppbuf,int width,int height,mlkb
 void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
 	int srcbits,mlkbool ignore_alpha)
 {
-	if(TILEIMGWORK->bits == 8)
-	{
-		//8bit: "アルファ値無効"なしの場合は、何もしない
+	uint16_t *tbl;
 
-		if(!ignore_alpha) return;
+	tbl = _loadimgbuf_create_table(srcbits);
 
-		_loadimgbuf_convert_8bit(ppbuf, width, height);
-	}
-	else if(srcbits == 8)
-		//8bit -> 16bit(15fix)
-		_loadimgbuf_convert_8to16(ppbuf, width, height, ignore_alpha);
-	else
-		//16bit -> 16bit(15fix)
-		_loadimgbuf_convert_16to16(ppbuf, width, height, ignore_alpha);
+	_loadimgbuf_convert_rows(ppbuf, width, height, srcbits, ignore_alpha, tbl);
+
+	mFree(tbl);
 }
 
 
@@ -232,6 +250,48 @@ void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
 //===========================================
 
 
+/* イメージからタイル 1 行分を変換
+ *
+ * ppsrc: タイル行の先頭 Y 位置のライン
+ * ty: タイルの Y 位置
+ * h: ソースの行数 (1-64) */
+
+static void _convert_tilerow(TileImage *p,uint8_t *tilebuf,uint8_t **ppsrc,int srcw,int ty,int h)
+{
+	uint8_t **ppdst;
+	int ix,xx,w;
+	TileImageColFunc_RGBAtoTile func_conv;
+	TileImageColFunc_isTransparentTile func_isempty;
+
+	ppdst = p->ppbuf + ty * p->tilew;
+
+	func_conv = TILEIMGWORK->colfunc[p->type].rgba_to_tile;
+	func_isempty = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
+
+	for(ix = p->tilew, xx = 0; ix; ix--, xx += 64, ppdst++)
+	{
+		w = 64;
+		if(xx + 64 > srcw) w = srcw - xx;
+
+		//64x64 でなければクリア
+
+		if(w != 64 || h != 64)
+			TileImage_clearTile(p, tilebuf);
+
+		//tilebuf に変換
+
+		(func_conv)(tilebuf, ppsrc, xx, w, h);
+
+		//すべて透明でなければ、確保してコピー
+
+		if(!(func_isempty)(tilebuf))
+		{
+			if(TileImage_allocTile_atptr(p, ppdst))
+				TileImage_copyTile(p, *ppdst, tilebuf);
+		}
+	}
+}
+
 /** イメージバッファから TileImage に変換 (RGBA)
  *
  * - RGBA -> TileImage の現在のタイプに変換される (RGBA/GRAY のみ)。
@@ -242,10 +302,8 @@ void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,
 void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,
 	mPopupProgress *prog,int prog_subnum)
 {
-	uint8_t **ppdst,*tilebuf;
-	int ix,iy,xx,yy,w,h;
-	TileImageColFunc_RGBAtoTile func_conv;
-	TileImageColFunc_isTransparentTile func_isempty;
+	uint8_t *tilebuf;
+	int iy,yy,h;
 
 	//作業用タイル
 
@@ -254,49 +312,21 @@ void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,
 
 	//
 
-	ppdst = p->ppbuf;
-
-	func_conv = TILEIMGWORK->colfunc[p->type].rgba_to_tile;
-	func_isempty = TILEIMGWORK->colfunc[p->type].is_transparent_tile;
-
-	mPopupProgressThreadSubStep_begin(prog, prog_subnum, p->tilew * p->tileh);
-
-	//
+	mPopupProgressThreadSubStep_begin(prog, prog_subnum, p->tileh);
 
-	for(iy = p->tileh, yy = 0; iy; iy--, yy += 64)
+	for(iy = 0, yy = 0; iy < p->tileh; iy++, yy += 64)
 	{
 		h = 64;
 		if(yy + 64 > srch) h = srch - yy;
-	
-		for(ix = p->tilew, xx = 0; ix; ix--, xx += 64, ppdst++)
-		{
-			w = 64;
-			if(xx + 64 > srcw) w = srcw - xx;
-
-			//64x64 でなければクリア
-
-			if(w != 64 || h != 64)
-				TileImage_clearTile(p, tilebuf);
-
-			//tilebuf に変換
 
-			(func_conv)(tilebuf, ppsrc, xx, w, h);
-
-			//すべて透明でなければ、確保してコピー
-
-			if(!(func_isempty)(tilebuf))
-			{
-				if(TileImage_allocTile_atptr(p, ppdst))
-					TileImage_copyTile(p, *ppdst, tilebuf);
-			}
-
-			mPopupProgressThreadSubStep_inc(prog);
-		}
+		_convert_tilerow(p, tilebuf, ppsrc, srcw, iy, h);
 
 		ppsrc += 64;
+
+		mPopupProgressThreadSubStep_inc(prog);
 	}
 
-	mFree(tilebuf);
+	TileImage_freeTile_buf(tilebuf);
 }
 
 /** ImageCanvas のバッファから TileImage に変換 (RGBA) */
@@ -313,6 +343,38 @@ void TileImage_convertFromCanvas(TileImage *p,ImageCanvas *src,mPopupProgress *p
 //===============================
 
 
+/*
+  - PNG/JPEG/TIFF/WEBP は、mLoadImage::putrow で Y1行ずつ受け取り、
+    64 行 (タイル 1 行分) ごとにタイルへ変換する。
+    画像全体のバッファは確保しない。
+  - 64 行のバッファを 2 つ用意し、一方にデコードしている間に、
+    もう一方をスレッドで変換する。
+*/
+
+#define _LOADROWS_BAND_H  64
+
+typedef struct
+{
+	mThread th;
+
+	TileImage *img;
+	mPopupProgress *prog;
+	uint16_t *table;	//ビット変換用テーブル (8bit 時は NULL)
+	uint8_t *buf,		//バンドのバッファ [2][64 行]
+		**pprow[2],		//各バンドの行のポインタ
+		*tilebuf;		//作業用タイル (変換スレッド用)
+	int width,
+		height,
+		srcbits,
+		ignore_alpha,
+		line_bytes,		//ソースの Y1行のバイト数
+		curband,		//読み込み中のバンド
+		conv_band,		//変換するバンド
+		conv_ty,		//変換するタイルの Y 位置
+		conv_h;			//変換する行数
+}_loadrows;
+
+
 /* mLoadImage 用進捗 (0-100) */
 
 static void _loadimg_progress(mLoadImage *p,int prog)
@@ -320,6 +382,215 @@ static void _loadimg_progress(mLoadImage *p,int prog)
 	mPopupProgressThreadSetPos((mPopupProgress *)p->param, prog);
 }
 
+/* [putrow] 進捗 (0-100) */
+
+static void _loadrows_progress(mLoadImage *li,int prog)
+{
+	mPopupProgressThreadSetPos(((_loadrows *)li->param)->prog, prog);
+}
+
+/* 1 バンドを変換 */
+
+static void _loadrows_convert(_loadrows *p)
+{
+	uint8_t **pprow = p->pprow[p->conv_band];
+
+	_loadimgbuf_convert_rows(pprow, p->width, p->conv_h,
+		p->srcbits, p->ignore_alpha, p->table);
+
+	_convert_tilerow(p->img, p->tilebuf, pprow, p->width, p->conv_ty, p->conv_h);
+}
+
+/* [スレッド] バンドの変換 */
+
+static void _loadrows_thread(mThread *th)
+{
+	_loadrows_convert((_loadrows *)th);
+}
+
+/* [putrow] Y1行を受け取る */
+
+static mlkerr _loadrows_putrow(mLoadImage *li,int y,uint8_t *buf)
+{
+	_loadrows *p = (_loadrows *)li->param;
+	int n;
+
+	n = y & (_LOADROWS_BAND_H - 1);
+
+	memcpy(p->pprow[p->curband][n], buf, p->line_bytes);
+
+	//バンドの最後の行
+
+	if(n == _LOADROWS_BAND_H - 1 || y == p->height - 1)
+	{
+		//前のバンドの変換が終わるまで待つ
+
+		mThreadWait((mThread *)p);
+
+		p->conv_band = p->curband;
+		p->conv_ty = y / _LOADROWS_BAND_H;
+		p->conv_h = n + 1;
+
+		//スレッドを開始できなければ、ここで変換
+
+		if(!mThreadRun((mThread *)p))
+			_loadrows_convert(p);
+
+		p->curband ^= 1;
+	}
+
+	return MLKERR_OK;
+}
+
+/* Y1行単位で読み込み */
+
+static mlkerr _load_rows(TileImage *img,mLoadImage *li,mLoadImageType *tp,
+	mlkbool ignore_alpha,mPopupProgress *prog)
+{
+	_loadrows *p;
+	int i,rowsize;
+	mlkerr ret = MLKERR_ALLOC;
+
+	p = (_loadrows *)mThreadNew(sizeof(_loadrows), _loadrows_thread, NULL);
+	if(!p) return MLKERR_ALLOC;
+
+	p->img = img;
+	p->prog = prog;
+	p->width = li->width;
+	p->height = li->height;
+	p->srcbits = li->bits_per_sample;
+	p->ignore_alpha = ignore_alpha;
+	p->line_bytes = mLoadImage_getLineBytes(li);
+
+	//バッファ
+	// :各行は、キャンバスのビット数の RGBA に変換できるサイズ
+
+	rowsize = li->width * (TILEIMGWORK->bits / 8) * 4;
+	if(rowsize < p->line_bytes) rowsize = p->line_bytes;
+
+	p->buf = (uint8_t *)mMalloc((mlksize)rowsize * _LOADROWS_BAND_H * 2);
+	p->pprow[0] = (uint8_t **)mMalloc(sizeof(void *) * _LOADROWS_BAND_H * 2);
+	p->tilebuf = TileImage_allocTile(img);
+
+	if(!p->buf || !p->pprow[0] || !p->tilebuf)
+		goto END;
+
+	p->pprow[1] = p->pprow[0] + _LOADROWS_BAND_H;
+
+	for(i = 0; i < _LOADROWS_BAND_H * 2; i++)
+		p->pprow[0][i] = p->buf + i * rowsize;
+
+	//ビット変換テーブル
+
+	if(TILEIMGWORK->bits == 16)
+	{
+		p->table = _loadimgbuf_create_table(p->srcbits);
+		if(!p->table) goto END;
+	}
+
+	//読み込み
+
+	li->putrow = _loadrows_putrow;
+	li->progress = _loadrows_progress;
+	li->param = p;
+
+	mPopupProgressThreadSetMax(prog, 100);
+
+	ret = (tp->getimage)(li);
+
+	//最後のバンドの変換が終わるまで待つ
+
+	mThreadWait((mThread *)p);
+
+END:
+	li->putrow = NULL;
+	li->progress = _loadimg_progress;
+	li->param = prog;
+
+	TileImage_freeTile_buf(p->tilebuf);
+	mFree(p->table);
+	mFree(p->pprow[0]);
+	mFree(p->buf);
+
+	mThreadDestroy((mThread *)p);
+
+	return ret;
+}
+
+/* 全体をバッファに読み込んでから変換 */
+
+static mlkerr _load_imgbuf(TileImage *img,mLoadImage *li,mLoadImageType *tp,
+	uint8_t **ppbuf,mlkbool ignore_alpha,mPopupProgress *prog)
+{
+	mlkerr ret;
+
+	li->progress = _loadimg_progress;
+	li->param = prog;
+
+	//読み込み用バッファ
+	// :キャンバスのビットに合わせる。
+
+	if(ppbuf)
+		li->imgbuf = ppbuf;
+	else if(!mLoadImage_allocImage(li, li->width * (TILEIMGWORK->bits / 8) * 4))
+	{
+		li->imgbuf = NULL;
+		return MLKERR_ALLOC;
+	}
+
+	//読み込み
+
+	mPopupProgressThreadSetMax(prog, 100 + 10);
+
+	ret = (tp->getimage)(li);
+
+	if(ret == MLKERR_OK)
+	{
+		//イメージの処理
+
+		TileImage_loadimgbuf_convert(li->imgbuf, li->width, li->height,
+			li->bits_per_sample, ignore_alpha);
+
+		//タイルイメージに変換
+
+		TileImage_convertFromImage(img,
+			li->imgbuf, li->width, li->height, prog, 10);
+	}
+
+	if(!ppbuf)
+		mLoadImage_freeImage(li);
+
+	li->imgbuf = NULL;
+
+	return ret;
+}
+
+/** 開いた状態の mLoadImage から読み込んで、TileImage に変換 (RGBA)
+ *
+ * - img は、画像のサイズで作成してあること。
+ * - PNG/JPEG/TIFF/WEBP は、64 行ずつタイルに変換するため、画像全体のバッファは使わない。
+ * - それ以外は、ppbuf に全体を読み込んでから変換する。
+ *   ppbuf が NULL の場合は確保する。
+ *   各ラインは、キャンバスのビット数で RGBA の幅分のサイズがあること。
+ * - li の progress, param は上書きされる。
+ *
+ * ignore_alpha: アルファチャンネル無効 (すべて完全不透明に) */
+
+mlkerr TileImage_loadFromLoadImage(TileImage *img,mLoadImage *li,mLoadImageType *tp,
+	uint8_t **ppbuf,mlkbool ignore_alpha,mPopupProgress *prog)
+{
+	switch(tp->format_tag)
+	{
+		case MLK_MAKE32_4('P','N','G',' '):
+		case MLK_MAKE32_4('J','P','E','G'):
+		case MLK_MAKE32_4('T','I','F','F'):
+		case MLK_MAKE32_4('W','E','B','P'):
+			return _load_rows(img, li, tp, ignore_alpha, prog);
+	}
+
+	return _load_imgbuf(img, li, tp, ppbuf, ignore_alpha, prog);
+}
+
 /** ファイルから画像読み込み
  *
  * dst_size: NULL 以外で、画像のサイズが入る */
@@ -357,8 +628,6 @@ mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format
 	ret = (tp.open)(&li);
 	if(ret) goto ERR;
 
-	mPopupProgressThreadSetMax(prog, 100 + 10);
-
 	//イメージ作成
 
 	img = TileImage_new(TILEIMAGE_COLTYPE_RGBA, li.width, li.height);
@@ -368,30 +637,15 @@ mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format
 		goto ERR;
 	}
 
-	//読み込み用バッファ
-	// :キャンバスのビットに合わせる。
+	//読み込み
 
-	if(!mLoadImage_allocImage(&li, li.width * (TILEIMGWORK->bits / 8) * 4))
+	ret = TileImage_loadFromLoadImage(img, &li, &tp, NULL, FALSE, prog);
+	if(ret)
 	{
-		ret = MLKERR_ALLOC;
+		TileImage_free(img);
 		goto ERR;
 	}
 
-	//読み込み
-
-	ret = (tp.getimage)(&li);
-	if(ret) goto ERR;
-
-	//イメージの処理
-
-	TileImage_loadimgbuf_convert(li.imgbuf, li.width, li.height,
-		li.bits_per_sample, FALSE);
-
-	//タイルイメージに変換
-
-	TileImage_convertFromImage(img,
-		li.imgbuf, li.width, li.height, prog, 10);
-
 	//
 
 	*ppdst = img;
@@ -407,8 +661,6 @@ mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format
 ERR:
 	(tp.close)(&li);
 
-	mLoadImage_freeImage(&li);
-
 	return ret;
 }
 
@@ -924,6 +1176,9 @@ void TileImage_converTile_APDv3(TileImage *p,uint8_t *dst,uint8_t *src)
 }
 
 /** (APDv4) イメージ保存時のタイル処理
+ *
+ * 同じ単色タイルが続く場合は、前回の変換結果をそのまま使う。
+ * (func では buf のタイルデータを変更しないこと)
  *
  * rc: イメージのあるpx範囲
  * buf: タイルサイズ + 4byte */
@@ -931,7 +1186,7 @@ void TileImage_converTile_APDv3(TileImage *p,uint8_t *dst,uint8_t *src)
 mlkerr TileImage_saveTiles_apd4(TileImage *p,mRect *rc,uint8_t *buf,
 	mlkerr (*func)(TileImage *p,void *param),void *param)
 {
-	uint8_t **pptile;
+	uint8_t **pptile,*lastsolid = NULL;
 	int ix,iy,tx,ty;
 	mlkerr ret;
 	TileImageColFunc_convert_forSave func_conv;
@@ -957,7 +1212,12 @@ mlkerr TileImage_saveTiles_apd4(TileImage *p,mRect *rc,uint8_t *buf,
 
 			//タイルデータ
 
-			(func_conv)(buf + 4, *pptile);
+			if(*pptile != lastsolid)
+			{
+				(func_conv)(buf + 4, *pptile);
+
+				lastsolid = (TileImage_pool_isSolid(*pptile))? *pptile: NULL;
+			}
 
 			//呼び出し
 
@@ -47,6 +47,20 @@ typedef struct
 	uint64_t coldst;	//描画先の色
 }_setpixelinfo;
 
+//タイル位置のキャッシュ
+typedef struct
+{
+	int tx,ty;
+	uint8_t *tile;		//NULL でタイル範囲外、または未確保
+}_tilecache;
+
+//水平方向に連続して描画する時のキャッシュ
+typedef struct
+{
+	_tilecache sel,
+		mask;
+}_spancache;
+
 //-------------------
 
 
@@ -143,13 +157,58 @@ static void _setpixeldraw_get_save_color(TileImage *p,int x,int y,
 	}
 }
 
+/* タイル位置のキャッシュを初期化 */
+
+static void _tilecache_init(_tilecache *p)
+{
+	p->tx = p->ty = INT32_MIN;
+	p->tile = NULL;
+}
+
+/* 色を取得 (タイル位置のキャッシュを使う)
+ *
+ * TileImage_getPixel() と同じ。
+ * 描画中に変化しないイメージに対して使う。 */
+
+static void _getpixel_cache(TileImage *p,int x,int y,_tilecache *cache,void *dst)
+{
+	int tx,ty;
+
+	if(!cache)
+	{
+		TileImage_getPixel(p, x, y, dst);
+		return;
+	}
+
+	//タイルが変わった時のみ再取得
+
+	TileImage_pixel_to_tile_nojudge(p, x, y, &tx, &ty);
+
+	if(tx != cache->tx || ty != cache->ty)
+	{
+		cache->tx = tx;
+		cache->ty = ty;
+
+		if(tx >= 0 && tx < p->tilew && ty >= 0 && ty < p->tileh)
+			cache->tile = TILEIMAGE_GETTILE_PT(p, tx, ty);
+		else
+			cache->tile = NULL;
+	}
+
+	if(cache->tile)
+		(TILEIMGWORK->colfunc[p->type].getpixel_at_tile)(p, cache->tile, x, y, dst);
+	else
+		(TILEIMGWORK->setcol_rgba_transparent)(dst);
+}
+
 /* 描画先の情報取得 + マスク処理
  *
  * coldraw: 描画色。テクスチャが適用されて返る。
+ * cache: 連続描画時のキャッシュ (NULL でなし)
  * return: 0 以外で描画しない */
 
-static int _setpixeldraw_dstpixel(TileImage *p,int x,int y,void *coldraw,
-	_setpixelinfo *dst)
+static int _setpixeldraw_dstpixel_cache(TileImage *p,int x,int y,void *coldraw,
+	_setpixelinfo *dst,_spancache *cache)
 {
 	TileImageDrawInfo *dinfo = &g_tileimage_dinfo;
 	uint8_t **pptile;
@@ -160,18 +219,22 @@ static int _setpixeldraw_dstpixel(TileImage *p,int x,int y,void *coldraw,
 
 	if(dinfo->err) return 1;
 
+	bits = TILEIMGWORK->bits;
+
 	//選択範囲 (点がない場合は描画しない)
 
 	if(dinfo->img_sel)
 	{
-		if(TileImage_isPixel_transparent(dinfo->img_sel, x, y))
-			return 1;
-	}
+		_getpixel_cache(dinfo->img_sel, x, y, (cache)? &cache->sel: NULL, &col);
 
-	//
+		if(bits == 8)
+			n = *((uint8_t *)&col + 3);
+		else
+			n = *((uint16_t *)&col + 3);
+
+		if(n == 0) return 1;
+	}
 
-	bits = TILEIMGWORK->bits;
-	
 	//テクスチャ適用
 	//[!] 色を上書きする場合は、透明時も色をセットしなければならないため、
 	//    テクスチャの値が 0 でも処理を続ける。
@@ -197,7 +260,7 @@ static int _setpixeldraw_dstpixel(TileImage *p,int x,int y,void *coldraw,
 		maska = (bits == 8)? 255: 0x8000;
 	else
 	{
-		TileImage_getPixel(dinfo->img_mask, x, y, &col);
+		_getpixel_cache(dinfo->img_mask, x, y, (cache)? &cache->mask: NULL, &col);
 
 		if(bits == 8)
 			maska = *((uint8_t *)&col + 3);
@@ -280,9 +343,17 @@ static int _setpixeldraw_dstpixel(TileImage *p,int x,int y,void *coldraw,
 	return 0;
 }
 
+/* 描画先の情報取得 + マスク処理 (1点のみ) */
+
+static int _setpixeldraw_dstpixel(TileImage *p,int x,int y,void *coldraw,
+	_setpixelinfo *dst)
+{
+	return _setpixeldraw_dstpixel_cache(p, x, y, coldraw, dst, NULL);
+}
+
 /* 描画前のタイル関連処理
  *
- * [タイル作成][タイル配列リサイズ][アンドゥ用イメージコピー]
+ * [タイル作成][タイル配列リサイズ][アンドゥ用イメージ保存][共有タイルの複製]
  * 
  * これが終了した時点で、エラー時を除き、info->pptile には必ず NULL 以外が入る。
  * 
@@ -335,7 +406,7 @@ static mlkbool _setpixeldraw_tile(TileImage *p,int x,int y,_setpixelinfo *info)
 		is_empty_tile = TRUE;  //描画前は空のタイル
 	}
 
-	//imgsave に元イメージをコピー
+	//imgsave に元イメージを保存
 
 	pptmp = TILEIMAGE_GETTILE_BUFPT(img_save, tx, ty);
 
@@ -346,15 +417,19 @@ static mlkbool _setpixeldraw_tile(TileImage *p,int x,int y,_setpixelinfo *info)
 			*pptmp = TILEIMAGE_TILE_EMPTY;
 		else
 		{
-			//確保 & コピー
+			//タイルを共有 (描画先は、この後複製される)
 
-			*pptmp = TileImage_allocTile(img_save);
-			if(!(*pptmp)) return FALSE;
-		
-			TileImage_copyTile(img_save, *pptmp, *pptile);
+			TileImage_pool_addRef(*pptile);
+
+			*pptmp = *pptile;
 		}
 	}
 
+	//描画先のタイルが共有されている場合は複製
+
+	if(!TileImage_unshareTile(p, pptile))
+		return FALSE;
+
 	//描画先タイル情報
 
 	info->pptile = pptile;
@@ -662,6 +737,34 @@ static void _getcolor_blur_16bit(TileImage *p,int x,int y,int range,void *dstcol
  */
 
 
+/** 複数スレッドで描画する前の準備
+ *
+ * 描画中に、タイル配列のリサイズと rcdraw への範囲追加が起こらないようにする。
+ * 以降、各スレッドがそれぞれ異なるタイルに描画する場合は、ロックなしで描画できる。
+ *
+ * rc: 描画する範囲 (キャンバス範囲内であること) */
+
+mlkbool TileImage_setPixel_beginThread(TileImage *p,const mRect *rc)
+{
+	TileImageDrawInfo *dinfo = &g_tileimage_dinfo;
+
+	//キャンバス範囲を含むようにリサイズ
+
+	if(!TileImage_resizeTileBuf_includeCanvas(p)
+		|| !__TileImage_resizeTileBuf_clone(dinfo->img_save, p))
+		return FALSE;
+
+	if(dinfo->img_brush_stroke
+		&& !__TileImage_resizeTileBuf_clone(dinfo->img_brush_stroke, p))
+		return FALSE;
+
+	//描画範囲
+
+	mRectUnion(&dinfo->rcdraw, rc);
+
+	return TRUE;
+}
+
 /** 直接描画で色セット */
 
 void TileImage_setPixel_draw_direct(TileImage *p,int x,int y,void *colbuf)
@@ -716,11 +819,11 @@ void TileImage_setPixel_draw_dot_stroke(TileImage *p,int x,int y,void *colbuf)
 	_setpixeldraw_setcolor(p, x, y, &colres, &info);
 }
 
-/** ストローク重ね塗り描画 (ブラシ用)
+/* ストローク重ね塗り描画 (ブラシ用)
  *
- * ストローク中の最大濃度を記録するための作業用イメージが必要。 */
+ * cache: 連続描画時のキャッシュ (NULL でなし) */
 
-void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf)
+static void _setpixel_brush_stroke(TileImage *p,int x,int y,void *colbuf,_spancache *cache)
 {
 	TileImage *img_stroke = g_tileimage_dinfo.img_brush_stroke;
 	uint8_t **pptile,*tilebuf,*buf;
@@ -733,7 +836,7 @@ void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf)
 
 	(TILEIMGWORK->copy_color)(&colsrc, colbuf);
 
-	if(_setpixeldraw_dstpixel(p, x, y, &colsrc, &info))
+	if(_setpixeldraw_dstpixel_cache(p, x, y, &colsrc, &info, cache))
 		return;
 
 	//濃度用イメージから、ストローク中の現在濃度を取得
@@ -832,6 +935,66 @@ void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf)
 	}
 }
 
+/** ストローク重ね塗り描画 (ブラシ用)
+ *
+ * ストローク中の最大濃度を記録するための作業用イメージが必要。 */
+
+void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf)
+{
+	_setpixel_brush_stroke(p, x, y, colbuf, NULL);
+}
+
+/** 水平方向に連続した点を描画
+ *
+ * 各点で、アルファ値のみ異なる色を g_tileimage_dinfo.func_setpixel で描画するのと同じ結果になる。
+ * ブラシのストローク重ね塗り時は、選択範囲とマスクのタイルを、タイルが変わる時のみ取得する。
+ *
+ * drawcol: 描画色 (アルファ値は置き換わる)
+ * alpha: 各点のアルファ値。負の値で点を描画しない。0 の場合、色はすべて 0 とする。 */
+
+void TileImage_setPixel_span(TileImage *p,int x,int y,int num,void *drawcol,const int *alpha)
+{
+	TileImageSetPixelFunc setpix;
+	_spancache cache;
+	uint64_t col0 = 0;
+	int a,bits;
+	mlkbool fbrush;
+
+	setpix = g_tileimage_dinfo.func_setpixel;
+	bits = TILEIMGWORK->bits;
+
+	//描画先が選択範囲やマスクのイメージの場合、描画中にタイルが変わるため、キャッシュしない
+
+	fbrush = (setpix == TileImage_setPixel_draw_brush_stroke
+		&& g_tileimage_dinfo.img_sel != p
+		&& g_tileimage_dinfo.img_mask != p);
+
+	if(fbrush)
+	{
+		_tilecache_init(&cache.sel);
+		_tilecache_init(&cache.mask);
+	}
+
+	for(; num > 0; num--, x++, alpha++)
+	{
+		a = *alpha;
+		if(a < 0) continue;
+
+		if(a)
+		{
+			if(bits == 8)
+				*((uint8_t *)drawcol + 3) = a;
+			else
+				*((uint16_t *)drawcol + 3) = a;
+		}
+
+		if(fbrush)
+			_setpixel_brush_stroke(p, x, y, (a)? drawcol: (void *)&col0, &cache);
+		else
+			(setpix)(p, x, y, (a)? drawcol: (void *)&col0);
+	}
+}
+
 /** ドットペン形状を使って、直接描画 */
 
 void TileImage_setPixel_draw_dotpen_direct(TileImage *p,int x,int y,void *pix)
@@ -1101,11 +1264,8 @@ void TileImage_setPixel_work(TileImage *p,int x,int y,void *pix)
 
 	pptile = TILEIMAGE_GETTILE_BUFPT(p, tx, ty);
 
-	if(!(*pptile))
-	{
-		*pptile = TileImage_allocTile_clear(p);
-		if(!(*pptile)) return;
-	}
+	if(!TileImage_allocTile_atptr_clear(p, pptile))
+		return;
 
 	//セット
 
@@ -1160,11 +1320,8 @@ void TileImage_setPixel_nolimit(TileImage *p,int x,int y,void *pix)
 
 	pptile = TILEIMAGE_GETTILE_BUFPT(p, tx, ty);
 
-	if(!(*pptile))
-	{
-		*pptile = TileImage_allocTile_clear(p);
-		if(!(*pptile)) return;
-	}
+	if(!TileImage_allocTile_atptr_clear(p, pptile))
+		return;
 
 	//セット
 
@@ -1183,7 +1340,7 @@ void TileImage_setPixel_nolimit(TileImage *p,int x,int y,void *pix)
 //================================
 
 
-/** 指定位置のピクセルバッファ位置取得
+/** 指定位置のピクセルバッファ位置取得 (書き込み用)
  *
  * その位置にタイルがない場合は作成する。ただし、タイル配列の拡張は行わない。
  *
@@ -1199,15 +1356,12 @@ uint8_t *__TileImage_getPixelBuf_new(TileImage *p,int x,int y)
 	if(!TileImage_pixel_to_tile(p, x, y, &tx, &ty))
 		return NULL;
 
-	//タイルがない場合は確保
+	//タイルがない場合は確保 (共有されている場合は複製)
 
 	pp = TILEIMAGE_GETTILE_BUFPT(p, tx, ty);
 
-	if(!(*pp))
-	{
-		*pp = TileImage_allocTile_clear(p);
-		if(!(*pp)) return NULL;
-	}
+	if(!TileImage_allocTile_atptr_clear(p, pp))
+		return NULL;
 
 	//ピクセルのバッファ位置
 
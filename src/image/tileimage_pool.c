@@ -0,0 +1,748 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/**********************************
+ * TileImage: タイルのメモリプール
+ **********************************/
+
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "mlk.h"
+#include "mlk_rectbox.h"
+#include "mlk_thread.h"
+#include "mlk_file.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+
+#include "pv_tileimage.h"
+
+
+/*
+  - タイルは、サイズごとに複数個まとめて確保したブロック (スラブ) から割り当てる。
+  - スラブは [_slab] + ([ヘッダ 16byte] + [タイル]) x N。
+    タイルの直前のヘッダに、所属するスラブのポインタが入っている。
+    (解放時にサイズを指定しなくて良いように)
+  - 空きタイルは、タイルの先頭に次の空きタイルのポインタを入れて、リストにする。
+  - スラブは、サイズごとに、空きのあるものと空きのないものに分けてリストでつなぐ。
+  - すべてのタイルが解放されたスラブは、サイズごとに 1 つだけ残して、他は解放する。
+    (レイヤ削除時などに、まとめてメモリが返される)
+  - タイルは複数のスレッドで確保/解放されるため、mutex で排他する。
+  - ヘッダには参照カウントも入っている。
+    イメージの複製時はタイルを共有して参照カウントを増やし、
+    書き込む前に、共有されていれば複製する (TileImage_unshareTile)。
+    参照カウントはアトミックに操作し、0 になった時にプールに返す。
+  - すべてのピクセルが同じ値のタイル (単色タイル) は、
+    サイズ・ピクセルのバイト数・値ごとに一つだけ残して、各イメージで共有する。
+    単色タイルは常に共有中として扱われるため、書き込み時は必ず複製される。
+    単色タイルの検索と、参照カウントが 0 になった時の削除は mutex 内で行う。
+  - スワップファイルが設定されている場合、メモリ上のスラブの合計が上限を超えると、
+    以降のスラブは、スワップファイルをマップしたメモリ (セグメント) から確保する。
+    使われていないページは OS によってファイルに書き出され、参照時に読み込まれるので、
+    タイルを扱う側は、通常のメモリと同じように扱える。
+  - スワップファイルは、作成後すぐに削除する (異常終了時に残らないように)。
+    セグメントは _SWAP_SEGSIZE 単位でマップし、終了時までマップしたままにする。
+    解放されたスワップ上のスラブは、サイズごとの空きリストに入れて再利用する。
+*/
+
+//---------------------
+
+#define _HEADSIZE    16			//タイルのヘッダサイズ
+#define _SLAB_SIZE   (256 * 1024)	//スラブの最小サイズの目安
+#define _SLAB_MINNUM 4			//スラブ内の最小タイル数
+#define _CLASS_MAX   8			//サイズの種類の最大数
+
+#define _HEAD_SLAB(buf)    (*((_slab **)((buf) - _HEADSIZE)))		//所属するスラブ
+#define _HEAD_REFCNT(buf)  (*((int32_t *)((buf) - _HEADSIZE + 8)))	//参照カウント
+#define _HEAD_SOLID(buf)   (*((int32_t *)((buf) - _HEADSIZE + 12)))	//単色タイルのピクセルのバイト数 (0 で通常)
+
+#define _SOLID_HASHNUM  64	//単色タイルのハッシュテーブルの数
+
+#define _SWAP_SEGSIZE   (64 * 1024 * 1024)	//スワップファイルをマップする単位
+#define _SWAP_SEGHEAD   16					//セグメントのヘッダサイズ (次のセグメント)
+
+typedef struct _slab _slab;
+typedef struct _sizeclass _sizeclass;
+typedef struct _solid _solid;
+
+struct _slab
+{
+	_slab *prev,*next;	//スラブのリスト (空きあり or 空きなし)
+	_sizeclass *cls;
+	uint8_t *freetop;	//空きタイルの先頭
+	int used;			//使用中のタイル数
+	mlkbool fswap;		//スワップファイル上のスラブ
+};
+
+struct _sizeclass
+{
+	_slab *top,			//空きのあるスラブ
+		*full;			//空きのないスラブ
+	int size,			//タイルサイズ
+		tilenum,		//スラブ内のタイル数
+		emptynum;		//すべて空きのスラブの数
+	uint32_t slabsize;	//スラブのバイト数
+	uint8_t *swapfree;	//スワップファイル上の空きスラブ (先頭に次のポインタ)
+};
+
+struct _solid
+{
+	_solid *next;
+	uint8_t *buf;		//単色タイル
+	uint64_t col;		//ピクセルの値
+	int size,			//タイルサイズ
+		pixbytes;		//ピクセルのバイト数
+};
+
+typedef struct
+{
+	mThreadMutex mutex;
+	_sizeclass cls[_CLASS_MAX];
+	int clsnum;
+
+	_solid *solid[_SOLID_HASHNUM];	//単色タイル
+
+	char *swapfile;		//スワップファイル名 (NULL でなし)
+	mFile swapfd;		//スワップファイル (-1 で未作成)
+	uint64_t rambudget,	//メモリ上のスラブの上限 (0 でスワップしない)
+		swapfilesize;	//スワップファイルのサイズ
+	uint8_t *seg,		//マップしたセグメントのリスト
+		*segcur;		//現在のセグメントの未使用位置
+	uint32_t segremain;	//現在のセグメントの残りサイズ
+
+	TileImagePoolInfo info;
+}_tilepool;
+
+static _tilepool g_tilepool = {0};
+
+#define _SLAB_HEADSIZE  ((sizeof(_slab) + 15) & ~15)
+
+//---------------------
+
+
+/* サイズのクラスを取得 (なければ追加) */
+
+static _sizeclass *_get_class(_tilepool *p,int size)
+{
+	_sizeclass *cls;
+	int i;
+
+	cls = p->cls;
+
+	for(i = p->clsnum; i; i--, cls++)
+	{
+		if(cls->size == size) return cls;
+	}
+
+	//追加
+
+	if(p->clsnum == _CLASS_MAX) return NULL;
+
+	cls = p->cls + p->clsnum;
+	p->clsnum++;
+
+	cls->size = size;
+	cls->tilenum = _SLAB_SIZE / (size + _HEADSIZE);
+
+	if(cls->tilenum < _SLAB_MINNUM)
+		cls->tilenum = _SLAB_MINNUM;
+
+	cls->slabsize = _SLAB_HEADSIZE + (uint32_t)(size + _HEADSIZE) * cls->tilenum;
+
+	return cls;
+}
+
+/* リストにスラブを追加 */
+
+static void _link_slab(_slab **pptop,_slab *slab)
+{
+	slab->prev = NULL;
+	slab->next = *pptop;
+
+	if(*pptop) (*pptop)->prev = slab;
+
+	*pptop = slab;
+}
+
+/* リストからスラブを外す */
+
+static void _unlink_slab(_slab **pptop,_slab *slab)
+{
+	if(slab->prev)
+		slab->prev->next = slab->next;
+	else
+		*pptop = slab->next;
+
+	if(slab->next)
+		slab->next->prev = slab->prev;
+
+	slab->prev = slab->next = NULL;
+}
+
+/* スワップファイルのセグメントを新規マップ */
+
+static mlkbool _map_segment(_tilepool *p)
+{
+	uint8_t *buf;
+
+	//ファイル作成
+	// :開いた後、すぐに削除する
+
+	if(p->swapfd == -1)
+	{
+		if(mFileOpen_temp(&p->swapfd, p->swapfile) != MLKERR_OK)
+		{
+			p->swapfd = -1;
+			return FALSE;
+		}
+
+		mDeleteFile(p->swapfile);
+	}
+
+	//ディスク領域を確保
+	// :容量不足時に、ページの書き出しで SIGBUS にならないように
+
+	if(posix_fallocate(p->swapfd, p->swapfilesize, _SWAP_SEGSIZE))
+		return FALSE;
+
+	//マップ
+
+	buf = (uint8_t *)mmap(NULL, _SWAP_SEGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED,
+		p->swapfd, p->swapfilesize);
+
+	//失敗時、確保した領域は次回に再度使われる
+
+	if(buf == MAP_FAILED) return FALSE;
+
+	p->swapfilesize += _SWAP_SEGSIZE;
+
+	//リストに追加
+
+	*((uint8_t **)buf) = p->seg;
+	p->seg = buf;
+
+	p->segcur = buf + _SWAP_SEGHEAD;
+	p->segremain = _SWAP_SEGSIZE - _SWAP_SEGHEAD;
+
+	return TRUE;
+}
+
+/* スワップファイル上にスラブのメモリを確保 */
+
+static uint8_t *_alloc_swap(_tilepool *p,_sizeclass *cls)
+{
+	uint8_t *buf;
+
+	//空きスラブを再利用
+
+	if(cls->swapfree)
+	{
+		buf = cls->swapfree;
+		cls->swapfree = *((uint8_t **)buf);
+
+		return buf;
+	}
+
+	//現在のセグメントから切り出す
+	// :残りが足りない場合、残りは使わずに新しいセグメントへ
+
+	if(p->segremain < cls->slabsize)
+	{
+		if(!_map_segment(p)) return NULL;
+	}
+
+	buf = p->segcur;
+
+	p->segcur += cls->slabsize;
+	p->segremain -= cls->slabsize;
+
+	return buf;
+}
+
+/* スラブを新規作成 */
+
+static _slab *_create_slab(_tilepool *p,_sizeclass *cls)
+{
+	_slab *slab = NULL;
+	uint8_t *pd,*next;
+	int i,step;
+	mlkbool fswap = FALSE;
+
+	//メモリ上のスラブが上限を超える場合、スワップファイル上に確保
+	// :失敗時はメモリ上に確保
+
+	if(p->swapfile && p->rambudget
+		&& p->info.poolsize - p->info.swapsize + cls->slabsize > p->rambudget)
+	{
+		slab = (_slab *)_alloc_swap(p, cls);
+		fswap = (slab != NULL);
+	}
+
+	if(!slab)
+	{
+		slab = (_slab *)mMallocAlign(cls->slabsize, 16);
+		if(!slab) return NULL;
+	}
+
+	slab->cls = cls;
+	slab->used = 0;
+	slab->fswap = fswap;
+
+	//空きリスト (後ろからつなげる)
+
+	step = cls->size + _HEADSIZE;
+	pd = (uint8_t *)slab + _SLAB_HEADSIZE + _HEADSIZE + step * (cls->tilenum - 1);
+	next = NULL;
+
+	for(i = cls->tilenum; i; i--, pd -= step)
+	{
+		_HEAD_SLAB(pd) = slab;
+		*((uint8_t **)pd) = next;
+
+		next = pd;
+	}
+
+	slab->freetop = next;
+
+	//
+
+	_link_slab(&cls->top, slab);
+
+	cls->emptynum++;
+
+	p->info.slabnum++;
+	p->info.poolsize += cls->slabsize;
+
+	if(fswap)
+		p->info.swapsize += cls->slabsize;
+
+	return slab;
+}
+
+/* スラブを解放 */
+
+static void _free_slab(_tilepool *p,_slab *slab)
+{
+	_sizeclass *cls = slab->cls;
+
+	//空きがなければ、空きなしのリストにある
+
+	_unlink_slab((slab->freetop)? &cls->top: &cls->full, slab);
+
+	p->info.slabnum--;
+	p->info.poolsize -= cls->slabsize;
+
+	//スワップ上のスラブは空きリストへ
+
+	if(slab->fswap)
+	{
+		p->info.swapsize -= cls->slabsize;
+
+		*((uint8_t **)slab) = cls->swapfree;
+		cls->swapfree = (uint8_t *)slab;
+	}
+	else
+		mFree(slab);
+}
+
+/* タイルを空きリストに戻す (mutex 内) */
+
+static void _release_buf(_tilepool *p,uint8_t *buf)
+{
+	_slab *slab;
+	_sizeclass *cls;
+
+	slab = _HEAD_SLAB(buf);
+	cls = slab->cls;
+
+	//空きリストに追加
+
+	*((uint8_t **)buf) = slab->freetop;
+
+	if(!slab->freetop)
+	{
+		_unlink_slab(&cls->full, slab);
+		_link_slab(&cls->top, slab);
+	}
+
+	slab->freetop = buf;
+
+	//すべて空きになった場合、
+	//すでに空のスラブがあれば解放
+
+	if(--slab->used == 0)
+	{
+		if(cls->emptynum)
+			_free_slab(p, slab);
+		else
+			cls->emptynum++;
+	}
+
+	//情報
+
+	p->info.tilenum--;
+	p->info.usedsize -= cls->size;
+}
+
+/* 単色タイルのピクセル値を取得 */
+
+static uint64_t _get_solid_col(uint8_t *buf,int pixbytes)
+{
+	uint64_t col = 0;
+
+	memcpy(&col, buf, pixbytes);
+
+	return col;
+}
+
+/* 単色タイルのハッシュ値 */
+
+static int _get_solid_hash(uint64_t col,int size)
+{
+	return (int)(((col ^ size) * 0x9E3779B97F4A7C15ULL) >> 58);
+}
+
+/* 単色タイルをテーブルから削除 (mutex 内) */
+
+static void _remove_solid(_tilepool *p,uint8_t *buf)
+{
+	_solid **pp,*ps;
+	int pixbytes;
+
+	pixbytes = _HEAD_SOLID(buf);
+
+	pp = p->solid + _get_solid_hash(_get_solid_col(buf, pixbytes), _HEAD_SLAB(buf)->cls->size);
+
+	for(; *pp; pp = &ps->next)
+	{
+		ps = *pp;
+
+		if(ps->buf == buf)
+		{
+			*pp = ps->next;
+			mFree(ps);
+
+			p->info.solidnum--;
+			break;
+		}
+	}
+
+	_HEAD_SOLID(buf) = 0;
+}
+
+
+//==========================
+// main
+//==========================
+
+
+/** 初期化 */
+
+mlkbool __TileImage_pool_init(void)
+{
+	g_tilepool.swapfd = -1;
+	g_tilepool.mutex = mThreadMutexNew();
+
+	return (g_tilepool.mutex != NULL);
+}
+
+/** 終了時 (すべてのスラブを解放) */
+
+void __TileImage_pool_finish(void)
+{
+	_tilepool *p = &g_tilepool;
+	_sizeclass *cls;
+	_solid *ps,*next;
+	uint8_t *seg,*segnext;
+	int i;
+
+	for(i = 0; i < _SOLID_HASHNUM; i++)
+	{
+		for(ps = p->solid[i]; ps; ps = next)
+		{
+			next = ps->next;
+			mFree(ps);
+		}
+	}
+
+	for(i = 0, cls = p->cls; i < p->clsnum; i++, cls++)
+	{
+		while(cls->top)
+			_free_slab(p, cls->top);
+
+		while(cls->full)
+			_free_slab(p, cls->full);
+	}
+
+	//スワップファイル
+
+	for(seg = p->seg; seg; seg = segnext)
+	{
+		segnext = *((uint8_t **)seg);
+		munmap(seg, _SWAP_SEGSIZE);
+	}
+
+	if(p->swapfd != -1)
+		mFileClose(p->swapfd);
+
+	mFree(p->swapfile);
+
+	mThreadMutexDestroy(p->mutex);
+
+	mMemset0(p, sizeof(_tilepool));
+}
+
+/** スワップファイルを設定
+ *
+ * メモリ上のスラブの合計が budget を超える場合、
+ * 以降のスラブは、スワップファイルをマップしたメモリから確保する。
+ * スワップファイルはスラブが必要になった時に作成され、作成後すぐに削除される。
+ * 作成後はファイル名は変更されない。
+ *
+ * filename: スワップファイル名 (NULL でなし)
+ * budget: メモリ上のスラブの上限 (バイト数。0 でスワップしない) */
+
+void TileImage_pool_setSwap(const char *filename,uint64_t budget)
+{
+	_tilepool *p = &g_tilepool;
+
+	mThreadMutexLock(p->mutex);
+
+	if(p->swapfd == -1)
+	{
+		mFree(p->swapfile);
+		p->swapfile = (filename)? mStrdup(filename): NULL;
+	}
+
+	p->rambudget = budget;
+
+	mThreadMutexUnlock(p->mutex);
+}
+
+/** プールからバッファを確保
+ *
+ * size: 16 の倍数であること
+ * return: 16 byte 境界のバッファ */
+
+uint8_t *TileImage_pool_alloc(int size)
+{
+	_tilepool *p = &g_tilepool;
+	_sizeclass *cls;
+	_slab *slab;
+	uint8_t *buf = NULL;
+
+	mThreadMutexLock(p->mutex);
+
+	cls = _get_class(p, size);
+	if(!cls) goto END;
+
+	//空きのあるスラブ
+
+	slab = cls->top;
+
+	if(!slab)
+	{
+		slab = _create_slab(p, cls);
+		if(!slab) goto END;
+	}
+
+	//取り出し
+
+	buf = slab->freetop;
+
+	slab->freetop = *((uint8_t **)buf);
+
+	if(slab->used++ == 0)
+		cls->emptynum--;
+
+	if(!slab->freetop)
+	{
+		_unlink_slab(&cls->top, slab);
+		_link_slab(&cls->full, slab);
+	}
+
+	_HEAD_REFCNT(buf) = 1;
+	_HEAD_SOLID(buf) = 0;
+
+	//情報
+
+	p->info.tilenum++;
+	p->info.usedsize += size;
+
+	if(p->info.usedsize > p->info.maxsize)
+		p->info.maxsize = p->info.usedsize;
+
+END:
+	mThreadMutexUnlock(p->mutex);
+
+	return buf;
+}
+
+/** バッファの参照カウントを減らし、0 になったらプールに返す
+ *
+ * buf: TileImage_pool_alloc() で確保したもの。NULL で何もしない。 */
+
+void TileImage_pool_release(uint8_t *buf)
+{
+	_tilepool *p = &g_tilepool;
+
+	if(!buf) return;
+
+	//単色タイル
+	// :検索時に参照が増やされるため、mutex 内で減らす
+
+	if(_HEAD_SOLID(buf))
+	{
+		mThreadMutexLock(p->mutex);
+
+		if(__atomic_sub_fetch(&_HEAD_REFCNT(buf), 1, __ATOMIC_ACQ_REL) == 0)
+		{
+			_remove_solid(p, buf);
+			_release_buf(p, buf);
+		}
+
+		mThreadMutexUnlock(p->mutex);
+		return;
+	}
+
+	//他で共有されている
+
+	if(__atomic_sub_fetch(&_HEAD_REFCNT(buf), 1, __ATOMIC_ACQ_REL))
+		return;
+
+	mThreadMutexLock(p->mutex);
+
+	_release_buf(p, buf);
+
+	mThreadMutexUnlock(p->mutex);
+}
+
+/** バッファの参照カウントを増やす (共有する) */
+
+void TileImage_pool_addRef(uint8_t *buf)
+{
+	__atomic_add_fetch(&_HEAD_REFCNT(buf), 1, __ATOMIC_RELAXED);
+}
+
+/** バッファが共有されているか
+ *
+ * 単色タイルは、常に共有中とする。 */
+
+mlkbool TileImage_pool_isShared(uint8_t *buf)
+{
+	return (_HEAD_SOLID(buf)
+		|| __atomic_load_n(&_HEAD_REFCNT(buf), __ATOMIC_ACQUIRE) > 1);
+}
+
+/** 単色タイルか */
+
+mlkbool TileImage_pool_isSolid(uint8_t *buf)
+{
+	return (_HEAD_SOLID(buf) != 0);
+}
+
+/** 単色のバッファを、共有の単色タイルにする
+ *
+ * 同じ値の単色タイルがすでにあれば、その参照を増やして返し、buf は解放される。
+ * なければ buf を単色タイルとして登録する。
+ * buf が他と共有されている場合 (単色タイル以外) は、登録しない。
+ *
+ * buf: すべてのピクセルが同じ値であること
+ * pixbytes: 1 ピクセルのバイト数 (1,2,4,8)
+ * return: buf の代わりに使うバッファ */
+
+uint8_t *TileImage_pool_toSolid(uint8_t *buf,int pixbytes)
+{
+	_tilepool *p = &g_tilepool;
+	_solid *ps;
+	uint8_t *ret = buf;
+	uint64_t col;
+	int size,hash;
+
+	size = _HEAD_SLAB(buf)->cls->size;
+	col = _get_solid_col(buf, pixbytes);
+	hash = _get_solid_hash(col, size);
+
+	mThreadMutexLock(p->mutex);
+
+	//検索
+
+	for(ps = p->solid[hash]; ps; ps = ps->next)
+	{
+		if(ps->col == col && ps->size == size && ps->pixbytes == pixbytes)
+			break;
+	}
+
+	if(ps)
+	{
+		//既存のタイルを共有
+
+		if(ps->buf != buf)
+		{
+			__atomic_add_fetch(&_HEAD_REFCNT(ps->buf), 1, __ATOMIC_RELAXED);
+
+			ret = ps->buf;
+		}
+	}
+	else if(__atomic_load_n(&_HEAD_REFCNT(buf), __ATOMIC_ACQUIRE) == 1)
+	{
+		//新規登録
+
+		ps = (_solid *)mMalloc(sizeof(_solid));
+
+		if(ps)
+		{
+			ps->buf = buf;
+			ps->col = col;
+			ps->size = size;
+			ps->pixbytes = pixbytes;
+
+			ps->next = p->solid[hash];
+			p->solid[hash] = ps;
+
+			_HEAD_SOLID(buf) = pixbytes;
+
+			p->info.solidnum++;
+		}
+	}
+
+	mThreadMutexUnlock(p->mutex);
+
+	//元のバッファを解放
+
+	if(ret != buf)
+		TileImage_pool_release(buf);
+
+	return ret;
+}
+
+/** プールの情報を取得 */
+
+void TileImage_pool_getInfo(TileImagePoolInfo *info)
+{
+	_tilepool *p = &g_tilepool;
+
+	mThreadMutexLock(p->mutex);
+
+	*info = p->info;
+
+	mThreadMutexUnlock(p->mutex);
+}
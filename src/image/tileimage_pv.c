@@ -221,6 +221,126 @@ void __TileImage_setBlendInfo(TileImageBlendInfo *info,int px,int py,const mRect
 	info->dx = dx, info->dy = dy;
 }
 
+/** キャンバスの1行分を合成
+ *
+ * row: src と a をセットしておく。dst はここでキャンバスから読み込む。
+ * dstbuf: キャンバスバッファの合成開始位置
+ * num: px 数 */
+
+void __TileImage_blendRow(TileImageBlendInfo *info,BlendColorRow *row,uint8_t *dstbuf,int num)
+{
+	int32_t *pr,*pg,*pb;
+	int i;
+
+	pr = row->dst[0];
+	pg = row->dst[1];
+	pb = row->dst[2];
+
+	if(TILEIMGWORK->bits == 8)
+	{
+		//8bit
+
+#if MLK_ENABLE_SSE2 && _TILEIMG_SIMD_ON
+
+		__m128i v,vmask;
+		uint8_t *pd = dstbuf;
+		int n;
+
+		//4px 単位 (RGBX を R,G,B ごとに分解)
+
+		n = num & (~3);
+		vmask = _mm_set1_epi32(255);
+
+		for(i = 0; i < n; i += 4, pd += 16)
+		{
+			v = _mm_loadu_si128((__m128i *)pd);
+
+			_mm_storeu_si128((__m128i *)(pr + i), _mm_and_si128(v, vmask));
+			_mm_storeu_si128((__m128i *)(pg + i), _mm_and_si128(_mm_srli_epi32(v, 8), vmask));
+			_mm_storeu_si128((__m128i *)(pb + i), _mm_and_si128(_mm_srli_epi32(v, 16), vmask));
+		}
+
+		for(; i < num; i++, pd += 4)
+		{
+			pr[i] = pd[0];
+			pg[i] = pd[1];
+			pb[i] = pd[2];
+		}
+
+		(info->func_blendrow)(row, num);
+
+		//セット (X の値は維持)
+
+		pd = dstbuf;
+		vmask = _mm_set1_epi32(0xff000000);
+
+		for(i = 0; i < n; i += 4, pd += 16)
+		{
+			v = _mm_and_si128(_mm_loadu_si128((__m128i *)pd), vmask);
+			v = _mm_or_si128(v, _mm_loadu_si128((__m128i *)(pr + i)));
+			v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128((__m128i *)(pg + i)), 8));
+			v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128((__m128i *)(pb + i)), 16));
+
+			_mm_storeu_si128((__m128i *)pd, v);
+		}
+
+		for(; i < num; i++, pd += 4)
+		{
+			pd[0] = pr[i];
+			pd[1] = pg[i];
+			pd[2] = pb[i];
+		}
+
+#else
+
+		uint8_t *pd = dstbuf;
+
+		for(i = 0; i < num; i++, pd += 4)
+		{
+			pr[i] = pd[0];
+			pg[i] = pd[1];
+			pb[i] = pd[2];
+		}
+
+		(info->func_blendrow)(row, num);
+
+		pd = dstbuf;
+
+		for(i = 0; i < num; i++, pd += 4)
+		{
+			pd[0] = pr[i];
+			pd[1] = pg[i];
+			pd[2] = pb[i];
+		}
+
+#endif
+	}
+	else
+	{
+		//16bit
+
+		uint16_t *pd = (uint16_t *)dstbuf;
+
+		for(i = 0; i < num; i++, pd += 4)
+		{
+			pr[i] = pd[0];
+			pg[i] = pd[1];
+			pb[i] = pd[2];
+		}
+
+		(info->func_blendrow)(row, num);
+
+		pd = (uint16_t *)dstbuf;
+
+		for(i = 0; i < num; i++, pd += 4)
+		{
+			pd[0] = pr[i];
+			pd[1] = pg[i];
+			pd[2] = pb[i];
+		}
+	}
+}
+
 
 //==============================
 // ほか
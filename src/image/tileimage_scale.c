@@ -0,0 +1,439 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * TileImage: 拡大縮小
+ *****************************************/
+
+#include <math.h>
+
+#include "mlk_gui.h"
+#include "mlk_widget_def.h"
+#include "mlk_popup_progress.h"
+#include "mlk_rectbox.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+#include "pv_tileimage.h"
+#include "imagecanvas.h"
+
+#include "threadpool.h"
+
+
+/*
+  - キャンバス範囲 (0,0)-(imgw x imgh) のイメージを拡大縮小して、新しいイメージを作成する。
+    キャンバス範囲外のイメージは含まない。
+  - 重みは ImageCanvas_resize() と同じものを使う。
+    色は、RGB にアルファを掛けた値で補間する。
+  - 出力先のタイル 1 行 (64px) を一つのジョブとして、スレッドプールで並列処理する。
+    各ジョブは異なるタイルに書き込むので、ロックなしで描画できる。
+  - 垂直方向 → 水平方向の順で処理する。
+    ソースの行は、スレッドごとの作業用バッファに数行分保持して、再利用する。
+*/
+
+//---------------------
+
+#define _ROWBUF_MAXPX  (1 << 20)	//ソース行バッファの最大 px 数
+
+/* スレッドごとの作業用データ */
+
+typedef struct
+{
+	int32_t *rowbuf;	//ソースの行 [rownum][srcw * 4] (A, R*A, G*A, B*A)
+	double *vbuf;		//垂直方向の処理結果 [srcw * 4]
+	int *rowno,			//rowbuf の各行のソース位置 (-1 でなし)
+		*rowhave,		//rowbuf の各行に不透明な点があるか
+		rownum;
+}_work;
+
+typedef struct
+{
+	TileImage *dst,*src;
+	ImageCanvasResizeParam ph,pv;	//水平/垂直方向のパラメータ
+	mPopupProgress *prog;
+	mRect rcsrc;	//ソースのイメージがある範囲 (キャンバス範囲内)
+	int srcw,
+		dstw,
+		dsth,
+		is8bit,
+		is_a1,	//A1 (アルファ値を 2 値化する)
+		err;
+	_work *work[THREADPOOL_MAXNUM];
+}_scale;
+
+//---------------------
+
+
+/* 作業用データを解放 */
+
+static void _work_free(_work *p)
+{
+	if(p)
+	{
+		mFree(p->rowbuf);
+		mFree(p->vbuf);
+		mFree(p->rowno);
+		mFree(p->rowhave);
+		mFree(p);
+	}
+}
+
+/* 作業用データを作成 */
+
+static _work *_work_new(_scale *p)
+{
+	_work *wk;
+	int i,num;
+
+	wk = (_work *)mMalloc0(sizeof(_work));
+	if(!wk) return NULL;
+
+	//保持する行数 (最大で垂直方向の tap 数)
+
+	num = _ROWBUF_MAXPX / p->srcw;
+
+	if(num > p->pv.tap) num = p->pv.tap;
+	if(num < 1) num = 1;
+
+	wk->rownum = num;
+
+	//確保
+
+	wk->rowbuf = (int32_t *)mMalloc(sizeof(int32_t) * 4 * p->srcw * num);
+	wk->vbuf = (double *)mMalloc(sizeof(double) * 4 * p->srcw);
+	wk->rowno = (int *)mMalloc(sizeof(int) * num);
+	wk->rowhave = (int *)mMalloc(sizeof(int) * num);
+
+	if(!wk->rowbuf || !wk->vbuf || !wk->rowno || !wk->rowhave)
+	{
+		_work_free(wk);
+		return NULL;
+	}
+
+	for(i = 0; i < num; i++)
+		wk->rowno[i] = -1;
+
+	return wk;
+}
+
+/* ソースの 1 行を読み込み
+ *
+ * return: 不透明な点があるか */
+
+static int _read_row(_scale *p,int y,int32_t *pd)
+{
+	uint64_t col;
+	uint8_t *ps8;
+	uint16_t *ps16;
+	int ix,have = 0;
+
+	ps8 = (uint8_t *)&col;
+	ps16 = (uint16_t *)&col;
+
+	//イメージがない範囲は 0
+
+	mMemset0(pd, sizeof(int32_t) * 4 * p->srcw);
+
+	pd += p->rcsrc.x1 * 4;
+
+	for(ix = p->rcsrc.x1; ix <= p->rcsrc.x2; ix++, pd += 4)
+	{
+		TileImage_getPixel(p->src, ix, y, &col);
+
+		if(p->is8bit)
+		{
+			pd[0] = ps8[3];
+			pd[1] = ps8[0] * ps8[3];
+			pd[2] = ps8[1] * ps8[3];
+			pd[3] = ps8[2] * ps8[3];
+		}
+		else
+		{
+			pd[0] = ps16[3];
+			pd[1] = ps16[0] * ps16[3];
+			pd[2] = ps16[1] * ps16[3];
+			pd[3] = ps16[2] * ps16[3];
+		}
+
+		have |= pd[0];
+	}
+
+	return (have != 0);
+}
+
+/* ソースの行を取得 (バッファになければ読み込む)
+ *
+ * return: NULL で、すべて透明 */
+
+static int32_t *_get_row(_scale *p,_work *wk,int y)
+{
+	int32_t *buf;
+	int no;
+
+	if(y < p->rcsrc.y1 || y > p->rcsrc.y2)
+		return NULL;
+
+	no = y % wk->rownum;
+	buf = wk->rowbuf + no * p->srcw * 4;
+
+	if(wk->rowno[no] != y)
+	{
+		wk->rowno[no] = y;
+		wk->rowhave[no] = _read_row(p, y, buf);
+	}
+
+	return (wk->rowhave[no])? buf: NULL;
+}
+
+/* 垂直方向の処理
+ *
+ * return: FALSE で、すべて透明 */
+
+static mlkbool _proc_vert(_scale *p,_work *wk,int y)
+{
+	int32_t *ps;
+	double *pd,*pw,w;
+	uint16_t *pi;
+	int i,ix,num,have = FALSE;
+
+	num = p->srcw * 4;
+	pw = p->pv.pweight + y * p->pv.tap;
+	pi = p->pv.pindex + y * p->pv.tap;
+
+	for(i = 0; i < p->pv.tap; i++)
+	{
+		ps = _get_row(p, wk, pi[i]);
+		if(!ps) continue;
+
+		pd = wk->vbuf;
+		w = pw[i];
+
+		if(!have)
+		{
+			for(ix = num; ix; ix--)
+				*(pd++) = *(ps++) * w;
+
+			have = TRUE;
+		}
+		else
+		{
+			for(ix = num; ix; ix--)
+				*(pd++) += *(ps++) * w;
+		}
+	}
+
+	return have;
+}
+
+/* 水平方向の処理と、色のセット */
+
+static void _proc_horz(_scale *p,_work *wk,int y)
+{
+	double *ps,*pw,c[4],w;
+	uint16_t *pi;
+	uint64_t col;
+	uint8_t *pd8;
+	uint16_t *pd16;
+	int ix,i,j,n,a,max,tap;
+
+	pw = p->ph.pweight;
+	pi = p->ph.pindex;
+	tap = p->ph.tap;
+	max = (p->is8bit)? 255: 0x8000;
+
+	pd8 = (uint8_t *)&col;
+	pd16 = (uint16_t *)&col;
+
+	for(ix = 0; ix < p->dstw; ix++)
+	{
+		c[0] = c[1] = c[2] = c[3] = 0;
+
+		for(i = tap; i; i--, pw++, pi++)
+		{
+			ps = wk->vbuf + (*pi << 2);
+			w = *pw;
+
+			c[0] += ps[0] * w;
+			c[1] += ps[1] * w;
+			c[2] += ps[2] * w;
+			c[3] += ps[3] * w;
+		}
+
+		//A
+
+		a = lround(c[0]);
+
+		if(a <= 0) continue;
+		if(a > max) a = max;
+
+		//A1 の場合は、半分未満を透明にする
+		// :補間の裾やリンギングの小さい値で、点が不透明にならないように
+
+		if(p->is_a1)
+		{
+			if(a < (max + 1) / 2) continue;
+			a = max;
+		}
+
+		//RGB (アルファで割る)
+
+		col = 0;
+
+		for(j = 0; j < 3; j++)
+		{
+			n = lround(c[j + 1] / c[0]);
+
+			if(n < 0) n = 0;
+			else if(n > max) n = max;
+
+			if(p->is8bit)
+				pd8[j] = n;
+			else
+				pd16[j] = n;
+		}
+
+		if(p->is8bit)
+			pd8[3] = a;
+		else
+			pd16[3] = a;
+
+		TileImage_setPixel_new(p->dst, ix, y, &col);
+	}
+}
+
+/* [スレッド] 出力先のタイル 1 行を処理 */
+
+static void _thread_row(void *param,int jobno,int threadno)
+{
+	_scale *p = (_scale *)param;
+	_work *wk;
+	int y,yend;
+
+	//作業用データ
+
+	wk = p->work[threadno];
+
+	if(!wk)
+	{
+		wk = p->work[threadno] = _work_new(p);
+
+		if(!wk)
+		{
+			p->err = TRUE;
+			return;
+		}
+	}
+
+	//処理
+
+	y = jobno * 64;
+	yend = y + 64;
+	if(yend > p->dsth) yend = p->dsth;
+
+	for(; y < yend; y++)
+	{
+		if(_proc_vert(p, wk, y))
+			_proc_horz(p, wk, y);
+	}
+
+	mPopupProgressThreadSubStep_inc(p->prog);
+}
+
+
+//=============================
+// main
+//=============================
+
+
+/** キャンバス範囲のイメージを拡大縮小したイメージを作成
+ *
+ * カラータイプとレイヤ色は src と同じ。オフセットは (0,0) となる。
+ *
+ * method: 補間方法 (ImageCanvas_resize() と同じ)
+ * return: NULL でメモリが足りない */
+
+TileImage *TileImage_createScaleImage(TileImage *src,int dstw,int dsth,int method,
+	mPopupProgress *prog,int stepnum)
+{
+	_scale *p;
+	TileImage *dst = NULL;
+	mRect rc;
+	int i,num;
+
+	p = (_scale *)mMalloc0(sizeof(_scale));
+	if(!p) return NULL;
+
+	p->src = src;
+	p->prog = prog;
+	p->srcw = TILEIMGWORK->imgw;
+	p->dstw = dstw;
+	p->dsth = dsth;
+	p->is8bit = (TILEIMGWORK->bits == 8);
+	p->is_a1 = (src->type == TILEIMAGE_COLTYPE_ALPHA1BIT);
+
+	//パラメータ
+
+	if(!ImageCanvas_setResizeParam(&p->ph, p->srcw, dstw, method)
+		|| !ImageCanvas_setResizeParam(&p->pv, TILEIMGWORK->imgh, dsth, method))
+		goto END;
+
+	//作成
+
+	dst = TileImage_new(src->type, dstw, dsth);
+	if(!dst) goto END;
+
+	dst->col = src->col;
+
+	p->dst = dst;
+
+	//ソースのイメージ範囲 (キャンバス範囲内にイメージがない場合は空)
+
+	p->rcsrc.x1 = p->rcsrc.y1 = 0;
+	p->rcsrc.x2 = p->srcw - 1;
+	p->rcsrc.y2 = TILEIMGWORK->imgh - 1;
+
+	if(!TileImage_getHaveImageRect_pixel(src, &rc, NULL)
+		|| !mRectClipRect(&p->rcsrc, &rc))
+		goto END;
+
+	//処理
+
+	num = (dsth + 63) / 64;
+
+	mPopupProgressThreadSubStep_begin_onestep(prog, stepnum, num);
+
+	ThreadPool_run(_thread_row, p, num);
+
+	if(p->err)
+	{
+		TileImage_free(dst);
+		dst = NULL;
+	}
+
+END:
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		_work_free(p->work[i]);
+
+	ImageCanvas_freeResizeParam(&p->ph);
+	ImageCanvas_freeResizeParam(&p->pv);
+
+	mFree(p);
+
+	return dst;
+}
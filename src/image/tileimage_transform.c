@@ -0,0 +1,551 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * TileImage: 変形 (アフィン変換/射影変換) の描画
+ *****************************************/
+
+#include <math.h>
+
+#include "mlk_gui.h"
+#include "mlk_widget_def.h"
+#include "mlk_popup_progress.h"
+#include "mlk_rectbox.h"
+
+#include "def_tileimage.h"
+#include "tileimage.h"
+#include "tileimage_drawinfo.h"
+#include "pv_tileimage.h"
+
+#include "threadpool.h"
+
+
+/*
+  - 描画先の範囲を、描画先のタイル位置に合わせて 64x64 のブロックに分割し、
+    スレッドプールで並列処理する。
+    事前に TileImage_setPixel_beginThread() でタイル配列を確保しておくので、
+    各ブロックは、ロックなしで描画できる。
+  - ブロックごとに、四隅の位置からソースの参照範囲を求め、
+    その範囲のソースの色 (RGB にアルファを掛けたもの) を作業用バッファに読み込む。
+    参照範囲が大きすぎる場合 (縮小時) は、ブロックを 2 分割していく。
+    最小サイズでも大きい場合や、射影変換で範囲が求められない場合は、
+    ソースから 1px ずつ取得する。
+  - Bicubic の重みは、位置の小数部分を _WEIGHT_DIV 段階にしたテーブルから取得する。
+    (_WEIGHT_BITS の固定小数点数)
+  - アフィン変換は、射影変換のパラメータ ([6],[7] = 0, [8] = 1) として扱う。
+*/
+
+//---------------------
+
+#define _WEIGHT_BITS  14
+#define _WEIGHT_DIV   1024			//位置の小数部分の分割数
+#define _SRCBUF_MAX   (128 * 128)	//作業用バッファの最大 px 数
+#define _BLOCK_MIN    8				//分割するブロックの最小サイズ
+
+typedef struct
+{
+	TileImage *dst,*src;
+	TileImageSetPixelFunc setpix;
+	mPopupProgress *prog;
+	const double *param;	//[0..8] 射影変換用パラメータ [9,10] 平行移動
+	mRect rc;		//描画範囲
+	int sx,sy,		//ソースの位置 (変換後の座標から引く)
+		sw,sh,		//ソースのサイズ
+		x1,y1,		//先頭ブロックの左上位置
+		xnum,		//横のブロック数
+		is8bit;
+	int16_t weight[_WEIGHT_DIV + 1][4];		//Bicubic 重み
+	int32_t *srcbuf[THREADPOOL_MAXNUM];		//スレッドごとの作業用バッファ
+}_transform;
+
+/* 作業用バッファの情報 */
+
+typedef struct
+{
+	int32_t *buf;	//[A, R*A, G*A, B*A] の順
+	mRect rc;		//ソースの範囲
+	int pitch;		//1行の値の数
+}_srcinfo;
+
+//---------------------
+
+
+/* Bicubic 重み取得 */
+
+static double _get_bicubic(double d)
+{
+	d = fabs(d);
+
+	if(d < 1.0)
+		return (d - 2) * d * d + 1;
+	else if(d < 2.0)
+		return ((5 - d) * d - 8) * d + 4;
+	else
+		return 0;
+}
+
+/* Bicubic 重みテーブルをセット
+ *
+ * 小数部分 t のとき、4 点の位置 (-1,0,1,2) の重み。
+ * TileImage_getColor_bicubic() と同じく、中心は +0.5 の位置。 */
+
+static void _set_weight_table(_transform *p)
+{
+	int i,j;
+	double t;
+
+	for(i = 0; i <= _WEIGHT_DIV; i++)
+	{
+		t = (double)i / _WEIGHT_DIV;
+
+		for(j = 0; j < 4; j++)
+			p->weight[i][j] = (int16_t)lround(_get_bicubic(t + 0.5 - j) * (1 << _WEIGHT_BITS));
+	}
+}
+
+/* 描画先の位置から、ソースの位置を取得
+ *
+ * return: FALSE で、射影変換の分母が 0 */
+
+static mlkbool _get_srcpos(_transform *p,int x,int y,double *dstx,double *dsty,double *dstp)
+{
+	const double *param = p->param;
+	double dx,dy,dp;
+
+	dx = x - param[9];
+	dy = y - param[10];
+
+	dp = dx * param[6] + dy * param[7] + param[8];
+
+	if(dstp) *dstp = dp;
+
+	if(dp == 0) return FALSE;
+
+	*dstx = (dx * param[0] + dy * param[1] + param[2]) / dp - p->sx;
+	*dsty = (dx * param[3] + dy * param[4] + param[5]) / dp - p->sy;
+
+	return TRUE;
+}
+
+/* ブロックのソースの参照範囲を取得
+ *
+ * 四隅の位置から求める (射影変換でも、分母の符号が変わらなければ凸四角形になる)。
+ * ソースの範囲外の点は描画されないので、ソースの範囲内に収める。
+ *
+ * return: [0] 参照する点がない [1] 成功 [-1] 範囲を求められない */
+
+static int _get_src_rect(_transform *p,const mRect *rc,mRect *rcsrc)
+{
+	double dx,dy,dp,xmin = 0,ymin = 0,xmax = 0,ymax = 0;
+	int i,x1,y1,x2,y2,sign = 0;
+
+	for(i = 0; i < 4; i++)
+	{
+		if(!_get_srcpos(p, (i & 1)? rc->x2: rc->x1, (i & 2)? rc->y2: rc->y1, &dx, &dy, &dp))
+			return -1;
+
+		//分母の符号がすべて同じであること
+
+		if(i == 0)
+			sign = (dp > 0);
+		else if(sign != (dp > 0))
+			return -1;
+
+		if(i == 0)
+		{
+			xmin = xmax = dx;
+			ymin = ymax = dy;
+		}
+		else
+		{
+			if(dx < xmin) xmin = dx;
+			if(dx > xmax) xmax = dx;
+			if(dy < ymin) ymin = dy;
+			if(dy > ymax) ymax = dy;
+		}
+	}
+
+	//参照する整数位置 (誤差を考慮して +1 拡張)
+
+	x1 = (int)floor(xmin) - 2;
+	y1 = (int)floor(ymin) - 2;
+	x2 = (int)floor(xmax) + 3;
+	y2 = (int)floor(ymax) + 3;
+
+	//ソースの範囲外
+
+	if(x2 < -1 || y2 < -1 || x1 > p->sw || y1 > p->sh)
+		return 0;
+
+	if(x1 < 0) x1 = 0;
+	if(y1 < 0) y1 = 0;
+	if(x2 >= p->sw) x2 = p->sw - 1;
+	if(y2 >= p->sh) y2 = p->sh - 1;
+
+	rcsrc->x1 = x1;
+	rcsrc->y1 = y1;
+	rcsrc->x2 = x2;
+	rcsrc->y2 = y2;
+
+	return 1;
+}
+
+/* ソースの色を取得 (RGB はアルファを掛けた値) */
+
+static void _get_src_color(_transform *p,int x,int y,int32_t *dst)
+{
+	uint64_t col;
+	uint8_t *ps8;
+	uint16_t *ps16;
+
+	TileImage_getPixel(p->src, x, y, &col);
+
+	if(p->is8bit)
+	{
+		ps8 = (uint8_t *)&col;
+
+		dst[0] = ps8[3];
+		dst[1] = ps8[0] * ps8[3];
+		dst[2] = ps8[1] * ps8[3];
+		dst[3] = ps8[2] * ps8[3];
+	}
+	else
+	{
+		ps16 = (uint16_t *)&col;
+
+		dst[0] = ps16[3];
+		dst[1] = ps16[0] * ps16[3];
+		dst[2] = ps16[1] * ps16[3];
+		dst[3] = ps16[2] * ps16[3];
+	}
+}
+
+/* 作業用バッファにソースを読み込む */
+
+static void _read_srcbuf(_transform *p,_srcinfo *info)
+{
+	int32_t *pd;
+	int ix,iy;
+
+	pd = info->buf;
+
+	for(iy = info->rc.y1; iy <= info->rc.y2; iy++)
+	{
+		for(ix = info->rc.x1; ix <= info->rc.x2; ix++, pd += 4)
+			_get_src_color(p, ix, iy, pd);
+	}
+}
+
+/* Bicubic で補間した色を取得
+ *
+ * info: NULL でソースから直接取得
+ * return: FALSE で範囲外、または透明 */
+
+static mlkbool _get_color(_transform *p,_srcinfo *info,double dx,double dy,uint64_t *dstcol)
+{
+	int16_t *wx,*wy;
+	int32_t *ps,tmp[4];
+	int64_t w,a,r,g,b,n;
+	int i,j,nx,ny,x[4],y,max,pitch;
+
+	nx = (int)floor(dx);
+	ny = (int)floor(dy);
+
+	//ソース範囲外
+
+	if(nx < 0 || ny < 0 || nx >= p->sw || ny >= p->sh)
+		return FALSE;
+
+	//重み
+
+	wx = p->weight[(int)((dx - nx) * _WEIGHT_DIV + 0.5)];
+	wy = p->weight[(int)((dy - ny) * _WEIGHT_DIV + 0.5)];
+
+	//参照する X 位置
+
+	for(i = 0; i < 4; i++)
+	{
+		j = nx - 1 + i;
+		if(j < 0) j = 0;
+		else if(j >= p->sw) j = p->sw - 1;
+
+		if(info)
+		{
+			if(j < info->rc.x1) j = info->rc.x1;
+			else if(j > info->rc.x2) j = info->rc.x2;
+		}
+
+		x[i] = j;
+	}
+
+	//4x4 近傍
+
+	a = r = g = b = 0;
+	pitch = (info)? info->pitch: 0;
+
+	for(i = 0; i < 4; i++)
+	{
+		if(!wy[i]) continue;
+
+		y = ny - 1 + i;
+		if(y < 0) y = 0;
+		else if(y >= p->sh) y = p->sh - 1;
+
+		if(info)
+		{
+			if(y < info->rc.y1) y = info->rc.y1;
+			else if(y > info->rc.y2) y = info->rc.y2;
+		}
+
+		for(j = 0; j < 4; j++)
+		{
+			if(!wx[j]) continue;
+
+			if(info)
+				ps = info->buf + (y - info->rc.y1) * pitch + ((x[j] - info->rc.x1) << 2);
+			else
+			{
+				_get_src_color(p, x[j], y, tmp);
+				ps = tmp;
+			}
+
+			if(!ps[0]) continue;
+
+			w = wx[j] * wy[i];
+
+			a += w * ps[0];
+			r += w * ps[1];
+			g += w * ps[2];
+			b += w * ps[3];
+		}
+	}
+
+	//A
+
+	max = (p->is8bit)? 255: 0x8000;
+
+	n = (a + (1 << (_WEIGHT_BITS * 2 - 1))) >> (_WEIGHT_BITS * 2);
+
+	if(n <= 0) return FALSE;
+	if(n > max) n = max;
+
+	//RGB (アルファで割る)
+
+	r = (r <= 0)? 0: (r + a / 2) / a;
+	g = (g <= 0)? 0: (g + a / 2) / a;
+	b = (b <= 0)? 0: (b + a / 2) / a;
+
+	if(r > max) r = max;
+	if(g > max) g = max;
+	if(b > max) b = max;
+
+	//セット
+
+	if(p->is8bit)
+		*dstcol = (uint32_t)((n << 24) | (b << 16) | (g << 8) | r);
+	else
+		*dstcol = ((uint64_t)n << 48) | ((uint64_t)b << 32) | ((uint64_t)g << 16) | r;
+
+	return TRUE;
+}
+
+/* ブロックを描画
+ *
+ * info: NULL でソースから直接取得 */
+
+static void _draw_block(_transform *p,const mRect *rc,_srcinfo *info)
+{
+	int ix,iy;
+	double dx,dy;
+	uint64_t col;
+
+	for(iy = rc->y1; iy <= rc->y2; iy++)
+	{
+		for(ix = rc->x1; ix <= rc->x2; ix++)
+		{
+			if(_get_srcpos(p, ix, iy, &dx, &dy, NULL)
+				&& _get_color(p, info, dx, dy, &col))
+				(p->setpix)(p->dst, ix, iy, &col);
+		}
+	}
+}
+
+/* ブロックを処理 */
+
+static void _proc_block(_transform *p,const mRect *rc,int32_t *buf)
+{
+	_srcinfo info;
+	mRect rc2;
+	int n,w,h;
+
+	n = _get_src_rect(p, rc, &info.rc);
+
+	//参照する点がない
+
+	if(n == 0) return;
+
+	//作業用バッファを使う
+
+	if(n == 1 && buf)
+	{
+		w = info.rc.x2 - info.rc.x1 + 1;
+		h = info.rc.y2 - info.rc.y1 + 1;
+
+		if(w * h <= _SRCBUF_MAX)
+		{
+			info.buf = buf;
+			info.pitch = w * 4;
+
+			_read_srcbuf(p, &info);
+			_draw_block(p, rc, &info);
+			return;
+		}
+
+		//範囲が大きい場合、長い方を2分割
+
+		w = rc->x2 - rc->x1 + 1;
+		h = rc->y2 - rc->y1 + 1;
+
+		if(w > _BLOCK_MIN || h > _BLOCK_MIN)
+		{
+			rc2 = *rc;
+
+			if(w >= h)
+			{
+				rc2.x2 = rc->x1 + w / 2 - 1;
+				_proc_block(p, &rc2, buf);
+
+				rc2.x1 = rc2.x2 + 1;
+				rc2.x2 = rc->x2;
+			}
+			else
+			{
+				rc2.y2 = rc->y1 + h / 2 - 1;
+				_proc_block(p, &rc2, buf);
+
+				rc2.y1 = rc2.y2 + 1;
+				rc2.y2 = rc->y2;
+			}
+
+			_proc_block(p, &rc2, buf);
+			return;
+		}
+	}
+
+	//ソースから直接取得
+
+	_draw_block(p, rc, NULL);
+}
+
+/* [スレッド] 一つのブロックを処理 */
+
+static void _thread_block(void *param,int jobno,int threadno)
+{
+	_transform *p = (_transform *)param;
+	mRect rc;
+
+	//範囲
+
+	rc.x1 = p->x1 + (jobno % p->xnum) * 64;
+	rc.y1 = p->y1 + (jobno / p->xnum) * 64;
+	rc.x2 = rc.x1 + 63;
+	rc.y2 = rc.y1 + 63;
+
+	if(rc.x1 < p->rc.x1) rc.x1 = p->rc.x1;
+	if(rc.y1 < p->rc.y1) rc.y1 = p->rc.y1;
+	if(rc.x2 > p->rc.x2) rc.x2 = p->rc.x2;
+	if(rc.y2 > p->rc.y2) rc.y2 = p->rc.y2;
+
+	//作業用バッファ (失敗時は NULL)
+
+	if(!p->srcbuf[threadno])
+		p->srcbuf[threadno] = (int32_t *)mMalloc(_SRCBUF_MAX * 4 * 4);
+
+	_proc_block(p, &rc, p->srcbuf[threadno]);
+
+	mPopupProgressThreadSubStep_inc(p->prog);
+}
+
+
+//=============================
+// main
+//=============================
+
+
+/** 射影変換で描画 (アフィン変換も含む)
+ *
+ * 描画先の位置 (x,y) に対して、ソースの位置は
+ * dx = x - param[9], dy = y - param[10] として、
+ * ((dx * [0] + dy * [1] + [2]) / dp - sx, (dx * [3] + dy * [4] + [5]) / dp - sy)。
+ * dp = dx * [6] + dy * [7] + [8]。
+ *
+ * rcdst: 描画範囲 (描画可能範囲内であること)
+ * param: [0..8] 射影変換用パラメータ [9,10] 平行移動
+ * sx,sy: ソース位置の調整値
+ * sw,sh: ソースのサイズ。src の (0,0)-(sw x sh) の範囲を参照する。 */
+
+void __TileImage_transform(TileImage *dst,TileImage *src,const mRect *rcdst,
+	const double *param,int sx,int sy,int sw,int sh,mPopupProgress *prog)
+{
+	_transform *p;
+	int i,num;
+
+	p = (_transform *)mMalloc0(sizeof(_transform));
+	if(!p) return;
+
+	//タイル配列を確保
+
+	if(!TileImage_setPixel_beginThread(dst, rcdst)) goto END;
+
+	//
+
+	p->dst = dst;
+	p->src = src;
+	p->setpix = g_tileimage_dinfo.func_setpixel;
+	p->prog = prog;
+	p->param = param;
+	p->rc = *rcdst;
+	p->sx = sx;
+	p->sy = sy;
+	p->sw = sw;
+	p->sh = sh;
+	p->is8bit = (TILEIMGWORK->bits == 8);
+
+	_set_weight_table(p);
+
+	//ブロック
+
+	p->x1 = dst->offx + ((rcdst->x1 - dst->offx) & ~63);
+	p->y1 = dst->offy + ((rcdst->y1 - dst->offy) & ~63);
+	p->xnum = (rcdst->x2 - p->x1) / 64 + 1;
+
+	num = p->xnum * ((rcdst->y2 - p->y1) / 64 + 1);
+
+	//処理
+
+	mPopupProgressThreadSubStep_begin_onestep(prog, 50, num);
+
+	ThreadPool_run(_thread_block, p, num);
+
+END:
+	for(i = 0; i < THREADPOOL_MAXNUM; i++)
+		mFree(p->srcbuf[i]);
+
+	mFree(p);
+}
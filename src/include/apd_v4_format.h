@@ -24,6 +24,7 @@ $*/
 typedef struct _apd4save apd4save;
 typedef struct _apd4load apd4load;
 typedef struct _LayerItem LayerItem;
+typedef struct _LayerList LayerList;
 
 typedef struct
 {
@@ -55,7 +56,11 @@ mlkerr apd4save_saveSingleLayer(LayerItem *item,const char *filename,mPopupProgr
 mlkerr apd4save_open(apd4save **ppdst,const char *filename,mPopupProgress *prog);
 void apd4save_close(apd4save *p);
 
+void apd4save_setApdInfo(apd4save *p,const char *srcfile);
+void apd4save_setLayerList(apd4save *p,LayerList *list,LayerItem *curlayer);
+
 mlkerr apd4save_writeHeadInfo(apd4save *p,int layernum);
+mlkerr apd4save_writeHeadInfo_info(apd4save *p,const apd4info *info);
 
 mlkerr apd4save_writeChunk_thumbnail(apd4save *p,uint8_t **ppbuf,int width,int height);
 mlkerr apd4save_writeChunk_picture(apd4save *p,uint8_t **ppbuf,int width,int height,int stepnum);
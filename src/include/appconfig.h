@@ -29,4 +29,5 @@ void AppConfig_setWaterPreset_default(void);
 
 void AppConfig_deleteTempDir(void);
 mlkbool AppConfig_getTempPath(mStr *str,const char *path);
+void AppConfig_setTileSwap(void);
 
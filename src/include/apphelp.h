@@ -42,7 +42,8 @@ enum
 	HELP_TRID_SEL_MATERIAL,		//画像素材選択
 	HELP_TRID_HEADTAIL,			//入り抜き
 	HELP_TRID_CANVASKEY,		//キャンバスキー設定
-	HELP_TRID_ENVOPT_UNDOBUFSIZE	//環境設定:アンドゥバッファサイズ
+	HELP_TRID_ENVOPT_UNDOBUFSIZE,	//環境設定:アンドゥバッファサイズ
+	HELP_TRID_ENVOPT_TILE_MAXMEM	//環境設定:イメージのメモリ上限
 };
 
 
@@ -0,0 +1,37 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+
+/************************************
+ * 自動保存
+ ************************************/
+
+#ifndef AZPT_AUTOSAVE_H
+#define AZPT_AUTOSAVE_H
+
+void AutoSave_finish(void);
+
+mlkbool AutoSave_run(void);
+void AutoSave_wait(void);
+void AutoSave_deleteFile(void);
+
+mlkbool AutoSave_getRecoveryFile(mStr *strdst);
+void AutoSave_setRecoveryFile(const char *filename);
+
+#endif
@@ -51,4 +51,17 @@ enum
 
 typedef mlkbool (*BlendColorFunc)(int32_t *src,int32_t *dst,int a);
 
+/* 行単位の合成 */
+
+#define BLENDCOLOR_ROW_MAX  64
+
+typedef struct
+{
+	int32_t src[3][BLENDCOLOR_ROW_MAX],	//合成する色 (R,G,B ごと)
+		dst[3][BLENDCOLOR_ROW_MAX],		//合成先の色 (結果もここにセットされる)
+		a[BLENDCOLOR_ROW_MAX];			//アルファ値 (0 で合成しない)
+}BlendColorRow;
+
+typedef void (*BlendColorRowFunc)(BlendColorRow *p,int num);
+
 #endif
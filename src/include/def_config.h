@@ -163,7 +163,8 @@ typedef struct
 		webp;
 	uint8_t png,
 		tiff,
-		psd;
+		psd,
+		apd;
 	mPoint pt_tpcol; //透過色のイメージ位置 (x = -1 でなし,上書き保存時用)
 }ConfigSaveOption;
 
@@ -191,7 +192,8 @@ typedef struct _AppConfig
 	int textdlg_toph;		//上部の高さ
 
 	int savedup_type,		//複製保存時の保存形式 (0 で現在のファイルと同じ)
-		undo_maxbufsize;	//アンドゥ最大バッファサイズ (0 ですべてファイルに出力)
+		undo_maxbufsize,	//アンドゥ最大バッファサイズ (0 ですべてファイルに出力)
+		tile_maxmem_mb;		//タイルのメモリ上限 (MiB。超えた分は作業用ファイルにスワップ。0 で無制限)
 
 	uint32_t fview,			//表示フラグ
 		foption,			//オプションフラグ
@@ -210,6 +212,9 @@ typedef struct _AppConfig
 
 	uint8_t loadimg_default_bits,	//画像読み込み時のデフォルトビット数
 		canvas_scale_method,		//キャンバス拡大縮小の補間方法
+		canvas_scale_keep_layer,	//キャンバス拡大縮小時、レイヤを維持
+		thread_num,					//処理に使うスレッド数 (0 で CPU 数)
+		autosave_min,				//自動保存の間隔 (分。0 でなし)
 		pointer_btt_default[CONFIG_POINTERBTT_NUM], //デフォルトデバイスの各ボタンのコマンド (0:消しゴム側, 1:左ボタン, ...)
 		pointer_btt_pentab[CONFIG_POINTERBTT_NUM];  //筆圧情報があるデバイスの各ボタンのコマンド
 
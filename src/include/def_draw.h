@@ -39,6 +39,7 @@ typedef struct _FillPolygon FillPolygon;
 typedef struct _DrawFont DrawFont;
 typedef struct _PointBuf PointBuf;
 typedef struct _AppDrawToolList AppDrawToolList;
+typedef struct _DrawBlendCache DrawBlendCache;
 
 
 #define DRAW_COLORMASK_NUM  6	//色マスクの色数
@@ -295,9 +296,13 @@ typedef struct _AppDraw
 	mList list_material[2],		//素材画像の管理リスト
 		list_grad_custom;		//グラデーションカスタムのリスト
 
-	mStr strOptTexturePath;		//オプションテクスチャのファイルパス
+	mStr strOptTexturePath,		//オプションテクスチャのファイルパス
+		strApdFile;				//レイヤの APD 保存情報が示すファイルパス (空でなし)
+	mlkfoff apdfile_size;		//strApdFile の保存/読み込み時のファイルサイズ
+	uint64_t apdfile_time;		//strApdFile の保存/読み込み時の更新日時
 
 	ImageCanvas *imgcanvas;		//全レイヤ合成後のイメージ
+	DrawBlendCache *blendcache;	//カレントより下層の合成キャッシュ (draw_update.c)
 	ImageMaterial *imgmat_opttex;	//オプションテクスチャの現在イメージ
 
 	TileImage *tileimg_sel,	//選択範囲用 (1bit)
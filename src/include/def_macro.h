@@ -34,3 +34,4 @@ $*/
 
 #define APP_DIRNAME_TEXTURE  "texture"
 #define APP_DIRNAME_BRUSH    "brush"
+#define APP_DIRNAME_AUTOSAVE "autosave"
@@ -70,3 +70,10 @@ $*/
 #define SAVEOPT_PSD_F_UNCOMPRESS (1<<3)
 #define SAVEOPT_PSD_GET_TYPE(n)  ((n) & 3)
 
+/* APD
+ * [bit0-3{4}:level (0-9)] */
+
+#define SAVEOPT_APD_DEFAULT  6
+
+#define SAVEOPT_APD_GET_LEVEL(n)  ((n) & 15)
+
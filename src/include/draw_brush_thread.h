@@ -0,0 +1,41 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * ブラシ自由線の描画スレッド
+ ************************************/
+
+#ifndef AZPT_DRAW_BRUSH_THREAD_H
+#define AZPT_DRAW_BRUSH_THREAD_H
+
+typedef struct _TileImage TileImage;
+
+mlkbool drawBrushThread_begin(TileImage *img);
+void drawBrushThread_end(AppDraw *p);
+mlkbool drawBrushThread_isRunning(void);
+
+void drawBrushThread_addPoint(int no,double x,double y,double pressure);
+void drawBrushThread_addFinish(int no,double x,double y,double pressure);
+
+mlkbool drawBrushThread_update(AppDraw *p);
+
+void drawBrushThread_lockImage(void);
+void drawBrushThread_unlockImage(void);
+
+#endif
@@ -29,6 +29,7 @@ typedef struct _LayerTextItem LayerTextItem;
 typedef struct _TileImage TileImage;
 typedef struct _mPopupProgress mPopupProgress;
 typedef struct _TileImageBlendSrcInfo TileImageBlendSrcInfo;
+typedef struct _DrawBlendBand DrawBlendBand;
 
 
 /* init */
@@ -90,10 +91,14 @@ mlkerr drawImage_changeImageBits_proc(AppDraw *p,mPopupProgress *prog);
 
 mlkbool drawImage_resizeCanvas(AppDraw *p,int w,int h,int movx,int movy,int fcrop);
 mlkbool drawImage_scaleCanvas(AppDraw *p,int w,int h,int dpi,int method);
+mlkbool drawImage_scaleCanvas_layer(AppDraw *p,int w,int h,int dpi,int method);
 
 void drawImage_blendImageReal_curbits(AppDraw *p,mPopupProgress *prog,int stepnum);
 mlkerr drawImage_blendImageReal_normal(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum);
-mlkerr drawImage_blendImageReal_alpha(AppDraw *p,int dstbits,mPopupProgress *prog,int stepnum);
+
+DrawBlendBand *drawImage_blendBand_new(AppDraw *p,int dstbits,mlkbool falpha);
+void drawImage_blendBand_free(DrawBlendBand *p);
+uint8_t *drawImage_blendBand_getRow(DrawBlendBand *p,int y);
 
 /* loadfile */
 
@@ -139,6 +144,8 @@ void drawUpdate_all_layer(void);
 
 void drawUpdate_blendImage_full(AppDraw *p,const mBox *box);
 void drawUpdate_blendImage_layer(AppDraw *p,const mBox *box);
+void drawUpdate_blendImage_curlayer(AppDraw *p,const mBox *box);
+void drawUpdate_freeBlendCache(AppDraw *p);
 
 void drawUpdate_drawCanvas(AppDraw *p,mPixbuf *pixbuf,const mBox *box);
 
@@ -147,6 +154,7 @@ void drawUpdateBox_canvaswg_direct(AppDraw *p,const mBox *boximg);
 
 void drawUpdateBox_canvas(AppDraw *p,const mBox *boximg);
 void drawUpdateBox_canvas_direct(AppDraw *p,const mBox *boximg);
+void drawUpdateBox_canvas_curlayer(AppDraw *p,const mBox *boximg,mlkbool direct);
 
 void drawUpdateRect_canvas(AppDraw *p,const mRect *rc);
 void drawUpdateRect_canvasview(AppDraw *p,const mRect *rc);
@@ -33,8 +33,20 @@ struct _ImageCanvas
 		height,
 		bits, //8 or 16
 		line_bytes;
+
+	ImageCanvas *mip;	//縮小表示用の 1/2 サイズイメージ (8bit。NULL で未作成)
+	mRect rcmip;		//mip の更新が必要な範囲
 };
 
+/* リサイズ用パラメータ */
+
+typedef struct
+{
+	double *pweight;	//重み [出力幅 x tap]
+	uint16_t *pindex;	//参照位置 [出力幅 x tap]
+	int tap;
+}ImageCanvasResizeParam;
+
 
 ImageCanvas *ImageCanvas_new(int width,int height,int bits);
 void ImageCanvas_free(ImageCanvas *p);
@@ -54,5 +66,10 @@ void ImageCanvas_drawPixbuf_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInf
 void ImageCanvas_drawPixbuf_rotate(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 void ImageCanvas_drawPixbuf_rotate_oversamp(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
 
+void ImageCanvas_setMipUpdate(ImageCanvas *p,const mBox *box);
+mlkbool ImageCanvas_drawPixbuf_mip(ImageCanvas *src,mPixbuf *dst,CanvasDrawInfo *info);
+
 ImageCanvas *ImageCanvas_resize(ImageCanvas *src,int neww,int newh,int method,mPopupProgress *prog,int stepnum);
+mlkbool ImageCanvas_setResizeParam(ImageCanvasResizeParam *p,int srcw,int dstw,int method);
+void ImageCanvas_freeResizeParam(ImageCanvasResizeParam *p);
 
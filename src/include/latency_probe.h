@@ -0,0 +1,48 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * 描画の遅延計測
+ ************************************/
+
+#ifndef AZPT_LATENCY_PROBE_H
+#define AZPT_LATENCY_PROBE_H
+
+enum
+{
+	LATENCY_STAGE_RASTER,	//ブラシ自由線の1点の描画
+	LATENCY_STAGE_BLEND,	//レイヤ合成
+	LATENCY_STAGE_CANVAS,	//キャンバスへの描画
+	LATENCY_STAGE_COMMIT,	//ウィンドウイメージの転送
+	LATENCY_STAGE_TOTAL,	//ポインタイベント受信から転送まで
+
+	LATENCY_STAGE_NUM
+};
+
+void LatencyProbe_init(const char *filename,mlkbool overlay);
+void LatencyProbe_finish(void);
+mlkbool LatencyProbe_isEnable(void);
+
+uint64_t LatencyProbe_begin(void);
+void LatencyProbe_end(int stage,uint64_t begin);
+
+void LatencyProbe_onStrokeEnd(void);
+void LatencyProbe_getSummary(mStr *str);
+
+#endif
@@ -42,6 +42,10 @@ struct _LayerItem
 	TileImage *img;			//レイヤイメージ
 	ImageMaterial *img_texture;	//テクスチャイメージ
 	LayerItem *link;		//作業用リンク
+
+	int64_t apd_fpos;	//APD 保存/読み込み時のイメージデータの位置 (差分保存用)
+	uint32_t apd_size;	//イメージデータのサイズ (0 で情報なし)
+	mRect apd_rc;		//ファイル上のイメージ範囲
 	
 	char *name,     	//レイヤ名 (NULL で空文字列)
 		*texture_path;	//レイヤテクスチャパス (NULL でなし)
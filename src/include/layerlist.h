@@ -31,6 +31,7 @@ typedef struct _mPopupProgress mPopupProgress;
 
 
 LayerList *LayerList_new(void);
+LayerList *LayerList_newSnapshot(LayerList *src,LayerItem *current,LayerItem **ppcur);
 void LayerList_free(LayerList *p);
 
 void LayerList_clear(LayerList *p);
@@ -78,6 +79,7 @@ void LayerList_folder_open_all(LayerList *p);
 void LayerList_folder_close_all(LayerList *p,LayerItem *curitem);
 void LayerList_setFlags_all_off(LayerList *p,uint32_t flags);
 void LayerList_replaceToneLines_all(LayerList *p,int src,int dst);
+void LayerList_clearApdInfo(LayerList *p);
 
 /* リンク */
 
@@ -104,5 +106,6 @@ void LayerList_setItemName_shiftjis(LayerList *p,LayerItem *item,const char *nam
 void LayerList_moveOffset_rel_all(LayerList *p,int movx,int movy);
 void LayerList_moveOffset_rel_text(LayerList *p,int movx,int movy);
 void LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog);
+void LayerList_shareSolidTiles(LayerList *p);
 
 #endif
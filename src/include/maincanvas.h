@@ -50,6 +50,9 @@ mlkbool MainCanvasPage_clearTimer_updateSelectImageMove(void);
 void MainCanvasPage_setTimer_updatePasteMove(void);
 void MainCanvasPage_clearTimer_updatePasteMove(void);
 
+void MainCanvasPage_setTimer_brushThread(void);
+void MainCanvasPage_clearTimer_brushThread(void);
+
 void MainCanvasPage_changeDrawCursor(void);
 void MainCanvasPage_setCursor_forTool(void);
 void MainCanvasPage_setCursor(int curno);
@@ -34,11 +34,13 @@ void MainWindow_errmes_win(mWindow *parent,mlkerr err,const char *detail);
 mlkbool MainWindow_confirmSave(MainWindow *p);
 void MainWindow_updateNewCanvas(MainWindow *p,const char *filename);
 mWidget *MainWindow_getProgressBarPos(mBox *box);
+void MainWindow_setTimer_autosave(MainWindow *p,mlkbool retry);
 
 /* mainwin_file.c */
 
 void MainWindow_openFileDialog(MainWindow *p,int recentno);
 mlkbool MainWindow_loadImage(MainWindow *p,const char *filename,LoadImageOption *opt);
+mlkbool MainWindow_loadRecoveryFile(MainWindow *p,const char *filename);
 
 /* mainwin_cmd.c */
 
@@ -24,3 +24,4 @@ $*/
 typedef int (*PopupThreadFunc)(mPopupProgress *prog,void *data);
 
 int PopupThread_run(void *data,PopupThreadFunc func);
+mlkbool PopupThread_isRunning(void);
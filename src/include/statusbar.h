@@ -30,3 +30,4 @@ void StatusBar_setImageInfo(void);
 void StatusBar_setCursorPos(int x,int y);
 void StatusBar_setHelp_selbox(mlkbool reset);
 void StatusBar_setHelp_tool(void);
+void StatusBar_setHelp_text(const char *text);
@@ -0,0 +1,42 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/************************************
+ * スレッドプール
+ ************************************/
+
+#ifndef AZPT_THREADPOOL_H
+#define AZPT_THREADPOOL_H
+
+#define THREADPOOL_MAXNUM  32	//最大スレッド数 (呼び出し元含む)
+
+/* jobno: 0〜jobnum-1
+ * threadno: 処理しているスレッドの番号 (0〜ThreadPool_getNum()-1。0 は呼び出し元) */
+
+typedef void (*ThreadPoolFunc)(void *param,int jobno,int threadno);
+
+mlkbool ThreadPool_init(int num);
+void ThreadPool_finish(void);
+
+int ThreadPool_getNum(void);
+mlkbool ThreadPool_isParallel(void);
+
+void ThreadPool_run(ThreadPoolFunc func,void *param,int jobnum);
+
+#endif
@@ -29,6 +29,8 @@ typedef struct _TileImageDrawGradInfo TileImageDrawGradInfo;
 typedef struct _ImageCanvas ImageCanvas;
 typedef struct _ImageMaterial ImageMaterial;
 typedef struct _mPopupProgress mPopupProgress;
+typedef struct _mLoadImage mLoadImage;
+typedef struct _mLoadImageType mLoadImageType;
 typedef struct _CanvasDrawInfo CanvasDrawInfo;
 typedef struct _CanvasViewParam CanvasViewParam;
 typedef struct _FillPolygon FillPolygon;
@@ -61,6 +63,19 @@ typedef struct _TileImageBlendSrcInfo
 	ImageMaterial *img_texture;
 }TileImageBlendSrcInfo;
 
+/* タイルのメモリプール情報 */
+
+typedef struct
+{
+	uint32_t tilenum,	//使用中のタイル数
+		slabnum,		//確保されているスラブ数
+		solidnum;		//共有されている単色タイルの数
+	uint64_t usedsize,	//使用中のタイルのバイト数
+		maxsize,		//usedsize の最大値
+		poolsize,		//確保されているスラブの合計バイト数
+		swapsize;		//poolsize のうち、スワップファイル上のスラブのバイト数
+}TileImagePoolInfo;
+
 /* 処理範囲情報 */
 
 typedef struct
@@ -136,15 +151,28 @@ void TileImage_global_setPixelColorFunc(int type);
 
 mlkbool TileImage_tile_isTransparent_forA(uint8_t *tile,int size);
 
+/* メモリプール */
+
+uint8_t *TileImage_pool_alloc(int size);
+void TileImage_pool_release(uint8_t *buf);
+void TileImage_pool_addRef(uint8_t *buf);
+mlkbool TileImage_pool_isShared(uint8_t *buf);
+mlkbool TileImage_pool_isSolid(uint8_t *buf);
+uint8_t *TileImage_pool_toSolid(uint8_t *buf,int pixbytes);
+void TileImage_pool_setSwap(const char *filename,uint64_t budget);
+void TileImage_pool_getInfo(TileImagePoolInfo *info);
+
 /* 解放 */
 
 void TileImage_free(TileImage *p);
 void TileImage_freeTile(uint8_t **pptile);
+void TileImage_freeTile_buf(uint8_t *buf);
 void TileImage_freeTile_atPos(TileImage *p,int tx,int ty);
 void TileImage_freeTileBuf(TileImage *p);
 void TileImage_freeAllTiles(TileImage *p);
 mlkbool TileImage_freeEmptyTiles(TileImage *p);
 void TileImage_freeEmptyTiles_byUndo(TileImage *p,TileImage *imgundo);
+void TileImage_shareSolidTiles(TileImage *p);
 
 /* 作成 */
 
@@ -175,6 +203,7 @@ uint8_t *TileImage_allocTile_clear(TileImage *p);
 mlkbool TileImage_allocTile_atptr(TileImage *p,uint8_t **ppbuf);
 mlkbool TileImage_allocTile_atptr_clear(TileImage *p,uint8_t **ppbuf);
 uint8_t *TileImage_getTileAlloc_atpos(TileImage *p,int tx,int ty,mlkbool clear);
+mlkbool TileImage_unshareTile(TileImage *p,uint8_t **pptile);
 
 void TileImage_clearTile(TileImage *p,uint8_t *tile);
 void TileImage_copyTile(TileImage *p,uint8_t *dst,const uint8_t *src);
@@ -215,9 +244,12 @@ uint32_t *TileImage_getHistogram(TileImage *p);
 
 /* set pixel */
 
+mlkbool TileImage_setPixel_beginThread(TileImage *p,const mRect *rc);
+
 void TileImage_setPixel_draw_direct(TileImage *p,int x,int y,void *colbuf);
 void TileImage_setPixel_draw_dot_stroke(TileImage *p,int x,int y,void *colbuf);
 void TileImage_setPixel_draw_brush_stroke(TileImage *p,int x,int y,void *colbuf);
+void TileImage_setPixel_span(TileImage *p,int x,int y,int num,void *drawcol,const int *alpha);
 void TileImage_setPixel_draw_dotpen_direct(TileImage *p,int x,int y,void *pix);
 void TileImage_setPixel_draw_dotpen_stroke(TileImage *p,int x,int y,void *pix);
 void TileImage_setPixel_draw_dotpen_overwrite_square(TileImage *p,int x,int y,void *pix);
@@ -287,6 +319,7 @@ mlkbool TileImage_drawLineV_forA1(TileImage *p,int y1,int y2,int x);
 
 void TileImage_drawBrush_beginFree(TileImage *p,int no,double x,double y,double pressure);
 void TileImage_drawBrush_beginOther(TileImage *p,double x,double y);
+uint32_t TileImage_drawBrush_getDabNum(void);
 
 void TileImage_drawBrushFree(TileImage *p,int no,double x,double y,double pressure);
 void TileImage_drawBrushFree_finish(TileImage *p,int no);
@@ -312,6 +345,8 @@ void TileImage_combine(TileImage *dst,TileImage *src,mRect *rc,int opasrc,int op
 	int blendmode,mPopupProgress *prog);
 
 TileImage *TileImage_createCropImage(TileImage *src,int offx,int offy,int w,int h);
+TileImage *TileImage_createScaleImage(TileImage *src,int dstw,int dsth,int method,
+	mPopupProgress *prog,int stepnum);
 
 void TileImage_flipHorz_full(TileImage *p);
 void TileImage_flipVert_full(TileImage *p);
@@ -372,6 +407,8 @@ uint16_t *TileImage_create16fixto16_table(void);
 void TileImage_loadimgbuf_convert(uint8_t **ppbuf,int width,int height,int srcbits,mlkbool ignore_alpha);
 void TileImage_convertFromImage(TileImage *p,uint8_t **ppsrc,int srcw,int srch,mPopupProgress *prog,int prog_subnum);
 void TileImage_convertFromCanvas(TileImage *p,ImageCanvas *src,mPopupProgress *prog,int prog_subnum);
+mlkerr TileImage_loadFromLoadImage(TileImage *img,mLoadImage *li,mLoadImageType *tp,
+	uint8_t **ppbuf,mlkbool ignore_alpha,mPopupProgress *prog);
 mlkerr TileImage_loadFile(TileImage **ppdst,const char *filename,uint32_t format,mSize *dst_size,mPopupProgress *prog);
 
 mlkerr TileImage_savePNG_rgba(TileImage *p,const char *filename,int dpi,mPopupProgress *prog);
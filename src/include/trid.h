@@ -127,6 +127,7 @@ enum
 	TRID_MESSAGE_SAVE_OVERWRITE_APD,	//APD 以外での上書き保存
 	TRID_MESSAGE_SAVE_CLOSE_CONFIRM,	//閉じる時の保存確認
 	TRID_MESSAGE_CONVERT_VER2,			//ver2の設定ファイルを変換
+	TRID_MESSAGE_AUTOSAVE_RECOVERY,		//異常終了時の自動保存データを開く
 
 	TRID_MESSAGE_TEXT_NO_ADD = 100,	//テキスト追加なし
 
@@ -53,12 +53,14 @@ int Undo_new(void);
 void Undo_free(void);
 
 void Undo_setModifyFlag_off(void);
+void Undo_setModifyFlag_on(void);
 void Undo_setMaxNum(int num);
 
 mlkbool Undo_isHaveUndo(void);
 mlkbool Undo_isHaveRedo(void);
 mlkbool Undo_isModify(void);
 
+uint32_t Undo_getChangeCount(void);
 void Undo_deleteAll(void);
 mlkerr Undo_runUndoRedo(mlkbool redo,UndoUpdateInfo *info);
 
@@ -87,4 +89,5 @@ mlkerr Undo_addChangeImageBits(void);
 mlkerr Undo_addResizeCanvas_moveOffset(int mx,int my,int w,int h);
 mlkerr Undo_addResizeCanvas_crop(int mx,int my,int w,int h);
 mlkerr Undo_addScaleCanvas(void);
+mlkerr Undo_addScaleCanvas_layer(int w,int h);
 
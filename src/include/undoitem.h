@@ -69,7 +69,8 @@ enum
 	UNDO_TYPE_CHANGE_IMAGE_BITS,		//イメージビット数変更
 	UNDO_TYPE_RESIZECANVAS_MOVEOFFSET,	//キャンバスサイズ変更 (オフセット移動のみ)
 	UNDO_TYPE_RESIZECANVAS_CROP,		//キャンバスサイズ変更 (範囲外切り取り)
-	UNDO_TYPE_SCALE_CANVAS				//キャンバス拡大縮小
+	UNDO_TYPE_SCALE_CANVAS,				//キャンバス拡大縮小
+	UNDO_TYPE_SCALE_CANVAS_LAYER		//キャンバス拡大縮小 (レイヤ維持)
 };
 
 /** データ確保タイプ (UndoItem_alloc() 時のサイズ) */
@@ -103,6 +104,7 @@ mlkerr UndoItem_runLayerMoveList_multi(UndoItem *p,UndoUpdateInfo *info,int runt
 mlkerr UndoItem_runChangeImageBits(UndoItem *p,UndoUpdateInfo *info);
 mlkerr UndoItem_runCanvasResize(UndoItem *p,UndoUpdateInfo *info);
 mlkerr UndoItem_runCanvasScale(UndoItem *p,UndoUpdateInfo *info,int runtype);
+mlkerr UndoItem_runCanvasScale_layer(UndoItem *p,UndoUpdateInfo *info);
 
 mlkerr UndoItem_runLayerTextNew(UndoItem *p,UndoUpdateInfo *info,int runtype);
 mlkerr UndoItem_runLayerTextEdit(UndoItem *p,UndoUpdateInfo *info);
@@ -44,6 +44,9 @@ $*/
 #include "undo.h"
 #include "regfont.h"
 #include "textword_list.h"
+#include "threadpool.h"
+#include "autosave.h"
+#include "latency_probe.h"
 
 #include "panel.h"
 #include "panel_func.h"
@@ -58,7 +61,10 @@ $*/
 
 //-----------------------
 
-#define _HELP_TEXT "[usage] exe <FILE>\n\n--help-mlk : show mlk options"
+#define _HELP_TEXT "[usage] exe [OPTION] [--] <FILE>\n\n" \
+ "--latency=<FILE> : write input-to-display latency histograms to FILE on exit\n" \
+ "--latency-overlay : show latency summary in the status bar after each stroke\n" \
+ "--help-mlk : show mlk options"
 
 //-----------------------
 /* グローバル変数定義 */
@@ -209,6 +215,14 @@ static int _init_app(void)
 
 	Undo_setMaxNum(APPCONF->undo_maxnum);
 
+	//スレッドプール
+
+	ThreadPool_init(APPCONF->thread_num);
+
+	//タイルのスワップ
+
+	AppConfig_setTileSwap();
+
 	//カーソル
 
 	AppCursor_init();
@@ -281,6 +295,36 @@ static int _init_app(void)
 	return 0;
 }
 
+/** 異常終了時の自動保存ファイルがあれば、開く
+ *
+ * return: TRUE で開いた */
+
+static mlkbool _open_recovery_file(void)
+{
+	mStr str = MSTR_INIT;
+	mlkbool ret = FALSE;
+
+	if(!AutoSave_getRecoveryFile(&str)) return FALSE;
+
+	MLK_TRGROUP(TRGROUP_MESSAGE);
+
+	if(mMessageBox(MLK_WINDOW(APPWIDGET->mainwin), MLK_TR(TRID_MESSAGE_TITLE_CONFIRM),
+		MLK_TR(TRID_MESSAGE_AUTOSAVE_RECOVERY),
+		MMESBOX_YESNO, MMESBOX_YES) == MMESBOX_YES)
+	{
+		ret = MainWindow_loadRecoveryFile(APPWIDGET->mainwin, str.buf);
+	}
+
+	//開かなかった場合は削除
+
+	if(!ret)
+		mDeleteFile(str.buf);
+
+	mStrFree(&str);
+
+	return ret;
+}
+
 /** 引数のファイルを開く */
 
 static void _open_arg_file(const char *fname)
@@ -321,6 +365,10 @@ static void _free_widgets(AppWidgets *p)
 
 static void _finish(void)
 {
+	//遅延計測の結果を出力
+
+	LatencyProbe_finish();
+
 	//----- 設定ファイル保存
 
 	app_save_config();
@@ -343,9 +391,13 @@ static void _finish(void)
 	TableData_free();
 	RegFont_free();
 
+	AutoSave_finish();
+
 	Undo_free();
 
 	AppDraw_free();
+
+	ThreadPool_finish();
 	
 	//作業用ディレクトリ削除
 
@@ -360,20 +412,55 @@ static void _finish(void)
 
 static int _init_main(int argc,char **argv)
 {
-	int top,i;
+	const char *latency_file = NULL;
+	char *endopt_arg = NULL;
+	int top,i,fileno = -1;
+	mlkbool latency_overlay = FALSE,fend_opt = FALSE;
+
+	//"--" の次の引数
+	// :mGuiInit() で argv は並び替えられ、"--" は top より前に移動するため、先に取得しておく。
+	// :"--" 以降は、すべてファイル名として扱う。
+
+	for(i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "--") == 0)
+		{
+			endopt_arg = argv[i + 1];
+			break;
+		}
+	}
 
 	if(mGuiInit(argc, argv, &top)) return 1;
 
-	//"--help"
+	//オプション
 
 	for(i = top; i < argc; i++)
 	{
-		if(strcmp(argv[i], "--help") == 0)
+		if(argv[i] == endopt_arg)
+			fend_opt = TRUE;
+
+		if(fend_opt || strncmp(argv[i], "--", 2) != 0)
+		{
+			if(fileno == -1) fileno = i;
+		}
+		else if(strcmp(argv[i], "--help") == 0)
 		{
 			puts(_HELP_TEXT);
 			mGuiEnd();
 			return 1;
 		}
+		else if(strncmp(argv[i], "--latency=", 10) == 0)
+			latency_file = argv[i] + 10;
+		else if(strcmp(argv[i], "--latency-overlay") == 0)
+			latency_overlay = TRUE;
+		else
+		{
+			//不明なオプション
+
+			fprintf(stderr, "unknown option: %s\n(see --help)\n", argv[i]);
+			mGuiEnd();
+			return 1;
+		}
 	}
 
 	//
@@ -403,10 +490,20 @@ static int _init_main(int argc,char **argv)
 		return 1;
 	}
 
+	//遅延計測
+
+	if(latency_file && *latency_file)
+		LatencyProbe_init(latency_file, latency_overlay);
+
 	//ファイル開く
+	// :自動保存ファイルを復元した場合は、引数のファイルは開かない
+
+	if(!_open_recovery_file() && fileno != -1)
+		_open_arg_file(argv[fileno]);
+
+	//自動保存
 
-	if(top < argc)
-		_open_arg_file(argv[top]);
+	MainWindow_setTimer_autosave(APPWIDGET->mainwin, FALSE);
 
 	return 0;
 }
@@ -28,10 +28,13 @@ $*/
 #include "mlk_popup_progress.h"
 #include "mlk_stdio.h"
 #include "mlk_zlib.h"
+#include "mlk_buf.h"
 #include "mlk_util.h"
 #include "mlk_unicode.h"
 
 #include "def_macro.h"
+#include "def_config.h"
+#include "def_saveopt.h"
 #include "def_draw.h"
 
 #include "layerlist.h"
@@ -40,6 +43,7 @@ $*/
 #include "tileimage.h"
 
 #include "draw_main.h"
+#include "threadpool.h"
 
 #include "apd_v4_format.h"
 #include "pv_apd_format.h"
@@ -49,31 +53,65 @@ $*/
 
 /* load */
 
+typedef struct
+{
+	uint8_t *enc,	//圧縮データ
+		*raw;		//展開後のタイルデータ
+	uint32_t encsize,
+		encalloc,	//enc の確保サイズ
+		rawsize,	//展開後のサイズ
+		rawalloc;	//raw の確保サイズ
+	int tilenum;
+	mlkerr err;
+}_loadblock;
+
 struct _apd4load
 {
 	FILE *fp;
 	mPopupProgress *prog;
-	mZlib *zlib;
+	mZlib *zlib,
+		*zlib_block[THREADPOOL_MAXNUM];	//ブロック展開用 (スレッドごと)
 	uint8_t *workbuf;
 
+	_loadblock *block;	//まとめて展開するブロック
+	int blocknum;
+
 	apd4info info;
 
 	off_t fpos;
+	uint8_t fapdinfo;	//レイヤに APD 保存情報をセットするか
 };
 
 /* save */
 
+typedef struct
+{
+	mBuf raw,	//タイルデータ (圧縮前)
+		enc;	//圧縮後のデータ
+	int tilenum;
+	mlkerr err;
+}_saveblock;
+
 struct _apd4save
 {
 	FILE *fp;
 	mPopupProgress *prog;
-	mZlib *zlib;
+	mZlib *zlib,
+		*zlib_block[THREADPOOL_MAXNUM];	//ブロック圧縮用 (スレッドごと)
 	uint8_t *tilebuf;
 
+	_saveblock *block;	//まとめて圧縮するブロック
+
+	FILE *fpcopy;	//イメージデータのコピー元 (NULL でなし)
+
+	LayerList *list;	//書き込むレイヤリスト
+	LayerItem *curlayer;	//カレントレイヤ
+
 	uint32_t tilenum, //総数
 		curtsize;
-	int curtnum;
-	off_t fpos;
+	int blocknum,	//block の数
+		curblock;	//現在のブロック位置
+	uint8_t fapdinfo;	//レイヤに APD 保存情報をセットするか
 };
 
 //-------------------
@@ -88,20 +126,40 @@ struct _apd4save
 
 static void _load_free_workbuf(apd4load *p)
 {
+	int i;
+
 	mFree(p->workbuf);
 	p->workbuf = NULL;
+
+	//ブロック
+
+	for(i = 0; i < p->blocknum; i++)
+	{
+		mFree(p->block[i].enc);
+		mFree(p->block[i].raw);
+	}
+
+	mFree(p->block);
+	p->block = NULL;
+	p->blocknum = 0;
 }
 
 /** 閉じる */
 
 void apd4load_close(apd4load *p)
 {
+	int i;
+
 	if(p)
 	{
 		if(p->fp) fclose(p->fp);
 
+		_load_free_workbuf(p);
+
 		mZlibFree(p->zlib);
-		mFree(p->workbuf);
+
+		for(i = 0; i < THREADPOOL_MAXNUM; i++)
+			mZlibFree(p->zlib_block[i]);
 		
 		mFree(p);
 	}
@@ -156,6 +214,8 @@ static mlkerr _load_headinfo(apd4load *p)
 
 static mlkerr _load_init(apd4load *p,const char *filename)
 {
+	int i;
+
 	//開く
 
 	p->fp = mFILEopen(filename, "rb");
@@ -168,6 +228,12 @@ static mlkerr _load_init(apd4load *p,const char *filename)
 
 	mZlibSetIO_stdio(p->zlib, p->fp);
 
+	for(i = ThreadPool_getNum() - 1; i >= 0; i--)
+	{
+		p->zlib_block[i] = mZlibDecNew(256, -15);
+		if(!p->zlib_block[i]) return MLKERR_ALLOC;
+	}
+
 	//先頭情報の取得
 
 	return _load_headinfo(p);
@@ -421,18 +487,100 @@ static mlkerr _load_layer_ex(apd4load *p,LayerItem *pi)
 //----------- レイヤ
 
 
+/*
+  - タイルのブロックを、スレッド数分まとめて読み込み、スレッドプールで並列に展開する。
+  - タイルのセットは、読み込み側のスレッドで、ファイル内の順番通りに行う。
+*/
+
+/* バッファを指定サイズ以上にする */
+
+static mlkbool _loadblock_resize(uint8_t **ppbuf,uint32_t *palloc,uint32_t size)
+{
+	if(size > *palloc)
+	{
+		mFree(*ppbuf);
+
+		*ppbuf = (uint8_t *)mMalloc(size);
+		*palloc = (*ppbuf)? size: 0;
+	}
+
+	return (*ppbuf != NULL);
+}
+
+/* [スレッド] ブロックを展開 */
+
+static void _thread_decode_block(void *param,int jobno,int threadno)
+{
+	apd4load *p = (apd4load *)param;
+	_loadblock *pb = p->block + jobno;
+	mZlib *zlib = p->zlib_block[threadno];
+
+	mZlibDecReset(zlib);
+
+	//展開後のサイズが足りない場合も、データが壊れている
+
+	if(mZlibDecReadBuf(zlib, pb->raw, pb->rawsize, pb->enc, pb->encsize))
+		pb->err = MLKERR_DAMAGED;
+	else
+		pb->err = MLKERR_OK;
+}
+
+/* ブロックをまとめて読み込み
+ *
+ * ptilenum: 残りのタイル数。読み込んだ分が引かれる。
+ * return: 読み込んだブロック数。負の値でエラー */
+
+static int _load_blocks(apd4load *p,uint32_t *ptilenum,int tilesize)
+{
+	_loadblock *pb;
+	uint32_t size;
+	uint16_t tnum;
+	int num;
+
+	for(num = 0, pb = p->block; num < p->blocknum && *ptilenum; num++, pb++)
+	{
+		//タイル数, 圧縮サイズ
+		
+		if(mFILEreadBE16(p->fp, &tnum)
+			|| mFILEreadBE32(p->fp, &size)
+			|| tnum > *ptilenum)
+			return -MLKERR_DAMAGED;
+
+		//圧縮データ
+
+		if(!_loadblock_resize(&pb->enc, &pb->encalloc, size))
+			return -MLKERR_ALLOC;
+
+		if(mFILEreadOK(p->fp, pb->enc, size))
+			return -MLKERR_DAMAGED;
+
+		//展開後のバッファ
+
+		pb->rawsize = tnum * (tilesize + 4);
+
+		if(!_loadblock_resize(&pb->raw, &pb->rawalloc, pb->rawsize))
+			return -MLKERR_ALLOC;
+
+		pb->encsize = size;
+		pb->tilenum = tnum;
+
+		*ptilenum -= tnum;
+	}
+
+	return num;
+}
+
 /* タイルイメージ読み込み */
 
 static mlkerr _load_layer_image(apd4load *p,TileImage *img)
 {
 	FILE *fp = p->fp;
-	mZlib *zlib = p->zlib;
-	uint8_t *buf = p->workbuf;
-	uint32_t size,tilenum;
-	uint16_t tnum,tx,ty;
+	_loadblock *pb;
+	uint8_t *buf;
+	uint32_t tilenum;
+	uint16_t tx,ty;
 	uint8_t comptype;
-	int i,tilesize;
-	mlkerr ret;
+	int i,j,num,tilesize;
 
 	//圧縮タイプ, タイル総数
 
@@ -457,39 +605,46 @@ static mlkerr _load_layer_image(apd4load *p,TileImage *img)
 
 	tilesize = img->tilesize;
 
+	//ブロック (スレッドごとに一つ)
+
+	if(!p->block)
+	{
+		p->block = (_loadblock *)mMalloc0(sizeof(_loadblock) * ThreadPool_getNum());
+		if(!p->block) return MLKERR_ALLOC;
+
+		p->blocknum = ThreadPool_getNum();
+	}
+
 	while(tilenum)
 	{
-		//タイル数, 圧縮サイズ
-		
-		if(mFILEreadBE16(fp, &tnum)
-			|| mFILEreadBE32(fp, &size))
-			return MLKERR_DAMAGED;
+		//読み込み
 
-		//ブロック読み込み
+		num = _load_blocks(p, &tilenum, tilesize);
+		if(num < 0) return -num;
 
-		mZlibDecReset(zlib);
-		mZlibDecSetSize(zlib, size);
+		//展開
 
-		for(i = tnum; i; i--)
-		{
-			ret = mZlibDecRead(zlib, buf, tilesize + 4);
-			if(ret) return ret;
+		ThreadPool_run(_thread_decode_block, p, num);
 
-			tx = mGetBufBE16(buf);
-			ty = mGetBufBE16(buf + 2);
+		//タイルをセット
 
-			if(!TileImage_setTile_fromSave(img, tx, ty, buf + 4))
-				return MLKERR_ALLOC;
+		for(i = 0, pb = p->block; i < num; i++, pb++)
+		{
+			if(pb->err) return pb->err;
 
-			mPopupProgressThreadSubStep_inc(p->prog);
-		}
+			buf = pb->raw;
 
-		ret = mZlibDecFinish(zlib);
-		if(ret) return ret;
+			for(j = pb->tilenum; j; j--, buf += tilesize + 4)
+			{
+				tx = mGetBufBE16(buf);
+				ty = mGetBufBE16(buf + 2);
 
-		//
+				if(!TileImage_setTile_fromSave(img, tx, ty, buf + 4))
+					return MLKERR_ALLOC;
 
-		tilenum -= tnum;
+				mPopupProgressThreadSubStep_inc(p->prog);
+			}
+		}
 	}
 
 	return MLKERR_OK;
@@ -513,6 +668,7 @@ static mlkerr _load_layer(apd4load *p,LayerItem **ppitem,mlkbool fadd)
 	int i;
 	mlkerr ret;
 	mRect rc;
+	off_t pos;
 
 	//親のレイヤ番号
 
@@ -600,14 +756,27 @@ static mlkerr _load_layer(apd4load *p,LayerItem **ppitem,mlkbool fadd)
 		LayerItem_replaceImage(pi, img, coltype);
 		LayerItem_setLayerColor(pi, pi->col);
 
+		pos = ftello(fp);
+
 		ret = _load_layer_image(p, img);
 		if(ret) return ret;
+
+		//APD 保存情報
+
+		if(p->fapdinfo)
+		{
+			pi->apd_fpos = pos;
+			pi->apd_size = ftello(fp) - pos;
+			pi->apd_rc = rc;
+		}
 	}
 
 	return MLKERR_OK;
 }
 
-/** レイヤをすべて読み込み */
+/** レイヤをすべて読み込み
+ *
+ * 各レイヤに、イメージデータのファイル位置 (APD 保存情報) をセットする。 */
 
 mlkerr apd4load_readLayers(apd4load *p)
 {
@@ -622,6 +791,8 @@ mlkerr apd4load_readLayers(apd4load *p)
 
 	mPopupProgressThreadSetMax(p->prog, p->info.layernum * 6);
 
+	p->fapdinfo = TRUE;
+
 	while(1)
 	{
 		ret = _load_layer(p, NULL, FALSE);
@@ -721,12 +892,29 @@ ERR:
 
 void apd4save_close(apd4save *p)
 {
+	int i;
+
 	if(p)
 	{
 		if(p->fp) fclose(p->fp);
+		if(p->fpcopy) fclose(p->fpcopy);
 
 		mZlibFree(p->zlib);
 		mFree(p->tilebuf);
+
+		for(i = 0; i < THREADPOOL_MAXNUM; i++)
+			mZlibFree(p->zlib_block[i]);
+
+		if(p->block)
+		{
+			for(i = 0; i < p->blocknum; i++)
+			{
+				mBufFree(&p->block[i].raw);
+				mBufFree(&p->block[i].enc);
+			}
+
+			mFree(p->block);
+		}
 		
 		mFree(p);
 	}
@@ -736,6 +924,11 @@ void apd4save_close(apd4save *p)
 
 static mlkerr _save_init(apd4save *p,const char *filename)
 {
+	int i,level;
+
+	level = SAVEOPT_APD_GET_LEVEL(APPCONF->save.apd);
+	if(level > 9) level = 9;
+
 	//開く
 
 	p->fp = mFILEopen(filename, "wb");
@@ -748,15 +941,31 @@ static mlkerr _save_init(apd4save *p,const char *filename)
 
 	//zlib
 
-	p->zlib = mZlibEncNew(8192, 6, -15, 8, 0);
+	p->zlib = mZlibEncNew(8192, level, -15, 8, 0);
 	if(!p->zlib) return MLKERR_ALLOC;
 
 	mZlibSetIO_stdio(p->zlib, p->fp);
 
+	//タイルのブロック (スレッドごとに一つ)
+	// :進捗なしの場合は、バックグラウンドでの処理のため、スレッドプールは使わない
+
+	p->blocknum = (p->prog)? ThreadPool_getNum(): 1;
+
+	p->block = (_saveblock *)mMalloc0(sizeof(_saveblock) * p->blocknum);
+	if(!p->block) return MLKERR_ALLOC;
+
+	for(i = 0; i < p->blocknum; i++)
+	{
+		p->zlib_block[i] = mZlibEncNew(8192, level, -15, 8, 0);
+		if(!p->zlib_block[i]) return MLKERR_ALLOC;
+	}
+
 	return MLKERR_OK;
 }
 
-/** 開く */
+/** 開く
+ *
+ * prog: NULL で進捗なし (バックグラウンドでの保存時) */
 
 mlkerr apd4save_open(apd4save **ppdst,const char *filename,mPopupProgress *prog)
 {
@@ -769,6 +978,8 @@ mlkerr apd4save_open(apd4save **ppdst,const char *filename,mPopupProgress *prog)
 	if(!p) return MLKERR_ALLOC;
 
 	p->prog = prog;
+	p->list = APPDRAW->layerlist;
+	p->curlayer = APPDRAW->curlayer;
 
 	//初期化
 
@@ -782,11 +993,55 @@ mlkerr apd4save_open(apd4save **ppdst,const char *filename,mPopupProgress *prog)
 	return ret;
 }
 
-/** 先頭情報書き込み */
+/** レイヤの APD 保存情報を使う
+ *
+ * レイヤの書き込み時、各レイヤにイメージデータのファイル位置をセットする。
+ *
+ * srcfile: NULL 以外で、保存情報があるレイヤのイメージデータを、
+ *  圧縮し直さずにこのファイルからコピーする (上書き保存時の元ファイル)。
+ *  開けなかった場合は、すべて圧縮する。 */
+
+void apd4save_setApdInfo(apd4save *p,const char *srcfile)
+{
+	p->fapdinfo = TRUE;
+
+	if(srcfile)
+		p->fpcopy = mFILEopen(srcfile, "rb");
+}
+
+/** 書き込むレイヤリストをセット
+ *
+ * デフォルトでは、現在のキャンバスのレイヤリスト。
+ *
+ * curlayer: カレントレイヤとして記録するレイヤ */
+
+void apd4save_setLayerList(apd4save *p,LayerList *list,LayerItem *curlayer)
+{
+	p->list = list;
+	p->curlayer = curlayer;
+}
+
+/** 先頭情報書き込み (現在のキャンバスの情報) */
 
 mlkerr apd4save_writeHeadInfo(apd4save *p,int layernum)
 {
 	AppDraw *pd = APPDRAW;
+	apd4info info;
+
+	info.width = pd->imgw;
+	info.height = pd->imgh;
+	info.dpi = pd->imgdpi;
+	info.bits = pd->imgbits;
+	info.layernum = layernum;
+	info.bkgndcol = MLK_RGB(pd->imgbkcol.c8.r, pd->imgbkcol.c8.g, pd->imgbkcol.c8.b);
+
+	return apd4save_writeHeadInfo_info(p, &info);
+}
+
+/** 先頭情報書き込み (情報を指定) */
+
+mlkerr apd4save_writeHeadInfo_info(apd4save *p,const apd4info *info)
+{
 	FILE *fp = p->fp;
 	uint8_t *buf = p->tilebuf;
 
@@ -799,10 +1054,10 @@ mlkerr apd4save_writeHeadInfo(apd4save *p,int layernum)
 	//
 
 	mSetBuf_format(buf, ">hiiibbbbbh",
-		19, pd->imgw, pd->imgh, pd->imgdpi,
-		pd->imgbits, 0,
-		pd->imgbkcol.c8.r, pd->imgbkcol.c8.g, pd->imgbkcol.c8.b,
-		layernum);
+		19, info->width, info->height, info->dpi,
+		info->bits, 0,
+		MLK_RGB_R(info->bkgndcol), MLK_RGB_G(info->bkgndcol), MLK_RGB_B(info->bkgndcol),
+		info->layernum);
 
 	mFILEwriteOK(fp, buf, 19 + 2);
 
@@ -1034,56 +1289,116 @@ static mlkerr _write_layerex(apd4save *p,LayerItem *pi)
 }
 
 //------ タイルイメージ
+/*
+  - タイルは、最大 1MB または 0xffff 個ごとのブロックに分けて、ブロックごとに圧縮する。
+  - タイルデータをスレッド数分のブロックだけメモリ上に溜めておき、
+    スレッドプールで並列に圧縮した後、順番に書き込む。
+    (ブロックの区切りは常に同じなので、出力されるデータはスレッド数に関係なく同じ)
+*/
 
-/* タイル書き込み関数 */
 
-static mlkerr _func_savetile(TileImage *img,void *param)
+/* [スレッド] ブロックを圧縮 */
+
+static void _thread_encode_block(void *param,int jobno,int threadno)
 {
 	apd4save *p = (apd4save *)param;
-	FILE *fp = p->fp;
-	mlkerr ret;
+	_saveblock *pb = p->block + jobno;
+	mZlib *zlib = p->zlib_block[threadno];
 
-	//先頭時、情報を仮書き込み
+	pb->enc.cursize = 0;
 
-	if(p->curtnum == 0)
+	if(!mZlibEncReset(zlib))
+		pb->err = MLKERR_ENCODE;
+	else
 	{
-		p->fpos = ftello(fp);
+		mZlibSetIO_buf(zlib, &pb->enc);
 
-		if(mFILEwrite0(fp, 6))
-			return MLKERR_IO;
+		pb->err = mZlibEncSend(zlib, pb->raw.buf, pb->raw.cursize);
 
-		mZlibEncReset(p->zlib);
+		if(!pb->err)
+			pb->err = mZlibEncFinish(zlib);
 	}
+}
+
+/* 溜めたブロックを圧縮して書き込み */
+
+static mlkerr _write_blocks(apd4save *p)
+{
+	_saveblock *pb;
+	int i,j;
+	mlkerr ret = MLKERR_OK;
 
 	//圧縮
 
-	ret = mZlibEncSend(p->zlib, p->tilebuf, img->tilesize + 4);
-	if(ret) return ret;
+	ThreadPool_run(_thread_encode_block, p, p->curblock);
+
+	//書き込み
+
+	for(i = 0, pb = p->block; i < p->curblock; i++, pb++)
+	{
+		if(!ret)
+		{
+			if(pb->err)
+				ret = pb->err;
+			else if(mFILEwriteBE16(p->fp, pb->tilenum)
+				|| mFILEwriteBE32(p->fp, pb->enc.cursize)
+				|| mFILEwriteOK(p->fp, pb->enc.buf, pb->enc.cursize))
+				ret = MLKERR_IO;
+			else
+			{
+				for(j = pb->tilenum; j > 0; j--)
+					mPopupProgressThreadSubStep_inc(p->prog);
+			}
+		}
+
+		pb->tilenum = 0;
+		pb->raw.cursize = 0;
+	}
+
+	p->curblock = 0;
+
+	return ret;
+}
+
+/* タイル書き込み関数 */
+
+static mlkerr _func_savetile(TileImage *img,void *param)
+{
+	apd4save *p = (apd4save *)param;
+	_saveblock *pb;
+
+	pb = p->block + p->curblock;
+
+	//バッファ確保
+
+	if(!pb->raw.buf)
+	{
+		if(!mBufAlloc(&pb->raw, 0x100000 + 64 * 64 * 8 + 4, 0x10000)
+			|| !mBufAlloc(&pb->enc, 0x80000, 0x40000))
+			return MLKERR_ALLOC;
+	}
+
+	//タイルデータを追加
+
+	if(!mBufAppend(&pb->raw, p->tilebuf, img->tilesize + 4))
+		return MLKERR_ALLOC;
 
 	p->tilenum--;
-	p->curtnum++;
 	p->curtsize += img->tilesize;
+	pb->tilenum++;
 
 	//ブロック終わり
 
-	if(p->tilenum == 0 || p->curtsize >= 0x100000 || p->curtnum == 0xffff)
+	if(p->tilenum == 0 || p->curtsize >= 0x100000 || pb->tilenum == 0xffff)
 	{
-		ret = mZlibEncFinish(p->zlib);
-		if(ret) return ret;
-		
-		if(fseeko(fp, p->fpos, SEEK_SET)
-			|| mFILEwriteBE16(fp, p->curtnum)
-			|| mFILEwriteBE32(fp, mZlibEncGetSize(p->zlib))
-			|| fseek(fp, 0, SEEK_END))
-			return MLKERR_IO;
-
-		p->curtnum = 0;
 		p->curtsize = 0;
-	}
+		p->curblock++;
 
-	//
-	
-	mPopupProgressThreadSubStep_inc(p->prog);
+		//すべてのブロックが埋まったか、最後のタイルの場合、書き込み
+
+		if(p->curblock == p->blocknum || p->tilenum == 0)
+			return _write_blocks(p);
+	}
 
 	return MLKERR_OK;
 }
@@ -1112,11 +1427,37 @@ static mlkerr _write_tileimage(apd4save *p,TileImage *img,mRect *rc,uint32_t til
 
 	p->tilenum = tilenum;
 	p->curtsize = 0;
-	p->curtnum = 0;
+	p->curblock = 0;
 
 	return TileImage_saveTiles_apd4(img, rc, p->tilebuf, _func_savetile, p);
 }
 
+/* 元ファイルからイメージデータをコピー */
+
+static mlkerr _copy_tileimage(apd4save *p,LayerItem *pi,int stepnum)
+{
+	uint32_t remain;
+	int size;
+
+	if(fseeko(p->fpcopy, pi->apd_fpos, SEEK_SET))
+		return MLKERR_IO;
+
+	for(remain = pi->apd_size; remain; remain -= size)
+	{
+		size = (remain < 64 * 64 * 8)? remain: 64 * 64 * 8;
+
+		if(mFILEreadOK(p->fpcopy, p->tilebuf, size))
+			return MLKERR_DAMAGED;
+
+		if(mFILEwriteOK(p->fp, p->tilebuf, size))
+			return MLKERR_IO;
+	}
+
+	mPopupProgressThreadAddPos(p->prog, stepnum);
+
+	return MLKERR_OK;
+}
+
 /** レイヤの書き込み
  *
  * parent_root: 親レイヤを常にルートにする */
@@ -1126,18 +1467,23 @@ mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int ste
 	uint32_t tilenum;
 	uint16_t parent;
 	uint8_t lflags;
-	int size,fimg;
+	int size,fimg,fcopy;
 	mlkerr ret;
 	mRect rc;
+	off_t pos;
 
 	fimg = LAYERITEM_IS_IMAGE(pi);
 
+	//イメージデータを元ファイルからコピーするか
+
+	fcopy = (fimg && p->fpcopy && pi->apd_size);
+
 	//親のレイヤ番号
 
 	if(parent_root || !pi->i.parent)
 		parent = 0xfffe;
 	else
-		parent = LayerList_getItemIndex(APPDRAW->layerlist, (LayerItem *)pi->i.parent);
+		parent = LayerList_getItemIndex(p->list, (LayerItem *)pi->i.parent);
 
 	//フラグ
 
@@ -1145,11 +1491,14 @@ mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int ste
 
 	if(LAYERITEM_IS_FOLDER(pi)) lflags |= 1;
 
-	if(pi == APPDRAW->curlayer) lflags |= 2;
+	if(pi == p->curlayer) lflags |= 2;
 
 	//イメージ範囲
+	// :コピー時は、元ファイルに書き込まれた範囲
 
-	if(fimg && TileImage_getHaveImageRect_pixel(pi->img, &rc, &tilenum))
+	if(fcopy)
+		rc = pi->apd_rc;
+	else if(fimg && TileImage_getHaveImageRect_pixel(pi->img, &rc, &tilenum))
 	{
 		rc.x2++;
 		rc.y2++;
@@ -1181,8 +1530,23 @@ mlkerr apd4save_writeLayer(apd4save *p,LayerItem *pi,mlkbool parent_root,int ste
 		mPopupProgressThreadAddPos(p->prog, stepnum);
 	else
 	{
-		ret = _write_tileimage(p, pi->img, &rc, tilenum, stepnum);
+		pos = ftello(p->fp);
+
+		if(fcopy)
+			ret = _copy_tileimage(p, pi, stepnum);
+		else
+			ret = _write_tileimage(p, pi->img, &rc, tilenum, stepnum);
+
 		if(ret) return ret;
+
+		//APD 保存情報
+
+		if(p->fapdinfo)
+		{
+			pi->apd_fpos = pos;
+			pi->apd_size = ftello(p->fp) - pos;
+			pi->apd_rc = rc;
+		}
 	}
 
 	return MLKERR_OK;
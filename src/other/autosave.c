@@ -0,0 +1,407 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+
+/*****************************************
+ * 自動保存
+ *
+ * 一定間隔で、編集中のデータを APD v4 形式で保存する。
+ *****************************************/
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+
+#include "mlk_gui.h"
+#include "mlk_str.h"
+#include "mlk_file.h"
+#include "mlk_filestat.h"
+#include "mlk_dir.h"
+#include "mlk_thread.h"
+#include "mlk_util.h"
+
+#include "def_macro.h"
+#include "def_draw.h"
+
+#include "layerlist.h"
+#include "layeritem.h"
+#include "undo.h"
+#include "popup_thread.h"
+#include "apd_v4_format.h"
+
+#include "draw_op_def.h"
+
+#include "autosave.h"
+
+
+/*
+  - ファイルは <config>/autosave/<プロセスID>.apd。
+    正常終了時と、ファイル保存時/新規作成時に削除する。
+  - 起動時に、終了したプロセスのファイルが残っていれば、異常終了時のデータとして復元する。
+  - レイヤイメージの複製はメインスレッドで行い、
+    ファイルへの書き込みは、優先度を下げたスレッドで行う。
+  - 一枚絵とサムネイルは保存しない。
+*/
+
+//---------------------
+
+typedef struct
+{
+	mThread *th;
+	LayerList *list;		//書き込み中のレイヤの複製
+	LayerItem *curlayer;
+	apd4info info;
+	mStr strfile;			//自動保存ファイル名
+	uint32_t change_count;	//保存時の変更カウント
+	mlkerr err;
+	uint8_t fend,			//スレッドの処理が終了したか
+		ferr;				//前回の保存に失敗した
+}_autosave;
+
+static _autosave g_autosave = {0};
+
+//---------------------
+
+
+/* 書き込み */
+
+static mlkerr _write_file(_autosave *p,const char *filename)
+{
+	apd4save *save;
+	LayerItem *pi;
+	mlkerr ret;
+
+	ret = apd4save_open(&save, filename, NULL);
+	if(ret) return ret;
+
+	apd4save_setLayerList(save, p->list, p->curlayer);
+
+	ret = apd4save_writeHeadInfo_info(save, &p->info);
+	if(ret) goto ERR;
+
+	ret = apd4save_writeChunk_end(save);
+	if(ret) goto ERR;
+
+	for(pi = LayerList_getTopItem(p->list); pi; pi = LayerItem_getNext(pi))
+	{
+		ret = apd4save_writeLayer(save, pi, FALSE, 0);
+		if(ret) goto ERR;
+	}
+
+	ret = apd4save_writeLayer_end(save);
+
+ERR:
+	apd4save_close(save);
+
+	return ret;
+}
+
+/* スレッド */
+
+static void _thread_save(mThread *th)
+{
+	_autosave *p = (_autosave *)th->param;
+	mStr str = MSTR_INIT;
+	mlkerr ret;
+
+	mThreadSetLowPriority();
+
+	//一時ファイルに書き込み後、置き換え
+	// :書き込み途中で終了した場合に、前回のファイルが壊れないように
+
+	mStrCopy(&str, &p->strfile);
+	mStrAppendText(&str, ".tmp");
+
+	ret = _write_file(p, str.buf);
+
+	if(ret == MLKERR_OK && !mRenameFile(str.buf, p->strfile.buf))
+		ret = MLKERR_IO;
+
+	if(ret) mDeleteFile(str.buf);
+
+	mStrFree(&str);
+
+	//終了
+
+	mThreadMutexLock(th->mutex);
+
+	p->err = ret;
+	p->fend = TRUE;
+
+	mThreadMutexUnlock(th->mutex);
+}
+
+/* スレッドが終了しているか */
+
+static mlkbool _is_thread_end(_autosave *p)
+{
+	mlkbool ret;
+
+	mThreadMutexLock(p->th->mutex);
+	ret = p->fend;
+	mThreadMutexUnlock(p->th->mutex);
+
+	return ret;
+}
+
+/* 自動保存ファイル名をセット */
+
+static mlkbool _set_filename(_autosave *p)
+{
+	char *name;
+	mlkerr ret;
+
+	if(mStrIsnotEmpty(&p->strfile)) return TRUE;
+
+	ret = mGuiCreateConfigDir(APP_DIRNAME_AUTOSAVE);
+	if(ret != MLKERR_OK && ret != MLKERR_EXIST)
+		return FALSE;
+
+	name = mGetProcessName();
+	if(!name) return FALSE;
+
+	mGuiGetPath_config(&p->strfile, APP_DIRNAME_AUTOSAVE);
+	mStrPathJoin(&p->strfile, name);
+	mStrAppendText(&p->strfile, ".apd");
+
+	mFree(name);
+
+	return TRUE;
+}
+
+/* ファイル名のプロセスが終了しているか */
+
+static mlkbool _is_dead_process(const char *fname)
+{
+	int pid;
+
+	pid = atoi(fname);
+
+	if(pid <= 0 || pid == getpid())
+		return FALSE;
+
+	return (kill(pid, 0) != 0 && errno != EPERM);
+}
+
+
+//=========================
+// main
+//=========================
+
+
+/** 終了
+ *
+ * 正常終了時は、自動保存ファイルを削除する。 */
+
+void AutoSave_finish(void)
+{
+	AutoSave_deleteFile();
+
+	mStrFree(&g_autosave.strfile);
+}
+
+/** 自動保存を実行
+ *
+ * 変更がない場合は何もしない。
+ *
+ * return: FALSE で、操作中などのため行えなかった (少し後に再試行する) */
+
+mlkbool AutoSave_run(void)
+{
+	_autosave *p = &g_autosave;
+	AppDraw *draw = APPDRAW;
+	uint32_t count;
+
+	count = Undo_getChangeCount();
+
+	if(count == p->change_count && !p->ferr)
+		return TRUE;
+
+	//操作中、スレッド処理中、ダイアログ表示中は行わない
+
+	if(draw->w.optype != DRAW_OPTYPE_NONE
+		|| draw->in_filter_dialog
+		|| draw->in_thread_imgcanvas
+		|| PopupThread_isRunning()
+		|| mGuiGetCurrentModal())
+		return FALSE;
+
+	//前回の書き込みが終わっていない
+
+	if(p->th)
+	{
+		if(!_is_thread_end(p))
+			return FALSE;
+
+		AutoSave_wait();
+	}
+
+	//ファイル名
+
+	if(!_set_filename(p))
+	{
+		p->change_count = count;
+		return TRUE;
+	}
+
+	//レイヤの複製
+
+	p->list = LayerList_newSnapshot(draw->layerlist, draw->curlayer, &p->curlayer);
+	if(!p->list) return FALSE;
+
+	p->info.width = draw->imgw;
+	p->info.height = draw->imgh;
+	p->info.dpi = draw->imgdpi;
+	p->info.bits = draw->imgbits;
+	p->info.coltype = 0;
+	p->info.layernum = LayerList_getNum(p->list);
+	p->info.bkgndcol = MLK_RGB(draw->imgbkcol.c8.r, draw->imgbkcol.c8.g, draw->imgbkcol.c8.b);
+
+	p->change_count = count;
+	p->fend = FALSE;
+
+	//スレッド開始
+
+	p->th = mThreadNew(0, _thread_save, p);
+
+	if(p->th && mThreadRun(p->th))
+		return TRUE;
+
+	//失敗時
+
+	mThreadDestroy(p->th);
+	p->th = NULL;
+
+	LayerList_free(p->list);
+	p->list = NULL;
+
+	return FALSE;
+}
+
+/** 書き込み中であれば、終了を待つ */
+
+void AutoSave_wait(void)
+{
+	_autosave *p = &g_autosave;
+
+	if(!p->th) return;
+
+	mThreadWait(p->th);
+	mThreadDestroy(p->th);
+	p->th = NULL;
+
+	LayerList_free(p->list);
+	p->list = NULL;
+
+	p->ferr = (p->err != MLKERR_OK);
+}
+
+/** 自動保存ファイルを削除
+ *
+ * ファイル保存時など、現在のデータが保存済みになった時。 */
+
+void AutoSave_deleteFile(void)
+{
+	_autosave *p = &g_autosave;
+
+	AutoSave_wait();
+
+	if(mStrIsnotEmpty(&p->strfile))
+		mDeleteFile(p->strfile.buf);
+
+	p->change_count = Undo_getChangeCount();
+	p->ferr = FALSE;
+}
+
+/** 異常終了時の自動保存ファイルを取得
+ *
+ * 終了したプロセスのファイルのうち、最も新しいものを返す。
+ * それ以外の古いファイルは削除する。
+ *
+ * return: ファイルがあるか */
+
+mlkbool AutoSave_getRecoveryFile(mStr *strdst)
+{
+	mDir *dir;
+	mStr str = MSTR_INIT,strpath = MSTR_INIT;
+	mFileStat st;
+	uint64_t time = 0;
+	mlkbool ret = FALSE;
+
+	mStrEmpty(strdst);
+
+	mGuiGetPath_config(&strpath, APP_DIRNAME_AUTOSAVE);
+
+	dir = mDirOpen(strpath.buf);
+	if(!dir) goto END;
+
+	while(mDirNext(dir))
+	{
+		if(mDirIsDirectory(dir)
+			|| !_is_dead_process(mDirGetFilename(dir)))
+			continue;
+
+		mDirGetFilename_str(dir, &str, TRUE);
+
+		//書き込み途中の一時ファイル
+
+		if(!mDirCompareExt(dir, "apd"))
+		{
+			mDeleteFile(str.buf);
+			continue;
+		}
+
+		if(!mDirGetStat(dir, &st)) continue;
+
+		//新しい方を残す
+
+		if(!ret || st.time_modify > time)
+		{
+			if(ret) mDeleteFile(strdst->buf);
+
+			mStrCopy(strdst, &str);
+			time = st.time_modify;
+			ret = TRUE;
+		}
+		else
+			mDeleteFile(str.buf);
+	}
+
+	mDirClose(dir);
+
+END:
+	mStrFree(&str);
+	mStrFree(&strpath);
+
+	return ret;
+}
+
+/** 復元したファイルを、現在のプロセスの自動保存ファイルとする */
+
+void AutoSave_setRecoveryFile(const char *filename)
+{
+	_autosave *p = &g_autosave;
+
+	if(!_set_filename(p)
+		|| !mRenameFile(filename, p->strfile.buf))
+		mDeleteFile(filename);
+
+	p->change_count = Undo_getChangeCount();
+}
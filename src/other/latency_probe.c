@@ -0,0 +1,349 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * 描画の遅延計測
+ *
+ * 入力から画面表示までの各段階の時間を計測し、
+ * ヒストグラムとして集計する。
+ *****************************************/
+
+#include <stdio.h>
+
+#include "mlk_gui.h"
+#include "mlk_str.h"
+#include "mlk_stdio.h"
+#include "mlk_nanotime.h"
+
+#include "def_draw.h"
+
+#include "draw_op_def.h"
+#include "statusbar.h"
+
+#include "latency_probe.h"
+
+
+/*
+  - 起動時のオプション "--latency=<FILE>" で有効になる。
+    終了時に、集計結果を FILE にテキストで出力する。
+    "--latency-overlay" も指定すると、ストローク終了ごとに
+    ステータスバーに概要を表示する。
+  - 無効時は、各関数は何もしない。
+  - ヒストグラムは、マイクロ秒単位の2の累乗ごとに区切る。
+    [0] = 1us 未満、[n] = 2^(n-1)〜2^n us。
+  - 各段階は、同時には一つのスレッドからしか記録されないので、ロックはしない。
+    (RASTER は描画スレッドの場合があるが、その間 GUI スレッドは RASTER を記録しない)
+  - TOTAL は、まだ表示されていない一番古いポインタイベントの受信時刻から、
+    キャンバスを描画した後の転送終了までの時間。
+*/
+
+//---------------------
+
+#define _HIST_NUM  32
+
+typedef struct
+{
+	uint32_t hist[_HIST_NUM],
+		count;
+	uint64_t sum,	//合計 (ns)
+		max;		//最大 (ns)
+}_stage;
+
+typedef struct
+{
+	_stage stage[LATENCY_STAGE_NUM];
+
+	mStr strfile;		//出力ファイル名
+	uint64_t t_input,	//未表示の一番古い入力の時刻 (0 でなし)
+		t_render;		//転送開始時刻
+	mlkbool enable,
+		overlay,		//ステータスバーに表示
+		fcanvas;		//入力後にキャンバスが描画された
+}_latency;
+
+static _latency g_latency = {0};
+
+static const char *g_stage_name[] = {
+	"raster", "blend", "canvas", "commit", "total"
+};
+
+//---------------------
+
+
+/* 現在時刻を取得 (ns) */
+
+static uint64_t _get_time(void)
+{
+	mNanoTime nt;
+
+	mNanoTimeGet(&nt);
+
+	return nt.sec * 1000000000 + nt.ns;
+}
+
+/* 時間を記録 */
+
+static void _add_time(_stage *p,uint64_t t)
+{
+	uint64_t us;
+	int n;
+
+	//ヒストグラムの位置
+
+	us = t / 1000;
+
+	for(n = 0; us && n < _HIST_NUM - 1; n++, us >>= 1);
+
+	p->hist[n]++;
+
+	//
+
+	p->count++;
+	p->sum += t;
+
+	if(t > p->max) p->max = t;
+}
+
+/* パーセンタイル値を取得 (us)
+ *
+ * ヒストグラムの区間内は線形補間する。 */
+
+static double _get_percentile(_stage *p,int per)
+{
+	uint32_t pos,cnt = 0;
+	double low,high;
+	int i;
+
+	if(!p->count) return 0;
+
+	pos = (uint32_t)((uint64_t)p->count * per / 100);
+
+	for(i = 0; i < _HIST_NUM; i++)
+	{
+		if(cnt + p->hist[i] > pos)
+		{
+			low = (i == 0)? 0: (double)(1 << (i - 1));
+			high = (double)((uint64_t)1 << i);
+
+			return low + (high - low) * (pos - cnt) / p->hist[i];
+		}
+
+		cnt += p->hist[i];
+	}
+
+	return p->max / 1000.0;
+}
+
+/* mlk からの計測ハンドラ */
+
+static void _probe_handle(int type)
+{
+	_latency *p = &g_latency;
+	uint64_t t;
+
+	switch(type)
+	{
+		//ポインタイベント受信
+		// :未表示の入力がある場合は、古い方を残す
+		case MGUI_PROBE_POINTER:
+			if(!p->t_input)
+				p->t_input = _get_time();
+			break;
+		//転送開始
+		case MGUI_PROBE_RENDER_BEGIN:
+			p->t_render = _get_time();
+			break;
+		//転送終了
+		case MGUI_PROBE_RENDER_END:
+			t = _get_time();
+
+			_add_time(p->stage + LATENCY_STAGE_COMMIT, t - p->t_render);
+
+			if(p->fcanvas)
+			{
+				if(p->t_input)
+					_add_time(p->stage + LATENCY_STAGE_TOTAL, t - p->t_input);
+
+				p->t_input = 0;
+				p->fcanvas = FALSE;
+			}
+			else if(APPDRAW->w.optype == DRAW_OPTYPE_NONE)
+			{
+				//操作中でない場合、キャンバスを更新しない入力は対象外
+				p->t_input = 0;
+			}
+			break;
+	}
+}
+
+/* ファイルに出力 */
+
+static void _write_file(_latency *p,const char *filename)
+{
+	FILE *fp;
+	_stage *ps;
+	int i,j;
+
+	fp = mFILEopen(filename, "w");
+	if(!fp) return;
+
+	//各段階の概要
+
+	fputs("# stage count mean(us) p50(us) p90(us) p99(us) max(us)\n", fp);
+
+	for(i = 0; i < LATENCY_STAGE_NUM; i++)
+	{
+		ps = p->stage + i;
+
+		fprintf(fp, "%s %u %.1f %.1f %.1f %.1f %.1f\n",
+			g_stage_name[i], ps->count,
+			(ps->count)? ps->sum / 1000.0 / ps->count: 0,
+			_get_percentile(ps, 50), _get_percentile(ps, 90), _get_percentile(ps, 99),
+			ps->max / 1000.0);
+	}
+
+	//ヒストグラム
+
+	fputs("\n# histogram: <us", fp);
+
+	for(i = 0; i < LATENCY_STAGE_NUM; i++)
+		fprintf(fp, " %s", g_stage_name[i]);
+
+	fputc('\n', fp);
+
+	for(j = 0; j < _HIST_NUM; j++)
+	{
+		fprintf(fp, "%u", 1U << j);
+
+		for(i = 0; i < LATENCY_STAGE_NUM; i++)
+			fprintf(fp, " %u", p->stage[i].hist[j]);
+
+		fputc('\n', fp);
+	}
+
+	fclose(fp);
+}
+
+
+//=========================
+// main
+//=========================
+
+
+/** 計測を開始
+ *
+ * mGuiInitBackend() の後に行う。
+ *
+ * filename: 終了時に出力するファイル名 (ロケール文字列)
+ * overlay: ストローク終了時にステータスバーに表示 */
+
+void LatencyProbe_init(const char *filename,mlkbool overlay)
+{
+	_latency *p = &g_latency;
+
+	p->enable = TRUE;
+	p->overlay = overlay;
+
+	mStrSetText_locale(&p->strfile, filename, -1);
+
+	mGuiSetProbeHandler(_probe_handle);
+}
+
+/** 終了 (ファイルに出力) */
+
+void LatencyProbe_finish(void)
+{
+	_latency *p = &g_latency;
+
+	if(!p->enable) return;
+
+	mGuiSetProbeHandler(NULL);
+
+	_write_file(p, p->strfile.buf);
+
+	mStrFree(&p->strfile);
+
+	p->enable = FALSE;
+}
+
+/** 計測が有効か */
+
+mlkbool LatencyProbe_isEnable(void)
+{
+	return g_latency.enable;
+}
+
+/** 計測開始時の時刻を取得
+ *
+ * return: 無効時は 0 */
+
+uint64_t LatencyProbe_begin(void)
+{
+	return (g_latency.enable)? _get_time(): 0;
+}
+
+/** 計測終了時、時間を記録
+ *
+ * begin: LatencyProbe_begin() の戻り値 */
+
+void LatencyProbe_end(int stage,uint64_t begin)
+{
+	if(!begin) return;
+
+	_add_time(g_latency.stage + stage, _get_time() - begin);
+
+	if(stage == LATENCY_STAGE_CANVAS)
+		g_latency.fcanvas = TRUE;
+}
+
+/** ストローク終了時
+ *
+ * オーバーレイが有効なら、ステータスバーに概要を表示する。 */
+
+void LatencyProbe_onStrokeEnd(void)
+{
+	mStr str = MSTR_INIT;
+
+	if(!g_latency.overlay) return;
+
+	LatencyProbe_getSummary(&str);
+
+	StatusBar_setHelp_text(str.buf);
+
+	mStrFree(&str);
+}
+
+/** 概要の文字列を取得 */
+
+void LatencyProbe_getSummary(mStr *str)
+{
+	_latency *p = &g_latency;
+	_stage *ps;
+
+	ps = p->stage + LATENCY_STAGE_TOTAL;
+
+	mStrSetFormat(str, "latency p50 %.1fms p99 %.1fms max %.1fms",
+		_get_percentile(ps, 50) / 1000, _get_percentile(ps, 99) / 1000,
+		ps->max / 1000000.0);
+
+	ps = p->stage + LATENCY_STAGE_RASTER;
+
+	if(ps->count)
+		mStrAppendFormat(str, " | raster %.1fus", ps->sum / 1000.0 / ps->count);
+}
@@ -169,6 +169,7 @@ void LayerItem_replaceImage(LayerItem *p,TileImage *img,int type)
 	TileImage_free(p->img);
 
 	p->img = img;
+	p->apd_size = 0;
 
 	if(type >= 0) p->type = type;
 }
@@ -180,6 +181,7 @@ void LayerItem_replaceImage(LayerItem *p,TileImage *img,int type)
 void LayerItem_setImage(LayerItem *p,TileImage *img)
 {
 	p->img = img;
+	p->apd_size = 0;
 	p->type = img->type;
 	p->col = RGBcombo_to_32bit(&img->col);
 }
@@ -94,6 +94,22 @@ static void _destroy_item(mTree *tree,mTreeItem *item)
 	mFree(p->texture_path);
 }
 
+/* ツリーアイテム 破棄ハンドラ (スナップショット用)
+ *
+ * AppDraw のデータは参照しない (スレッドから解放される場合がある)。 */
+
+static void _destroy_item_snapshot(mTree *tree,mTreeItem *item)
+{
+	LayerItem *p = (LayerItem *)item;
+
+	TileImage_free(p->img);
+
+	mListDeleteAll(&p->list_text);
+
+	mFree(p->name);
+	mFree(p->texture_path);
+}
+
 /* LayerItem 確保 (ツリーへのリンクは行わない) */
 
 static LayerItem *_item_new(LayerList *list)
@@ -134,6 +150,79 @@ LayerList *LayerList_new(void)
 	return p;
 }
 
+/** スナップショットのレイヤリストを作成
+ *
+ * 保存用に、すべてのレイヤの情報とイメージを複製する。
+ * レイヤテクスチャのイメージは参照しない。
+ *
+ * current: src のカレントレイヤ
+ * ppcur: 複製されたカレントレイヤが入る
+ * return: NULL で失敗 */
+
+LayerList *LayerList_newSnapshot(LayerList *src,LayerItem *current,LayerItem **ppcur)
+{
+	LayerList *p;
+	LayerItem *pi,*pinew,**parents;
+	TileImage *img;
+	int depth;
+
+	*ppcur = NULL;
+
+	p = LayerList_new();
+	if(!p) return NULL;
+
+	p->tree.item_destroy = _destroy_item_snapshot;
+
+	//各階層の複製先の親 ([0] はルート)
+
+	parents = (LayerItem **)mMalloc0(sizeof(LayerItem *) * (src->num + 1));
+	if(!parents) goto ERR;
+
+	for(pi = _TOPITEM(src); pi; pi = _NEXT_TREEITEM(pi))
+	{
+		//イメージ
+
+		img = NULL;
+
+		if(pi->img)
+		{
+			img = TileImage_newClone(pi->img);
+			if(!img) goto ERR;
+		}
+
+		//追加
+
+		depth = LayerItem_getTreeDepth(pi);
+
+		pinew = LayerList_addLayer_parent(p, parents[depth]);
+		if(!pinew)
+		{
+			TileImage_free(img);
+			goto ERR;
+		}
+
+		pinew->img = img;
+		pinew->type = pi->type;
+
+		LayerItem_copyInfo(pinew, pi);
+		LayerItem_appendText_dup(pinew, pi);
+
+		parents[depth + 1] = pinew;
+
+		if(pi == current)
+			*ppcur = pinew;
+	}
+
+	mFree(parents);
+
+	return p;
+
+ERR:
+	mFree(parents);
+	LayerList_free(p);
+	return NULL;
+}
+
 /** レイヤリスト解放 */
 
 void LayerList_free(LayerList *p)
@@ -757,6 +846,18 @@ void LayerList_replaceToneLines_all(LayerList *p,int src,int dst)
 	}
 }
 
+/** すべてのレイヤの APD 保存情報をクリア
+ *
+ * 次回の保存時は、すべてのイメージを圧縮し直す。 */
+
+void LayerList_clearApdInfo(LayerList *p)
+{
+	LayerItem *pi;
+
+	for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
+		pi->apd_size = 0;
+}
+
 
 //=========================
 // リンク
@@ -1245,9 +1346,27 @@ void LayerList_convertImageBits(LayerList *p,int bits,mPopupProgress *prog)
 	for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
 	{
 		if(pi->img)
+		{
 			TileImage_convertBits(pi->img, bits, tblbuf, prog);
+			TileImage_shareSolidTiles(pi->img);
+		}
 	}
 
 	mFree(tblbuf);
 }
 
+/** すべてのレイヤで、単色のタイルを共有の単色タイルにする
+ *
+ * ファイル読み込み後。 */
+
+void LayerList_shareSolidTiles(LayerList *p)
+{
+	LayerItem *pi;
+
+	for(pi = _TOPITEM(p); pi; pi = _NEXT_TREEITEM(pi))
+	{
+		if(pi->img)
+			TileImage_shareSolidTiles(pi->img);
+	}
+}
+
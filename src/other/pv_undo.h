@@ -29,6 +29,7 @@ typedef struct
 
 	UndoUpdateInfo update;	//(作業用) 更新情報
 	uint8_t fmodify;		//データが変更されたかのフラグに使う
+	uint32_t change_count;	//変更ごとに +1 (自動保存の判定用)
 
 	uint32_t used_bufsize;	//バッファに確保されたアンドゥデータの総サイズ
 	int cur_fileno,			//[file] ファイル番号の現在値
@@ -0,0 +1,333 @@
+/*$
+ Copyright (C) 2013-2022 Azel.
+
+ This file is part of AzPainter.
+
+ AzPainter is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ AzPainter is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+$*/
+
+/*****************************************
+ * スレッドプール
+ *
+ * 常駐するワーカースレッドで、ジョブを並列処理する
+ *****************************************/
+
+#include "mlk.h"
+#include "mlk_thread.h"
+#include "mlk_util.h"
+
+#include "threadpool.h"
+
+
+/*
+  - ジョブは番号 (0〜jobnum-1) のみで指定し、空いているスレッドから順に取得する。
+  - 呼び出し元のスレッドも、スレッド番号 0 として処理に参加する。
+  - 実行中に他のスレッドから (またはジョブ内から) 呼ばれた場合は、
+    呼び出し元のスレッドのみで順に処理する。
+  - 終了時は、実行中のジョブがすべて終わるまで待ってからスレッドを終了する。
+    (スレッド数変更時に、他のスレッドでの処理中に破棄しないように)
+*/
+
+//---------------------
+
+typedef struct
+{
+	mThreadMutex mutex;
+	mThreadCond cond_job,	//ジョブ開始の通知
+		cond_end;			//ワーカー終了の通知
+
+	mThread *thread[THREADPOOL_MAXNUM];
+
+	int num,		//スレッド数 (呼び出し元含む)
+		jobnum,		//ジョブ数
+		jobnext,	//次に処理するジョブ番号
+		running,	//処理中のワーカー数
+		gen;		//ジョブの世代 (実行ごとに +1)
+	uint8_t fbusy,	//実行中
+		fexit;		//終了要求
+
+	ThreadPoolFunc func;
+	void *param;
+}_threadpool;
+
+typedef struct
+{
+	mThread th;
+	int no;		//スレッド番号 (1〜)
+}_worker;
+
+static _threadpool *g_threadpool = NULL;
+
+//---------------------
+
+
+/* ジョブを取得して処理
+ *
+ * 処理するジョブがなくなったら戻る。 */
+
+static void _proc_jobs(_threadpool *p,int threadno)
+{
+	int no;
+
+	while(1)
+	{
+		mThreadMutexLock(p->mutex);
+
+		no = p->jobnext;
+		if(no < p->jobnum) p->jobnext++;
+
+		mThreadMutexUnlock(p->mutex);
+
+		if(no >= p->jobnum) break;
+
+		(p->func)(p->param, no, threadno);
+	}
+}
+
+/* ワーカースレッド */
+
+static void _thread_worker(mThread *th)
+{
+	_threadpool *p = (_threadpool *)th->param;
+	int no,gen = 0;
+
+	no = ((_worker *)th)->no;
+
+	while(1)
+	{
+		//ジョブの開始か、終了要求を待つ
+
+		mThreadMutexLock(p->mutex);
+
+		while(!p->fexit && p->gen == gen)
+			mThreadCondWait(p->cond_job, p->mutex);
+
+		gen = p->gen;
+
+		if(p->fexit)
+		{
+			mThreadMutexUnlock(p->mutex);
+			break;
+		}
+
+		mThreadMutexUnlock(p->mutex);
+
+		//処理
+
+		_proc_jobs(p, no);
+
+		//終了
+
+		mThreadMutexLock(p->mutex);
+
+		p->running--;
+		if(p->running == 0)
+			mThreadCondBroadcast(p->cond_end);
+
+		mThreadMutexUnlock(p->mutex);
+	}
+}
+
+
+//=========================
+
+
+/** 初期化
+ *
+ * num: スレッド数 (呼び出し元含む)。0 以下で CPU 数。
+ * return: FALSE で失敗 (スレッドなしで処理する) */
+
+mlkbool ThreadPool_init(int num)
+{
+	_threadpool *p;
+	_worker *th;
+	int i;
+
+	if(num <= 0)
+		num = mGetCPUNum();
+
+	if(num > THREADPOOL_MAXNUM)
+		num = THREADPOOL_MAXNUM;
+
+	//作成
+
+	p = (_threadpool *)mMalloc0(sizeof(_threadpool));
+	if(!p) return FALSE;
+
+	p->mutex = mThreadMutexNew();
+	p->cond_job = mThreadCondNew();
+	p->cond_end = mThreadCondNew();
+	p->num = 1;
+
+	if(!p->mutex || !p->cond_job || !p->cond_end)
+	{
+		mThreadCondDestroy(p->cond_job);
+		mThreadCondDestroy(p->cond_end);
+		mThreadMutexDestroy(p->mutex);
+		mFree(p);
+		return FALSE;
+	}
+
+	g_threadpool = p;
+
+	//ワーカースレッド (呼び出し元の分は除く)
+
+	for(i = 1; i < num; i++)
+	{
+		th = (_worker *)mThreadNew(sizeof(_worker), _thread_worker, p);
+		if(!th) break;
+
+		th->no = i;
+
+		if(!mThreadRun((mThread *)th))
+		{
+			mThreadDestroy((mThread *)th);
+			break;
+		}
+
+		p->thread[i] = (mThread *)th;
+		p->num++;
+	}
+
+	return TRUE;
+}
+
+/** 終了
+ *
+ * 他のスレッドでジョブを実行中の場合は、終わるまで待つ。 */
+
+void ThreadPool_finish(void)
+{
+	_threadpool *p = g_threadpool;
+	int i;
+
+	if(!p) return;
+
+	//実行中のジョブの終了を待ち、終了要求
+
+	mThreadMutexLock(p->mutex);
+
+	while(p->fbusy)
+		mThreadCondWait(p->cond_end, p->mutex);
+
+	p->fexit = TRUE;
+	mThreadCondBroadcast(p->cond_job);
+
+	mThreadMutexUnlock(p->mutex);
+
+	//スレッド終了を待つ
+
+	for(i = 1; i < p->num; i++)
+	{
+		mThreadWait(p->thread[i]);
+		mThreadDestroy(p->thread[i]);
+	}
+
+	mThreadCondDestroy(p->cond_job);
+	mThreadCondDestroy(p->cond_end);
+	mThreadMutexDestroy(p->mutex);
+
+	mFree(p);
+
+	g_threadpool = NULL;
+}
+
+/** スレッド数を取得 (呼び出し元含む)
+ *
+ * スレッドごとの作業用データを確保する際のサイズとして使う。 */
+
+int ThreadPool_getNum(void)
+{
+	return (g_threadpool)? g_threadpool->num: 1;
+}
+
+/** 並列処理が可能か */
+
+mlkbool ThreadPool_isParallel(void)
+{
+	return (g_threadpool && g_threadpool->num > 1);
+}
+
+/** ジョブを実行して、すべて終了するまで待つ
+ *
+ * func: ジョブの処理関数
+ * jobnum: ジョブ数 */
+
+void ThreadPool_run(ThreadPoolFunc func,void *param,int jobnum)
+{
+	_threadpool *p = g_threadpool;
+	int i;
+	mlkbool fbusy;
+
+	if(jobnum <= 0) return;
+
+	//スレッドなし、またはジョブが一つの場合は、そのまま実行
+
+	if(!p || p->num == 1 || jobnum == 1)
+	{
+		for(i = 0; i < jobnum; i++)
+			(func)(param, i, 0);
+
+		return;
+	}
+
+	//開始
+
+	mThreadMutexLock(p->mutex);
+
+	//終了処理中も、実行中として扱う
+
+	fbusy = (p->fbusy || p->fexit);
+
+	if(!fbusy)
+	{
+		p->fbusy = TRUE;
+		p->func = func;
+		p->param = param;
+		p->jobnum = jobnum;
+		p->jobnext = 0;
+		p->running = p->num - 1;
+		p->gen++;
+
+		mThreadCondBroadcast(p->cond_job);
+	}
+
+	mThreadMutexUnlock(p->mutex);
+
+	//他で実行中の場合は、呼び出し元のみで処理
+
+	if(fbusy)
+	{
+		for(i = 0; i < jobnum; i++)
+			(func)(param, i, 0);
+
+		return;
+	}
+
+	//呼び出し元も処理
+
+	_proc_jobs(p, 0);
+
+	//ワーカーの終了を待つ
+
+	mThreadMutexLock(p->mutex);
+
+	while(p->running)
+		mThreadCondWait(p->cond_end, p->mutex);
+
+	p->fbusy = FALSE;
+	mThreadCondBroadcast(p->cond_end);
+
+	mThreadMutexUnlock(p->mutex);
+}
@@ -53,6 +53,47 @@ AppUndo *g_app_undo = NULL;
 //========================
 
 
+/* APD 保存情報のクリア
+ *
+ * イメージが変更されるレイヤは、次回の保存時にイメージを圧縮し直す。
+ * undo: 実行するアイテム。NULL で追加時 (対象はカレントレイヤ) */
+
+static void _clear_apdinfo(int type,UndoItem *undo)
+{
+	LayerItem *item;
+
+	switch(type)
+	{
+		//単体レイヤのイメージ
+		case UNDO_TYPE_TILEIMAGE:
+		case UNDO_TYPE_LAYERTEXT_NEW:
+		case UNDO_TYPE_LAYERTEXT_EDIT:
+		case UNDO_TYPE_LAYERTEXT_MOVE:
+		case UNDO_TYPE_LAYERTEXT_DELETE:
+		case UNDO_TYPE_LAYERTEXT_CLEAR:
+			if(undo)
+				item = UndoItem_getLayerAtIndex(undo->val[0]);
+			else
+				item = APPDRAW->curlayer;
+
+			if(item) item->apd_size = 0;
+			break;
+
+		//既存レイヤのイメージは変わらない
+		case UNDO_TYPE_LAYER_NEW:
+		case UNDO_TYPE_LAYER_DUP:
+		case UNDO_TYPE_LAYER_DELETE:
+		case UNDO_TYPE_LAYER_MOVE_LIST:
+		case UNDO_TYPE_LAYER_MOVE_LIST_MULTI:
+			break;
+
+		default:
+			LayerList_clearApdInfo(APPDRAW->layerlist);
+			break;
+	}
+}
+
+
 /* (mUndo) アイテム作成 */
 
 static mlkerr _newitem_handle(mUndo *p,mListItem **ppdst)
@@ -75,6 +116,7 @@ static mlkerr _newitem_handle(mUndo *p,mListItem **ppdst)
 	// :イメージが変更されたということなので、フラグ ON
 
 	APPUNDO->fmodify = TRUE;
+	APPUNDO->change_count++;
 
 	return MLKERR_OK;
 }
@@ -259,6 +301,15 @@ static mlkerr _setreverse_handle(mUndo *undo,
 				return UndoItem_setdat_layer(dst, LayerList_getTopItem(APPDRAW->layerlist));
 			else
 				return UndoItem_setdat_layerAll(dst);
+
+		//キャンバス拡大縮小 (レイヤ維持)
+		case UNDO_TYPE_SCALE_CANVAS_LAYER:
+			dst->val[0] = APPDRAW->imgw;
+			dst->val[1] = APPDRAW->imgh;
+			dst->val[2] = APPDRAW->imgdpi;
+			dst->val[3] = LayerList_getItemIndex(APPDRAW->layerlist, APPDRAW->curlayer);
+
+			return UndoItem_setdat_layerAll(dst);
 	}
 
 	return MLKERR_OK;
@@ -280,6 +331,10 @@ static mlkerr _run_handle(mUndo *undoptr,mListItem *runitem,int runtype)
 
 	mRectEmpty(&update->rc);
 
+	//APD 保存情報
+
+	_clear_apdinfo(item->type, item);
+
 	//
 
 	switch(item->type)
@@ -387,6 +442,10 @@ static mlkerr _run_handle(mUndo *undoptr,mListItem *runitem,int runtype)
 		//キャンバス拡大縮小
 		case UNDO_TYPE_SCALE_CANVAS:
 			return UndoItem_runCanvasScale(item, update, runtype);
+
+		//キャンバス拡大縮小 (レイヤ維持)
+		case UNDO_TYPE_SCALE_CANVAS_LAYER:
+			return UndoItem_runCanvasScale_layer(item, update);
 	}
 
 	return MLKERR_OK;
@@ -406,6 +465,10 @@ static mlkerr _add_item(int type,UndoItem **ppdst)
 	mListItem *pi;
 	mlkerr ret;
 
+	//APD 保存情報
+
+	_clear_apdinfo(type, NULL);
+
 	ret = _newitem_handle(&APPUNDO->undo, &pi);
 	if(ret)
 	{
@@ -504,6 +567,13 @@ void Undo_setModifyFlag_off(void)
 	APPUNDO->fmodify = FALSE;
 }
 
+/** データ更新用フラグを ON (未保存のデータとして扱う) */
+
+void Undo_setModifyFlag_on(void)
+{
+	APPUNDO->fmodify = TRUE;
+}
+
 /** アンドゥ最大回数をセット */
 
 void Undo_setMaxNum(int num)
@@ -536,11 +606,25 @@ mlkbool Undo_isModify(void)
 	return APPUNDO->fmodify;
 }
 
+/** 変更カウントを取得
+ *
+ * 前回の取得時から値が変わっていれば、データが変更されている。 */
+
+uint32_t Undo_getChangeCount(void)
+{
+	return APPUNDO->change_count;
+}
+
 /** すべて削除 */
 
 void Undo_deleteAll(void)
 {
 	mUndoDeleteAll(&APPUNDO->undo);
+
+	//エラー時はイメージが中途半端に変更されている場合がある
+
+	if(APPDRAW->layerlist)
+		LayerList_clearApdInfo(APPDRAW->layerlist);
 }
 
 /** アンドゥ/リドゥ実行
@@ -1122,3 +1206,29 @@ mlkerr Undo_addScaleCanvas(void)
 	return ret;
 }
 
+/** キャンバス拡大縮小 (レイヤ維持)
+ *
+ * w,h: 変更前のキャンバスサイズ */
+
+mlkerr Undo_addScaleCanvas_layer(int w,int h)
+{
+	UndoItem *pi;
+	mlkerr ret;
+
+	ret = _add_item(UNDO_TYPE_SCALE_CANVAS_LAYER, &pi);
+	if(ret) return ret;
+
+	pi->val[0] = w;
+	pi->val[1] = h;
+	pi->val[2] = APPDRAW->imgdpi;
+	pi->val[3] = LayerList_getItemIndex(APPDRAW->layerlist, APPDRAW->curlayer);
+
+	//テキストレイヤは通常レイヤになるので、レイヤ情報も含めてすべて
+
+	ret = UndoItem_setdat_layerAll(pi);
+	if(ret)
+		_on_failed();
+
+	return ret;
+}
+
@@ -635,6 +635,39 @@ mlkerr UndoItem_runCanvasScale(UndoItem *p,UndoUpdateInfo *info,int runtype)
 	return ret;
 }
 
+/** キャンバス拡大縮小 (レイヤ維持)
+ *
+ * UNDO/REDO 共に、全レイヤを削除して、保存されたレイヤを復元する。 */
+
+mlkerr UndoItem_runCanvasScale_layer(UndoItem *p,UndoUpdateInfo *info)
+{
+	mRect rc;
+	mlkerr ret;
+
+	info->type = UNDO_UPDATE_CANVAS_RESIZE;
+	info->rc.x1 = p->val[0];
+	info->rc.y1 = p->val[1];
+
+	drawImage_changeDPI(APPDRAW, p->val[2]);
+
+	//
+
+	_CURSOR_WAIT;
+
+	LayerList_clear(APPDRAW->layerlist);
+
+	ret = UndoItem_restore_layerMulti(p, &rc);
+
+	APPDRAW->curlayer = UndoItem_getLayerAtIndex(p->val[3]);
+
+	if(!APPDRAW->curlayer)
+		APPDRAW->curlayer = LayerList_getTopItem(APPDRAW->layerlist);
+
+	_CURSOR_RESTORE;
+
+	return ret;
+}
+
 
 //============================
 // レイヤテキスト
@@ -551,7 +551,7 @@ static const uint8_t g_eff_rgbshift[] = {
 //油絵風
 static const uint8_t g_eff_oilpaint[] = {
 	FDDAT_PREV_IN_DIALOG, PREVSIZE_DEF,
-	WG_BAR, TRID_RADIUS, 8, VAL16(100), VAL16(1), VAL16(8), VAL16(2),
+	WG_BAR, TRID_RADIUS, 8, VAL16(160), VAL16(1), VAL16(50), VAL16(2),
 	WG_DEF_CLIPPING,
 	WG_END
 };
@@ -595,7 +595,7 @@ static const uint8_t g_eff_scratch[] = {
 //メディアン
 static const uint8_t g_eff_median[] = {
 	FDDAT_PREV_IN_DIALOG, PREVSIZE_DEF,
-	WG_BAR, TRID_RADIUS, 6, VAL16(50), VAL16(1), VAL16(3),
+	WG_BAR, TRID_RADIUS, 6, VAL16(160), VAL16(1), VAL16(50),
 	WG_COMBO, TRID_TYPE, 3, VAL16(TRID_MEDIAN_TYPE_LIST), 1,
 	WG_DEF_CLIPPING,
 	WG_END
@@ -56,7 +56,8 @@ enum
 	TRID_RATIO,
 	TRID_KEEP_ASPECT,
 	TRID_CHANGE_DPI,
-	TRID_METHOD
+	TRID_METHOD,
+	TRID_KEEP_LAYER
 };
 
 //--------------------
@@ -189,7 +190,8 @@ typedef struct
 	mLineEdit *edit[4],
 		*edit_dpi;
 	mCheckButton *ck_aspect,
-		*ck_dpi;
+		*ck_dpi,
+		*ck_layer;
 	mComboBox *cb_type;
 
 	CanvasScaleInfo *info;
@@ -441,6 +443,11 @@ static _dlg_scale *_scale_create(mWindow *parent,CanvasScaleInfo *info)
 	mComboBoxSetAutoWidth(p->cb_type);
 	mComboBoxSetSelItem_atIndex(p->cb_type, APPCONF->canvas_scale_method);
 
+	//レイヤを維持
+
+	p->ck_layer = mCheckButtonCreate(MLK_WIDGET(p), 0, 0, MLK_MAKE32_4(0,10,0,0),
+		0, MLK_TR(TRID_KEEP_LAYER), APPCONF->canvas_scale_keep_layer);
+
 	//OK/cancel
 
 	mContainerCreateButtons_okcancel(MLK_WIDGET(p), MLK_MAKE32_4(0,15,0,0));
@@ -470,8 +477,10 @@ mlkbool CanvasDialog_scale(mWindow *parent,CanvasScaleInfo *info)
 		info->h = mLineEditGetNum(p->edit[1]);
 		info->dpi = (mCheckButtonIsChecked(p->ck_dpi))? mLineEditGetNum(p->edit_dpi): -1;
 		info->method = mComboBoxGetItemParam(p->cb_type, -1);
+		info->keep_layer = mCheckButtonIsChecked(p->ck_layer);
 
 		APPCONF->canvas_scale_method = info->method;
+		APPCONF->canvas_scale_keep_layer = info->keep_layer;
 	}
 
 	mWidgetDestroy(MLK_WIDGET(p));
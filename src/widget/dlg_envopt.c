@@ -39,10 +39,14 @@ $*/
 
 #include "def_config.h"
 #include "def_draw.h"
+#include "def_saveopt.h"
 
 #include "undo.h"
 #include "draw_main.h"
 #include "draw_rule.h"
+#include "threadpool.h"
+#include "autosave.h"
+#include "appconfig.h"
 
 #include "widget_func.h"
 
@@ -111,6 +115,10 @@ static void _config_to_data(EnvOptData *pd,AppConfig *cf)
 	pd->undo_maxbufsize = cf->undo_maxbufsize;
 	pd->canv_zoom_step = cf->canvas_zoom_step_hi;
 	pd->canv_rotate_step = cf->canvas_angle_step;
+	pd->thread_num = cf->thread_num;
+	pd->autosave_min = cf->autosave_min;
+	pd->tile_maxmem_mb = cf->tile_maxmem_mb;
+	pd->apd_complevel = SAVEOPT_APD_GET_LEVEL(cf->save.apd);
 
 	//フラグ
 
@@ -201,6 +209,21 @@ static int _data_to_config(AppConfig *cf,EnvOptData *pd)
 	cf->undo_maxbufsize = pd->undo_maxbufsize;
 	cf->canvas_zoom_step_hi = pd->canv_zoom_step;
 	cf->canvas_angle_step = pd->canv_rotate_step;
+
+	if(cf->thread_num != pd->thread_num)
+	{
+		cf->thread_num = pd->thread_num;
+		ret |= 1<<4;
+	}
+
+	if(cf->autosave_min != pd->autosave_min)
+	{
+		cf->autosave_min = pd->autosave_min;
+		ret |= 1<<5;
+	}
+
+	cf->tile_maxmem_mb = pd->tile_maxmem_mb;
+	cf->save.apd = pd->apd_complevel;
 	
 	//フラグ
 
@@ -246,6 +269,20 @@ static int _data_to_config(AppConfig *cf,EnvOptData *pd)
 
 	Undo_setMaxNum(cf->undo_maxnum);
 
+	//タイルのスワップ
+
+	AppConfig_setTileSwap();
+
+	//スレッド数変更
+	// :自動保存の終了を待った後、ThreadPool_finish() で実行中のジョブの終了を待つ
+
+	if(ret & (1<<4))
+	{
+		AutoSave_wait();
+
+		ThreadPool_finish();
+		ThreadPool_init(cf->thread_num);
+	}
 	return ret;
 }
 
@@ -40,6 +40,7 @@ $*/
 
 #include "widget_func.h"
 #include "apphelp.h"
+#include "threadpool.h"
 
 #include "trid.h"
 
@@ -71,13 +72,18 @@ typedef struct
 		*edit_undonum,
 		*edit_undobuf,
 		*edit_zoom_step,
-		*edit_rotate_step;
+		*edit_rotate_step,
+		*edit_thread_num,
+		*edit_autosave_min,
+		*edit_tile_maxmem,
+		*edit_apd_complevel;
 	mCheckButton *ck_bits8;
 }_pagedata_opt1;
 
 enum
 {
-	WID_OPT1_HELP_UNDOBUF = 100
+	WID_OPT1_HELP_UNDOBUF = 100,
+	WID_OPT1_HELP_TILE_MAXMEM
 };
 
 
@@ -166,6 +172,14 @@ static mlkbool _opt1_getdata(mPager *p,void *pagedat,void *dst)
 
 	dat->canv_rotate_step = mLineEditGetNum(pd->edit_rotate_step);
 
+	dat->thread_num = mLineEditGetNum(pd->edit_thread_num);
+
+	dat->autosave_min = mLineEditGetNum(pd->edit_autosave_min);
+
+	dat->tile_maxmem_mb = mLineEditGetNum(pd->edit_tile_maxmem);
+
+	dat->apd_complevel = mLineEditGetNum(pd->edit_apd_complevel);
+
 	return TRUE;
 }
 
@@ -180,6 +194,9 @@ static int _opt1_event(mPager *p,mEvent *ev,void *pagedat)
 			case WID_OPT1_HELP_UNDOBUF:
 				AppHelp_message(p->wg.toplevel, HELP_TRGROUP_SINGLE, HELP_TRID_ENVOPT_UNDOBUFSIZE);
 				break;
+			case WID_OPT1_HELP_TILE_MAXMEM:
+				AppHelp_message(p->wg.toplevel, HELP_TRGROUP_SINGLE, HELP_TRID_ENVOPT_TILE_MAXMEM);
+				break;
 		}
 	}
 
@@ -287,6 +304,34 @@ mlkbool EnvOpt_createPage_opt1(mPager *p,mPagerInfo *info)
 
 	_widget_set_margin(MLK_WIDGET(pd->edit_rotate_step));
 
+	//処理に使うスレッド数
+
+	pd->edit_thread_num = widget_createLabelEditNum(ct, MLK_TR(TRID_OPT1_THREAD_NUM), 5, 0, THREADPOOL_MAXNUM, dat->thread_num);
+
+	_widget_set_margin(MLK_WIDGET(pd->edit_thread_num));
+
+	//自動保存の間隔
+
+	pd->edit_autosave_min = widget_createLabelEditNum(ct, MLK_TR(TRID_OPT1_AUTOSAVE_MIN), 5, 0, 120, dat->autosave_min);
+
+	_widget_set_margin(MLK_WIDGET(pd->edit_autosave_min));
+
+	//タイルのメモリ上限
+
+	widget_createLabel_trid(ct, TRID_OPT1_TILE_MAXMEM);
+
+	ct2 = mContainerCreateHorz(ct, 5, 0, _MARGIN_LEFT);
+
+	pd->edit_tile_maxmem = widget_createEdit_num(ct2, 7, 0, 1048576, 0, dat->tile_maxmem_mb);
+
+	widget_createHelpButton(ct2, WID_OPT1_HELP_TILE_MAXMEM, MLF_MIDDLE, 0);
+
+	//APD 保存時の圧縮レベル
+
+	pd->edit_apd_complevel = widget_createLabelEditNum(ct, MLK_TR(TRID_OPT1_APD_COMPLEVEL), 4, 0, 9, dat->apd_complevel);
+
+	_widget_set_margin(MLK_WIDGET(pd->edit_apd_complevel));
+
 	return TRUE;
 }
 
@@ -29,9 +29,12 @@ $*/
 #include "mlk_checkbutton.h"
 #include "mlk_colorbutton.h"
 #include "mlk_event.h"
+#include "mlk_str.h"
 
 #include "def_draw.h"
 
+#include "tileimage.h"
+
 #include "dialogs.h"
 #include "widget_func.h"
 
@@ -51,12 +54,27 @@ typedef struct
 }_dlg_imgopt;
 
 
+/* タイルのメモリ使用量の文字列を取得 */
+
+static void _imgopt_get_tilemem(mStr *str)
+{
+	TileImagePoolInfo info;
+
+	TileImage_pool_getInfo(&info);
+
+	mStrSetFormat(str, "%u tiles, %.1f MiB (max %.1f MiB / pool %.1f MiB)",
+		info.tilenum, info.usedsize / 1048576.0,
+		info.maxsize / 1048576.0, info.poolsize / 1048576.0);
+}
+
+
 /* ダイアログ作成 */
 
 static _dlg_imgopt *_imgopt_create(mWindow *parent)
 {
 	_dlg_imgopt *p;
 	mWidget *ct;
+	mStr str = MSTR_INIT;
 
 	//作成
 
@@ -78,6 +96,15 @@ static _dlg_imgopt *_imgopt_create(mWindow *parent)
 	p->colbtt = widget_createLabelColorButton(ct,
 		MLK_TR2(TRGROUP_WORD, TRID_WORD_BKGND_COLOR), 0, RGBcombo_to_32bit(&APPDRAW->imgbkcol));
 
+	//タイルのメモリ使用量
+
+	_imgopt_get_tilemem(&str);
+
+	widget_createLabel(ct, MLK_TR2(TRGROUP_DLG_IMAGEOPT, 1));
+	mLabelCreate(ct, MLF_MIDDLE, 0, MLABEL_S_COPYTEXT, str.buf);
+
+	mStrFree(&str);
+
 	//
 
 	mContainerCreateButtons_okcancel(MLK_WIDGET(p), MLK_MAKE32_4(0,15,0,0));
@@ -44,10 +44,12 @@ $*/
 
 #include "layeritem.h"
 #include "appcursor.h"
+#include "latency_probe.h"
 
 #include "draw_main.h"
 #include "draw_calc.h"
 #include "draw_op_main.h"
+#include "draw_brush_thread.h"
 
 
 //----------------
@@ -71,7 +73,8 @@ enum
 	_TIMERID_UPDATE_MOVE_SELECT_IMAGE,
 	_TIMERID_UPDATE_PASTE_MOVE,
 	_TIMERID_SCROLL,
-	_TIMERID_LAYERNAME
+	_TIMERID_LAYERNAME,
+	_TIMERID_BRUSH_THREAD
 };
 
 
@@ -128,7 +131,7 @@ static void _page_event_timer(MainCanvasPage *p,int id)
 	{
 		//範囲更新
 		case _TIMERID_UPDATE_RECT:
-			drawUpdateBox_canvas(APPDRAW, &p->box_update);
+			drawUpdateBox_canvas_curlayer(APPDRAW, &p->box_update, FALSE);
 			p->box_update.x = -1;
 			break;
 
@@ -167,6 +170,13 @@ static void _page_event_timer(MainCanvasPage *p,int id)
 			mWidgetDestroy(MLK_WIDGET(p->ttip_layername));
 			p->ttip_layername = NULL;
 			break;
+
+		//ブラシ描画スレッドの描画範囲を更新
+		// :スレッドの実行中は繰り返す
+		case _TIMERID_BRUSH_THREAD:
+			if(drawBrushThread_update(APPDRAW))
+				MainCanvasPage_setTimer_brushThread();
+			break;
 	}
 }
 
@@ -236,7 +246,11 @@ static int _page_event_handle(mWidget *wg,mEvent *ev)
 				//離し
 				case MEVENT_POINTER_ACT_RELEASE:
 					if(drawOp_onRelease(APPDRAW, ev))
+					{
 						_page_ungrab(p);
+
+						LatencyProbe_onStrokeEnd();
+					}
 					break;
 			}
 			break;
@@ -474,7 +488,7 @@ void MainCanvasPage_clearTimer_updateRect(mlkbool update)
 	if(mWidgetTimerDelete(MLK_WIDGET(p), _TIMERID_UPDATE_RECT))
 	{
 		if(update)
-			drawUpdateBox_canvas(APPDRAW, &p->box_update);
+			drawUpdateBox_canvas_curlayer(APPDRAW, &p->box_update, FALSE);
 	}
 
 	p->box_update.x = -1;
@@ -494,6 +508,20 @@ void MainCanvasPage_clearTimer_updateMove(void)
 	mWidgetTimerDelete(MLK_WIDGET(APPWIDGET->canvaspage), _TIMERID_UPDATE_MOVE);
 }
 
+/** ブラシ描画スレッドの更新タイマーをセット */
+
+void MainCanvasPage_setTimer_brushThread(void)
+{
+	mWidgetTimerAdd_ifnothave(MLK_WIDGET(APPWIDGET->canvaspage), _TIMERID_BRUSH_THREAD, 5, 0);
+}
+
+/** ブラシ描画スレッドの更新タイマーをクリア */
+
+void MainCanvasPage_clearTimer_brushThread(void)
+{
+	mWidgetTimerDelete(MLK_WIDGET(APPWIDGET->canvaspage), _TIMERID_BRUSH_THREAD);
+}
+
 /** 選択範囲の位置移動のタイマーセット */
 
 void MainCanvasPage_setTimer_updateSelectMove(void)
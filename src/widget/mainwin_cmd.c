@@ -359,11 +359,12 @@ void MainWindow_cmd_resizeCanvas(MainWindow *p)
 	MainWindow_updateNewCanvas(p, NULL);
 }
 
-/** 画像を統合して拡大縮小 */
+/** キャンバス拡大縮小 */
 
 void MainWindow_cmd_scaleCanvas(MainWindow *p)
 {
 	CanvasScaleInfo info;
+	mlkbool ret;
 
 	//ダイアログ
 
@@ -381,7 +382,12 @@ void MainWindow_cmd_scaleCanvas(MainWindow *p)
 
 	//実行
 
-	if(!drawImage_scaleCanvas(APPDRAW, info.w, info.h, info.dpi, info.method))
+	if(info.keep_layer)
+		ret = drawImage_scaleCanvas_layer(APPDRAW, info.w, info.h, info.dpi, info.method);
+	else
+		ret = drawImage_scaleCanvas(APPDRAW, info.w, info.h, info.dpi, info.method);
+
+	if(!ret)
 		MainWindow_errmes(MLKERR_ALLOC, NULL);
 	
 	MainWindow_updateNewCanvas(p, NULL);
@@ -450,6 +456,11 @@ void MainWindow_cmd_envoption(MainWindow *p)
 
 	if(f & (1<<3))
 		MainCanvasPage_changeDrawCursor();
+
+	//自動保存の間隔
+
+	if(f & (1<<5))
+		MainWindow_setTimer_autosave(p, FALSE);
 }
 
 
@@ -42,6 +42,7 @@ $*/
 
 #include "fileformat.h"
 #include "undo.h"
+#include "autosave.h"
 
 #include "draw_main.h"
 #include "draw_file.h"
@@ -260,6 +261,58 @@ mlkbool MainWindow_loadImage(MainWindow *p,const char *filename,LoadImageOption
 	}
 }
 
+/** 自動保存ファイルから復元
+ *
+ * 無題の新規データとして開き、未保存の状態にする。
+ * 成功時は、自動保存ファイルを現在のプロセスのものとして引き継ぐ。 */
+
+mlkbool MainWindow_loadRecoveryFile(MainWindow *p,const char *filename)
+{
+	_thread_openfileinfo dat;
+	int err;
+
+	mMemset0(&dat, sizeof(_thread_openfileinfo));
+
+	dat.filename = filename;
+	dat.format = FILEFORMAT_APD | FILEFORMAT_APD_v4;
+
+	APPDRAW->fnewcanvas = FALSE;
+
+	//スレッド
+
+	APPDRAW->in_thread_imgcanvas = TRUE;
+
+	err = PopupThread_run(&dat, _thread_load);
+
+	APPDRAW->in_thread_imgcanvas = FALSE;
+
+	if(err == -1) return FALSE;
+
+	if(err != MLKERR_OK)
+	{
+		MainWindow_errmes(err, NULL);
+
+		if(drawImage_loadError(APPDRAW))
+			MainWindow_updateNewCanvas(p, "");
+
+		return FALSE;
+	}
+
+	//更新 (無題)
+
+	MainWindow_updateNewCanvas(p, "");
+
+	//上書き保存時のコピー元にはしない
+
+	mStrEmpty(&APPDRAW->strApdFile);
+
+	Undo_setModifyFlag_on();
+
+	AutoSave_setRecoveryFile(filename);
+
+	return TRUE;
+}
+
 /** ファイルを開く (ダイアログ)
  *
  * recentno: ディレクトリ番号 (-2 で現在の編集ファイルと同じ) */
@@ -553,7 +606,8 @@ static int _thread_save(mPopupProgress *prog,void *data)
 	else
 	{
 		//----- PNG/JPEG/BMP/GIF/TIFF/WEBP
-		// :プログレスは、合成時と保存時で２周する。
+		// :GIF 以外は、保存時に 64 行単位で合成する。
+		// :GIF は先に全体を合成するため、プログレスは合成時と保存時で２周する。
 
 		dstbits = 8;
 		falpha = FALSE;
@@ -581,18 +635,15 @@ static int _thread_save(mPopupProgress *prog,void *data)
 			}
 		}
 
-		//合成イメージ
+		//合成イメージ (GIF)
 
-		mPopupProgressThreadSetMax(prog, 20);
+		if(format & FILEFORMAT_GIF)
+		{
+			mPopupProgressThreadSetMax(prog, 20);
 
-		if(falpha)
-			//アルファ付き
-			ret = drawImage_blendImageReal_alpha(APPDRAW, dstbits, prog, 20);
-		else
-			//アルファなし
 			ret = drawImage_blendImageReal_normal(APPDRAW, dstbits, prog, 20);
-
-		if(ret) return ret;
+			if(ret) return ret;
+		}
 
 		//保存
 
@@ -600,7 +651,8 @@ static int _thread_save(mPopupProgress *prog,void *data)
 
 		//合成イメージ再セット
 
-		drawUpdate_blendImage_full(APPDRAW, NULL);
+		if(format & FILEFORMAT_GIF)
+			drawUpdate_blendImage_full(APPDRAW, NULL);
 	}
 
 	return ret;
@@ -699,6 +751,10 @@ mlkbool MainWindow_saveFile(MainWindow *p,int savetype,int recentno)
 		//undo データ変更フラグ OFF
 
 		Undo_setModifyFlag_off();
+
+		//保存されたので、自動保存ファイルは不要
+
+		AutoSave_deleteFile();
 	}
 
 	//ファイル履歴
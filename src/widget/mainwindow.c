@@ -51,6 +51,7 @@ $*/
 #include "dialogs.h"
 
 #include "undo.h"
+#include "autosave.h"
 
 #include "draw_main.h"
 
@@ -107,6 +108,15 @@ static int _event_handle(mWidget *wg,mEvent *ev);
 
 //---------------------
 
+enum
+{
+	_TIMERID_AUTOSAVE = 1
+};
+
+#define _AUTOSAVE_RETRY_MSEC  (10 * 1000)	//自動保存が行えなかった時、再試行するまでの時間
+
+//---------------------
+
 
 
 /* mSplitter 対象取得関数*/
@@ -402,6 +412,24 @@ void MainWindow_showInit(MainWindow *p,mToplevelSaveState *st)
 	mWidgetShow(MLK_WIDGET(p), 1);
 }
 
+/** 自動保存のタイマーをセット
+ *
+ * retry: TRUE で、再試行用の短い間隔 */
+
+void MainWindow_setTimer_autosave(MainWindow *p,mlkbool retry)
+{
+	uint32_t msec;
+
+	if(!APPCONF->autosave_min)
+		mWidgetTimerDelete(MLK_WIDGET(p), _TIMERID_AUTOSAVE);
+	else
+	{
+		msec = (retry)? _AUTOSAVE_RETRY_MSEC: APPCONF->autosave_min * 60 * 1000;
+
+		mWidgetTimerAdd(MLK_WIDGET(p), _TIMERID_AUTOSAVE, msec, 0);
+	}
+}
+
 /** 終了 */
 
 void MainWindow_quit(void)
@@ -518,6 +546,10 @@ void MainWindow_updateNewCanvas(MainWindow *p,const char *filename)
 		mStrSetText(&p->strFilename, filename);
 
 		p->fsaved = FALSE;
+
+		//前の編集データの自動保存ファイルは不要
+
+		AutoSave_deleteFile();
 	}
 
 	//タイトル
@@ -968,6 +1000,17 @@ int _event_handle(mWidget *wg,mEvent *ev)
 		case MEVENT_CLOSE:
 			MainWindow_quit();
 			break;
+
+		//タイマー
+		case MEVENT_TIMER:
+			if(ev->timer.id == _TIMERID_AUTOSAVE)
+			{
+				//自動保存
+				// :操作中などで行えなかった場合は、少し後に再試行
+
+				MainWindow_setTimer_autosave(MAINWINDOW(wg), !AutoSave_run());
+			}
+			break;
 		
 		default:
 			return FALSE;
@@ -51,6 +51,8 @@ typedef struct
 	int ret;
 }PopupThread;
 
+static int g_popupthread_run = 0;	//実行中の数
+
 //-------------------------
 
 
@@ -89,9 +91,13 @@ int PopupThread_run(void *data,PopupThreadFunc func)
 
 	wg = MainWindow_getProgressBarPos(&box);
 
+	g_popupthread_run++;
+
 	mPopupProgressRun(MLK_POPUPPROGRESS(p), wg, 0, -(p->pg.progress->wg.hintH), &box,
 		MPOPUP_F_LEFT | MPOPUP_F_BOTTOM | MPOPUP_F_GRAVITY_TOP, 130, _thread_func);
 
+	g_popupthread_run--;
+
 	//終了
 
 	ret = p->ret;
@@ -101,3 +107,12 @@ int PopupThread_run(void *data,PopupThreadFunc func)
 	return ret;
 }
 
+
+/** スレッド実行中か
+ *
+ * スレッド中はイベントループが動くため、タイマー処理などで判定する。 */
+
+mlkbool PopupThread_isRunning(void)
+{
+	return (g_popupthread_run != 0);
+}
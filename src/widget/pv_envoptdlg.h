@@ -32,6 +32,10 @@ typedef struct
 		undo_maxbufsize,
 		canv_zoom_step,
 		canv_rotate_step,
+		thread_num,
+		autosave_min,
+		tile_maxmem_mb,
+		apd_complevel,
 		iconsize[3],
 		toolbar_btts_size,
 		cursor_hotspot[2];
@@ -76,6 +80,10 @@ enum
 	TRID_OPT1_UNDO_MAXBUFSIZE,
 	TRID_OPT1_CANVAS_ZOOM_STEP,
 	TRID_OPT1_CANVAS_ROTATE_STEP,
+	TRID_OPT1_THREAD_NUM,
+	TRID_OPT1_AUTOSAVE_MIN,
+	TRID_OPT1_TILE_MAXMEM,
+	TRID_OPT1_APD_COMPLEVEL,
 
 	//フラグ
 	TRID_FLAGS_TOP = 150,
@@ -442,3 +442,14 @@ void StatusBar_setHelp_tool(void)
 		mLabelSetText(p->label_help, MLK_TR2(TRGROUP_STATUSBAR_HELP, id));
 }
 
+/** ヘルプ欄に任意のテキストをセット
+ *
+ * 次にツールが変更されるまで表示される。 */
+
+void StatusBar_setHelp_text(const char *text)
+{
+	StatusBar *p = APPWIDGET->statusbar;
+
+	if(p)
+		mLabelSetText(p->label_help, text);
+}